@@ -0,0 +1,190 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifdef UWVM_MODULE
+import fast_io;
+import :page;
+#else
+// std
+# include <cstddef>
+# include <cstdint>
+# include <cstdlib>
+# include <cstring>
+# include <memory>
+# include <utility>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# include "page.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::memory::linear
+{
+    /// @brief      Linear memory with explicit bounds checks
+    /// @details    Only the current pages are allocated, memory.grow reallocates (the base address may change). Every access has to be checked with
+    ///             get_address, which returns nullptr when the access is out of bounds. This is the fallback for hosts that cannot reserve the whole
+    ///             wasm32 address space per memory.
+    ///             The pages come from calloc/realloc: running out of memory is an ordinary result of memory.grow (grow_failed), so it must not
+    ///             terminate like the fast_io allocators do.
+    struct allocator_memory_t
+    {
+        inline static constexpr bool explicit_bounds_check{true};
+
+        ::std::byte* memory_begin{};
+        ::std::size_t memory_length{};
+        ::std::size_t max_page{};
+
+        inline constexpr allocator_memory_t() noexcept = default;
+
+        inline allocator_memory_t(allocator_memory_t const&) = delete;
+        inline allocator_memory_t& operator= (allocator_memory_t const&) = delete;
+
+        inline constexpr allocator_memory_t(allocator_memory_t&& other) noexcept :
+            memory_begin{::std::exchange(other.memory_begin, nullptr)}, memory_length{::std::exchange(other.memory_length, 0uz)}, max_page{other.max_page}
+        {
+        }
+
+        inline allocator_memory_t& operator= (allocator_memory_t&& other) noexcept
+        {
+            if(::std::addressof(other) == this) [[unlikely]] { return *this; }
+
+            this->clear();
+
+            this->memory_begin = ::std::exchange(other.memory_begin, nullptr);
+            this->memory_length = ::std::exchange(other.memory_length, 0uz);
+            this->max_page = other.max_page;
+
+            return *this;
+        }
+
+        inline ~allocator_memory_t() { this->clear(); }
+
+        /// @brief      Allocate the initial pages (zero filled)
+        /// @return     false if min_page exceeds max_page or the pages cannot be allocated
+        inline bool init(::std::size_t min_page, ::std::size_t max_page_v) noexcept
+        {
+            this->clear();
+
+            max_page_v = ::uwvm2::memory::linear::clamp_max_page(max_page_v);
+            if(min_page > max_page_v) [[unlikely]] { return false; }
+
+            this->max_page = max_page_v;
+
+            if(min_page != 0uz)
+            {
+                auto const length{min_page * ::uwvm2::memory::linear::wasm_page_size};
+                auto const begin{static_cast<::std::byte*>(::std::calloc(length, 1uz))};
+                if(begin == nullptr) [[unlikely]] { return false; }
+
+                this->memory_begin = begin;
+                this->memory_length = length;
+            }
+
+            return true;
+        }
+
+        inline constexpr ::std::size_t page_count() const noexcept { return this->memory_length / ::uwvm2::memory::linear::wasm_page_size; }
+
+        /// @brief      memory.grow
+        /// @return     The old page count, or grow_failed if the new size exceeds max_page or the pages cannot be allocated (the memory is unchanged).
+        ///             The new pages are zero filled.
+        inline ::std::size_t grow(::std::size_t delta_page) noexcept
+        {
+            auto const old_page{this->page_count()};
+            if(delta_page > this->max_page - old_page) [[unlikely]] { return ::uwvm2::memory::linear::grow_failed; }
+
+            if(delta_page == 0uz) { return old_page; }
+
+            auto const new_length{(old_page + delta_page) * ::uwvm2::memory::linear::wasm_page_size};
+            if(!this->resize(new_length)) [[unlikely]] { return ::uwvm2::memory::linear::grow_failed; }
+
+            return old_page;
+        }
+
+        /// @brief      Return the memory to `page` zero filled pages, the allocation is reused when the size does not change
+        /// @return     false if page exceeds max_page or the pages cannot be allocated (the memory keeps its old size, zero filled)
+        inline bool reset(::std::size_t page) noexcept
+        {
+            if(page > this->max_page) [[unlikely]] { return false; }
+
+            if(this->memory_begin != nullptr) { ::std::memset(this->memory_begin, 0, this->memory_length); }
+
+            auto const new_length{page * ::uwvm2::memory::linear::wasm_page_size};
+            if(new_length == this->memory_length) { return true; }
+
+            if(new_length == 0uz)
+            {
+                this->clear();
+                return true;
+            }
+
+            return this->resize(new_length);
+        }
+
+        /// @brief      Effective address of an access of `size` bytes
+        /// @details    `offset` is the dynamic i32 address plus the static offset of the instruction (computed in 64 bits, so it cannot wrap).
+        /// @return     nullptr if the access is out of bounds (trap)
+        inline constexpr ::std::byte* get_address(::std::uint_least64_t offset, ::std::size_t size) const noexcept
+        {
+            if(offset > this->memory_length || size > this->memory_length - static_cast<::std::size_t>(offset)) [[unlikely]] { return nullptr; }
+            return this->memory_begin + offset;
+        }
+
+        inline void clear() noexcept
+        {
+            ::std::free(this->memory_begin);
+
+            this->memory_begin = nullptr;
+            this->memory_length = 0uz;
+        }
+
+        /// @brief      Reallocate to new_length (not 0) bytes, the bytes after the old length are zero filled
+        /// @return     false if the allocation fails, the memory is unchanged then
+        inline bool resize(::std::size_t new_length) noexcept
+        {
+            auto const new_begin{static_cast<::std::byte*>(this->memory_begin == nullptr ? ::std::calloc(new_length, 1uz)
+                                                                                          : ::std::realloc(this->memory_begin, new_length))};
+            if(new_begin == nullptr) [[unlikely]] { return false; }
+
+            if(this->memory_begin != nullptr && new_length > this->memory_length)
+            {
+                ::std::memset(new_begin + this->memory_length, 0, new_length - this->memory_length);
+            }
+
+            this->memory_begin = new_begin;
+            this->memory_length = new_length;
+
+            return true;
+        }
+    };
+}  // namespace uwvm2::memory::linear
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
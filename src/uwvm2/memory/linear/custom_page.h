@@ -0,0 +1,207 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifdef UWVM_MODULE
+import fast_io;
+import :page;
+#else
+// std
+# include <cstddef>
+# include <cstdint>
+# include <cstdlib>
+# include <cstring>
+# include <memory>
+# include <utility>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# include "page.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::memory::linear
+{
+    /// @brief      Linear memory of the custom-page-sizes proposal
+    /// @details    Meant for tiny memories (1-byte pages): the bytes are a compact heap allocation that is not rounded up to 64 KiB or backed by
+    ///             a reservation, so thousands of small instances fit in one process. The allocation grows geometrically (memory.grow by a few
+    ///             bytes at a time stays amortized O(1)) but never beyond the maximum. The bytes between memory_length and memory_capacity are kept
+    ///             zero, they are unreachable because every access is checked against memory_length. The bytes come from calloc/realloc like
+    ///             allocator_memory_t, running out of memory fails memory.grow instead of terminating.
+    struct custom_page_memory_t
+    {
+        inline static constexpr bool explicit_bounds_check{true};
+
+        ::std::byte* memory_begin{};
+        ::std::size_t memory_length{};
+        ::std::size_t memory_capacity{};
+        ::std::size_t max_page{};
+        unsigned page_size_log2{16u};
+
+        inline constexpr custom_page_memory_t() noexcept = default;
+
+        inline custom_page_memory_t(custom_page_memory_t const&) = delete;
+        inline custom_page_memory_t& operator= (custom_page_memory_t const&) = delete;
+
+        inline constexpr custom_page_memory_t(custom_page_memory_t&& other) noexcept :
+            memory_begin{::std::exchange(other.memory_begin, nullptr)}, memory_length{::std::exchange(other.memory_length, 0uz)},
+            memory_capacity{::std::exchange(other.memory_capacity, 0uz)}, max_page{other.max_page}, page_size_log2{other.page_size_log2}
+        {
+        }
+
+        inline custom_page_memory_t& operator= (custom_page_memory_t&& other) noexcept
+        {
+            if(::std::addressof(other) == this) [[unlikely]] { return *this; }
+
+            this->clear();
+
+            this->memory_begin = ::std::exchange(other.memory_begin, nullptr);
+            this->memory_length = ::std::exchange(other.memory_length, 0uz);
+            this->memory_capacity = ::std::exchange(other.memory_capacity, 0uz);
+            this->max_page = other.max_page;
+            this->page_size_log2 = other.page_size_log2;
+
+            return *this;
+        }
+
+        inline ~custom_page_memory_t() { this->clear(); }
+
+        /// @brief      Allocate the initial pages (zero filled)
+        /// @return     false if the page size is not valid, min_page exceeds max_page or the pages cannot be allocated
+        inline bool init(::std::size_t min_page, ::std::size_t max_page_v, unsigned page_size_log2_v) noexcept
+        {
+            this->clear();
+
+            if(!::uwvm2::memory::linear::is_valid_page_size_log2(page_size_log2_v)) [[unlikely]] { return false; }
+
+            auto const max_custom_page{::uwvm2::memory::linear::wasm32_max_custom_page(page_size_log2_v)};
+            if(max_page_v > max_custom_page) { max_page_v = max_custom_page; }
+            if(min_page > max_page_v) [[unlikely]] { return false; }
+
+            this->page_size_log2 = page_size_log2_v;
+            this->max_page = max_page_v;
+
+            if(min_page != 0uz)
+            {
+                auto const length{min_page << page_size_log2_v};
+                auto const begin{static_cast<::std::byte*>(::std::calloc(length, 1uz))};
+                if(begin == nullptr) [[unlikely]] { return false; }
+
+                this->memory_begin = begin;
+                this->memory_length = length;
+                this->memory_capacity = length;
+            }
+
+            return true;
+        }
+
+        inline constexpr ::std::size_t page_count() const noexcept { return this->memory_length >> this->page_size_log2; }
+
+        /// @brief      memory.grow
+        /// @return     The old page count, or grow_failed if the new size exceeds max_page or the pages cannot be allocated (the memory is unchanged).
+        ///             The new pages are zero filled.
+        inline ::std::size_t grow(::std::size_t delta_page) noexcept
+        {
+            auto const old_page{this->page_count()};
+            if(delta_page > this->max_page - old_page) [[unlikely]] { return ::uwvm2::memory::linear::grow_failed; }
+
+            if(delta_page == 0uz) { return old_page; }
+
+            auto const new_length{(old_page + delta_page) << this->page_size_log2};
+
+            if(new_length > this->memory_capacity)
+            {
+                // Double, but never allocate more than the maximum can ever use
+                auto const max_length{this->max_page << this->page_size_log2};
+                auto new_capacity{this->memory_capacity > max_length / 2uz ? max_length : this->memory_capacity * 2uz};
+                if(new_capacity < new_length) { new_capacity = new_length; }
+
+                // The doubled capacity may not be available when the exact length still is
+                if(!this->reserve(new_capacity) && (new_capacity == new_length || !this->reserve(new_length))) [[unlikely]]
+                {
+                    return ::uwvm2::memory::linear::grow_failed;
+                }
+            }
+
+            this->memory_length = new_length;
+
+            return old_page;
+        }
+
+        /// @brief      Return the memory to `page` zero filled pages, the allocation is kept
+        /// @return     false if page exceeds max_page or the pages cannot be allocated (the memory is then empty)
+        inline bool reset(::std::size_t page) noexcept
+        {
+            if(page > this->max_page) [[unlikely]] { return false; }
+
+            // Keeps the bytes behind memory_length zero
+            if(this->memory_begin != nullptr) { ::std::memset(this->memory_begin, 0, this->memory_length); }
+
+            this->memory_length = 0uz;
+
+            return this->grow(page) != ::uwvm2::memory::linear::grow_failed;
+        }
+
+        /// @brief      Effective address of an access of `size` bytes
+        /// @details    `offset` is the dynamic i32 address plus the static offset of the instruction (computed in 64 bits, so it cannot wrap).
+        /// @return     nullptr if the access is out of bounds (trap)
+        inline constexpr ::std::byte* get_address(::std::uint_least64_t offset, ::std::size_t size) const noexcept
+        {
+            if(offset > this->memory_length || size > this->memory_length - static_cast<::std::size_t>(offset)) [[unlikely]] { return nullptr; }
+            return this->memory_begin + offset;
+        }
+
+        inline void clear() noexcept
+        {
+            ::std::free(this->memory_begin);
+
+            this->memory_begin = nullptr;
+            this->memory_length = 0uz;
+            this->memory_capacity = 0uz;
+        }
+
+        /// @brief      Reallocate to new_capacity bytes (more than memory_capacity), the added bytes are zero filled
+        /// @return     false if the allocation fails, the memory is unchanged then
+        inline bool reserve(::std::size_t new_capacity) noexcept
+        {
+            auto const new_begin{static_cast<::std::byte*>(this->memory_begin == nullptr ? ::std::calloc(new_capacity, 1uz)
+                                                                                          : ::std::realloc(this->memory_begin, new_capacity))};
+            if(new_begin == nullptr) [[unlikely]] { return false; }
+
+            if(this->memory_begin != nullptr) { ::std::memset(new_begin + this->memory_capacity, 0, new_capacity - this->memory_capacity); }
+
+            this->memory_begin = new_begin;
+            this->memory_capacity = new_capacity;
+
+            return true;
+        }
+    };
+}  // namespace uwvm2::memory::linear
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
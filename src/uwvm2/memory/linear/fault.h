@@ -0,0 +1,193 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifdef UWVM_MODULE
+import fast_io;
+#else
+// std
+# include <cstddef>
+# include <cstdint>
+# include <atomic>
+# include <memory>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// platform
+# ifdef UWVM_SUPPORT_GUARDED_LINEAR_MEMORY
+#  include <signal.h>
+# endif
+// import
+# include <fast_io.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::memory::linear
+{
+#ifdef UWVM_SUPPORT_GUARDED_LINEAR_MEMORY
+    /// @brief      Called by the fault handler when an access hits the reservation of a guarded memory
+    /// @details    Runs inside the signal handler with the faulting address. It must not return, the runtime leaves the faulting code with
+    ///             siglongjmp and raises the out-of-bounds trap there.
+    using memory_fault_trap_t = void (*)(void* fault_address) noexcept;
+
+    namespace details
+    {
+        /// @brief  Reservations are registered lock-free, the signal handler only reads the table
+        struct guarded_range_t
+        {
+            ::std::atomic<::std::uintptr_t> begin;
+            ::std::atomic<::std::uintptr_t> end;
+        };
+
+        inline constexpr ::std::size_t max_guarded_range{4096uz};
+
+        inline guarded_range_t guarded_ranges[max_guarded_range]{};
+
+        inline ::std::atomic<memory_fault_trap_t> memory_fault_trap{};
+        inline ::std::atomic_bool memory_fault_handler_installed{};
+
+        inline struct ::sigaction old_sigsegv_action{};
+        inline struct ::sigaction old_sigbus_action{};
+
+        inline bool is_guarded_address(::std::uintptr_t addr) noexcept
+        {
+            for(auto const& r: guarded_ranges)
+            {
+                auto const begin{r.begin.load(::std::memory_order_acquire)};
+                if(begin != 0u && addr >= begin && addr < r.end.load(::std::memory_order_acquire)) { return true; }
+            }
+            return false;
+        }
+
+        /// @brief  Faults outside guarded memories are passed to the previous handler (or the default action)
+        inline void chain_memory_fault(int sig, ::siginfo_t* info, void* context) noexcept
+        {
+            auto const& old{sig == SIGBUS ? old_sigbus_action : old_sigsegv_action};
+
+            if(old.sa_flags & SA_SIGINFO)
+            {
+                if(old.sa_sigaction != nullptr) { old.sa_sigaction(sig, info, context); }
+                return;
+            }
+
+            if(old.sa_handler == SIG_IGN) { return; }
+            if(old.sa_handler != SIG_DFL)
+            {
+                old.sa_handler(sig);
+                return;
+            }
+
+            // Restore the default action, the fault repeats when the handler returns
+            struct ::sigaction dfl{};
+            dfl.sa_handler = SIG_DFL;
+            ::sigemptyset(::std::addressof(dfl.sa_mask));
+            ::sigaction(sig, ::std::addressof(dfl), nullptr);
+        }
+
+        inline void memory_fault_handler(int sig, ::siginfo_t* info, void* context) noexcept
+        {
+            auto const fault_address{info->si_addr};
+            if(auto const trap{memory_fault_trap.load(::std::memory_order_acquire)};
+               trap != nullptr && is_guarded_address(reinterpret_cast<::std::uintptr_t>(fault_address)))
+            {
+                trap(fault_address);
+            }
+
+            chain_memory_fault(sig, info, context);
+        }
+    }  // namespace details
+
+    /// @brief      Register a reservation whose faults are wasm out-of-bounds accesses
+    /// @return     false if the table is full, the memory must then be used with explicit bounds checks
+    inline bool register_guarded_range(void const* begin, ::std::size_t size) noexcept
+    {
+        auto const begin_uptr{reinterpret_cast<::std::uintptr_t>(begin)};
+        for(auto& r: details::guarded_ranges)
+        {
+            ::std::uintptr_t expected{};
+            // Claim the slot with a sentinel first, so the handler never sees a begin without its end
+            if(r.begin.compare_exchange_strong(expected, static_cast<::std::uintptr_t>(-1), ::std::memory_order_acq_rel))
+            {
+                r.end.store(begin_uptr + size, ::std::memory_order_release);
+                r.begin.store(begin_uptr, ::std::memory_order_release);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    inline void unregister_guarded_range(void const* begin) noexcept
+    {
+        auto const begin_uptr{reinterpret_cast<::std::uintptr_t>(begin)};
+        for(auto& r: details::guarded_ranges)
+        {
+            if(r.begin.load(::std::memory_order_acquire) == begin_uptr)
+            {
+                r.end.store(0u, ::std::memory_order_release);
+                r.begin.store(0u, ::std::memory_order_release);
+                return;
+            }
+        }
+    }
+
+    /// @brief      Install the SIGSEGV/SIGBUS handler of guarded memories
+    /// @details    Must be called before guarded memories are accessed, later calls only replace the trap. The handler runs on the alternate signal
+    ///             stack if the thread has one, faults outside guarded memories are chained to the previous handlers.
+    /// @return     false if the handler cannot be installed, memories must then use explicit bounds checks
+    inline bool install_memory_fault_handler(memory_fault_trap_t trap) noexcept
+    {
+        details::memory_fault_trap.store(trap, ::std::memory_order_release);
+
+        // Installing twice would chain the handler to itself
+        if(details::memory_fault_handler_installed.exchange(true, ::std::memory_order_acq_rel)) { return true; }
+
+        struct ::sigaction sa{};
+        sa.sa_sigaction = details::memory_fault_handler;
+        sa.sa_flags = SA_SIGINFO | SA_ONSTACK | SA_NODEFER;
+        ::sigemptyset(::std::addressof(sa.sa_mask));
+
+        if(::sigaction(SIGSEGV, ::std::addressof(sa), ::std::addressof(details::old_sigsegv_action)) != 0) [[unlikely]]
+        {
+            details::memory_fault_handler_installed.store(false, ::std::memory_order_release);
+            return false;
+        }
+
+        // Darwin and the BSDs raise SIGBUS on PROT_NONE pages
+        if(::sigaction(SIGBUS, ::std::addressof(sa), ::std::addressof(details::old_sigbus_action)) != 0) [[unlikely]]
+        {
+            // Not installed at all, so a later call can try again
+            ::sigaction(SIGSEGV, ::std::addressof(details::old_sigsegv_action), nullptr);
+            details::memory_fault_handler_installed.store(false, ::std::memory_order_release);
+            return false;
+        }
+
+        return true;
+    }
+#endif
+}  // namespace uwvm2::memory::linear
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
@@ -0,0 +1,282 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifdef UWVM_MODULE
+import fast_io;
+import :page;
+import :allocator;
+import :custom_page;
+import :mmap;
+#else
+// std
+# include <cstddef>
+# include <cstdint>
+# include <cstring>
+# include <concepts>
+# include <memory>
+# include <utility>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// platform
+# if defined(UWVM_SUPPORT_GUARDED_LINEAR_MEMORY) && defined(__linux__)
+#  include <sys/mman.h>
+#  include <unistd.h>
+#  include <sys/syscall.h>
+# endif
+// import
+# include <fast_io.h>
+# include <fast_io_dsal/vector.h>
+# include "page.h"
+# include "allocator.h"
+# include "custom_page.h"
+# include "mmap.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::memory::linear
+{
+    /// @brief      An active data segment with a constant offset
+    struct memory_image_segment_t
+    {
+        ::std::size_t offset{};
+        ::std::byte const* begin{};
+        ::std::byte const* end{};
+    };
+
+    /// @brief      Decode the offset expression of an active data segment (`i32.const n end`)
+    /// @details    `expr_begin` and `expr_end` are wasm1_data_expr_t::begin and end (end is after 0x0B).
+    /// @return     false if the expression is not a single i32.const (e.g. global.get of an imported global), the segment then has to be copied
+    ///             by the runtime at instantiation (memory_image_t::add_runtime_segment)
+    inline constexpr bool decode_i32_const_offset(::std::byte const* expr_begin, ::std::byte const* expr_end, ::std::size_t& offset) noexcept
+    {
+        // i32.const
+        if(expr_begin == expr_end || *expr_begin != ::std::byte{0x41u}) { return false; }
+        ++expr_begin;
+
+        ::std::uint_least32_t res{};
+        unsigned shift{};
+        for(;; shift += 7u)
+        {
+            if(expr_begin == expr_end || shift == 35u) [[unlikely]] { return false; }
+
+            auto const byte{static_cast<::std::uint_least32_t>(*expr_begin++) & 0xFFu};
+            res |= (byte & 0x7Fu) << shift;
+            if((byte & 0x80u) == 0u)
+            {
+                // sign extension (sleb128)
+                if((byte & 0x40u) != 0u && shift + 7u < 32u) { res |= 0xFFFF'FFFFu << (shift + 7u); }
+                break;
+            }
+        }
+
+        // end
+        if(expr_begin == expr_end || *expr_begin != ::std::byte{0x0Bu} || expr_begin + 1 != expr_end) { return false; }
+
+        // The i32 offset is interpreted as u32
+        offset = static_cast<::std::size_t>(res & 0xFFFF'FFFFu);
+        return true;
+    }
+
+    /// @brief      Images smaller than this are copied, one mmap costs more than copying them
+    inline constexpr ::std::size_t memory_image_min_map_length{256uz * 1024uz};
+
+    /// @brief      Initial contents of a linear memory, built once per module
+    /// @details    The active data segments are added in module order (a later segment overwrites an earlier one). Segments with constant
+    ///             offsets are recorded and point into the module bytes, which outlive the image. The image ends at the first segment whose offset
+    ///             is only known at instantiation: it and every later segment are copied by the runtime after instantiate, so the order is kept.
+    ///             On linux the image is materialized once into a memfd, every guarded memory (mmap_memory_t) maps it MAP_PRIVATE over its first
+    ///             pages: instantiation does not depend on the data size and the pages are shared until an instance writes to them (copy-on-write).
+    ///             Other memory types and hosts without memfd copy the segments.
+    struct memory_image_t
+    {
+        ::fast_io::vector<memory_image_segment_t> segments{};
+        ::std::size_t image_length{};
+        // A segment ends beyond the maximum of the memory, instantiation always traps
+        bool out_of_bounds{};
+        // A segment without a constant offset was added (add_runtime_segment), the later segments are not part of the image
+        bool has_runtime_segments{};
+#if defined(UWVM_SUPPORT_GUARDED_LINEAR_MEMORY) && defined(__linux__)
+        int image_fd{-1};
+        ::std::size_t image_map_length{};
+#endif
+
+        inline constexpr memory_image_t() noexcept = default;
+
+        inline memory_image_t(memory_image_t const&) = delete;
+        inline memory_image_t& operator= (memory_image_t const&) = delete;
+
+        inline memory_image_t(memory_image_t&& other) noexcept :
+            segments{::std::move(other.segments)}, image_length{::std::exchange(other.image_length, 0uz)},
+            out_of_bounds{::std::exchange(other.out_of_bounds, false)}, has_runtime_segments{::std::exchange(other.has_runtime_segments, false)}
+#if defined(UWVM_SUPPORT_GUARDED_LINEAR_MEMORY) && defined(__linux__)
+            ,
+            image_fd{::std::exchange(other.image_fd, -1)}, image_map_length{::std::exchange(other.image_map_length, 0uz)}
+#endif
+        {
+        }
+
+        inline memory_image_t& operator= (memory_image_t&& other) noexcept
+        {
+            if(::std::addressof(other) == this) [[unlikely]] { return *this; }
+
+            this->clear();
+
+            this->segments = ::std::move(other.segments);
+            this->image_length = ::std::exchange(other.image_length, 0uz);
+            this->out_of_bounds = ::std::exchange(other.out_of_bounds, false);
+            this->has_runtime_segments = ::std::exchange(other.has_runtime_segments, false);
+#if defined(UWVM_SUPPORT_GUARDED_LINEAR_MEMORY) && defined(__linux__)
+            this->image_fd = ::std::exchange(other.image_fd, -1);
+            this->image_map_length = ::std::exchange(other.image_map_length, 0uz);
+#endif
+
+            return *this;
+        }
+
+        inline ~memory_image_t() { this->clear(); }
+
+        /// @brief      Add the next active data segment with a constant offset
+        /// @details    max_length is the maximum byte length of the memory. The end of the segment is computed in 64 bits, offset + size can exceed
+        ///             size_t on 32-bit hosts.
+        /// @return     false if the segment is not part of the image because a segment without a constant offset came before it, the runtime has to
+        ///             copy it after instantiate
+        inline bool add_segment(::std::size_t offset, ::std::byte const* begin, ::std::byte const* end, ::std::size_t max_length) noexcept
+        {
+            if(this->has_runtime_segments) { return false; }
+
+            auto const size{static_cast<::std::size_t>(end - begin)};
+            auto const segment_end{static_cast<::std::uint_least64_t>(offset) + static_cast<::std::uint_least64_t>(size)};
+
+            if(segment_end > static_cast<::std::uint_least64_t>(max_length)) [[unlikely]]
+            {
+                this->out_of_bounds = true;
+                return true;
+            }
+
+            // An empty segment still has to be in bounds
+            if(segment_end > this->image_length) { this->image_length = static_cast<::std::size_t>(segment_end); }
+
+            if(size != 0uz) { this->segments.emplace_back(offset, begin, end); }
+
+            return true;
+        }
+
+        /// @brief      Add the next active data segment, whose offset is only known at instantiation (e.g. global.get)
+        /// @details    The image ends here, add_segment rejects the later segments.
+        inline void add_runtime_segment() noexcept { this->has_runtime_segments = true; }
+
+        /// @brief      Materialize the image after all segments are added
+        /// @details    Failing to create the memfd is not an error, instantiate falls back to copying.
+        inline void build() noexcept
+        {
+#if defined(UWVM_SUPPORT_GUARDED_LINEAR_MEMORY) && defined(__linux__) && defined(__NR_memfd_create)
+            if(this->image_fd != -1 || this->out_of_bounds || this->image_length < memory_image_min_map_length) { return; }
+
+            // Rounded to the wasm page size, which is a multiple of the host page size and never exceeds the memory that holds the image
+            auto const map_length{(this->image_length + (::uwvm2::memory::linear::wasm_page_size - 1uz)) &
+                                  ~(::uwvm2::memory::linear::wasm_page_size - 1uz)};
+
+            constexpr unsigned mfd_cloexec{1u};  // MFD_CLOEXEC
+            int const fd{::fast_io::system_call<__NR_memfd_create, int>("uwvm memory image", mfd_cloexec)};
+            if(fd < 0) [[unlikely]] { return; }
+
+            if(::ftruncate(fd, static_cast<::off_t>(map_length)) != 0) [[unlikely]]
+            {
+                ::close(fd);
+                return;
+            }
+
+            for(auto const& seg: this->segments)
+            {
+                auto curr{seg.begin};
+                auto file_offset{seg.offset};
+                while(curr != seg.end)
+                {
+                    auto const written{::pwrite(fd, curr, static_cast<::std::size_t>(seg.end - curr), static_cast<::off_t>(file_offset))};
+                    if(written <= 0) [[unlikely]]
+                    {
+                        ::close(fd);
+                        return;
+                    }
+                    curr += written;
+                    file_offset += static_cast<::std::size_t>(written);
+                }
+            }
+
+            this->image_fd = fd;
+            this->image_map_length = map_length;
+#endif
+        }
+
+        /// @brief      Write the image into a freshly initialized memory
+        /// @return     false if a segment is out of bounds of the memory (instantiation traps), the memory is then left unchanged
+        template <typename Memory>
+        inline bool instantiate(Memory& mem) const noexcept
+        {
+            if(this->out_of_bounds || this->image_length > mem.memory_length) [[unlikely]] { return false; }
+
+#if defined(UWVM_SUPPORT_GUARDED_LINEAR_MEMORY) && defined(__linux__)
+            if constexpr(::std::same_as<Memory, ::uwvm2::memory::linear::mmap_memory_t>)
+            {
+                if(this->image_fd != -1)
+                {
+                    // Replaces the first pages of the committed range, the rest of the reservation is untouched
+                    if(::mmap(mem.memory_begin, this->image_map_length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, this->image_fd, 0) !=
+                       MAP_FAILED) [[likely]]
+                    {
+                        return true;
+                    }
+                }
+            }
+#endif
+
+            for(auto const& seg: this->segments)
+            {
+                ::std::memcpy(mem.memory_begin + seg.offset, seg.begin, static_cast<::std::size_t>(seg.end - seg.begin));
+            }
+
+            return true;
+        }
+
+        inline void clear() noexcept
+        {
+            this->segments.clear();
+            this->image_length = 0uz;
+            this->out_of_bounds = false;
+            this->has_runtime_segments = false;
+#if defined(UWVM_SUPPORT_GUARDED_LINEAR_MEMORY) && defined(__linux__)
+            if(this->image_fd != -1) { ::close(this->image_fd); }
+            this->image_fd = -1;
+            this->image_map_length = 0uz;
+#endif
+        }
+    };
+}  // namespace uwvm2::memory::linear
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
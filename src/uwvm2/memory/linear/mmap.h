@@ -0,0 +1,218 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.utils.madvise;
+import :page;
+import :fault;
+#else
+// std
+# include <cstddef>
+# include <cstdint>
+# include <memory>
+# include <utility>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// platform
+# ifdef UWVM_SUPPORT_GUARDED_LINEAR_MEMORY
+#  include <sys/mman.h>
+# endif
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/madvise/impl.h>
+# include "page.h"
+# include "fault.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::memory::linear
+{
+#ifdef UWVM_SUPPORT_GUARDED_LINEAR_MEMORY
+    /// @brief      Size of the reservation of a guarded memory
+    /// @details    A wasm32 access is `i32 address + u32 static offset + access size`, so 8 GiB plus one page covers every effective address. The
+    ///             committed pages are at the start, everything behind them stays PROT_NONE.
+    inline constexpr ::std::size_t guarded_memory_reserve_size{2uz * 4uz * 1024uz * 1024uz * 1024uz + ::uwvm2::memory::linear::wasm_page_size};
+
+    /// @brief      Linear memory that relies on guard pages instead of bounds checks
+    /// @details    The whole reservation is mapped PROT_NONE (MAP_NORESERVE, it costs address space but no memory), memory.grow only makes more pages
+    ///             readable and writable with mprotect. The base address never changes, so it can be cached across memory.grow. An out-of-bounds
+    ///             access faults and is turned into a trap by the handler installed with install_memory_fault_handler.
+    struct mmap_memory_t
+    {
+        inline static constexpr bool explicit_bounds_check{false};
+
+        ::std::byte* memory_begin{};
+        ::std::size_t memory_length{};
+        ::std::size_t max_page{};
+
+        inline constexpr mmap_memory_t() noexcept = default;
+
+        inline mmap_memory_t(mmap_memory_t const&) = delete;
+        inline mmap_memory_t& operator= (mmap_memory_t const&) = delete;
+
+        inline constexpr mmap_memory_t(mmap_memory_t&& other) noexcept :
+            memory_begin{::std::exchange(other.memory_begin, nullptr)}, memory_length{::std::exchange(other.memory_length, 0uz)}, max_page{other.max_page}
+        {
+        }
+
+        inline mmap_memory_t& operator= (mmap_memory_t&& other) noexcept
+        {
+            if(::std::addressof(other) == this) [[unlikely]] { return *this; }
+
+            this->clear();
+
+            this->memory_begin = ::std::exchange(other.memory_begin, nullptr);
+            this->memory_length = ::std::exchange(other.memory_length, 0uz);
+            this->max_page = other.max_page;
+
+            return *this;
+        }
+
+        inline ~mmap_memory_t() { this->clear(); }
+
+        /// @brief      Reserve the address space and commit the initial pages
+        /// @return     false if min_page exceeds max_page or the address space cannot be reserved (e.g. a limited `ulimit -v`), the caller falls back
+        ///             to allocator_memory_t
+        inline bool init(::std::size_t min_page, ::std::size_t max_page_v) noexcept
+        {
+            this->clear();
+
+            max_page_v = ::uwvm2::memory::linear::clamp_max_page(max_page_v);
+            if(min_page > max_page_v) [[unlikely]] { return false; }
+
+            int flags{MAP_PRIVATE | MAP_ANONYMOUS};
+# ifdef MAP_NORESERVE
+            flags |= MAP_NORESERVE;
+# endif
+            auto const reserve{::mmap(nullptr, guarded_memory_reserve_size, PROT_NONE, flags, -1, 0)};
+            if(reserve == MAP_FAILED) [[unlikely]] { return false; }
+
+            if(!::uwvm2::memory::linear::register_guarded_range(reserve, guarded_memory_reserve_size)) [[unlikely]]
+            {
+                ::munmap(reserve, guarded_memory_reserve_size);
+                return false;
+            }
+
+            this->memory_begin = static_cast<::std::byte*>(reserve);
+            this->max_page = max_page_v;
+
+            if(this->grow(min_page) == ::uwvm2::memory::linear::grow_failed) [[unlikely]]
+            {
+                this->clear();
+                return false;
+            }
+
+            return true;
+        }
+
+        inline constexpr ::std::size_t page_count() const noexcept { return this->memory_length / ::uwvm2::memory::linear::wasm_page_size; }
+
+        /// @brief      memory.grow
+        /// @return     The old page count, or grow_failed if the new size exceeds max_page or the pages cannot be committed. Anonymous pages are
+        ///             zero filled by the system.
+        inline ::std::size_t grow(::std::size_t delta_page) noexcept
+        {
+            auto const old_page{this->page_count()};
+            if(delta_page > this->max_page - old_page) [[unlikely]] { return ::uwvm2::memory::linear::grow_failed; }
+
+            if(delta_page == 0uz) { return old_page; }
+
+            auto const delta_length{delta_page * ::uwvm2::memory::linear::wasm_page_size};
+            if(::mprotect(this->memory_begin + this->memory_length, delta_length, PROT_READ | PROT_WRITE) != 0) [[unlikely]]
+            {
+                return ::uwvm2::memory::linear::grow_failed;
+            }
+
+            this->memory_length += delta_length;
+
+            return old_page;
+        }
+
+        /// @brief      Return the memory to `page` zero filled pages without giving up the reservation
+        /// @details    linux: the committed pages are dropped with MADV_DONTNEED, the mapping stays and the next touch gets fresh zero pages (or the
+        ///             contents of a mapped memory image, which is mapped again by memory_image_t::instantiate anyway). Other systems map fresh
+        ///             anonymous pages over the committed range. Pages above `page` are made inaccessible again.
+        /// @return     false if page exceeds max_page or the pages cannot be committed
+        inline bool reset(::std::size_t page) noexcept
+        {
+            if(page > this->max_page || this->memory_begin == nullptr) [[unlikely]] { return false; }
+
+            auto const new_length{page * ::uwvm2::memory::linear::wasm_page_size};
+
+            if(this->memory_length != 0uz)
+            {
+# if defined(__linux__)
+                ::uwvm2::utils::madvise::my_madvise(this->memory_begin, this->memory_length, ::uwvm2::utils::madvise::madvise_flag::dontneed);
+                if(new_length < this->memory_length)
+                {
+                    ::mprotect(this->memory_begin + new_length, this->memory_length - new_length, PROT_NONE);
+                }
+# else
+                int flags{MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED};
+#  ifdef MAP_NORESERVE
+                flags |= MAP_NORESERVE;
+#  endif
+                if(::mmap(this->memory_begin, this->memory_length, PROT_NONE, flags, -1, 0) == MAP_FAILED) [[unlikely]] { return false; }
+                this->memory_length = 0uz;
+# endif
+            }
+
+            if(new_length <= this->memory_length)
+            {
+                this->memory_length = new_length;
+                return true;
+            }
+
+            return this->grow(page - this->page_count()) != ::uwvm2::memory::linear::grow_failed;
+        }
+
+        /// @brief      Effective address of an access of `size` bytes
+        /// @details    Never fails, an out-of-bounds access faults in the guard. `offset` must be an i32 address plus a u32 static offset.
+        inline constexpr ::std::byte* get_address(::std::uint_least64_t offset, [[maybe_unused]] ::std::size_t size) const noexcept
+        {
+            return this->memory_begin + offset;
+        }
+
+        inline void clear() noexcept
+        {
+            if(this->memory_begin != nullptr)
+            {
+                ::uwvm2::memory::linear::unregister_guarded_range(this->memory_begin);
+                ::munmap(this->memory_begin, guarded_memory_reserve_size);
+            }
+
+            this->memory_begin = nullptr;
+            this->memory_length = 0uz;
+        }
+    };
+#endif
+}  // namespace uwvm2::memory::linear
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
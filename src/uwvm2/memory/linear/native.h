@@ -0,0 +1,62 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifdef UWVM_MODULE
+import fast_io;
+import :page;
+import :allocator;
+import :mmap;
+#else
+// std
+# include <cstddef>
+# include <cstdint>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# include "page.h"
+# include "allocator.h"
+# include "mmap.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::memory::linear
+{
+    /// @brief      Linear memory used by default on this platform
+    /// @details    Guarded memory (no bounds checks) where the platform supports it (UWVM_SUPPORT_GUARDED_LINEAR_MEMORY), otherwise explicit bounds
+    ///             checks. Code generated for one memory type is selected with `if constexpr(memory_t::explicit_bounds_check)`. A runtime that fails
+    ///             to init a guarded memory falls back to allocator_memory_t.
+#ifdef UWVM_SUPPORT_GUARDED_LINEAR_MEMORY
+    using native_memory_t = mmap_memory_t;
+#else
+    using native_memory_t = allocator_memory_t;
+#endif
+}  // namespace uwvm2::memory::linear
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
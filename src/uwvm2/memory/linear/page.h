@@ -0,0 +1,77 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifdef UWVM_MODULE
+import fast_io;
+#else
+// std
+# include <cstddef>
+# include <cstdint>
+# include <limits>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::memory::linear
+{
+    /// @brief      wasm page size (64 KiB)
+    inline constexpr ::std::size_t wasm_page_size{65536uz};
+
+    /// @brief      Maximum number of pages of a wasm32 memory (4 GiB)
+    inline constexpr ::std::size_t wasm32_max_page{65536uz};
+
+    /// @brief      Returned by grow when the memory cannot grow, memory.grow pushes -1 (as i32) in this case
+    inline constexpr ::std::size_t grow_failed{::std::numeric_limits<::std::size_t>::max()};
+
+    /// @brief      custom-page-sizes proposal: the page size is 2^page_size_log2, only 1 byte (0) and 64 KiB (16) are valid
+    inline constexpr bool is_valid_page_size_log2(unsigned page_size_log2) noexcept { return page_size_log2 == 0u || page_size_log2 == 16u; }
+
+    /// @brief      Maximum number of pages of a wasm32 memory with a custom page size
+    /// @details    64 KiB pages: 65536 (4 GiB). 1-byte pages: 2^32 - 1, so the page count still fits in the i32 result of memory.size. On 32-bit
+    ///             hosts the byte length must also fit in size_t.
+    inline constexpr ::std::size_t wasm32_max_custom_page(unsigned page_size_log2) noexcept
+    {
+        auto const wasm_max{page_size_log2 == 0u ? static_cast<::std::size_t>(0xFFFF'FFFFu) : wasm32_max_page};
+        auto const host_max{::std::numeric_limits<::std::size_t>::max() >> page_size_log2};
+        return wasm_max > host_max ? host_max : wasm_max;
+    }
+
+    /// @brief      Clamp the declared maximum of a memory type to what a wasm32 memory can address
+    /// @details    A memory type without a maximum is passed as wasm32_max_page.
+    inline constexpr ::std::size_t clamp_max_page(::std::size_t max_page) noexcept
+    {
+        auto const max_addressable{wasm32_max_custom_page(16u)};
+        return max_page > max_addressable ? max_addressable : max_page;
+    }
+}  // namespace uwvm2::memory::linear
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
@@ -0,0 +1,153 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.memory.linear;
+#else
+// std
+# include <cstddef>
+# include <cstdint>
+# include <memory>
+# include <utility>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# include <fast_io_dsal/vector.h>
+# include <uwvm2/memory/linear/impl.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::memory::multiple
+{
+    /// @brief      Entry of the descriptor table of secondary memories
+    /// @details    Accesses to a memory other than 0 only load these two words, never the memory object itself.
+    struct memory_descriptor_t
+    {
+        ::std::byte* memory_begin{};
+        ::std::size_t memory_length{};
+    };
+
+    /// @brief      The linear memories of one instance (multi-memory proposal)
+    /// @details    Memory 0 is stored inline and is accessed exactly like a single memory: the interpreter caches memory0.memory_begin in its frame
+    ///             and a JIT pins it in a register, a module with one memory never touches the descriptor table. Memories 1..n are reached through
+    ///             a descriptor table indexed by the memory index of the instruction. The table is refreshed by grow, so after memory.grow the
+    ///             cached base of memory 0 has to be reloaded as well (unless the memory type never moves, e.g. mmap_memory_t).
+    template <typename Memory>
+    struct multiple_memory_t
+    {
+        using memory_type = Memory;
+
+        Memory memory0{};
+        ::fast_io::vector<memory_descriptor_t> descriptors{};
+        ::fast_io::vector<Memory> secondary_memories{};
+
+        /// @brief      Create `memory_count` uninitialized memories, each is then set up with init_memory
+        inline void init(::std::size_t memory_count) noexcept
+        {
+            this->memory0.clear();
+            this->secondary_memories.clear();
+            this->descriptors.clear();
+
+            if(memory_count < 2uz) { return; }
+
+            this->secondary_memories.reserve(memory_count - 1uz);
+            for(::std::size_t i{1uz}; i != memory_count; ++i) { this->secondary_memories.emplace_back(); }
+
+            // descriptors[0] is never read, it keeps the table indexed by the memory index
+            this->descriptors.resize(memory_count);
+        }
+
+        inline constexpr ::std::size_t memory_count() const noexcept { return this->secondary_memories.size() + 1uz; }
+
+        inline constexpr Memory& memory(::std::size_t memory_idx) noexcept
+        {
+            return memory_idx == 0uz ? this->memory0 : this->secondary_memories.index_unchecked(memory_idx - 1uz);
+        }
+
+        inline constexpr Memory const& memory(::std::size_t memory_idx) const noexcept
+        {
+            return memory_idx == 0uz ? this->memory0 : this->secondary_memories.index_unchecked(memory_idx - 1uz);
+        }
+
+        /// @brief      Forward to Memory::init and publish the result in the descriptor table
+        template <typename... Args>
+        inline bool init_memory(::std::size_t memory_idx, Args&&... args) noexcept
+        {
+            auto& mem{this->memory(memory_idx)};
+            bool const res{mem.init(::std::forward<Args>(args)...)};
+            this->refresh_descriptor(memory_idx);
+            return res;
+        }
+
+        /// @brief      memory.grow on any memory
+        inline ::std::size_t grow(::std::size_t memory_idx, ::std::size_t delta_page) noexcept
+        {
+            auto const res{this->memory(memory_idx).grow(delta_page)};
+            this->refresh_descriptor(memory_idx);
+            return res;
+        }
+
+        /// @brief      Fast path of memory 0, identical to a single-memory access
+        inline constexpr ::std::byte* get_memory0_address(::std::uint_least64_t offset, ::std::size_t size) const noexcept
+        {
+            return this->memory0.get_address(offset, size);
+        }
+
+        /// @brief      Effective address of an access to memory `memory_idx`
+        /// @return     nullptr if the access is out of bounds (only for memory types with explicit bounds checks)
+        inline constexpr ::std::byte* get_address(::std::size_t memory_idx, ::std::uint_least64_t offset, ::std::size_t size) const noexcept
+        {
+            if(memory_idx == 0uz) [[likely]] { return this->memory0.get_address(offset, size); }
+
+            auto const& desc{this->descriptors.index_unchecked(memory_idx)};
+
+            if constexpr(Memory::explicit_bounds_check)
+            {
+                if(offset > desc.memory_length || size > desc.memory_length - static_cast<::std::size_t>(offset)) [[unlikely]] { return nullptr; }
+            }
+
+            return desc.memory_begin + offset;
+        }
+
+    private:
+        inline constexpr void refresh_descriptor(::std::size_t memory_idx) noexcept
+        {
+            if(memory_idx == 0uz) { return; }
+
+            auto const& mem{this->secondary_memories.index_unchecked(memory_idx - 1uz)};
+            this->descriptors.index_unchecked(memory_idx) = {mem.memory_begin, mem.memory_length};
+        }
+    };
+
+    using native_multiple_memory_t = multiple_memory_t<::uwvm2::memory::linear::native_memory_t>;
+}  // namespace uwvm2::memory::multiple
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
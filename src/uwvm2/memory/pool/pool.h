@@ -0,0 +1,222 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.memory.linear;
+#else
+// std
+# include <cstddef>
+# include <cstdint>
+# include <cstring>
+# include <limits>
+# include <memory>
+# include <utility>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// multithread
+# ifdef UWVM_SUPPORT_MULTITHREAD
+#  include <mutex>
+# endif
+// import
+# include <fast_io.h>
+# include <fast_io_dsal/vector.h>
+# include <uwvm2/memory/linear/impl.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::memory::pool
+{
+    /// @brief      Shape of every slot of a pool, taken from the module that is instantiated repeatedly
+    struct instance_pool_config_t
+    {
+        ::std::size_t slot_count{};
+        ::std::size_t memory_min_page{};
+        ::std::size_t memory_max_page{};
+        /// @brief  Bytes of table elements, zeroed when a slot is released
+        ::std::size_t table_size{};
+        /// @brief  Bytes of globals, zeroed when a slot is released
+        ::std::size_t global_size{};
+        /// @brief  Bytes of the operand and call stack, not cleared (always written before it is read)
+        ::std::size_t stack_size{};
+    };
+
+    namespace details
+    {
+        /// @brief      Round a region of a slot up to max_align_t, so every region of every slot starts aligned
+        /// @return     false on overflow
+        inline constexpr bool align_slot_region(::std::size_t& size) noexcept
+        {
+            constexpr ::std::size_t align{alignof(::std::max_align_t)};
+            if(size > ::std::numeric_limits<::std::size_t>::max() - (align - 1uz)) [[unlikely]] { return false; }
+            size = (size + (align - 1uz)) & ~(align - 1uz);
+            return true;
+        }
+    }  // namespace details
+
+    /// @brief      Everything one instance needs, created once by the pool
+    template <typename Memory>
+    struct instance_slot_t
+    {
+        Memory memory{};
+        ::std::byte* table_begin{};
+        ::std::byte* global_begin{};
+        ::std::byte* stack_begin{};
+    };
+
+    /// @brief      Pool of pre-created instance slots
+    /// @details    All slots are created by init: the linear memory is reserved (or allocated) and the tables, globals and stacks of all slots
+    ///             share one allocation. Releasing a slot resets it in place (Memory::reset, MADV_DONTNEED for guarded memories on linux) instead of
+    ///             freeing it, and acquire hands out the most recently released slot first, whose pages and cache lines are still warm. An
+    ///             instantiation from the pool is then only the data segment initialization (memory_image_t::instantiate).
+    template <typename Memory>
+    struct instance_pool_t
+    {
+        using slot_type = instance_slot_t<Memory>;
+
+        instance_pool_config_t config{};
+        ::fast_io::vector<slot_type> slots{};
+        /// @brief  Indices of the free slots, used as a stack
+        ::fast_io::vector<::std::size_t> free_slots{};
+        ::std::byte* area_begin{};
+        ::std::size_t area_size{};
+#ifdef UWVM_SUPPORT_MULTITHREAD
+        ::std::mutex free_slots_mutex{};
+#endif
+
+        inline constexpr instance_pool_t() noexcept = default;
+
+        inline instance_pool_t(instance_pool_t const&) = delete;
+        inline instance_pool_t& operator= (instance_pool_t const&) = delete;
+
+        inline ~instance_pool_t() { this->clear(); }
+
+        /// @brief      Create all slots
+        /// @details    The tables, globals and stack of a slot are each rounded up to max_align_t.
+        /// @return     false if a memory cannot be created or the sizes overflow, the pool is then empty
+        inline bool init(instance_pool_config_t const& config_v) noexcept
+        {
+            this->clear();
+
+            auto table_size{config_v.table_size};
+            auto global_size{config_v.global_size};
+            auto stack_size{config_v.stack_size};
+            if(!details::align_slot_region(table_size) || !details::align_slot_region(global_size) || !details::align_slot_region(stack_size))
+                [[unlikely]]
+            {
+                return false;
+            }
+
+            constexpr auto size_t_max{::std::numeric_limits<::std::size_t>::max()};
+            if(global_size > size_t_max - table_size || stack_size > size_t_max - table_size - global_size) [[unlikely]] { return false; }
+            auto const slot_area_size{table_size + global_size + stack_size};
+
+            if(slot_area_size != 0uz && config_v.slot_count > size_t_max / slot_area_size) [[unlikely]] { return false; }
+
+            this->config = config_v;
+
+            this->area_size = slot_area_size * config_v.slot_count;
+            if(this->area_size != 0uz) { this->area_begin = static_cast<::std::byte*>(::fast_io::native_global_allocator::allocate_zero(this->area_size)); }
+
+            this->slots.reserve(config_v.slot_count);
+            this->free_slots.reserve(config_v.slot_count);
+
+            for(::std::size_t i{}; i != config_v.slot_count; ++i)
+            {
+                auto& slot{this->slots.emplace_back()};
+
+                if(!slot.memory.init(config_v.memory_min_page, config_v.memory_max_page)) [[unlikely]]
+                {
+                    this->clear();
+                    return false;
+                }
+
+                auto const slot_area{this->area_begin + i * slot_area_size};
+                slot.table_begin = slot_area;
+                slot.global_begin = slot_area + table_size;
+                slot.stack_begin = slot_area + table_size + global_size;
+
+                // Slot 0 is handed out first
+                this->free_slots.push_back(config_v.slot_count - 1uz - i);
+            }
+
+            return true;
+        }
+
+        /// @brief      Take a free slot
+        /// @return     nullptr if all slots are in use
+        inline slot_type* acquire() noexcept
+        {
+#ifdef UWVM_SUPPORT_MULTITHREAD
+            ::std::scoped_lock guard{this->free_slots_mutex};
+#endif
+            if(this->free_slots.empty()) [[unlikely]] { return nullptr; }
+
+            auto const idx{this->free_slots.back()};
+            this->free_slots.pop_back();
+            return this->slots.data() + idx;
+        }
+
+        /// @brief      Reset a slot and return it to the pool
+        /// @details    The memory is back at memory_min_page zero filled pages, tables and globals are zeroed. A slot whose memory cannot be
+        ///             allocated again (out of memory) is not returned, the pool has one slot less.
+        inline void release(slot_type* slot) noexcept
+        {
+            if(!slot->memory.reset(this->config.memory_min_page)) [[unlikely]]
+            {
+                // Cannot be reset in place (the pages cannot be committed again), start over
+                slot->memory.clear();
+                if(!slot->memory.init(this->config.memory_min_page, this->config.memory_max_page)) [[unlikely]] { return; }
+            }
+
+            if(this->config.table_size != 0uz) { ::std::memset(slot->table_begin, 0, this->config.table_size); }
+            if(this->config.global_size != 0uz) { ::std::memset(slot->global_begin, 0, this->config.global_size); }
+
+#ifdef UWVM_SUPPORT_MULTITHREAD
+            ::std::scoped_lock guard{this->free_slots_mutex};
+#endif
+            this->free_slots.push_back(static_cast<::std::size_t>(slot - this->slots.data()));
+        }
+
+        inline void clear() noexcept
+        {
+            this->slots.clear();
+            this->free_slots.clear();
+
+            if(this->area_begin != nullptr) { ::fast_io::native_global_allocator::deallocate_n(this->area_begin, this->area_size); }
+
+            this->area_begin = nullptr;
+            this->area_size = 0uz;
+        }
+    };
+
+    using native_instance_pool_t = instance_pool_t<::uwvm2::memory::linear::native_memory_t>;
+}  // namespace uwvm2::memory::pool
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
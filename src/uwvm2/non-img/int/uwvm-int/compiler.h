@@ -0,0 +1,1494 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.parser.wasm.standard.wasm1.type;
+import uwvm2.parser.wasm.standard.wasm1.opcode;
+import :runtime;
+import :handler;
+import :fusion;
+#else
+// std
+# include <cstddef>
+# include <cstdint>
+# include <limits>
+# include <concepts>
+# ifdef UWVM_INT_PROFILE
+#  include <mutex>
+# endif
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# include <fast_io_dsal/vector.h>
+# include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/opcode/impl.h>
+# include "runtime.h"
+# include "handler.h"
+# include "fusion.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::non_img::uwvm_int
+{
+    namespace details
+    {
+        /// @brief  Reads the immediates of a validated function body, every read checks the end so a corrupted body fails instead of overrunning
+        struct code_reader_t
+        {
+            ::std::byte const* curr{};
+            ::std::byte const* end{};
+
+            inline constexpr bool read_byte(::std::uint_least8_t& v) noexcept
+            {
+                if(this->curr == this->end) [[unlikely]] { return false; }
+                v = static_cast<::std::uint_least8_t>(*this->curr++);
+                return true;
+            }
+
+            /// @brief  LEB128 of at most `Bits` bits, sign extended if `Signed`
+            template <unsigned Bits, bool Signed>
+            inline constexpr bool read_leb(::std::uint_least64_t& v) noexcept
+            {
+                ::std::uint_least64_t res{};
+                for(unsigned shift{};; shift += 7u)
+                {
+                    if(this->curr == this->end || shift >= Bits + 7u) [[unlikely]] { return false; }
+
+                    auto const byte{static_cast<::std::uint_least64_t>(*this->curr++) & 0xFFu};
+                    if(shift < 64u) { res |= (byte & 0x7Fu) << shift; }
+                    if((byte & 0x80u) == 0u)
+                    {
+                        if constexpr(Signed)
+                        {
+                            if((byte & 0x40u) != 0u && shift + 7u < 64u) { res |= ~::std::uint_least64_t{} << (shift + 7u); }
+                        }
+                        break;
+                    }
+                }
+
+                v = res;
+                return true;
+            }
+
+            inline constexpr bool read_u32(::std::size_t& v) noexcept
+            {
+                ::std::uint_least64_t res;
+                if(!this->read_leb<32u, false>(res)) [[unlikely]] { return false; }
+                v = static_cast<::std::size_t>(res & 0xFFFF'FFFFu);
+                return true;
+            }
+
+            /// @brief  f32.const and f64.const: little endian bits
+            template <unsigned Bytes>
+            inline constexpr bool read_fixed(::std::uint_least64_t& v) noexcept
+            {
+                if(static_cast<::std::size_t>(this->end - this->curr) < Bytes) [[unlikely]] { return false; }
+
+                ::std::uint_least64_t res{};
+                for(unsigned i{}; i != Bytes; ++i) { res |= (static_cast<::std::uint_least64_t>(this->curr[i]) & 0xFFu) << (i * 8u); }
+                this->curr += Bytes;
+
+                v = res;
+                return true;
+            }
+        };
+
+        enum class control_kind_t : unsigned
+        {
+            function,
+            block,
+            loop,
+            if_
+        };
+
+        struct control_t
+        {
+            control_kind_t kind{};
+            /// @brief  Operand stack height when the control was entered (after the condition of if)
+            ::std::size_t height{};
+            /// @brief  Values carried by a branch to the label: the results, none for loop (wasm1 blocks have no parameters)
+            ::std::size_t label_arity{};
+            ::std::size_t result_arity{};
+            /// @brief  loop: first op of the loop body, if: position of the br_unless target (SIZE_MAX after else)
+            ::std::size_t position{};
+            /// @brief  Last forward branch to the end of this control, each unpatched target holds the position of the previous one
+            ::std::size_t fixup_head{};
+            /// @brief  The control was entered in unreachable code, nothing of it is emitted
+            bool dead{};
+        };
+
+        inline constexpr ::std::size_t no_position{::std::numeric_limits<::std::size_t>::max()};
+
+        /// @brief  The const instruction of the operand type of a binary operator
+        template <typename T>
+        inline consteval op_basic const_opcode_of() noexcept
+        {
+            if constexpr(::std::same_as<T, wasm_u32>) { return op_basic::i32_const; }
+            else if constexpr(::std::same_as<T, wasm_u64>) { return op_basic::i64_const; }
+            else if constexpr(::std::same_as<T, wasm_f32>) { return op_basic::f32_const; }
+            else
+            {
+                static_assert(::std::same_as<T, wasm_f64>);
+                return op_basic::f64_const;
+            }
+        }
+
+        /// @brief  Handlers of one instruction by accumulator state: [operand read from acc (counted from 1), 0 for none][result left in acc]
+        struct handler_variants_t
+        {
+            handler_t handlers[3][2]{};
+        };
+
+        template <typename T, typename Op>
+        inline constexpr handler_variants_t unary_variants{
+            {{&handlers::unary<T, Op, 0u, false>, &handlers::unary<T, Op, 0u, true>}, {&handlers::unary<T, Op, 1u, false>, &handlers::unary<T, Op, 1u, true>}}
+        };
+
+        template <typename T, typename Op>
+        inline constexpr handler_variants_t binary_variants{
+            {{&handlers::binary<T, Op, 0u, false>, &handlers::binary<T, Op, 0u, true>},
+             {&handlers::binary<T, Op, 1u, false>, &handlers::binary<T, Op, 1u, true>},
+             {&handlers::binary<T, Op, 2u, false>, &handlers::binary<T, Op, 2u, true>}}
+        };
+
+        template <typename T, typename Op>
+        inline constexpr handler_variants_t binary_imm_variants{
+            {{&handlers::binary_imm<T, Op, 0u, false>, &handlers::binary_imm<T, Op, 0u, true>},
+             {&handlers::binary_imm<T, Op, 1u, false>, &handlers::binary_imm<T, Op, 1u, true>}}
+        };
+
+        template <typename T, bool Signed, bool Rem>
+        inline constexpr handler_variants_t divide_variants{
+            {{&handlers::divide<T, Signed, Rem, 0u, false>, &handlers::divide<T, Signed, Rem, 0u, true>},
+             {&handlers::divide<T, Signed, Rem, 1u, false>, &handlers::divide<T, Signed, Rem, 1u, true>},
+             {&handlers::divide<T, Signed, Rem, 2u, false>, &handlers::divide<T, Signed, Rem, 2u, true>}}
+        };
+
+        template <typename Stored, typename Result>
+        inline constexpr handler_variants_t load_variants{
+            {{&handlers::load<Stored, Result, 0u, false>, &handlers::load<Stored, Result, 0u, true>},
+             {&handlers::load<Stored, Result, 1u, false>, &handlers::load<Stored, Result, 1u, true>}}
+        };
+
+        template <typename Stored>
+        inline constexpr handler_variants_t store_variants{
+            {{&handlers::store<Stored, 0u>, nullptr}, {&handlers::store<Stored, 1u>, nullptr}, {&handlers::store<Stored, 2u>, nullptr}}
+        };
+
+        inline constexpr handler_variants_t const_variants{{{&handlers::const_<false>, &handlers::const_<true>}}};
+
+        inline constexpr handler_variants_t global_get_variants{{{&handlers::global_get<false>, &handlers::global_get<true>}}};
+
+        inline constexpr handler_variants_t global_set_variants{{{&handlers::global_set<0u>, nullptr}, {&handlers::global_set<1u>, nullptr}}};
+
+        /// @brief  The instruction that produced an operand stack entry, valid while nothing has been emitted after it
+        struct producer_t
+        {
+            /// @brief  Position of its destination immediate, no_position once the record is stale
+            ::std::size_t position{no_position};
+            ::std::size_t index{};
+            ::std::uint_least8_t opcode{};
+            /// @brief  The operand it reads from acc and its variant that leaves the result in acc (nullptr if it has none)
+            unsigned acc_in{};
+            handler_t acc_out{};
+            /// @brief  Its branch forms when it is a compare listed in fusion_rules
+            handler_t fused_br_if{};
+            handler_t fused_br_unless{};
+        };
+
+        /// @brief  Lowers one function body into register-form threaded code
+        /// @details Single pass. Every operand stack entry is a frame offset: a pushed value owns the slot `local_count + its index`, a local.get
+        ///          only aliases the local and emits nothing, drop emits nothing, and local.set rewrites the destination of the instruction that
+        ///          produced the value when it can. Aliases are copied to their own slots before the local changes and at every control boundary,
+        ///          so all paths that meet at a label agree on where the values are. A result read only by the next instruction is handed over in
+        ///          the accumulator. Unreachable code is skipped, forward branches are chained through their unpatched targets and patched when
+        ///          their block ends. Targets are indices until the code is complete, then they become addresses.
+        struct function_lowering_t
+        {
+            module_t const& mod;
+            ::fast_io::vector<::std::size_t> const& type_ids;
+            function_t& func;
+
+            ::fast_io::vector<op_t> code{};
+            ::fast_io::vector<control_t> controls{};
+            ::fast_io::vector<::std::size_t> target_positions{};
+            /// @brief  Frame offset of each operand stack entry
+            ::fast_io::vector<::std::size_t> operands{};
+
+            ::std::size_t max_height{};
+            /// @brief  The last emitted instruction if it produced an entry, and the producer before it if only the last one was emitted since
+            producer_t last{};
+            producer_t previous{};
+            /// @brief  Opcode being lowered
+            ::std::uint_least8_t curr_opcode{};
+            /// @brief  Operands of a compare removed by fuse_condition
+            op_t fused_operands[2]{};
+            ::std::size_t fused_operand_count{};
+            bool unreachable{};
+            /// @brief  Set when an instruction pops more entries than its block holds, lower fails after that instruction
+            bool malformed{};
+
+#ifdef UWVM_INT_PROFILE
+            /// @brief  Last two opcodes of the straight-line code and the keys recorded for fusion_profile
+            ::std::uint_least32_t profile_window{};
+            ::std::size_t profile_length{};
+            ::fast_io::vector<::std::uint_least32_t> profile_pairs{};
+            ::fast_io::vector<::std::uint_least32_t> profile_triples{};
+#endif
+
+            inline void emit(handler_t handler)
+            {
+                this->last.position = no_position;
+                this->previous.position = no_position;
+                this->code.push_back(op_t{.handler = handler});
+            }
+
+            inline void emit_index(::std::size_t index) { this->code.push_back(op_t{.index = index}); }
+
+            inline void emit_imm(slot_t imm) { this->code.push_back(op_t{.imm = imm}); }
+
+            inline void emit_target(::std::size_t target)
+            {
+                this->target_positions.push_back(this->code.size());
+                this->emit_index(target);
+            }
+
+            inline constexpr ::std::size_t own_slot(::std::size_t index) const noexcept { return this->func.local_count + index; }
+
+            inline void push(::std::size_t offset)
+            {
+                this->operands.push_back(offset);
+                if(this->operands.size() > this->max_height) { this->max_height = this->operands.size(); }
+            }
+
+            /// @brief  The innermost block holds fewer than `count` entries
+            inline bool underflows(::std::size_t count) const noexcept { return this->operands.size() - this->controls.back().height < count; }
+
+            inline ::std::size_t pop() noexcept
+            {
+                if(this->underflows(1uz)) [[unlikely]]
+                {
+                    this->malformed = true;
+                    return 0uz;
+                }
+                auto const offset{this->operands.back()};
+                this->operands.pop_back();
+                return offset;
+            }
+
+            /// @brief  Copy the aliased entries from `begin` up to the top into their own slots
+            inline void materialize(::std::size_t begin)
+            {
+                for(auto i{begin}; i != this->operands.size(); ++i)
+                {
+                    auto& offset{this->operands.index_unchecked(i)};
+                    if(offset == this->own_slot(i)) { continue; }
+                    this->emit(&handlers::copy);
+                    this->emit_index(this->own_slot(i));
+                    this->emit_index(offset);
+                    offset = this->own_slot(i);
+                }
+            }
+
+            /// @brief  If the last instruction produced one of the operands from `base` up, it leaves the result in acc instead of its slot
+            /// @return The operand (counted from 1) to read from acc, 0 for none
+            inline unsigned take_acc(::std::size_t base, handler_variants_t const& variants)
+            {
+                auto const index{this->last.index};
+                // Entries pushed after it are aliases, they emitted nothing
+                if(this->last.position == no_position || this->last.acc_out == nullptr || index < base || index >= this->operands.size() ||
+                   this->operands.index_unchecked(index) != this->own_slot(index))
+                {
+                    return 0u;
+                }
+
+                auto const acc_in{static_cast<unsigned>(index - base + 1uz)};
+                if(acc_in >= 3u || variants.handlers[acc_in][0] == nullptr) { return 0u; }
+
+                this->code.index_unchecked(this->last.position - 1uz).handler = this->last.acc_out;
+                this->last.position = no_position;
+                return acc_in;
+            }
+
+            /// @brief  Instruction that pops `operand_count` values and pushes one: [handler][dst][operands], the caller emits the immediates that
+            ///         follow
+            /// @return The operand read from acc
+            inline unsigned produce(handler_variants_t const& variants, ::std::size_t operand_count)
+            {
+                if(this->underflows(operand_count)) [[unlikely]]
+                {
+                    this->malformed = true;
+                    return 0u;
+                }
+                auto const base{this->operands.size() - operand_count};
+                auto const acc_in{this->take_acc(base, variants)};
+                auto const before{this->last};
+
+                this->emit(variants.handlers[acc_in][0]);
+                auto const dst_position{this->code.size()};
+                this->emit_index(this->own_slot(base));
+                for(auto i{base}; i != this->operands.size(); ++i) { this->emit_index(this->operands.index_unchecked(i)); }
+
+                this->operands.resize(base);
+                this->push(this->own_slot(base));
+                this->previous = before;
+                this->last = producer_t{.position = dst_position,
+                                        .index = base,
+                                        .opcode = this->curr_opcode,
+                                        .acc_in = acc_in,
+                                        .acc_out = variants.handlers[acc_in][1]};
+                return acc_in;
+            }
+
+            /// @brief  Instruction without cached variants
+            inline void produce(handler_t handler, ::std::size_t operand_count) { this->produce(handler_variants_t{{{handler, nullptr}}}, operand_count); }
+
+            /// @brief  Instruction that pops `operand_count` values and pushes nothing: [handler][operands], the caller emits the immediates that
+            ///         follow
+            inline void consume(handler_variants_t const& variants, ::std::size_t operand_count)
+            {
+                if(this->underflows(operand_count)) [[unlikely]]
+                {
+                    this->malformed = true;
+                    return;
+                }
+                auto const base{this->operands.size() - operand_count};
+                auto const acc_in{this->take_acc(base, variants)};
+                this->emit(variants.handlers[acc_in][0]);
+                for(auto i{base}; i != this->operands.size(); ++i) { this->emit_index(this->operands.index_unchecked(i)); }
+                this->operands.resize(base);
+            }
+
+            /// @brief  The entry `index` is the top, it was produced by the last emitted instruction and is still in its own slot
+            inline bool is_last_produced(::std::size_t index) const noexcept
+            {
+                return this->last.position != no_position && this->last.index == index && index + 1uz == this->operands.size() &&
+                       this->operands.index_unchecked(index) == this->own_slot(index);
+            }
+
+            /// @brief  Binary operator `Opcode`, a const before it becomes its immediate and a branch after it evaluates it if fusion_rules lists the
+            ///         pairs
+            template <typename T, typename Op, op_basic Opcode>
+            inline void binary()
+            {
+                if(this->unreachable) { return; }
+
+                constexpr auto const_opcode{const_opcode_of<T>()};
+                bool with_imm{};
+                unsigned acc_in{};
+                if constexpr(is_fused(const_opcode, Opcode))
+                {
+                    if(this->is_last_produced(this->operands.size() - 1uz) && this->last.opcode == static_cast<::std::uint_least8_t>(const_opcode))
+                    {
+                        // [const_][dst][imm] is the last instruction, its value is only read here
+                        auto const imm{this->code.index_unchecked(this->last.position + 1uz).imm};
+                        this->code.resize(this->last.position - 1uz);
+                        this->operands.pop_back();
+                        // The instruction before the const is the last one again
+                        this->last = this->previous;
+                        this->previous.position = no_position;
+
+                        acc_in = this->produce(binary_imm_variants<T, Op>, 1uz);
+                        this->emit_imm(imm);
+                        with_imm = true;
+                    }
+                }
+                if(!with_imm) { acc_in = this->produce(binary_variants<T, Op>, 2uz); }
+
+                if constexpr(is_fused(Opcode, op_basic::br_if))
+                {
+                    static_assert(::std::same_as<decltype(Op{}(T{}, T{})), bool>, "only a compare can be fused into a branch");
+                    constexpr handler_t br_if_handlers[2][3]{
+                        {&handlers::branch_compare<T, Op, false, false, 0u>,
+                         &handlers::branch_compare<T, Op, false, false, 1u>,
+                         &handlers::branch_compare<T, Op, false, false, 2u>},
+                        {&handlers::branch_compare<T, Op, true, false, 0u>, &handlers::branch_compare<T, Op, true, false, 1u>, nullptr}
+                    };
+                    this->last.fused_br_if = br_if_handlers[with_imm][acc_in];
+                }
+                if constexpr(is_fused(Opcode, op_basic::if_))
+                {
+                    static_assert(::std::same_as<decltype(Op{}(T{}, T{})), bool>, "only a compare can be fused into a branch");
+                    constexpr handler_t br_unless_handlers[2][3]{
+                        {&handlers::branch_compare<T, Op, false, true, 0u>,
+                         &handlers::branch_compare<T, Op, false, true, 1u>,
+                         &handlers::branch_compare<T, Op, false, true, 2u>},
+                        {&handlers::branch_compare<T, Op, true, true, 0u>, &handlers::branch_compare<T, Op, true, true, 1u>, nullptr}
+                    };
+                    this->last.fused_br_unless = br_unless_handlers[with_imm][acc_in];
+                }
+            }
+
+            /// @brief      The condition `index` (already popped) of `second` was just computed by a compare that fusion_rules pairs with it
+            /// @details    The compare is removed and its operands are kept in fused_operands, the returned handler branches to its target if the
+            ///             condition is `when` and reads the operands after the target.
+            /// @return     nullptr if the condition cannot be fused
+            inline handler_t fuse_condition(::std::size_t index, op_basic second, bool when)
+            {
+                // The condition was popped, it has to be the entry right above the others
+                if(this->last.position == no_position || this->last.index != index || index != this->operands.size()) { return nullptr; }
+                if(!is_fused(static_cast<op_basic>(this->last.opcode), second)) { return nullptr; }
+
+                handler_t handler;
+                if(static_cast<op_basic>(this->last.opcode) == op_basic::i32_eqz)
+                {
+                    // eqz(x) is true when x is zero, the plain branches do not read acc
+                    if(this->last.acc_in != 0u) { return nullptr; }
+                    handler = when ? &handlers::br_unless : &handlers::br_if;
+                }
+                else
+                {
+                    handler = when ? this->last.fused_br_if : this->last.fused_br_unless;
+                }
+                if(handler == nullptr) { return nullptr; }
+
+                // [handler][dst][operands], an operand read from acc is still read from acc
+                auto const operand_begin{this->last.position + 1uz};
+                this->fused_operand_count = this->code.size() - operand_begin;
+                for(::std::size_t i{}; i != this->fused_operand_count; ++i) { this->fused_operands[i] = this->code.index_unchecked(operand_begin + i); }
+                this->code.resize(this->last.position - 1uz);
+                this->last.position = no_position;
+                return handler;
+            }
+
+            inline void emit_fused_operands()
+            {
+                for(::std::size_t i{}; i != this->fused_operand_count; ++i) { this->code.push_back(this->fused_operands[i]); }
+            }
+
+            /// @brief  Instruction without immediates that pops `operand_count` values and pushes one
+            inline void simple(handler_variants_t const& variants, ::std::size_t operand_count)
+            {
+                if(this->unreachable) { return; }
+                this->produce(variants, operand_count);
+            }
+
+            inline void simple(handler_t handler, ::std::size_t operand_count)
+            {
+                if(this->unreachable) { return; }
+                this->produce(handler, operand_count);
+            }
+
+            /// @brief  local.set and local.tee
+            inline void set_local(::std::size_t local_idx, bool tee)
+            {
+                if(this->underflows(1uz)) [[unlikely]]
+                {
+                    this->malformed = true;
+                    return;
+                }
+                auto const top{this->operands.size() - 1uz};
+                auto const value{this->operands.back()};
+
+                if(value != local_idx)
+                {
+                    // Entries that still read the old value of the local get their own copy first
+                    for(::std::size_t i{}; i != top; ++i)
+                    {
+                        if(this->operands.index_unchecked(i) != local_idx) { continue; }
+                        this->emit(&handlers::copy);
+                        this->emit_index(this->own_slot(i));
+                        this->emit_index(local_idx);
+                        this->operands.index_unchecked(i) = this->own_slot(i);
+                    }
+
+                    if(this->is_last_produced(top))
+                    {
+                        // The value was just computed, it is written to the local directly
+                        this->code.index_unchecked(this->last.position).index = local_idx;
+                    }
+                    else
+                    {
+                        this->emit(&handlers::copy);
+                        this->emit_index(local_idx);
+                        this->emit_index(value);
+                    }
+                }
+
+                if(tee) { this->operands.back() = local_idx; }
+                else
+                {
+                    this->operands.pop_back();
+                }
+            }
+
+            /// @brief  Target of a branch to `label`: known for loops, patched at the end otherwise
+            inline void emit_label_target(control_t& label)
+            {
+                if(label.kind == control_kind_t::loop) { this->emit_target(label.position); }
+                else
+                {
+                    auto const pos{this->code.size()};
+                    this->emit_target(label.fixup_head);
+                    label.fixup_head = pos;
+                }
+            }
+
+            /// @brief  br and br_if, the condition of br_if (the entry `condition_index`) is already popped, the entries are materialized
+            inline void branch(::std::size_t depth, bool conditional, ::std::size_t condition, ::std::size_t condition_index)
+            {
+                auto& label{this->controls.index_unchecked(this->controls.size() - 1uz - depth)};
+                auto const arity{label.label_arity};
+                auto const src{this->own_slot(this->operands.size() - arity)};
+                auto const dst{this->own_slot(label.height)};
+
+                if(arity == 0uz || src == dst)
+                {
+                    if(conditional)
+                    {
+                        if(auto const fused{this->fuse_condition(condition_index, op_basic::br_if, true)}; fused != nullptr)
+                        {
+                            this->emit(fused);
+                            this->emit_label_target(label);
+                            this->emit_fused_operands();
+                            return;
+                        }
+                    }
+
+                    // The label values are already in place (the usual case for loops and for branches at the end of a block)
+                    this->emit(conditional ? &handlers::br_if : &handlers::br);
+                    this->emit_label_target(label);
+                    if(conditional) { this->emit_index(condition); }
+                }
+                else
+                {
+                    this->emit(conditional ? &handlers::br_if_copy : &handlers::br_copy);
+                    this->emit_label_target(label);
+                    if(conditional) { this->emit_index(condition); }
+                    this->emit_index(arity);
+                    this->emit_index(dst);
+                    this->emit_index(src);
+                }
+            }
+
+            /// @brief  The results are the top entries, they are materialized
+            inline void emit_return()
+            {
+                this->emit(&handlers::return_);
+                this->emit_index(this->func.result_count);
+                this->emit_index(this->own_slot(this->operands.size() - this->func.result_count));
+            }
+
+            /// @brief  After else and end: the entries below the block are in their own slots, the results of the block follow them
+            inline void reset_operands(::std::size_t height, ::std::size_t result_count)
+            {
+                this->operands.resize(height);
+                for(::std::size_t i{}; i != result_count; ++i) { this->push(this->own_slot(height + i)); }
+                this->last.position = no_position;
+                this->previous.position = no_position;
+            }
+
+            inline void patch_fixups(::std::size_t fixup_head, ::std::size_t target) noexcept
+            {
+                for(auto pos{fixup_head}; pos != no_position;)
+                {
+                    auto& op{this->code.index_unchecked(pos)};
+                    pos = op.index;
+                    op.index = target;
+                }
+            }
+
+            inline bool read_block_arity(code_reader_t& reader, ::std::size_t& arity) noexcept
+            {
+                ::std::uint_least8_t block_type;
+                if(!reader.read_byte(block_type)) [[unlikely]] { return false; }
+                // 0x40: empty, otherwise a value type
+                arity = block_type == 0x40u ? 0uz : 1uz;
+                return true;
+            }
+
+            inline void push_control(control_kind_t kind, ::std::size_t arity, ::std::size_t position)
+            {
+                this->controls.push_back(control_t{.kind = kind,
+                                                   .height = this->operands.size(),
+                                                   .label_arity = kind == control_kind_t::loop ? 0uz : arity,
+                                                   .result_arity = arity,
+                                                   .position = position,
+                                                   .fixup_head = no_position,
+                                                   .dead = this->unreachable});
+            }
+
+            template <typename Stored, typename Result>
+            inline bool load(code_reader_t& reader)
+            {
+                ::std::size_t align, offset;
+                if(!reader.read_u32(align) || !reader.read_u32(offset)) [[unlikely]] { return false; }
+                if(this->unreachable) { return true; }
+                this->produce(load_variants<Stored, Result>, 1uz);
+                this->emit_imm(offset);
+                return true;
+            }
+
+            template <typename Stored>
+            inline bool store(code_reader_t& reader)
+            {
+                ::std::size_t align, offset;
+                if(!reader.read_u32(align) || !reader.read_u32(offset)) [[unlikely]] { return false; }
+                if(this->unreachable) { return true; }
+                this->consume(store_variants<Stored>, 2uz);
+                this->emit_imm(offset);
+                return true;
+            }
+
+#ifdef UWVM_INT_PROFILE
+            /// @brief  Record the sequences that end with `opcode`, merged into fusion_profile when the function is lowered
+            inline void profile(::std::uint_least8_t opcode)
+            {
+                if(this->unreachable)
+                {
+                    this->profile_length = 0uz;
+                    return;
+                }
+
+                auto const key{(this->profile_window << 8u) | opcode};
+                if(this->profile_length >= 1uz) { this->profile_pairs.push_back(key & 0xFFFFu); }
+                if(this->profile_length >= 2uz) { this->profile_triples.push_back(key & 0xFF'FFFFu); }
+                this->profile_window = key & 0xFFFFu;
+                ++this->profile_length;
+
+                switch(static_cast<op_basic>(opcode))
+                {
+                    case op_basic::block: [[fallthrough]];
+                    case op_basic::loop: [[fallthrough]];
+                    case op_basic::if_: [[fallthrough]];
+                    case op_basic::else_: [[fallthrough]];
+                    case op_basic::end:
+                    {
+                        // A label starts here
+                        this->profile_length = 0uz;
+                        break;
+                    }
+                    default:
+                    {
+                        break;
+                    }
+                }
+            }
+#endif
+
+            inline bool lower()
+            {
+                using op_basic = ::uwvm2::parser::wasm::standard::wasm1::opcode::op_basic;
+                using wasm_i32 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_i32;
+                using wasm_u32 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32;
+                using wasm_i64 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_i64;
+                using wasm_u64 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u64;
+                using wasm_f32 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_f32;
+                using wasm_f64 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_f64;
+                using wasm_i8 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_i8;
+                using wasm_u8 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u8;
+                using wasm_i16 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_i16;
+                using wasm_u16 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u16;
+
+                code_reader_t reader{this->func.body.expr_begin, this->func.body.code_end};
+
+                // The function is the outermost label, its end is the final return
+                this->push_control(control_kind_t::function, this->func.result_count, no_position);
+
+                while(!this->controls.empty())
+                {
+                    ::std::uint_least8_t opcode;
+                    if(!reader.read_byte(opcode)) [[unlikely]] { return false; }
+                    this->curr_opcode = opcode;
+#ifdef UWVM_INT_PROFILE
+                    this->profile(opcode);
+#endif
+
+                    switch(static_cast<op_basic>(opcode))
+                    {
+                        // Control
+                        case op_basic::unreachable:
+                        {
+                            if(!this->unreachable) { this->emit(&handlers::unreachable); }
+                            this->unreachable = true;
+                            break;
+                        }
+                        case op_basic::nop:
+                        {
+                            break;
+                        }
+                        case op_basic::block: [[fallthrough]];
+                        case op_basic::loop:
+                        {
+                            ::std::size_t arity;
+                            if(!this->read_block_arity(reader, arity)) [[unlikely]] { return false; }
+                            if(!this->unreachable)
+                            {
+                                this->materialize(0uz);
+                                this->last.position = no_position;
+                                this->previous.position = no_position;
+                            }
+                            auto const kind{static_cast<op_basic>(opcode) == op_basic::loop ? control_kind_t::loop : control_kind_t::block};
+                            this->push_control(kind, arity, this->code.size());
+
+                            // The branches back to the loop run the counter with each iteration
+                            if(kind == control_kind_t::loop && !this->unreachable && this->mod.tier_up.request != nullptr)
+                            {
+                                this->emit(&handlers::count_loop);
+                                this->code.push_back(op_t{.function = ::std::addressof(this->func)});
+                            }
+                            break;
+                        }
+                        case op_basic::if_:
+                        {
+                            ::std::size_t arity;
+                            if(!this->read_block_arity(reader, arity)) [[unlikely]] { return false; }
+
+                            auto position{no_position};
+                            if(!this->unreachable)
+                            {
+                                auto const condition_index{this->operands.size() - 1uz};
+                                auto const condition{this->pop()};
+                                this->materialize(0uz);
+                                // Jumps to the else branch if the condition is false
+                                auto const fused{this->fuse_condition(condition_index, op_basic::if_, false)};
+                                this->emit(fused != nullptr ? fused : &handlers::br_unless);
+                                position = this->code.size();
+                                this->emit_target(no_position);
+                                if(fused != nullptr) { this->emit_fused_operands(); }
+                                else
+                                {
+                                    this->emit_index(condition);
+                                }
+                            }
+                            this->push_control(control_kind_t::if_, arity, position);
+                            break;
+                        }
+                        case op_basic::else_:
+                        {
+                            auto& c{this->controls.back()};
+                            // The else branch ends like a block, a second else is malformed
+                            if(c.kind != control_kind_t::if_) [[unlikely]] { return false; }
+                            c.kind = control_kind_t::block;
+                            if(c.dead) { break; }
+
+                            // The then branch jumps over the else branch
+                            if(!this->unreachable)
+                            {
+                                this->materialize(0uz);
+                                this->emit(&handlers::br);
+                                this->emit_label_target(c);
+                            }
+
+                            this->code.index_unchecked(c.position).index = this->code.size();
+                            c.position = no_position;
+
+                            this->reset_operands(c.height, 0uz);
+                            this->unreachable = false;
+                            break;
+                        }
+                        case op_basic::end:
+                        {
+                            if(!this->unreachable && this->underflows(this->controls.back().result_arity)) [[unlikely]] { return false; }
+                            auto const c{this->controls.back()};
+                            this->controls.pop_back();
+
+                            if(c.dead)
+                            {
+                                // Still unreachable after the end
+                                break;
+                            }
+
+                            // The fall through path leaves the results in their own slots, like the branches to the end
+                            if(!this->unreachable) { this->materialize(0uz); }
+                            this->reset_operands(c.height, c.result_arity);
+
+                            if(c.kind == control_kind_t::function)
+                            {
+                                this->patch_fixups(c.fixup_head, this->code.size());
+                                this->emit_return();
+                                break;
+                            }
+
+                            if(c.kind != control_kind_t::loop) { this->patch_fixups(c.fixup_head, this->code.size()); }
+                            // if without else: a false condition continues after the end
+                            if(c.kind == control_kind_t::if_ && c.position != no_position) { this->code.index_unchecked(c.position).index = this->code.size(); }
+
+                            this->unreachable = false;
+                            break;
+                        }
+                        case op_basic::br:
+                        {
+                            ::std::size_t depth;
+                            if(!reader.read_u32(depth) || depth >= this->controls.size()) [[unlikely]] { return false; }
+                            if(this->unreachable) { break; }
+                            if(this->underflows(this->controls.index_unchecked(this->controls.size() - 1uz - depth).label_arity)) [[unlikely]] { return false; }
+
+                            this->materialize(0uz);
+                            if(depth == this->controls.size() - 1uz) { this->emit_return(); }
+                            else
+                            {
+                                this->branch(depth, false, 0uz, 0uz);
+                            }
+                            this->unreachable = true;
+                            break;
+                        }
+                        case op_basic::br_if:
+                        {
+                            ::std::size_t depth;
+                            if(!reader.read_u32(depth) || depth >= this->controls.size()) [[unlikely]] { return false; }
+                            if(this->unreachable) { break; }
+
+                            auto const label_arity{this->controls.index_unchecked(this->controls.size() - 1uz - depth).label_arity};
+                            auto const condition_index{this->operands.size() - 1uz};
+                            auto const condition{this->pop()};
+                            if(this->malformed || this->underflows(label_arity)) [[unlikely]] { return false; }
+                            this->materialize(0uz);
+                            this->branch(depth, true, condition, condition_index);
+                            break;
+                        }
+                        case op_basic::br_table:
+                        {
+                            ::std::size_t label_count;
+                            if(!reader.read_u32(label_count)) [[unlikely]] { return false; }
+                            // Every label takes at least one byte
+                            if(label_count >= static_cast<::std::size_t>(reader.end - reader.curr)) [[unlikely]] { return false; }
+
+                            auto header{no_position};
+                            if(!this->unreachable)
+                            {
+                                auto const index{this->pop()};
+                                if(this->malformed) [[unlikely]] { return false; }
+                                this->materialize(0uz);
+                                this->emit(&handlers::br_table);
+                                this->emit_index(index);
+                                this->emit_index(label_count);
+                                // The arity and source are filled from the first label, all labels carry the same values
+                                header = this->code.size();
+                                this->emit_index(0uz);
+                                this->emit_index(0uz);
+                            }
+
+                            for(::std::size_t i{}; i != label_count + 1uz; ++i)
+                            {
+                                ::std::size_t depth;
+                                if(!reader.read_u32(depth) || depth >= this->controls.size()) [[unlikely]] { return false; }
+                                if(this->unreachable) { continue; }
+
+                                auto& label{this->controls.index_unchecked(this->controls.size() - 1uz - depth)};
+                                if(this->underflows(label.label_arity)) [[unlikely]] { return false; }
+                                if(i == 0uz)
+                                {
+                                    this->code.index_unchecked(header).index = label.label_arity;
+                                    this->code.index_unchecked(header + 1uz).index = this->own_slot(this->operands.size() - label.label_arity);
+                                }
+                                this->emit_label_target(label);
+                                this->emit_index(this->own_slot(label.height));
+                            }
+
+                            this->unreachable = true;
+                            break;
+                        }
+                        case op_basic::return_:
+                        {
+                            if(this->unreachable) { break; }
+                            if(this->underflows(this->func.result_count)) [[unlikely]] { return false; }
+                            this->materialize(0uz);
+                            this->emit_return();
+                            this->unreachable = true;
+                            break;
+                        }
+                        case op_basic::call:
+                        {
+                            ::std::size_t func_idx;
+                            if(!reader.read_u32(func_idx) || func_idx >= this->mod.functions.size()) [[unlikely]] { return false; }
+                            if(this->unreachable) { break; }
+
+                            // The arguments become the first slots of the callee frame, the results are left there
+                            auto const& callee{this->mod.functions.index_unchecked(func_idx)};
+                            if(this->underflows(callee.param_count)) [[unlikely]] { return false; }
+                            auto const base{this->operands.size() - callee.param_count};
+                            this->materialize(base);
+                            this->emit(&handlers::call);
+                            this->code.push_back(op_t{.function = ::std::addressof(callee)});
+                            this->emit_index(this->own_slot(base));
+                            this->reset_operands(base, callee.result_count);
+                            break;
+                        }
+                        case op_basic::call_indirect:
+                        {
+                            ::std::size_t type_idx;
+                            ::std::uint_least8_t table_idx;
+                            if(!reader.read_u32(type_idx) || type_idx >= this->mod.types.size() || !reader.read_byte(table_idx)) [[unlikely]] { return false; }
+                            if(this->unreachable) { break; }
+
+                            auto const& type{this->mod.types.index_unchecked(type_idx)};
+                            auto const index{this->pop()};
+                            auto const param_count{static_cast<::std::size_t>(type.parameter_end - type.parameter_begin)};
+                            if(this->malformed || this->underflows(param_count)) [[unlikely]] { return false; }
+                            auto const base{this->operands.size() - param_count};
+                            this->materialize(base);
+                            this->emit(&handlers::call_indirect);
+                            this->emit_index(this->type_ids.index_unchecked(type_idx));
+                            this->emit_index(index);
+                            this->emit_index(this->own_slot(base));
+                            this->reset_operands(base, static_cast<::std::size_t>(type.result_end - type.result_begin));
+                            break;
+                        }
+
+                        // Parametric
+                        case op_basic::drop:
+                        {
+                            if(this->unreachable) { break; }
+                            this->pop();
+                            break;
+                        }
+                        case op_basic::select:
+                        {
+                            this->simple(&handlers::select, 3uz);
+                            break;
+                        }
+
+                        // Variable
+                        case op_basic::local_get: [[fallthrough]];
+                        case op_basic::local_set: [[fallthrough]];
+                        case op_basic::local_tee:
+                        {
+                            ::std::size_t local_idx;
+                            if(!reader.read_u32(local_idx) || local_idx >= this->func.local_count) [[unlikely]] { return false; }
+                            if(this->unreachable) { break; }
+
+                            auto const op{static_cast<op_basic>(opcode)};
+                            if(op == op_basic::local_get) { this->push(local_idx); }
+                            else
+                            {
+                                this->set_local(local_idx, op == op_basic::local_tee);
+                            }
+                            break;
+                        }
+                        case op_basic::global_get: [[fallthrough]];
+                        case op_basic::global_set:
+                        {
+                            ::std::size_t global_idx;
+                            if(!reader.read_u32(global_idx) || global_idx >= this->mod.global_types.size()) [[unlikely]] { return false; }
+                            if(this->unreachable) { break; }
+
+                            if(static_cast<op_basic>(opcode) == op_basic::global_get) { this->produce(global_get_variants, 0uz); }
+                            else
+                            {
+                                this->consume(global_set_variants, 1uz);
+                            }
+                            this->emit_index(global_idx);
+                            break;
+                        }
+
+                        // Memory
+                        case op_basic::i32_load:
+                        {
+                            if(!this->load<wasm_u32, wasm_u32>(reader)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::i64_load:
+                        {
+                            if(!this->load<wasm_u64, wasm_u64>(reader)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::f32_load:
+                        {
+                            if(!this->load<wasm_u32, wasm_u32>(reader)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::f64_load:
+                        {
+                            if(!this->load<wasm_u64, wasm_u64>(reader)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::i32_load8_s:
+                        {
+                            if(!this->load<wasm_i8, wasm_u32>(reader)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::i32_load8_u:
+                        {
+                            if(!this->load<wasm_u8, wasm_u32>(reader)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::i32_load16_s:
+                        {
+                            if(!this->load<wasm_i16, wasm_u32>(reader)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::i32_load16_u:
+                        {
+                            if(!this->load<wasm_u16, wasm_u32>(reader)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::i64_load8_s:
+                        {
+                            if(!this->load<wasm_i8, wasm_u64>(reader)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::i64_load8_u:
+                        {
+                            if(!this->load<wasm_u8, wasm_u64>(reader)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::i64_load16_s:
+                        {
+                            if(!this->load<wasm_i16, wasm_u64>(reader)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::i64_load16_u:
+                        {
+                            if(!this->load<wasm_u16, wasm_u64>(reader)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::i64_load32_s:
+                        {
+                            if(!this->load<wasm_i32, wasm_u64>(reader)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::i64_load32_u:
+                        {
+                            if(!this->load<wasm_u32, wasm_u64>(reader)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::i32_store: [[fallthrough]];
+                        case op_basic::f32_store: [[fallthrough]];
+                        case op_basic::i64_store32:
+                        {
+                            if(!this->store<wasm_u32>(reader)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::i64_store: [[fallthrough]];
+                        case op_basic::f64_store:
+                        {
+                            if(!this->store<wasm_u64>(reader)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::i32_store8: [[fallthrough]];
+                        case op_basic::i64_store8:
+                        {
+                            if(!this->store<wasm_u8>(reader)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::i32_store16: [[fallthrough]];
+                        case op_basic::i64_store16:
+                        {
+                            if(!this->store<wasm_u16>(reader)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::memory_size: [[fallthrough]];
+                        case op_basic::memory_grow:
+                        {
+                            ::std::uint_least8_t memory_idx;
+                            if(!reader.read_byte(memory_idx)) [[unlikely]] { return false; }
+                            if(static_cast<op_basic>(opcode) == op_basic::memory_size) { this->simple(&handlers::memory_size, 0uz); }
+                            else
+                            {
+                                this->simple(&handlers::memory_grow, 1uz);
+                            }
+                            break;
+                        }
+
+                        // Numeric
+                        case op_basic::i32_const:
+                        {
+                            ::std::uint_least64_t v;
+                            if(!reader.read_leb<32u, true>(v)) [[unlikely]] { return false; }
+                            if(this->unreachable) { break; }
+                            this->produce(const_variants, 0uz);
+                            this->emit_imm(v & 0xFFFF'FFFFu);
+                            break;
+                        }
+                        case op_basic::i64_const:
+                        {
+                            ::std::uint_least64_t v;
+                            if(!reader.read_leb<64u, true>(v)) [[unlikely]] { return false; }
+                            if(this->unreachable) { break; }
+                            this->produce(const_variants, 0uz);
+                            this->emit_imm(v);
+                            break;
+                        }
+                        case op_basic::f32_const:
+                        {
+                            ::std::uint_least64_t v;
+                            if(!reader.read_fixed<4u>(v)) [[unlikely]] { return false; }
+                            if(this->unreachable) { break; }
+                            this->produce(const_variants, 0uz);
+                            this->emit_imm(v);
+                            break;
+                        }
+                        case op_basic::f64_const:
+                        {
+                            ::std::uint_least64_t v;
+                            if(!reader.read_fixed<8u>(v)) [[unlikely]] { return false; }
+                            if(this->unreachable) { break; }
+                            this->produce(const_variants, 0uz);
+                            this->emit_imm(v);
+                            break;
+                        }
+
+                            // clang-format off
+#define UWVM_INT_UNARY(opname, type, op)                                                                                                                       \
+    case op_basic::opname: this->simple(unary_variants<type, numeric::op>, 1uz); break
+#define UWVM_INT_BINARY(opname, type, op)                                                                                                                      \
+    case op_basic::opname: this->binary<type, numeric::op, op_basic::opname>(); break
+                            // clang-format on
+
+                            UWVM_INT_UNARY(i32_eqz, wasm_u32, eqz);
+                            UWVM_INT_BINARY(i32_eq, wasm_u32, eq);
+                            UWVM_INT_BINARY(i32_ne, wasm_u32, ne);
+                            UWVM_INT_BINARY(i32_lt_s, wasm_u32, lt_s);
+                            UWVM_INT_BINARY(i32_lt_u, wasm_u32, lt);
+                            UWVM_INT_BINARY(i32_gt_s, wasm_u32, gt_s);
+                            UWVM_INT_BINARY(i32_gt_u, wasm_u32, gt);
+                            UWVM_INT_BINARY(i32_le_s, wasm_u32, le_s);
+                            UWVM_INT_BINARY(i32_le_u, wasm_u32, le);
+                            UWVM_INT_BINARY(i32_ge_s, wasm_u32, ge_s);
+                            UWVM_INT_BINARY(i32_ge_u, wasm_u32, ge);
+
+                            UWVM_INT_UNARY(i64_eqz, wasm_u64, eqz);
+                            UWVM_INT_BINARY(i64_eq, wasm_u64, eq);
+                            UWVM_INT_BINARY(i64_ne, wasm_u64, ne);
+                            UWVM_INT_BINARY(i64_lt_s, wasm_u64, lt_s);
+                            UWVM_INT_BINARY(i64_lt_u, wasm_u64, lt);
+                            UWVM_INT_BINARY(i64_gt_s, wasm_u64, gt_s);
+                            UWVM_INT_BINARY(i64_gt_u, wasm_u64, gt);
+                            UWVM_INT_BINARY(i64_le_s, wasm_u64, le_s);
+                            UWVM_INT_BINARY(i64_le_u, wasm_u64, le);
+                            UWVM_INT_BINARY(i64_ge_s, wasm_u64, ge_s);
+                            UWVM_INT_BINARY(i64_ge_u, wasm_u64, ge);
+
+                            UWVM_INT_BINARY(f32_eq, wasm_f32, eq);
+                            UWVM_INT_BINARY(f32_ne, wasm_f32, ne);
+                            UWVM_INT_BINARY(f32_lt, wasm_f32, lt);
+                            UWVM_INT_BINARY(f32_gt, wasm_f32, gt);
+                            UWVM_INT_BINARY(f32_le, wasm_f32, le);
+                            UWVM_INT_BINARY(f32_ge, wasm_f32, ge);
+
+                            UWVM_INT_BINARY(f64_eq, wasm_f64, eq);
+                            UWVM_INT_BINARY(f64_ne, wasm_f64, ne);
+                            UWVM_INT_BINARY(f64_lt, wasm_f64, lt);
+                            UWVM_INT_BINARY(f64_gt, wasm_f64, gt);
+                            UWVM_INT_BINARY(f64_le, wasm_f64, le);
+                            UWVM_INT_BINARY(f64_ge, wasm_f64, ge);
+
+                            UWVM_INT_UNARY(i32_clz, wasm_u32, clz);
+                            UWVM_INT_UNARY(i32_ctz, wasm_u32, ctz);
+                            UWVM_INT_UNARY(i32_popcnt, wasm_u32, popcnt);
+                            UWVM_INT_BINARY(i32_add, wasm_u32, add);
+                            UWVM_INT_BINARY(i32_sub, wasm_u32, sub);
+                            UWVM_INT_BINARY(i32_mul, wasm_u32, mul);
+                            UWVM_INT_BINARY(i32_and, wasm_u32, bit_and);
+                            UWVM_INT_BINARY(i32_or, wasm_u32, bit_or);
+                            UWVM_INT_BINARY(i32_xor, wasm_u32, bit_xor);
+                            UWVM_INT_BINARY(i32_shl, wasm_u32, shl);
+                            UWVM_INT_BINARY(i32_shr_s, wasm_u32, shr_s);
+                            UWVM_INT_BINARY(i32_shr_u, wasm_u32, shr_u);
+                            UWVM_INT_BINARY(i32_rotl, wasm_u32, rotl);
+                            UWVM_INT_BINARY(i32_rotr, wasm_u32, rotr);
+
+                            UWVM_INT_UNARY(i64_clz, wasm_u64, clz);
+                            UWVM_INT_UNARY(i64_ctz, wasm_u64, ctz);
+                            UWVM_INT_UNARY(i64_popcnt, wasm_u64, popcnt);
+                            UWVM_INT_BINARY(i64_add, wasm_u64, add);
+                            UWVM_INT_BINARY(i64_sub, wasm_u64, sub);
+                            UWVM_INT_BINARY(i64_mul, wasm_u64, mul);
+                            UWVM_INT_BINARY(i64_and, wasm_u64, bit_and);
+                            UWVM_INT_BINARY(i64_or, wasm_u64, bit_or);
+                            UWVM_INT_BINARY(i64_xor, wasm_u64, bit_xor);
+                            UWVM_INT_BINARY(i64_shl, wasm_u64, shl);
+                            UWVM_INT_BINARY(i64_shr_s, wasm_u64, shr_s);
+                            UWVM_INT_BINARY(i64_shr_u, wasm_u64, shr_u);
+                            UWVM_INT_BINARY(i64_rotl, wasm_u64, rotl);
+                            UWVM_INT_BINARY(i64_rotr, wasm_u64, rotr);
+
+                            UWVM_INT_UNARY(f32_abs, wasm_f32, fabs);
+                            UWVM_INT_UNARY(f32_neg, wasm_f32, fneg);
+                            UWVM_INT_UNARY(f32_ceil, wasm_f32, fceil);
+                            UWVM_INT_UNARY(f32_floor, wasm_f32, ffloor);
+                            UWVM_INT_UNARY(f32_trunc, wasm_f32, ftrunc);
+                            UWVM_INT_UNARY(f32_nearest, wasm_f32, fnearest);
+                            UWVM_INT_UNARY(f32_sqrt, wasm_f32, fsqrt);
+                            UWVM_INT_BINARY(f32_add, wasm_f32, add);
+                            UWVM_INT_BINARY(f32_sub, wasm_f32, sub);
+                            UWVM_INT_BINARY(f32_mul, wasm_f32, mul);
+                            UWVM_INT_BINARY(f32_div, wasm_f32, fdiv);
+                            UWVM_INT_BINARY(f32_min, wasm_f32, fmin);
+                            UWVM_INT_BINARY(f32_max, wasm_f32, fmax);
+                            UWVM_INT_BINARY(f32_copysign, wasm_f32, fcopysign);
+
+                            UWVM_INT_UNARY(f64_abs, wasm_f64, fabs);
+                            UWVM_INT_UNARY(f64_neg, wasm_f64, fneg);
+                            UWVM_INT_UNARY(f64_ceil, wasm_f64, fceil);
+                            UWVM_INT_UNARY(f64_floor, wasm_f64, ffloor);
+                            UWVM_INT_UNARY(f64_trunc, wasm_f64, ftrunc);
+                            UWVM_INT_UNARY(f64_nearest, wasm_f64, fnearest);
+                            UWVM_INT_UNARY(f64_sqrt, wasm_f64, fsqrt);
+                            UWVM_INT_BINARY(f64_add, wasm_f64, add);
+                            UWVM_INT_BINARY(f64_sub, wasm_f64, sub);
+                            UWVM_INT_BINARY(f64_mul, wasm_f64, mul);
+                            UWVM_INT_BINARY(f64_div, wasm_f64, fdiv);
+                            UWVM_INT_BINARY(f64_min, wasm_f64, fmin);
+                            UWVM_INT_BINARY(f64_max, wasm_f64, fmax);
+                            UWVM_INT_BINARY(f64_copysign, wasm_f64, fcopysign);
+
+                            UWVM_INT_UNARY(i32_wrap_i64, wasm_u64, convert<wasm_u32>);
+                            UWVM_INT_UNARY(i64_extend_i32_s, wasm_i32, convert<wasm_i64>);
+                            UWVM_INT_UNARY(i64_extend_i32_u, wasm_u32, convert<wasm_u64>);
+                            UWVM_INT_UNARY(f32_convert_i32_s, wasm_i32, convert<wasm_f32>);
+                            UWVM_INT_UNARY(f32_convert_i32_u, wasm_u32, convert<wasm_f32>);
+                            UWVM_INT_UNARY(f32_convert_i64_s, wasm_i64, convert<wasm_f32>);
+                            UWVM_INT_UNARY(f32_convert_i64_u, wasm_u64, convert<wasm_f32>);
+                            UWVM_INT_UNARY(f32_demote_f64, wasm_f64, convert<wasm_f32>);
+                            UWVM_INT_UNARY(f64_convert_i32_s, wasm_i32, convert<wasm_f64>);
+                            UWVM_INT_UNARY(f64_convert_i32_u, wasm_u32, convert<wasm_f64>);
+                            UWVM_INT_UNARY(f64_convert_i64_s, wasm_i64, convert<wasm_f64>);
+                            UWVM_INT_UNARY(f64_convert_i64_u, wasm_u64, convert<wasm_f64>);
+                            UWVM_INT_UNARY(f64_promote_f32, wasm_f32, convert<wasm_f64>);
+
+#undef UWVM_INT_UNARY
+#undef UWVM_INT_BINARY
+
+                        case op_basic::i32_div_s:
+                        {
+                            this->simple(divide_variants<wasm_u32, true, false>, 2uz);
+                            break;
+                        }
+                        case op_basic::i32_div_u:
+                        {
+                            this->simple(divide_variants<wasm_u32, false, false>, 2uz);
+                            break;
+                        }
+                        case op_basic::i32_rem_s:
+                        {
+                            this->simple(divide_variants<wasm_u32, true, true>, 2uz);
+                            break;
+                        }
+                        case op_basic::i32_rem_u:
+                        {
+                            this->simple(divide_variants<wasm_u32, false, true>, 2uz);
+                            break;
+                        }
+                        case op_basic::i64_div_s:
+                        {
+                            this->simple(divide_variants<wasm_u64, true, false>, 2uz);
+                            break;
+                        }
+                        case op_basic::i64_div_u:
+                        {
+                            this->simple(divide_variants<wasm_u64, false, false>, 2uz);
+                            break;
+                        }
+                        case op_basic::i64_rem_s:
+                        {
+                            this->simple(divide_variants<wasm_u64, true, true>, 2uz);
+                            break;
+                        }
+                        case op_basic::i64_rem_u:
+                        {
+                            this->simple(divide_variants<wasm_u64, false, true>, 2uz);
+                            break;
+                        }
+
+                        case op_basic::i32_trunc_f32_s:
+                        {
+                            this->simple(&handlers::trunc<wasm_f32, wasm_i32>, 1uz);
+                            break;
+                        }
+                        case op_basic::i32_trunc_f32_u:
+                        {
+                            this->simple(&handlers::trunc<wasm_f32, wasm_u32>, 1uz);
+                            break;
+                        }
+                        case op_basic::i32_trunc_f64_s:
+                        {
+                            this->simple(&handlers::trunc<wasm_f64, wasm_i32>, 1uz);
+                            break;
+                        }
+                        case op_basic::i32_trunc_f64_u:
+                        {
+                            this->simple(&handlers::trunc<wasm_f64, wasm_u32>, 1uz);
+                            break;
+                        }
+                        case op_basic::i64_trunc_f32_s:
+                        {
+                            this->simple(&handlers::trunc<wasm_f32, wasm_i64>, 1uz);
+                            break;
+                        }
+                        case op_basic::i64_trunc_f32_u:
+                        {
+                            this->simple(&handlers::trunc<wasm_f32, wasm_u64>, 1uz);
+                            break;
+                        }
+                        case op_basic::i64_trunc_f64_s:
+                        {
+                            this->simple(&handlers::trunc<wasm_f64, wasm_i64>, 1uz);
+                            break;
+                        }
+                        case op_basic::i64_trunc_f64_u:
+                        {
+                            this->simple(&handlers::trunc<wasm_f64, wasm_u64>, 1uz);
+                            break;
+                        }
+
+                        // The slot already holds the bits
+                        case op_basic::i32_reinterpret_f32: [[fallthrough]];
+                        case op_basic::i64_reinterpret_f64: [[fallthrough]];
+                        case op_basic::f32_reinterpret_i32: [[fallthrough]];
+                        case op_basic::f64_reinterpret_i64:
+                        {
+                            break;
+                        }
+
+                        [[unlikely]] default:
+                        {
+                            // Not a wasm1 instruction
+                            return false;
+                        }
+                    }
+
+                    if(this->malformed) [[unlikely]] { return false; }
+                }
+
+                if(reader.curr != reader.end) [[unlikely]] { return false; }
+
+                // Branch targets become addresses, the code does not move anymore
+                auto const code_begin{this->code.cbegin()};
+                for(auto const pos: this->target_positions)
+                {
+                    auto& op{this->code.index_unchecked(pos)};
+                    op.target = code_begin + op.index;
+                }
+
+                this->func.frame_size = this->own_slot(this->max_height);
+                this->func.code = ::std::move(this->code);
+
+#ifdef UWVM_INT_PROFILE
+                ::std::lock_guard guard{fusion_profile.mutex};
+                for(auto const key: this->profile_pairs) { ++fusion_profile.pairs[key]; }
+                for(auto const key: this->profile_triples) { ++fusion_profile.triples[key]; }
+#endif
+
+                return true;
+            }
+        };
+
+        inline constexpr bool is_same_function_type(function_type_t const& a, function_type_t const& b) noexcept
+        {
+            auto const same_range{[](auto a_begin, auto a_end, auto b_begin, auto b_end) constexpr noexcept -> bool
+                                  {
+                                      if(a_end - a_begin != b_end - b_begin) { return false; }
+                                      for(; a_begin != a_end; ++a_begin, ++b_begin)
+                                      {
+                                          if(*a_begin != *b_begin) { return false; }
+                                      }
+                                      return true;
+                                  }};
+            return same_range(a.parameter_begin, a.parameter_end, b.parameter_begin, b.parameter_end) &&
+                   same_range(a.result_begin, a.result_end, b.result_begin, b.result_end);
+        }
+
+        /// @brief  FNV-1a of the parameter count and the value types, structurally equal types hash equally
+        inline constexpr ::std::size_t hash_function_type(function_type_t const& type) noexcept
+        {
+            ::std::uint_least64_t hash{0xcbf2'9ce4'8422'2325u};
+            auto const update{[&hash](::std::uint_least64_t value) constexpr noexcept { hash = (hash ^ value) * 0x100'0000'01b3u; }};
+
+            update(static_cast<::std::uint_least64_t>(type.parameter_end - type.parameter_begin));
+            for(auto curr{type.parameter_begin}; curr != type.parameter_end; ++curr) { update(static_cast<::std::uint_least64_t>(*curr)); }
+            for(auto curr{type.result_begin}; curr != type.result_end; ++curr) { update(static_cast<::std::uint_least64_t>(*curr)); }
+            return static_cast<::std::size_t>(hash);
+        }
+
+        /// @brief      Id of each type of the module: the smallest index of a structurally equal type, call_indirect compares ids
+        /// @details    The types are looked up in an open addressing table of type indices at most half full, the table is only probed
+        ///             further on a hash collision.
+        inline ::fast_io::vector<::std::size_t> get_type_ids(module_t const& mod)
+        {
+            auto const type_count{mod.types.size()};
+
+            ::std::size_t capacity{16uz};
+            while(capacity < type_count * 2uz) { capacity *= 2uz; }
+            ::fast_io::vector<::std::size_t> buckets(capacity, no_position);
+            auto const mask{capacity - 1uz};
+
+            ::fast_io::vector<::std::size_t> type_ids{};
+            type_ids.reserve(type_count);
+            for(::std::size_t i{}; i != type_count; ++i)
+            {
+                auto const& type{mod.types.index_unchecked(i)};
+                auto pos{hash_function_type(type) & mask};
+                for(;; pos = (pos + 1uz) & mask)
+                {
+                    auto& bucket{buckets.index_unchecked(pos)};
+                    if(bucket == no_position)
+                    {
+                        bucket = i;
+                        type_ids.push_back(i);
+                        break;
+                    }
+                    if(is_same_function_type(type, mod.types.index_unchecked(bucket)))
+                    {
+                        type_ids.push_back(bucket);
+                        break;
+                    }
+                }
+            }
+            return type_ids;
+        }
+    }  // namespace details
+
+    /// @brief      Lower every function of the module that is not imported
+    /// @details    Fills the fields of function_t that compile_module owns. Must be called after all functions of the module are in `mod.functions`.
+    /// @return     false if a body is malformed or uses an instruction outside of wasm1, the module must then run on another engine
+    inline bool compile_module(module_t& mod)
+    {
+        auto const type_ids{details::get_type_ids(mod)};
+
+        // Signatures first, a call needs the counts of its callee
+        for(auto& func: mod.functions)
+        {
+            if(func.type_index >= mod.types.size()) [[unlikely]] { return false; }
+            auto const& type{mod.types.index_unchecked(func.type_index)};
+
+            func.type_id = type_ids.index_unchecked(func.type_index);
+            func.param_count = static_cast<::std::size_t>(type.parameter_end - type.parameter_begin);
+            func.result_count = static_cast<::std::size_t>(type.result_end - type.result_begin);
+            func.local_count = func.param_count;
+            if(!func.is_host()) { func.local_count += static_cast<::std::size_t>(func.body.all_local_count); }
+            func.frame_size = func.param_count > func.result_count ? func.param_count : func.result_count;
+        }
+
+        for(auto& func: mod.functions)
+        {
+            if(func.is_host()) { continue; }
+
+            details::function_lowering_t lowering{.mod = mod, .type_ids = type_ids, .func = func};
+            if(!lowering.lower()) [[unlikely]] { return false; }
+        }
+
+        return true;
+    }
+}  // namespace uwvm2::non_img::uwvm_int
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
@@ -0,0 +1,204 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.parser.wasm.standard.wasm1.opcode;
+#else
+// std
+# include <cstddef>
+# include <cstdint>
+# include <array>
+# ifdef UWVM_INT_PROFILE
+#  include <mutex>
+#  include <unordered_map>
+#  include <algorithm>
+#  include <utility>
+# endif
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# include <fast_io_dsal/vector.h>
+# include <uwvm2/parser/wasm/standard/wasm1/opcode/impl.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::non_img::uwvm_int
+{
+    namespace details
+    {
+        using op_basic = ::uwvm2::parser::wasm::standard::wasm1::opcode::op_basic;
+    }  // namespace details
+
+    /// @brief      A pair of adjacent instructions that is lowered into one handler
+    /// @details    Supported shapes: a const followed by a binary operator of its type (the constant becomes an immediate), a compare followed by
+    ///             br_if or if (the branch evaluates the compare), i32.eqz followed by br_if or if (the branch tests the operand inverted).
+    ///             `local.get` followed by an operator and `local.get` followed by a load need no rule, the register form reads locals in place.
+    struct fusion_rule_t
+    {
+        details::op_basic first{};
+        details::op_basic second{};
+    };
+
+    /// @brief      Pairs fused by the lowering
+    /// @details    The default covers the loop conditions and the address arithmetic of compiled C and C++. Only the handlers of the listed pairs
+    ///             are instantiated. To tune the table for a workload, build with UWVM_INT_PROFILE (xmake option uwvm-int-profile), compile the
+    ///             modules of the workload and paste the pairs printed by dump_fusion_profile that have a supported shape.
+    inline constexpr fusion_rule_t fusion_rules[]{
+        {.first = details::op_basic::i32_const, .second = details::op_basic::i32_add},
+        {.first = details::op_basic::i32_const, .second = details::op_basic::i32_and},
+        {.first = details::op_basic::i32_const, .second = details::op_basic::i32_sub},
+        {.first = details::op_basic::i32_const, .second = details::op_basic::i32_shl},
+        {.first = details::op_basic::i32_const, .second = details::op_basic::i32_shr_u},
+        {.first = details::op_basic::i32_const, .second = details::op_basic::i32_shr_s},
+        {.first = details::op_basic::i32_const, .second = details::op_basic::i32_or},
+        {.first = details::op_basic::i32_const, .second = details::op_basic::i32_xor},
+        {.first = details::op_basic::i32_const, .second = details::op_basic::i32_mul},
+        {.first = details::op_basic::i32_const, .second = details::op_basic::i32_eq},
+        {.first = details::op_basic::i32_const, .second = details::op_basic::i32_ne},
+        {.first = details::op_basic::i32_const, .second = details::op_basic::i32_lt_s},
+        {.first = details::op_basic::i32_const, .second = details::op_basic::i32_lt_u},
+        {.first = details::op_basic::i32_const, .second = details::op_basic::i32_gt_s},
+        {.first = details::op_basic::i32_const, .second = details::op_basic::i32_gt_u},
+        {.first = details::op_basic::i32_const, .second = details::op_basic::i32_ge_s},
+        {.first = details::op_basic::i32_const, .second = details::op_basic::i32_le_u},
+        {.first = details::op_basic::i64_const, .second = details::op_basic::i64_add},
+        {.first = details::op_basic::i64_const, .second = details::op_basic::i64_and},
+        {.first = details::op_basic::i64_const, .second = details::op_basic::i64_shl},
+        {.first = details::op_basic::i64_const, .second = details::op_basic::i64_shr_u},
+
+        {.first = details::op_basic::i32_eqz, .second = details::op_basic::br_if},
+        {.first = details::op_basic::i32_eqz, .second = details::op_basic::if_},
+        {.first = details::op_basic::i32_eq, .second = details::op_basic::br_if},
+        {.first = details::op_basic::i32_eq, .second = details::op_basic::if_},
+        {.first = details::op_basic::i32_ne, .second = details::op_basic::br_if},
+        {.first = details::op_basic::i32_ne, .second = details::op_basic::if_},
+        {.first = details::op_basic::i32_lt_s, .second = details::op_basic::br_if},
+        {.first = details::op_basic::i32_lt_s, .second = details::op_basic::if_},
+        {.first = details::op_basic::i32_lt_u, .second = details::op_basic::br_if},
+        {.first = details::op_basic::i32_lt_u, .second = details::op_basic::if_},
+        {.first = details::op_basic::i32_gt_s, .second = details::op_basic::br_if},
+        {.first = details::op_basic::i32_gt_s, .second = details::op_basic::if_},
+        {.first = details::op_basic::i32_gt_u, .second = details::op_basic::br_if},
+        {.first = details::op_basic::i32_gt_u, .second = details::op_basic::if_},
+        {.first = details::op_basic::i32_ge_s, .second = details::op_basic::br_if},
+        {.first = details::op_basic::i32_ge_s, .second = details::op_basic::if_},
+        {.first = details::op_basic::i32_ge_u, .second = details::op_basic::br_if},
+        {.first = details::op_basic::i32_le_s, .second = details::op_basic::br_if},
+        {.first = details::op_basic::i32_le_u, .second = details::op_basic::br_if},
+        {.first = details::op_basic::i64_eq, .second = details::op_basic::br_if},
+        {.first = details::op_basic::i64_ne, .second = details::op_basic::br_if},
+        {.first = details::op_basic::i64_lt_u, .second = details::op_basic::br_if},
+    };
+
+    namespace details
+    {
+        /// @brief  One bit per (first, second) opcode pair
+        using fusion_matrix_t = ::std::array<::std::uint_least64_t, 256uz * 256uz / 64uz>;
+
+        inline consteval fusion_matrix_t make_fusion_matrix() noexcept
+        {
+            fusion_matrix_t matrix{};
+            for(auto const rule: fusion_rules)
+            {
+                auto const bit{static_cast<::std::size_t>(rule.first) * 256uz + static_cast<::std::size_t>(rule.second)};
+                matrix[bit / 64uz] |= ::std::uint_least64_t{1u} << (bit % 64uz);
+            }
+            return matrix;
+        }
+
+        inline constexpr fusion_matrix_t fusion_matrix{make_fusion_matrix()};
+    }  // namespace details
+
+    inline constexpr bool is_fused(details::op_basic first, details::op_basic second) noexcept
+    {
+        auto const bit{static_cast<::std::size_t>(first) * 256uz + static_cast<::std::size_t>(second)};
+        return ((details::fusion_matrix[bit / 64uz] >> (bit % 64uz)) & 1u) != 0u;
+    }
+
+#ifdef UWVM_INT_PROFILE
+    /// @brief      Static counts of adjacent opcodes in reachable code, keys are the opcodes packed into bytes (first in the highest byte)
+    /// @details    Sequences do not cross block, loop, if, else and end, a fused pair cannot span a label.
+    struct fusion_profile_t
+    {
+        ::std::mutex mutex{};
+        ::std::unordered_map<::std::uint_least32_t, ::std::uint_least64_t> pairs{};
+        ::std::unordered_map<::std::uint_least32_t, ::std::uint_least64_t> triples{};
+    };
+
+    inline fusion_profile_t fusion_profile{};
+
+    namespace details
+    {
+        inline ::fast_io::vector<::std::pair<::std::uint_least32_t, ::std::uint_least64_t>>
+            sort_fusion_counts(::std::unordered_map<::std::uint_least32_t, ::std::uint_least64_t> const& counts)
+        {
+            ::fast_io::vector<::std::pair<::std::uint_least32_t, ::std::uint_least64_t>> sorted{};
+            sorted.reserve(counts.size());
+            for(auto const& i: counts) { sorted.push_back(i); }
+            ::std::sort(sorted.begin(), sorted.end(), [](auto const& a, auto const& b) constexpr noexcept { return a.second > b.second; });
+            return sorted;
+        }
+    }  // namespace details
+
+    /// @brief  Print the pair counts in the syntax of fusion_rules and the triple counts as comments, the hottest first
+    template <typename Stream>
+    inline void dump_fusion_profile(Stream&& stream)
+    {
+        ::std::lock_guard guard{fusion_profile.mutex};
+
+        for(auto const& [key, count]: details::sort_fusion_counts(fusion_profile.pairs))
+        {
+            ::fast_io::io::perrln(::std::forward<Stream>(stream),
+                                  u8"        {.first = details::op_basic{",
+                                  ::fast_io::mnp::hex0x<true>(static_cast<::std::uint_least8_t>(key >> 8u)),
+                                  u8"}, .second = details::op_basic{",
+                                  ::fast_io::mnp::hex0x<true>(static_cast<::std::uint_least8_t>(key)),
+                                  u8"}},  // ",
+                                  count);
+        }
+
+        for(auto const& [key, count]: details::sort_fusion_counts(fusion_profile.triples))
+        {
+            ::fast_io::io::perrln(::std::forward<Stream>(stream),
+                                  u8"        // ",
+                                  ::fast_io::mnp::hex0x<true>(static_cast<::std::uint_least8_t>(key >> 16u)),
+                                  u8" ",
+                                  ::fast_io::mnp::hex0x<true>(static_cast<::std::uint_least8_t>(key >> 8u)),
+                                  u8" ",
+                                  ::fast_io::mnp::hex0x<true>(static_cast<::std::uint_least8_t>(key)),
+                                  u8": ",
+                                  count);
+        }
+    }
+#endif
+}  // namespace uwvm2::non_img::uwvm_int
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
@@ -0,0 +1,949 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.parser.wasm.standard.wasm1.type;
+import uwvm2.memory.linear;
+import :runtime;
+#else
+// std
+# include <cstddef>
+# include <cstdint>
+# include <cstring>
+# include <cmath>
+# include <memory>
+# include <atomic>
+# include <bit>
+# include <limits>
+# include <type_traits>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
+# include <uwvm2/memory/linear/impl.h>
+# include "runtime.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::non_img::uwvm_int
+{
+    namespace details
+    {
+        using wasm_i32 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_i32;
+        using wasm_u32 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32;
+        using wasm_i64 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_i64;
+        using wasm_u64 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u64;
+        using wasm_f32 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_f32;
+        using wasm_f64 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_f64;
+
+        template <typename T>
+        UWVM_ALWAYS_INLINE inline constexpr T get_slot(slot_t slot) noexcept
+        {
+            if constexpr(::std::same_as<T, wasm_u32>) { return static_cast<wasm_u32>(slot); }
+            else if constexpr(::std::same_as<T, wasm_i32>) { return static_cast<wasm_i32>(static_cast<wasm_u32>(slot)); }
+            else if constexpr(::std::same_as<T, wasm_u64>) { return slot; }
+            else if constexpr(::std::same_as<T, wasm_i64>) { return static_cast<wasm_i64>(slot); }
+            else if constexpr(::std::same_as<T, wasm_f32>) { return ::std::bit_cast<wasm_f32>(static_cast<wasm_u32>(slot)); }
+            else
+            {
+                static_assert(::std::same_as<T, wasm_f64>);
+                return ::std::bit_cast<wasm_f64>(slot);
+            }
+        }
+
+        /// @brief  i32 results (including comparisons) are stored zero extended, so that a slot written as i32 reads back the same as i64 bits
+        template <typename T>
+        UWVM_ALWAYS_INLINE inline constexpr slot_t to_slot(T v) noexcept
+        {
+            if constexpr(::std::same_as<T, bool>) { return v ? 1u : 0u; }
+            else if constexpr(::std::same_as<T, wasm_u32> || ::std::same_as<T, wasm_i32>) { return static_cast<wasm_u32>(v); }
+            else if constexpr(::std::same_as<T, wasm_u64> || ::std::same_as<T, wasm_i64>) { return static_cast<wasm_u64>(v); }
+            else if constexpr(::std::same_as<T, wasm_f32>) { return ::std::bit_cast<wasm_u32>(v); }
+            else
+            {
+                static_assert(::std::same_as<T, wasm_f64>);
+                return ::std::bit_cast<wasm_u64>(v);
+            }
+        }
+
+        template <typename T>
+        using bits_t = ::std::conditional_t<sizeof(T) == 4uz, wasm_u32, wasm_u64>;
+
+        /// @brief  <cmath> is called with float or double, the extended floating point types convert exactly
+        template <typename T>
+        using math_t = ::std::conditional_t<sizeof(T) == 4uz, float, double>;
+
+        template <typename T>
+        UWVM_ALWAYS_INLINE inline constexpr T sign_mask() noexcept
+        {
+            return static_cast<T>(static_cast<T>(1u) << (sizeof(T) * 8u - 1u));
+        }
+
+        template <typename T>
+        UWVM_ALWAYS_INLINE inline constexpr unsigned shift_mask() noexcept
+        {
+            return static_cast<unsigned>(sizeof(T) * 8u - 1u);
+        }
+
+        UWVM_GNU_COLD inline void raise_trap(context_t* ctx, trap_t trap) noexcept { ctx->trap = trap; }
+    }  // namespace details
+
+    /// @brief      Operations of the numeric instructions
+    /// @details    Integers are computed as unsigned (wrapping), signed instructions convert where the sign matters.
+    /// @see        WebAssembly Release 1.0 (2019-07-20) § 4.3
+    namespace numeric
+    {
+        // i32 and i64
+
+        struct add
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline constexpr T operator() (T a, T b) const noexcept
+            {
+                return static_cast<T>(a + b);
+            }
+        };
+
+        struct sub
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline constexpr T operator() (T a, T b) const noexcept
+            {
+                return static_cast<T>(a - b);
+            }
+        };
+
+        struct mul
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline constexpr T operator() (T a, T b) const noexcept
+            {
+                return static_cast<T>(a * b);
+            }
+        };
+
+        struct bit_and
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline constexpr T operator() (T a, T b) const noexcept
+            {
+                return static_cast<T>(a & b);
+            }
+        };
+
+        struct bit_or
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline constexpr T operator() (T a, T b) const noexcept
+            {
+                return static_cast<T>(a | b);
+            }
+        };
+
+        struct bit_xor
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline constexpr T operator() (T a, T b) const noexcept
+            {
+                return static_cast<T>(a ^ b);
+            }
+        };
+
+        struct shl
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline constexpr T operator() (T a, T b) const noexcept
+            {
+                return static_cast<T>(a << (b & details::shift_mask<T>()));
+            }
+        };
+
+        struct shr_s
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline constexpr T operator() (T a, T b) const noexcept
+            {
+                return static_cast<T>(static_cast<::std::make_signed_t<T>>(a) >> (b & details::shift_mask<T>()));
+            }
+        };
+
+        struct shr_u
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline constexpr T operator() (T a, T b) const noexcept
+            {
+                return static_cast<T>(a >> (b & details::shift_mask<T>()));
+            }
+        };
+
+        struct rotl
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline constexpr T operator() (T a, T b) const noexcept
+            {
+                return ::std::rotl(a, static_cast<int>(b & details::shift_mask<T>()));
+            }
+        };
+
+        struct rotr
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline constexpr T operator() (T a, T b) const noexcept
+            {
+                return ::std::rotr(a, static_cast<int>(b & details::shift_mask<T>()));
+            }
+        };
+
+        struct clz
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline constexpr T operator() (T a) const noexcept
+            {
+                return static_cast<T>(::std::countl_zero(a));
+            }
+        };
+
+        struct ctz
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline constexpr T operator() (T a) const noexcept
+            {
+                return static_cast<T>(::std::countr_zero(a));
+            }
+        };
+
+        struct popcnt
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline constexpr T operator() (T a) const noexcept
+            {
+                return static_cast<T>(::std::popcount(a));
+            }
+        };
+
+        struct eqz
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline constexpr bool operator() (T a) const noexcept
+            {
+                return a == static_cast<T>(0u);
+            }
+        };
+
+        struct lt_s
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline constexpr bool operator() (T a, T b) const noexcept
+            {
+                return static_cast<::std::make_signed_t<T>>(a) < static_cast<::std::make_signed_t<T>>(b);
+            }
+        };
+
+        struct gt_s
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline constexpr bool operator() (T a, T b) const noexcept
+            {
+                return static_cast<::std::make_signed_t<T>>(a) > static_cast<::std::make_signed_t<T>>(b);
+            }
+        };
+
+        struct le_s
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline constexpr bool operator() (T a, T b) const noexcept
+            {
+                return static_cast<::std::make_signed_t<T>>(a) <= static_cast<::std::make_signed_t<T>>(b);
+            }
+        };
+
+        struct ge_s
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline constexpr bool operator() (T a, T b) const noexcept
+            {
+                return static_cast<::std::make_signed_t<T>>(a) >= static_cast<::std::make_signed_t<T>>(b);
+            }
+        };
+
+        // integers (unsigned) and floats
+
+        struct eq
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline constexpr bool operator() (T a, T b) const noexcept
+            {
+                return a == b;
+            }
+        };
+
+        struct ne
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline constexpr bool operator() (T a, T b) const noexcept
+            {
+                return a != b;
+            }
+        };
+
+        struct lt
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline constexpr bool operator() (T a, T b) const noexcept
+            {
+                return a < b;
+            }
+        };
+
+        struct gt
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline constexpr bool operator() (T a, T b) const noexcept
+            {
+                return a > b;
+            }
+        };
+
+        struct le
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline constexpr bool operator() (T a, T b) const noexcept
+            {
+                return a <= b;
+            }
+        };
+
+        struct ge
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline constexpr bool operator() (T a, T b) const noexcept
+            {
+                return a >= b;
+            }
+        };
+
+        // f32 and f64
+
+        struct fdiv
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline constexpr T operator() (T a, T b) const noexcept
+            {
+                return a / b;
+            }
+        };
+
+        /// @brief  NaN if either operand is NaN, -0 is less than +0
+        struct fmin
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline constexpr T operator() (T a, T b) const noexcept
+            {
+                if(a != a || b != b) { return a + b; }
+                if(a == b) { return ::std::bit_cast<T>(static_cast<details::bits_t<T>>(::std::bit_cast<details::bits_t<T>>(a) | ::std::bit_cast<details::bits_t<T>>(b))); }
+                return a < b ? a : b;
+            }
+        };
+
+        struct fmax
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline constexpr T operator() (T a, T b) const noexcept
+            {
+                if(a != a || b != b) { return a + b; }
+                if(a == b) { return ::std::bit_cast<T>(static_cast<details::bits_t<T>>(::std::bit_cast<details::bits_t<T>>(a) & ::std::bit_cast<details::bits_t<T>>(b))); }
+                return a > b ? a : b;
+            }
+        };
+
+        /// @brief  abs, neg and copysign only change the sign bit, also of NaN
+        struct fabs
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline constexpr T operator() (T a) const noexcept
+            {
+                using bits = details::bits_t<T>;
+                return ::std::bit_cast<T>(static_cast<bits>(::std::bit_cast<bits>(a) & static_cast<bits>(~details::sign_mask<bits>())));
+            }
+        };
+
+        struct fneg
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline constexpr T operator() (T a) const noexcept
+            {
+                using bits = details::bits_t<T>;
+                return ::std::bit_cast<T>(static_cast<bits>(::std::bit_cast<bits>(a) ^ details::sign_mask<bits>()));
+            }
+        };
+
+        struct fcopysign
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline constexpr T operator() (T a, T b) const noexcept
+            {
+                using bits = details::bits_t<T>;
+                constexpr auto mask{details::sign_mask<bits>()};
+                return ::std::bit_cast<T>(static_cast<bits>((::std::bit_cast<bits>(a) & static_cast<bits>(~mask)) | (::std::bit_cast<bits>(b) & mask)));
+            }
+        };
+
+        struct fceil
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline T operator() (T a) const noexcept
+            {
+                return static_cast<T>(::std::ceil(static_cast<details::math_t<T>>(a)));
+            }
+        };
+
+        struct ffloor
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline T operator() (T a) const noexcept
+            {
+                return static_cast<T>(::std::floor(static_cast<details::math_t<T>>(a)));
+            }
+        };
+
+        struct ftrunc
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline T operator() (T a) const noexcept
+            {
+                return static_cast<T>(::std::trunc(static_cast<details::math_t<T>>(a)));
+            }
+        };
+
+        /// @brief  Round to nearest, ties to even (the default rounding mode)
+        struct fnearest
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline T operator() (T a) const noexcept
+            {
+                return static_cast<T>(::std::nearbyint(static_cast<details::math_t<T>>(a)));
+            }
+        };
+
+        struct fsqrt
+        {
+            template <typename T>
+            UWVM_ALWAYS_INLINE inline T operator() (T a) const noexcept
+            {
+                return static_cast<T>(::std::sqrt(static_cast<details::math_t<T>>(a)));
+            }
+        };
+
+        /// @brief  wrap, extend, convert, demote and promote, `From` is the operand type the instruction reads
+        template <typename To>
+        struct convert
+        {
+            template <typename From>
+            UWVM_ALWAYS_INLINE inline constexpr To operator() (From a) const noexcept
+            {
+                return static_cast<To>(a);
+            }
+        };
+    }  // namespace numeric
+
+    namespace details
+    {
+        /// @brief  Moves `n` slots down (dst <= src), used by branches and return
+        UWVM_ALWAYS_INLINE inline void copy_slots(slot_t* dst, slot_t const* src, ::std::size_t n) noexcept
+        {
+            if(dst == src) { return; }
+            for(::std::size_t i{}; i != n; ++i) { dst[i] = src[i]; }
+        }
+
+        /// @brief  Operand `N` (counted from 1) of an instruction whose operand `AccIn` is the result the previous instruction left in acc
+        template <unsigned AccIn, unsigned N>
+        UWVM_ALWAYS_INLINE inline constexpr slot_t read_operand(op_t op, slot_t const* fp, slot_t acc) noexcept
+        {
+            if constexpr(AccIn == N) { return acc; }
+            else
+            {
+                return fp[op.index];
+            }
+        }
+
+        /// @brief  The result goes to acc if the next instruction is its only reader, to its slot otherwise
+        template <bool AccOut>
+        UWVM_ALWAYS_INLINE inline constexpr void write_result(op_t dst, slot_t* fp, slot_t& acc, slot_t value) noexcept
+        {
+            if constexpr(AccOut) { acc = value; }
+            else
+            {
+                fp[dst.index] = value;
+            }
+        }
+
+        /// @brief  Count a call or a loop iteration of `func`, request the promotion when it becomes hot
+        inline void count_hotness(function_t const* func, tier_up_t const& tier_up) noexcept
+        {
+            ::std::atomic_ref hotness{func->hotness};
+            auto const curr{hotness.load(::std::memory_order_relaxed)};
+            // Already requested, the function stays interpreted until the tier installs its native code
+            if(curr >= tier_up.threshold) { return; }
+
+            // Not a read-modify-write: concurrent increments may be lost, which only delays the request
+            hotness.store(curr + 1u, ::std::memory_order_relaxed);
+            if(curr + 1u == tier_up.threshold) [[unlikely]] { tier_up.request(func, tier_up.tier_context); }
+        }
+    }  // namespace details
+
+    /// @brief      Instruction handlers
+    /// @details    Operands and results are frame offsets (locals first, then the operand stack slots), the lowering assigns them statically. Every
+    ///             handler reads all of its operands before it writes its result, so a result may overwrite an operand. A handler that continues
+    ///             ends with `UWVM_MUSTTAIL return ip->handler(ip, fp, ctx, acc);` after advancing ip over itself and its immediates.
+    ///             The accumulator `acc` caches a result between two adjacent instructions: a handler with `AccOut` leaves its result in acc
+    ///             instead of its slot, the next one reads its operand `AccIn` from acc (the immediate of that operand stays in place and is
+    ///             ignored). Instructions without these parameters pass acc through unchanged.
+    namespace handlers
+    {
+        // Control
+
+        UWVM_GNU_COLD inline void
+            unreachable([[maybe_unused]] op_t const* ip, [[maybe_unused]] slot_t* fp, context_t* ctx, [[maybe_unused]] slot_t acc) noexcept
+        {
+            details::raise_trap(ctx, trap_t::unreachable);
+        }
+
+        /// @brief  [handler][function], at the start of a loop when tier_up was enabled by compile_module: counts the iterations of the loop
+        inline void count_loop(op_t const* ip, slot_t* fp, context_t* ctx, slot_t acc) noexcept
+        {
+            // The tier may have been removed since
+            if(auto const& tier_up{ctx->module->tier_up}; tier_up.request != nullptr) { details::count_hotness(ip[1].function, tier_up); }
+            ip += 2;
+            UWVM_MUSTTAIL return ip->handler(ip, fp, ctx, acc);
+        }
+
+        /// @brief  [handler][target], the label values are already in place
+        inline void br(op_t const* ip, slot_t* fp, context_t* ctx, slot_t acc) noexcept
+        {
+            ip = ip[1].target;
+            UWVM_MUSTTAIL return ip->handler(ip, fp, ctx, acc);
+        }
+
+        /// @brief  [handler][target][arity][dst][src], moves the label values down to the height of the label
+        inline void br_copy(op_t const* ip, slot_t* fp, context_t* ctx, slot_t acc) noexcept
+        {
+            details::copy_slots(fp + ip[3].index, fp + ip[4].index, ip[2].index);
+            ip = ip[1].target;
+            UWVM_MUSTTAIL return ip->handler(ip, fp, ctx, acc);
+        }
+
+        /// @brief  [handler][target][condition]
+        inline void br_if(op_t const* ip, slot_t* fp, context_t* ctx, slot_t acc) noexcept
+        {
+            if(static_cast<details::wasm_u32>(fp[ip[2].index]) != 0u) { ip = ip[1].target; }
+            else
+            {
+                ip += 3;
+            }
+            UWVM_MUSTTAIL return ip->handler(ip, fp, ctx, acc);
+        }
+
+        /// @brief  [handler][target][condition][arity][dst][src]
+        inline void br_if_copy(op_t const* ip, slot_t* fp, context_t* ctx, slot_t acc) noexcept
+        {
+            if(static_cast<details::wasm_u32>(fp[ip[2].index]) != 0u)
+            {
+                details::copy_slots(fp + ip[4].index, fp + ip[5].index, ip[3].index);
+                ip = ip[1].target;
+            }
+            else
+            {
+                ip += 6;
+            }
+            UWVM_MUSTTAIL return ip->handler(ip, fp, ctx, acc);
+        }
+
+        /// @brief  `if`: [handler][target][condition], branches to the else branch (or after end) when the condition is zero
+        inline void br_unless(op_t const* ip, slot_t* fp, context_t* ctx, slot_t acc) noexcept
+        {
+            if(static_cast<details::wasm_u32>(fp[ip[2].index]) == 0u) { ip = ip[1].target; }
+            else
+            {
+                ip += 3;
+            }
+            UWVM_MUSTTAIL return ip->handler(ip, fp, ctx, acc);
+        }
+
+        /// @brief  [handler][index][label count n][arity][src][n + 1 entries of [target][dst]], the last entry is the default label
+        /// @details All labels of a br_table have the same arity.
+        inline void br_table(op_t const* ip, slot_t* fp, context_t* ctx, slot_t acc) noexcept
+        {
+            auto const label_count{ip[2].index};
+            auto idx{static_cast<::std::size_t>(static_cast<details::wasm_u32>(fp[ip[1].index]))};
+            if(idx > label_count) { idx = label_count; }
+
+            auto const entry{ip + 5uz + idx * 2uz};
+            details::copy_slots(fp + entry[1].index, fp + ip[4].index, ip[3].index);
+            ip = entry->target;
+            UWVM_MUSTTAIL return ip->handler(ip, fp, ctx, acc);
+        }
+
+        /// @brief  `return` and the end of the function: [handler][result count][src], the results are moved to the first slots of the frame
+        inline void return_(op_t const* ip, slot_t* fp, [[maybe_unused]] context_t* ctx, [[maybe_unused]] slot_t acc) noexcept
+        {
+            details::copy_slots(fp, fp + ip[2].index, ip[1].index);
+        }
+    }  // namespace handlers
+
+    namespace details
+    {
+        /// @brief      Run a function whose frame starts at `callee_fp` (the arguments are already there), the results are written to the first
+        ///             slots of the frame
+        /// @return     false if the function trapped (ctx->trap is set)
+        inline bool invoke_function(function_t const* callee, slot_t* callee_fp, context_t* ctx) noexcept
+        {
+            if(callee->is_host()) [[unlikely]]
+            {
+                if(auto const trap{callee->host.call(callee_fp, callee->host.host_context)}; trap != trap_t::none) [[unlikely]]
+                {
+                    raise_trap(ctx, trap);
+                    return false;
+                }
+                return true;
+            }
+
+            if(ctx->call_depth == ctx->max_call_depth || static_cast<::std::size_t>(ctx->stack_end - callee_fp) < callee->frame_size) [[unlikely]]
+            {
+                raise_trap(ctx, trap_t::call_stack_exhausted);
+                return false;
+            }
+
+            // Installed by another thread when a tier is enabled, acquire makes its code visible
+            if(auto const native{::std::atomic_ref{callee->native}.load(::std::memory_order_acquire)}; native != nullptr)
+            {
+                ++ctx->call_depth;
+                native(callee_fp, ctx);
+                --ctx->call_depth;
+                return ctx->trap == trap_t::none;
+            }
+
+            if(auto const& tier_up{ctx->module->tier_up}; tier_up.request != nullptr) { count_hotness(callee, tier_up); }
+
+            // Locals that are not parameters start as zero
+            for(auto curr{callee_fp + callee->param_count}, end{callee_fp + callee->local_count}; curr != end; ++curr) { *curr = 0u; }
+
+            ++ctx->call_depth;
+            auto const code{callee->code.cbegin()};
+            code->handler(code, callee_fp, ctx, slot_t{});
+            --ctx->call_depth;
+
+            return ctx->trap == trap_t::none;
+        }
+    }  // namespace details
+
+    namespace handlers
+    {
+        /// @brief  [handler][function][frame], the arguments are the first slots of the callee frame at fp + frame
+        inline void call(op_t const* ip, slot_t* fp, context_t* ctx, slot_t acc) noexcept
+        {
+            if(!details::invoke_function(ip[1].function, fp + ip[2].index, ctx)) [[unlikely]] { return; }
+            ip += 3;
+            UWVM_MUSTTAIL return ip->handler(ip, fp, ctx, acc);
+        }
+
+        /// @brief  [handler][type id][element index][frame], table 0
+        inline void call_indirect(op_t const* ip, slot_t* fp, context_t* ctx, slot_t acc) noexcept
+        {
+            auto const elem_idx{static_cast<::std::size_t>(static_cast<details::wasm_u32>(fp[ip[2].index]))};
+            if(elem_idx >= ctx->table_size) [[unlikely]]
+            {
+                details::raise_trap(ctx, trap_t::undefined_element);
+                return;
+            }
+
+            auto const callee{ctx->table_begin[elem_idx]};
+            if(callee == nullptr) [[unlikely]]
+            {
+                details::raise_trap(ctx, trap_t::uninitialized_element);
+                return;
+            }
+            if(callee->type_id != ip[1].index) [[unlikely]]
+            {
+                details::raise_trap(ctx, trap_t::indirect_call_type_mismatch);
+                return;
+            }
+
+            if(!details::invoke_function(callee, fp + ip[3].index, ctx)) [[unlikely]] { return; }
+            ip += 4;
+            UWVM_MUSTTAIL return ip->handler(ip, fp, ctx, acc);
+        }
+
+        // Parametric and variable
+
+        /// @brief  [handler][dst][val1][val2][condition]
+        inline void select(op_t const* ip, slot_t* fp, context_t* ctx, slot_t acc) noexcept
+        {
+            fp[ip[1].index] = static_cast<details::wasm_u32>(fp[ip[4].index]) != 0u ? fp[ip[2].index] : fp[ip[3].index];
+            ip += 5;
+            UWVM_MUSTTAIL return ip->handler(ip, fp, ctx, acc);
+        }
+
+        /// @brief  local.set, local.tee and a local.get that has to be materialized: [handler][dst][src]
+        inline void copy(op_t const* ip, slot_t* fp, context_t* ctx, slot_t acc) noexcept
+        {
+            fp[ip[1].index] = fp[ip[2].index];
+            ip += 3;
+            UWVM_MUSTTAIL return ip->handler(ip, fp, ctx, acc);
+        }
+
+        /// @brief  [handler][dst][global index]
+        template <bool AccOut>
+        inline void global_get(op_t const* ip, slot_t* fp, context_t* ctx, slot_t acc) noexcept
+        {
+            details::write_result<AccOut>(ip[1], fp, acc, ctx->globals[ip[2].index]);
+            ip += 3;
+            UWVM_MUSTTAIL return ip->handler(ip, fp, ctx, acc);
+        }
+
+        /// @brief  [handler][src][global index]
+        template <unsigned AccIn>
+        inline void global_set(op_t const* ip, slot_t* fp, context_t* ctx, slot_t acc) noexcept
+        {
+            ctx->globals[ip[2].index] = details::read_operand<AccIn, 1u>(ip[1], fp, acc);
+            ip += 3;
+            UWVM_MUSTTAIL return ip->handler(ip, fp, ctx, acc);
+        }
+
+        // Memory
+
+        /// @brief  [handler][dst][address][static offset], `Stored` is the integer in memory, `Result` the u32 or u64 result (signed Stored
+        ///         sign-extends)
+        template <typename Stored, typename Result, unsigned AccIn, bool AccOut>
+        inline void load(op_t const* ip, slot_t* fp, context_t* ctx, slot_t acc) noexcept
+        {
+            auto const offset{static_cast<::std::uint_least64_t>(static_cast<details::wasm_u32>(details::read_operand<AccIn, 1u>(ip[2], fp, acc))) +
+                              ip[3].imm};
+            auto const address{ctx->memory->get_address(offset, sizeof(Stored))};
+            if constexpr(::uwvm2::memory::linear::native_memory_t::explicit_bounds_check)
+            {
+                if(address == nullptr) [[unlikely]]
+                {
+                    details::raise_trap(ctx, trap_t::memory_out_of_bounds);
+                    return;
+                }
+            }
+
+            Stored value;
+            ::std::memcpy(::std::addressof(value), address, sizeof(Stored));
+            if constexpr(::std::endian::native == ::std::endian::big && sizeof(Stored) != 1uz) { value = ::std::byteswap(value); }
+
+            details::write_result<AccOut>(ip[1], fp, acc, static_cast<slot_t>(static_cast<Result>(value)));
+            ip += 4;
+            UWVM_MUSTTAIL return ip->handler(ip, fp, ctx, acc);
+        }
+
+        /// @brief  [handler][address][value][static offset], `Stored` is the unsigned integer the value is wrapped to
+        template <typename Stored, unsigned AccIn>
+        inline void store(op_t const* ip, slot_t* fp, context_t* ctx, slot_t acc) noexcept
+        {
+            auto const offset{static_cast<::std::uint_least64_t>(static_cast<details::wasm_u32>(details::read_operand<AccIn, 1u>(ip[1], fp, acc))) +
+                              ip[3].imm};
+            auto const address{ctx->memory->get_address(offset, sizeof(Stored))};
+            if constexpr(::uwvm2::memory::linear::native_memory_t::explicit_bounds_check)
+            {
+                if(address == nullptr) [[unlikely]]
+                {
+                    details::raise_trap(ctx, trap_t::memory_out_of_bounds);
+                    return;
+                }
+            }
+
+            auto value{static_cast<Stored>(details::read_operand<AccIn, 2u>(ip[2], fp, acc))};
+            if constexpr(::std::endian::native == ::std::endian::big && sizeof(Stored) != 1uz) { value = ::std::byteswap(value); }
+            ::std::memcpy(address, ::std::addressof(value), sizeof(Stored));
+
+            ip += 4;
+            UWVM_MUSTTAIL return ip->handler(ip, fp, ctx, acc);
+        }
+
+        /// @brief  [handler][dst]
+        inline void memory_size(op_t const* ip, slot_t* fp, context_t* ctx, slot_t acc) noexcept
+        {
+            fp[ip[1].index] = static_cast<details::wasm_u32>(ctx->memory->page_count());
+            ip += 2;
+            UWVM_MUSTTAIL return ip->handler(ip, fp, ctx, acc);
+        }
+
+        /// @brief  [handler][dst][delta]
+        inline void memory_grow(op_t const* ip, slot_t* fp, context_t* ctx, slot_t acc) noexcept
+        {
+            auto const old_page{ctx->memory->grow(static_cast<::std::size_t>(static_cast<details::wasm_u32>(fp[ip[2].index])))};
+            // -1 as i32 if the memory cannot grow
+            fp[ip[1].index] =
+                old_page == ::uwvm2::memory::linear::grow_failed ? slot_t{0xFFFF'FFFFu} : static_cast<slot_t>(static_cast<details::wasm_u32>(old_page));
+            ip += 3;
+            UWVM_MUSTTAIL return ip->handler(ip, fp, ctx, acc);
+        }
+
+        // Numeric
+
+        /// @brief  i32.const, i64.const, f32.const and f64.const: [handler][dst][slot]
+        template <bool AccOut>
+        inline void const_(op_t const* ip, slot_t* fp, context_t* ctx, slot_t acc) noexcept
+        {
+            details::write_result<AccOut>(ip[1], fp, acc, ip[2].imm);
+            ip += 3;
+            UWVM_MUSTTAIL return ip->handler(ip, fp, ctx, acc);
+        }
+
+        /// @brief  [handler][dst][src]
+        template <typename T, typename Op, unsigned AccIn, bool AccOut>
+        inline void unary(op_t const* ip, slot_t* fp, context_t* ctx, slot_t acc) noexcept
+        {
+            auto const src{details::get_slot<T>(details::read_operand<AccIn, 1u>(ip[2], fp, acc))};
+            details::write_result<AccOut>(ip[1], fp, acc, details::to_slot(Op{}(src)));
+            ip += 3;
+            UWVM_MUSTTAIL return ip->handler(ip, fp, ctx, acc);
+        }
+
+        /// @brief  [handler][dst][lhs][rhs]
+        template <typename T, typename Op, unsigned AccIn, bool AccOut>
+        inline void binary(op_t const* ip, slot_t* fp, context_t* ctx, slot_t acc) noexcept
+        {
+            auto const lhs{details::get_slot<T>(details::read_operand<AccIn, 1u>(ip[2], fp, acc))};
+            auto const rhs{details::get_slot<T>(details::read_operand<AccIn, 2u>(ip[3], fp, acc))};
+            details::write_result<AccOut>(ip[1], fp, acc, details::to_slot(Op{}(lhs, rhs)));
+            ip += 4;
+            UWVM_MUSTTAIL return ip->handler(ip, fp, ctx, acc);
+        }
+
+        /// @brief  A const fused into the binary operator that consumes it: [handler][dst][lhs][imm]
+        template <typename T, typename Op, unsigned AccIn, bool AccOut>
+        inline void binary_imm(op_t const* ip, slot_t* fp, context_t* ctx, slot_t acc) noexcept
+        {
+            auto const lhs{details::get_slot<T>(details::read_operand<AccIn, 1u>(ip[2], fp, acc))};
+            details::write_result<AccOut>(ip[1], fp, acc, details::to_slot(Op{}(lhs, details::get_slot<T>(ip[3].imm))));
+            ip += 4;
+            UWVM_MUSTTAIL return ip->handler(ip, fp, ctx, acc);
+        }
+
+        /// @brief  A compare fused into br_if (or into if with `Negate`): [handler][target][lhs][rhs], rhs is an immediate if `Imm`
+        template <typename T, typename Op, bool Imm, bool Negate, unsigned AccIn>
+        inline void branch_compare(op_t const* ip, slot_t* fp, context_t* ctx, slot_t acc) noexcept
+        {
+            auto const lhs{details::get_slot<T>(details::read_operand<AccIn, 1u>(ip[2], fp, acc))};
+            T rhs;
+            if constexpr(Imm) { rhs = details::get_slot<T>(ip[3].imm); }
+            else
+            {
+                rhs = details::get_slot<T>(details::read_operand<AccIn, 2u>(ip[3], fp, acc));
+            }
+
+            if(Op{}(lhs, rhs) != Negate) { ip = ip[1].target; }
+            else
+            {
+                ip += 4;
+            }
+            UWVM_MUSTTAIL return ip->handler(ip, fp, ctx, acc);
+        }
+
+        /// @brief  div_s, div_u, rem_s and rem_u of the unsigned type T: [handler][dst][lhs][rhs]
+        template <typename T, bool Signed, bool Rem, unsigned AccIn, bool AccOut>
+        inline void divide(op_t const* ip, slot_t* fp, context_t* ctx, slot_t acc) noexcept
+        {
+            using signed_t = ::std::make_signed_t<T>;
+
+            auto const lhs{details::get_slot<T>(details::read_operand<AccIn, 1u>(ip[2], fp, acc))};
+            auto const rhs{details::get_slot<T>(details::read_operand<AccIn, 2u>(ip[3], fp, acc))};
+            if(rhs == 0u) [[unlikely]]
+            {
+                details::raise_trap(ctx, trap_t::integer_divide_by_zero);
+                return;
+            }
+
+            T res;
+            if constexpr(Signed)
+            {
+                // INT_MIN / -1 overflows, INT_MIN % -1 is 0
+                if(rhs == static_cast<T>(-1))
+                {
+                    if constexpr(Rem) { res = 0u; }
+                    else
+                    {
+                        if(lhs == details::sign_mask<T>()) [[unlikely]]
+                        {
+                            details::raise_trap(ctx, trap_t::integer_overflow);
+                            return;
+                        }
+                        res = static_cast<T>(0u - lhs);
+                    }
+                }
+                else if constexpr(Rem) { res = static_cast<T>(static_cast<signed_t>(lhs) % static_cast<signed_t>(rhs)); }
+                else
+                {
+                    res = static_cast<T>(static_cast<signed_t>(lhs) / static_cast<signed_t>(rhs));
+                }
+            }
+            else if constexpr(Rem) { res = static_cast<T>(lhs % rhs); }
+            else
+            {
+                res = static_cast<T>(lhs / rhs);
+            }
+
+            details::write_result<AccOut>(ip[1], fp, acc, details::to_slot(res));
+            ip += 4;
+            UWVM_MUSTTAIL return ip->handler(ip, fp, ctx, acc);
+        }
+
+        /// @brief  iNN.trunc_fMM_s/u: [handler][dst][src], `I` is the signed or unsigned integer result
+        template <typename F, typename I>
+        inline void trunc(op_t const* ip, slot_t* fp, context_t* ctx, slot_t acc) noexcept
+        {
+            // f32 and f64 convert to double exactly, the bounds are powers of two
+            auto const value{static_cast<double>(details::get_slot<F>(fp[ip[2].index]))};
+            if(value != value) [[unlikely]]
+            {
+                details::raise_trap(ctx, trap_t::invalid_conversion_to_integer);
+                return;
+            }
+
+            auto const t{::std::trunc(value)};
+            constexpr double lower{static_cast<double>(::std::numeric_limits<I>::min())};
+            constexpr double upper{::std::is_signed_v<I> ? -lower : static_cast<double>(::std::numeric_limits<I>::max()) + 1.0};
+            if(!(t >= lower && t < upper)) [[unlikely]]
+            {
+                details::raise_trap(ctx, trap_t::integer_overflow);
+                return;
+            }
+
+            fp[ip[1].index] = details::to_slot(static_cast<I>(t));
+            ip += 3;
+            UWVM_MUSTTAIL return ip->handler(ip, fp, ctx, acc);
+        }
+    }  // namespace handlers
+}  // namespace uwvm2::non_img::uwvm_int
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
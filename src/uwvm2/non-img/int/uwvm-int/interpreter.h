@@ -0,0 +1,119 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.memory.linear;
+import :runtime;
+import :handler;
+#else
+// std
+# include <cstddef>
+# include <cstdint>
+# include <memory>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// platform
+# ifdef UWVM_SUPPORT_GUARDED_LINEAR_MEMORY
+#  include <setjmp.h>
+# endif
+// import
+# include <fast_io.h>
+# include <uwvm2/memory/linear/impl.h>
+# include "runtime.h"
+# include "handler.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::non_img::uwvm_int
+{
+#ifdef UWVM_SUPPORT_GUARDED_LINEAR_MEMORY
+    namespace details
+    {
+        /// @brief  Innermost invoke of this thread, an out-of-bounds access of a guarded memory jumps back to it
+        inline thread_local ::sigjmp_buf* memory_fault_jmp_buf{};
+
+        inline void memory_fault_trap([[maybe_unused]] void* fault_address) noexcept
+        {
+            // A fault outside of the interpreter returns and is chained to the previous handler
+            if(auto const buf{memory_fault_jmp_buf}; buf != nullptr) { ::siglongjmp(*buf, 1); }
+        }
+
+        inline bool install_memory_fault_trap() noexcept
+        {
+            static bool const installed{::uwvm2::memory::linear::install_memory_fault_handler(memory_fault_trap)};
+            return installed;
+        }
+    }  // namespace details
+#endif
+
+    /// @brief      Call a function of the module of `ctx`
+    /// @details    The arguments are passed in ctx.stack_begin[0, param_count), the results are returned in ctx.stack_begin[0, result_count). A host
+    ///             function that calls back into the module passes a context whose stack starts after its own frame. With guarded memory an
+    ///             out-of-bounds access faults and returns here, the frames in between are left without unwinding (handlers own no resources).
+    /// @return     trap_t::none or the trap that stopped the execution (also stored in ctx.trap)
+    inline trap_t invoke(context_t& ctx, ::std::size_t function_index) noexcept
+    {
+        auto const callee{::std::addressof(ctx.module->functions.index_unchecked(function_index))};
+        ctx.trap = trap_t::none;
+
+#ifdef UWVM_SUPPORT_GUARDED_LINEAR_MEMORY
+        if(!details::install_memory_fault_trap()) [[unlikely]]
+        {
+            // Without the handler a guarded memory cannot be accessed safely
+            ctx.trap = trap_t::memory_out_of_bounds;
+            return ctx.trap;
+        }
+
+        auto const prev_buf{details::memory_fault_jmp_buf};
+        auto const call_depth{ctx.call_depth};
+
+        ::sigjmp_buf buf;
+        // The handler runs with SA_NODEFER, the signal mask does not need to be restored
+        if(sigsetjmp(buf, 0) != 0) [[unlikely]]
+        {
+            details::memory_fault_jmp_buf = prev_buf;
+            ctx.call_depth = call_depth;
+            ctx.trap = trap_t::memory_out_of_bounds;
+            return ctx.trap;
+        }
+        details::memory_fault_jmp_buf = ::std::addressof(buf);
+#endif
+
+        details::invoke_function(callee, ctx.stack_begin, ::std::addressof(ctx));
+
+#ifdef UWVM_SUPPORT_GUARDED_LINEAR_MEMORY
+        details::memory_fault_jmp_buf = prev_buf;
+#endif
+
+        return ctx.trap;
+    }
+}  // namespace uwvm2::non_img::uwvm_int
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
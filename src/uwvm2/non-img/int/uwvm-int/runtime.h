@@ -0,0 +1,232 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.parser.wasm.standard.wasm1.type;
+import uwvm2.memory.linear;
+#else
+// std
+# include <cstddef>
+# include <cstdint>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# include <fast_io_dsal/vector.h>
+# include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
+# include <uwvm2/memory/linear/impl.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::non_img::uwvm_int
+{
+    /// @brief      One operand stack or local slot
+    /// @details    i32 and f32 occupy the low 32 bits (f32 as its bit pattern), i64 and f64 the whole slot. All values have the same size, so a frame
+    ///             is addressed by index and branches copy slots without knowing their types.
+    using slot_t = ::std::uint_least64_t;
+
+    /// @brief      Reason why the execution stopped
+    /// @see        WebAssembly Release 1.0 (2019-07-20) § 4.4
+    enum class trap_t : unsigned
+    {
+        none,
+        unreachable,
+        memory_out_of_bounds,
+        integer_divide_by_zero,
+        integer_overflow,
+        invalid_conversion_to_integer,
+        undefined_element,
+        uninitialized_element,
+        indirect_call_type_mismatch,
+        call_stack_exhausted,
+        host_trap
+    };
+
+    struct context_t;
+    union op_t;
+
+    /// @brief      Handler of one lowered instruction
+    /// @details    `ip` points to the handler itself, its immediates follow it. `fp` is the first slot of the frame: the locals (parameters
+    ///             first) followed by the slots of the operand stack. The operands are frame offsets fixed by the lowering, there is no stack
+    ///             pointer at run time. A handler continues with a tail call to the next handler (UWVM_MUSTTAIL), so the dispatch is one indirect
+    ///             jump per instruction. The handler that ends the function (return) and a trapping handler return instead. `acc` is the
+    ///             accumulator: a result handed to the next instruction in a register instead of through its slot.
+    using handler_t = void (*)(op_t const* ip, slot_t* fp, context_t* ctx, slot_t acc) noexcept;
+
+    struct function_t;
+
+    /// @brief      Machine code of a function compiled by a jit
+    /// @details    Same frame as the interpreter: the arguments are in fp[0, param_count), the results are written to fp[0, result_count) and the
+    ///             slots behind the arguments are free for the calls it makes. A trap is stored in ctx->trap before it returns.
+    using native_function_t = void (*)(slot_t* fp, context_t* ctx) noexcept;
+
+    /// @brief      One element of a lowered function: the handler or one of its immediates
+    union op_t
+    {
+        handler_t handler;
+        /// @brief  Branch target, resolved when the function is lowered
+        op_t const* target;
+        function_t const* function;
+        slot_t imm;
+        ::std::size_t index;
+    };
+
+    /// @brief      Parameter and result types of a function, with the layout of final_function_type of the parser
+    struct function_type_t
+    {
+        ::uwvm2::parser::wasm::standard::wasm1::type::value_type const* parameter_begin{};
+        ::uwvm2::parser::wasm::standard::wasm1::type::value_type const* parameter_end{};
+        ::uwvm2::parser::wasm::standard::wasm1::type::value_type const* result_begin{};
+        ::uwvm2::parser::wasm::standard::wasm1::type::value_type const* result_end{};
+    };
+
+    /// @brief      Locals of the same type, with the layout of final_local_entry_t of the parser
+    struct local_entry_t
+    {
+        ::std::uint_least32_t count{};
+        ::uwvm2::parser::wasm::standard::wasm1::type::value_type type{};
+    };
+
+    /// @brief      Body of a function defined by the module
+    /// @details    Filled from final_wasm_code_t: expr_begin and code_end of the body, all_local_count and the locals (only read by a jit, the
+    ///             slots of the interpreter are untyped). The lowering rejects a body that underflows the operand stack of a block or uses an
+    ///             index out of range, it does not check types: the body must have been validated (metadata.validated).
+    struct function_body_t
+    {
+        ::std::byte const* expr_begin{};
+        ::std::byte const* code_end{};
+        ::std::uint_least32_t all_local_count{};
+        local_entry_t const* local_begin{};
+        local_entry_t const* local_end{};
+    };
+
+    /// @brief      Imported function
+    /// @details    `frame` holds the parameters, the results are written to its first slots. Returns trap_t::none on success.
+    struct host_function_t
+    {
+        trap_t (*call)(slot_t* frame, void* host_context) noexcept {};
+        void* host_context{};
+    };
+
+    /// @brief      A function of a module, imported functions first (wasm function index order)
+    struct function_t
+    {
+        /// @brief  Filled by the loader
+        ::std::size_t type_index{};
+        function_body_t body{};
+        host_function_t host{};
+
+        /// @brief  Filled by compile_module
+        /// @details type_id is equal for structurally equal types (call_indirect), frame_size is the number of slots of the locals and the operand
+        ///          stack.
+        ::std::size_t type_id{};
+        ::std::size_t param_count{};
+        ::std::size_t result_count{};
+        ::std::size_t local_count{};
+        ::std::size_t frame_size{};
+        ::fast_io::vector<op_t> code{};
+
+        /// @brief  Filled by a jit, calls run it instead of `code`
+        /// @details Both may change while the module runs (through ::std::atomic_ref): a tiering jit installs `native` from its own thread and
+        ///          every thread counts `hotness`, so they are mutable in the functions that the contexts share as const.
+        mutable native_function_t native{};
+        /// @brief  Calls and loop iterations in the interpreter, counted up to tier_up_t::threshold
+        mutable ::std::uint_least32_t hotness{};
+
+        inline constexpr bool is_host() const noexcept { return this->host.call != nullptr; }
+    };
+
+    /// @brief      Default number of calls and loop iterations after which a function is hot
+    inline constexpr ::std::uint_least32_t default_tier_up_threshold{1000u};
+
+    /// @brief      Promotion of hot functions to a faster tier
+    /// @details    When `request` is set, compile_module counts loop iterations and the interpreter counts calls in function_t::hotness. The
+    ///             thread that brings a function to `threshold` calls `request` once, which may later install function_t::native from any thread.
+    ///             The counters are racy on purpose: a lost update only delays the request.
+    struct tier_up_t
+    {
+        void (*request)(function_t const* func, void* tier_context) noexcept {};
+        void* tier_context{};
+        ::std::uint_least32_t threshold{default_tier_up_threshold};
+    };
+
+    /// @brief      What the interpreter needs from a module
+    /// @details    The lowered code refers to other functions by address, `functions` must not change after compile_module. `global_types` (imported
+    ///             globals first) bounds the global indices, only a jit reads the types.
+    struct module_t
+    {
+        ::fast_io::vector<function_type_t> types{};
+        ::fast_io::vector<function_t> functions{};
+        ::fast_io::vector<::uwvm2::parser::wasm::standard::wasm1::type::value_type> global_types{};
+        /// @brief  Set before compile_module, the lowered code counts loop iterations only when it is enabled
+        tier_up_t tier_up{};
+    };
+
+    /// @brief      Default limit of nested calls, each nested call also uses native stack
+    inline constexpr ::std::size_t default_max_call_depth{16384uz};
+
+    /// @brief      State of one execution (one thread of one instance)
+    /// @details    The runtime owns the memory, the globals, the table and the stack. The table holds the function addresses of the module (nullptr
+    ///             for uninitialized elements).
+    struct context_t
+    {
+        module_t const* module{};
+        ::uwvm2::memory::linear::native_memory_t* memory{};
+        slot_t* globals{};
+        function_t const* const* table_begin{};
+        ::std::size_t table_size{};
+
+        slot_t* stack_begin{};
+        slot_t* stack_end{};
+
+        ::std::size_t call_depth{};
+        ::std::size_t max_call_depth{default_max_call_depth};
+
+        trap_t trap{};
+    };
+}  // namespace uwvm2::non_img::uwvm_int
+
+/// @brief Define container optimization operations for use with fast_io
+UWVM_MODULE_EXPORT namespace fast_io::freestanding
+{
+    template <>
+    struct is_trivially_copyable_or_relocatable<::uwvm2::non_img::uwvm_int::function_t>
+    {
+        inline static constexpr bool value = true;
+    };
+
+    template <>
+    struct is_zero_default_constructible<::uwvm2::non_img::uwvm_int::function_t>
+    {
+        inline static constexpr bool value = true;
+    };
+}  // namespace fast_io::freestanding
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
@@ -0,0 +1,60 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+module;
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+// llvm
+#ifdef UWVM_USE_LLVM_JIT
+# include <llvm/ADT/ArrayRef.h>
+# include <llvm/ADT/SmallString.h>
+# include <llvm/ADT/StringExtras.h>
+# include <llvm/ADT/StringRef.h>
+# include <llvm/ADT/Twine.h>
+# include <llvm/Config/llvm-config.h>
+# include <llvm/ExecutionEngine/ObjectCache.h>
+# include <llvm/ExecutionEngine/Orc/JITTargetMachineBuilder.h>
+# include <llvm/IR/Module.h>
+# include <llvm/Support/FileSystem.h>
+# include <llvm/Support/MemoryBuffer.h>
+# include <llvm/Support/SHA1.h>
+# include <llvm/Support/raw_ostream.h>
+#endif
+// macro
+#include <uwvm2/utils/macro/push_macros.h>
+
+export module uwvm2.non_img.llvm_jit:cache;
+
+#ifndef UWVM_MODULE
+# define UWVM_MODULE
+#endif
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT export
+#endif
+
+#include "cache.h"
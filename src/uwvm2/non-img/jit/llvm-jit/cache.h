@@ -0,0 +1,248 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.memory.linear;
+import uwvm2.uwvm.custom;
+import uwvm2.non_img.uwvm_int;
+#else
+// std
+# include <cstddef>
+# include <cstdint>
+# include <algorithm>
+# include <memory>
+# include <string>
+# include <utility>
+# include <vector>
+// llvm
+# ifdef UWVM_USE_LLVM_JIT
+#  include <llvm/ADT/ArrayRef.h>
+#  include <llvm/ADT/SmallString.h>
+#  include <llvm/ADT/StringExtras.h>
+#  include <llvm/ADT/StringRef.h>
+#  include <llvm/ADT/Twine.h>
+#  include <llvm/Config/llvm-config.h>
+#  include <llvm/ExecutionEngine/ObjectCache.h>
+#  include <llvm/ExecutionEngine/Orc/JITTargetMachineBuilder.h>
+#  include <llvm/IR/Module.h>
+#  include <llvm/Support/FileSystem.h>
+#  include <llvm/Support/MemoryBuffer.h>
+#  include <llvm/Support/SHA1.h>
+#  include <llvm/Support/raw_ostream.h>
+# endif
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# include <fast_io_dsal/vector.h>
+# include <uwvm2/memory/linear/impl.h>
+# include <uwvm2/uwvm/custom/impl.h>
+# include <uwvm2/non-img/int/uwvm-int/impl.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::non_img::llvm_jit
+{
+#ifdef UWVM_USE_LLVM_JIT
+    /// @brief      On-disk cache of the objects that the jit compiles
+    /// @details    One relocatable object per compiled unit (a whole module, or one function of a tiered module) in `directory`, named after its
+    ///             key. The key covers the wasm code, the target (triple, cpu, cpu features), the LLVM and uwvm versions and the memory model, so a
+    ///             file is never loaded into a process that would generate different code. The objects reach the runtime by symbol name and the
+    ///             instance through the context argument, nothing in them depends on the process that wrote them. A file is written to a unique
+    ///             temporary name and renamed, so concurrent processes see either no file or a complete one. Loading maps the file.
+    struct code_cache_t final : ::llvm::ObjectCache
+    {
+        ::std::string directory{};
+
+        inline explicit code_cache_t(::std::string dir) : directory{::std::move(dir)} {}
+
+        /// @return false if the directory cannot be created, the jit then compiles as without a cache
+        inline bool init() const { return !::llvm::sys::fs::create_directories(this->directory); }
+
+        inline ::std::string get_path(::llvm::StringRef key) const { return (::llvm::Twine{this->directory} + "/" + key + ".o").str(); }
+
+        /// @return nullptr on a miss
+        inline ::std::unique_ptr<::llvm::MemoryBuffer> load(::llvm::StringRef key) const
+        {
+            // Without a null terminator the file is mapped instead of read
+            auto buffer{::llvm::MemoryBuffer::getFile(this->get_path(key), false, false)};
+            if(!buffer) { return nullptr; }
+            return ::std::move(*buffer);
+        }
+
+        /// @brief  Failures are ignored, the object is compiled again next time
+        inline void store(::llvm::StringRef key, ::llvm::StringRef object) const
+        {
+            int fd;
+            ::llvm::SmallString<128u> temp_path{};
+            if(::llvm::sys::fs::createUniqueFile(::llvm::Twine{this->directory} + "/" + key + "-%%%%%%%%.tmp", fd, temp_path)) [[unlikely]] { return; }
+
+            bool written;
+            {
+                ::llvm::raw_fd_ostream stream{fd, true};
+                stream << object;
+                stream.close();
+                written = !stream.has_error();
+                stream.clear_error();
+            }
+
+            if(!written || ::llvm::sys::fs::rename(temp_path, this->get_path(key))) [[unlikely]] { ::llvm::sys::fs::remove(temp_path); }
+        }
+
+        /// @brief  An object that failed to load is not tried again
+        inline void remove(::llvm::StringRef key) const { ::llvm::sys::fs::remove(this->get_path(key)); }
+
+        /// @brief  Called by the compiler of the jit, the module identifier is the key (empty for modules that are not cached)
+        inline void notifyObjectCompiled(::llvm::Module const* module, ::llvm::MemoryBufferRef object) override
+        {
+            if(auto const& key{module->getModuleIdentifier()}; !key.empty()) { this->store(key, object.getBuffer()); }
+        }
+
+        /// @brief  compile_functions looks the key up before it builds the IR, this only hits when another process stored it in between
+        inline ::std::unique_ptr<::llvm::MemoryBuffer> getObject(::llvm::Module const* module) override
+        {
+            auto const& key{module->getModuleIdentifier()};
+            return key.empty() ? nullptr : this->load(key);
+        }
+    };
+
+    namespace details
+    {
+        struct hasher_t
+        {
+            ::llvm::SHA1 sha1{};
+
+            inline void update(::llvm::StringRef str)
+            {
+                // Length first, so that adjacent strings cannot be split differently
+                this->update_value(static_cast<::std::uint_least64_t>(str.size()));
+                this->sha1.update(str);
+            }
+
+            template <typename T>
+            inline void update_value(T value)
+            {
+                this->sha1.update(::llvm::ArrayRef<::std::uint8_t>{reinterpret_cast<::std::uint8_t const*>(::std::addressof(value)), sizeof(T)});
+            }
+
+            template <typename T>
+            inline void update_range(T const* begin, T const* end)
+            {
+                this->update_value(static_cast<::std::uint_least64_t>(end - begin));
+                for(; begin != end; ++begin) { this->update_value(*begin); }
+            }
+
+            inline ::std::string get_hex()
+            {
+#if LLVM_VERSION_MAJOR >= 15
+                auto const digest{this->sha1.final()};
+                return ::llvm::toHex(digest, true);
+#else
+                return ::llvm::toHex(::llvm::arrayRefFromStringRef(this->sha1.final()), true);
+#endif
+            }
+        };
+
+        /// @brief  Everything of the host that changes the generated code
+        inline ::std::string get_target_key(::llvm::orc::JITTargetMachineBuilder const& builder)
+        {
+            // The order of the features comes from a hash map
+            auto features{builder.getFeatures().getFeatures()};
+            ::std::ranges::sort(features);
+
+            hasher_t hasher{};
+            hasher.update(builder.getTargetTriple().str());
+            hasher.update(builder.getCPU());
+            hasher.update_value(static_cast<::std::uint_least64_t>(features.size()));
+            for(auto const& feature: features) { hasher.update(feature); }
+
+            hasher.update(LLVM_VERSION_STRING);
+            hasher.update_value(::uwvm2::memory::linear::native_memory_t::explicit_bounds_check);
+
+            auto const version{::uwvm2::uwvm::custom::uwvm_version};
+            hasher.update_value(version.x);
+            hasher.update_value(version.y);
+            hasher.update_value(version.z);
+            hasher.update_value(version.state);
+            auto const commit{::uwvm2::uwvm::custom::git_commit_id};
+            hasher.update(::llvm::StringRef{reinterpret_cast<char const*>(commit.data()), commit.size()});
+
+            return hasher.get_hex();
+        }
+
+        /// @brief  The wasm code of the module: types, functions, bodies, locals and globals
+        /// @note   Computed once per module, a key of a unit adds the functions it contains
+        inline ::std::string get_module_hash(::uwvm2::non_img::uwvm_int::module_t const& mod)
+        {
+            hasher_t hasher{};
+
+            hasher.update_value(static_cast<::std::uint_least64_t>(mod.types.size()));
+            for(auto const& type: mod.types)
+            {
+                hasher.update_range(type.parameter_begin, type.parameter_end);
+                hasher.update_range(type.result_begin, type.result_end);
+            }
+
+            hasher.update_value(static_cast<::std::uint_least64_t>(mod.functions.size()));
+            for(auto const& func: mod.functions)
+            {
+                hasher.update_value(static_cast<::std::uint_least64_t>(func.type_index));
+                hasher.update_value(func.is_host());
+                if(func.is_host()) { continue; }
+
+                hasher.update_range(func.body.expr_begin, func.body.code_end);
+                hasher.update_value(static_cast<::std::uint_least64_t>(func.body.local_end - func.body.local_begin));
+                for(auto curr{func.body.local_begin}; curr != func.body.local_end; ++curr)
+                {
+                    hasher.update_value(curr->count);
+                    hasher.update_value(curr->type);
+                }
+            }
+
+            hasher.update_range(mod.global_types.cbegin(), mod.global_types.cend());
+
+            return hasher.get_hex();
+        }
+
+        /// @brief  Key of the unit that contains `function_indices`, also its module identifier
+        inline ::std::string get_cache_key(::llvm::StringRef target_key, ::llvm::StringRef module_hash, ::fast_io::vector<::std::size_t> const& function_indices)
+        {
+            hasher_t hasher{};
+            hasher.update(target_key);
+            hasher.update(module_hash);
+            hasher.update_value(static_cast<::std::uint_least64_t>(function_indices.size()));
+            for(auto const i: function_indices) { hasher.update_value(static_cast<::std::uint_least64_t>(i)); }
+            return hasher.get_hex();
+        }
+    }  // namespace details
+#endif
+}  // namespace uwvm2::non_img::llvm_jit
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
@@ -0,0 +1,58 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+module;
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+// llvm
+#ifdef UWVM_USE_LLVM_JIT
+# include <llvm/Config/llvm-config.h>
+# include <llvm/ExecutionEngine/Orc/CompileUtils.h>
+# include <llvm/ExecutionEngine/Orc/ExecutionUtils.h>
+# include <llvm/ExecutionEngine/Orc/JITTargetMachineBuilder.h>
+# include <llvm/ExecutionEngine/Orc/LLJIT.h>
+# include <llvm/ExecutionEngine/Orc/ThreadSafeModule.h>
+# include <llvm/IR/LLVMContext.h>
+# include <llvm/IR/Module.h>
+# include <llvm/IR/Verifier.h>
+# include <llvm/Passes/PassBuilder.h>
+# include <llvm/Support/Error.h>
+# include <llvm/Support/TargetSelect.h>
+# include <llvm/Target/TargetMachine.h>
+#endif
+// macro
+#include <uwvm2/utils/macro/push_macros.h>
+
+export module uwvm2.non_img.llvm_jit:engine;
+
+#ifndef UWVM_MODULE
+# define UWVM_MODULE
+#endif
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT export
+#endif
+
+#include "engine.h"
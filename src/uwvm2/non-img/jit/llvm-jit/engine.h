@@ -0,0 +1,351 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.non_img.uwvm_int;
+import :runtime;
+import :translator;
+import :cache;
+#else
+// std
+# include <cstddef>
+# include <cstdint>
+# include <memory>
+# include <string>
+# include <utility>
+// llvm
+# ifdef UWVM_USE_LLVM_JIT
+#  include <llvm/Config/llvm-config.h>
+#  include <llvm/ExecutionEngine/Orc/CompileUtils.h>
+#  include <llvm/ExecutionEngine/Orc/ExecutionUtils.h>
+#  include <llvm/ExecutionEngine/Orc/JITTargetMachineBuilder.h>
+#  include <llvm/ExecutionEngine/Orc/LLJIT.h>
+#  include <llvm/ExecutionEngine/Orc/ThreadSafeModule.h>
+#  include <llvm/IR/LLVMContext.h>
+#  include <llvm/IR/Module.h>
+#  include <llvm/IR/Verifier.h>
+#  include <llvm/Passes/PassBuilder.h>
+#  include <llvm/Support/Error.h>
+#  include <llvm/Support/TargetSelect.h>
+#  include <llvm/Target/TargetMachine.h>
+# endif
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# include <fast_io_dsal/vector.h>
+# include <uwvm2/non-img/int/uwvm-int/impl.h>
+# include "runtime.h"
+# include "translator.h"
+# include "cache.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::non_img::llvm_jit
+{
+#ifdef UWVM_USE_LLVM_JIT
+    namespace details
+    {
+        inline bool initialize_native_target() noexcept
+        {
+            // Both return true on failure
+            static bool const initialized{!::llvm::InitializeNativeTarget() && !::llvm::InitializeNativeTargetAsmPrinter()};
+            return initialized;
+        }
+
+        template <typename T>
+        inline bool take(::llvm::Expected<T>& expected) noexcept
+        {
+            if(expected) [[likely]] { return true; }
+            ::llvm::consumeError(expected.takeError());
+            return false;
+        }
+
+        inline bool take(::llvm::Error error) noexcept
+        {
+            if(!error) [[likely]] { return true; }
+            ::llvm::consumeError(::std::move(error));
+            return false;
+        }
+
+        inline ::llvm::orc::SymbolMap get_runtime_symbol_map(::llvm::orc::LLJIT& lljit)
+        {
+            auto const flags{::llvm::JITSymbolFlags::Exported | ::llvm::JITSymbolFlags::Callable};
+
+            ::llvm::orc::SymbolMap symbols{};
+            for(auto const& symbol: runtime_symbols)
+            {
+#if LLVM_VERSION_MAJOR >= 17
+                symbols[lljit.mangleAndIntern(symbol.name)] = ::llvm::orc::ExecutorSymbolDef{::llvm::orc::ExecutorAddr::fromPtr(symbol.address), flags};
+#else
+                symbols[lljit.mangleAndIntern(symbol.name)] = ::llvm::JITEvaluatedSymbol{::llvm::pointerToJITTargetAddress(symbol.address), flags};
+#endif
+            }
+            return symbols;
+        }
+
+        inline ::llvm::Expected<::llvm::orc::JITTargetMachineBuilder> get_host_builder()
+        {
+            auto builder{::llvm::orc::JITTargetMachineBuilder::detectHost()};
+            if(builder)
+            {
+#if LLVM_VERSION_MAJOR >= 18
+                builder->setCodeGenOptLevel(::llvm::CodeGenOptLevel::Default);
+#else
+                builder->setCodeGenOptLevel(::llvm::CodeGenOpt::Default);
+#endif
+            }
+            return builder;
+        }
+
+        /// @brief  A TargetMachine for the optimization on another thread, nullptr if the host is not supported
+        inline ::std::unique_ptr<::llvm::TargetMachine> create_target_machine()
+        {
+            auto builder{get_host_builder()};
+            if(!take(builder)) [[unlikely]] { return nullptr; }
+            auto machine{builder->createTargetMachine()};
+            if(!take(machine)) [[unlikely]] { return nullptr; }
+            return ::std::move(*machine);
+        }
+
+        /// @brief  The per-module O2 pipeline, with the vectorizers and the unroller that the wasm loops profit from
+        inline void optimize_module(::llvm::Module& module, ::llvm::TargetMachine* target_machine)
+        {
+            ::llvm::PipelineTuningOptions tuning{};
+            tuning.LoopVectorization = true;
+            tuning.SLPVectorization = true;
+            tuning.LoopUnrolling = true;
+
+            ::llvm::LoopAnalysisManager loop_analysis{};
+            ::llvm::FunctionAnalysisManager function_analysis{};
+            ::llvm::CGSCCAnalysisManager cgscc_analysis{};
+            ::llvm::ModuleAnalysisManager module_analysis{};
+
+            ::llvm::PassBuilder pass_builder{target_machine, tuning};
+            pass_builder.registerModuleAnalyses(module_analysis);
+            pass_builder.registerCGSCCAnalyses(cgscc_analysis);
+            pass_builder.registerFunctionAnalyses(function_analysis);
+            pass_builder.registerLoopAnalyses(loop_analysis);
+            pass_builder.crossRegisterProxies(loop_analysis, function_analysis, cgscc_analysis, module_analysis);
+
+            auto passes{pass_builder.buildPerModuleDefaultPipeline(::llvm::OptimizationLevel::O2)};
+            passes.run(module, module_analysis);
+        }
+    }  // namespace details
+
+    /// @brief      ORC jit of the host
+    /// @details    Owns the machine code of every module compiled with it, the native functions of those modules must not be called after it is
+    ///             destroyed. The runtime functions are absolute symbols of the main JITDylib, each module gets its own JITDylib that links to it.
+    ///             Modules may be added and looked up from several threads: each compilation creates its own TargetMachine.
+    struct jit_t
+    {
+        ::std::unique_ptr<::llvm::orc::LLJIT> lljit{};
+        /// @brief  Tunes the optimization for the host, the same target as the code generator of lljit
+        ::std::unique_ptr<::llvm::TargetMachine> target_machine{};
+        ::std::size_t module_count{};
+        /// @brief  nullptr without a cache, it must outlive the jit
+        code_cache_t* cache{};
+        /// @brief  Hash of the target, part of the cache keys
+        ::std::string target_key{};
+
+        /// @return false if the host is not supported by the LLVM that uwvm is linked with
+        inline bool init(code_cache_t* code_cache = nullptr)
+        {
+            if(!details::initialize_native_target()) [[unlikely]] { return false; }
+
+            auto builder{details::get_host_builder()};
+            if(!details::take(builder)) [[unlikely]] { return false; }
+
+            auto machine{builder->createTargetMachine()};
+            if(!details::take(machine)) [[unlikely]] { return false; }
+
+            auto target_key_{details::get_target_key(*builder)};
+
+            // The default compiler shares one TargetMachine between all threads, the concurrent one also hands the objects to the cache
+            auto created{::llvm::orc::LLJITBuilder{}
+                             .setJITTargetMachineBuilder(::std::move(*builder))
+                             .setCompileFunctionCreator(
+                                 [code_cache](::llvm::orc::JITTargetMachineBuilder compile_builder)
+                                     -> ::llvm::Expected<::std::unique_ptr<::llvm::orc::IRCompileLayer::IRCompiler>>
+                                 { return ::std::make_unique<::llvm::orc::ConcurrentIRCompiler>(::std::move(compile_builder), code_cache); })
+                             .create()};
+            if(!details::take(created)) [[unlikely]] { return false; }
+
+            auto& main_dylib{(*created)->getMainJITDylib()};
+            if(!details::take(main_dylib.define(::llvm::orc::absoluteSymbols(details::get_runtime_symbol_map(**created))))) [[unlikely]] { return false; }
+
+            // Intrinsics without an instruction on the host are lowered to calls of libm
+            auto process_symbols{::llvm::orc::DynamicLibrarySearchGenerator::GetForCurrentProcess((*created)->getDataLayout().getGlobalPrefix())};
+            if(!details::take(process_symbols)) [[unlikely]] { return false; }
+            main_dylib.addGenerator(::std::move(*process_symbols));
+
+            this->lljit = ::std::move(*created);
+            this->target_machine = ::std::move(*machine);
+            this->cache = code_cache;
+            this->target_key = ::std::move(target_key_);
+            return true;
+        }
+
+        /// @brief  A new JITDylib for the code of one module, it resolves the runtime functions through the main JITDylib
+        inline ::llvm::orc::JITDylib* create_dylib()
+        {
+            auto dylib{this->lljit->createJITDylib((::llvm::Twine{"uwvm_module_"} + ::llvm::Twine{static_cast<::std::uint_least64_t>(this->module_count++)}).str())};
+            if(!details::take(dylib)) [[unlikely]] { return nullptr; }
+            dylib->addToLinkOrder(this->lljit->getMainJITDylib());
+            return ::std::addressof(*dylib);
+        }
+    };
+
+    namespace details
+    {
+        /// @brief  Look up the entries of `function_indices` in `dylib`, the first lookup materializes the unit
+        inline bool lookup_entries(::llvm::orc::LLJIT& lljit,
+                                   ::llvm::orc::JITDylib& dylib,
+                                   ::fast_io::vector<::std::size_t> const& function_indices,
+                                   ::fast_io::vector<::uwvm2::non_img::uwvm_int::native_function_t>& natives)
+        {
+            ::fast_io::vector<::uwvm2::non_img::uwvm_int::native_function_t> result{};
+            result.reserve(function_indices.size());
+            for(auto const i: function_indices)
+            {
+                auto entry{lljit.lookup(dylib, entry_symbol(i))};
+                if(!take(entry)) [[unlikely]] { return false; }
+#if LLVM_VERSION_MAJOR >= 15
+                result.push_back(entry->template toPtr<::uwvm2::non_img::uwvm_int::native_function_t>());
+#else
+                result.push_back(reinterpret_cast<::uwvm2::non_img::uwvm_int::native_function_t>(static_cast<::std::uintptr_t>(entry->getAddress())));
+#endif
+            }
+
+            natives = ::std::move(result);
+            return true;
+        }
+
+        /// @brief      Compile the functions `function_indices` of the module into one LLVM module of `dylib`
+        /// @details    They call each other directly, all other calls go through the runtime. The entry symbols are unique per function index, a
+        ///             dylib may hold several such units as long as no function is compiled twice into it. With a cache of the jit, `module_hash`
+        ///             (get_module_hash) keys the unit: a cached object is loaded instead of translating and optimizing, a compiled one is stored.
+        /// @return     false if a body cannot be translated or LLVM fails, `natives` (parallel to function_indices) is only filled on success
+        inline bool compile_functions(jit_t& jit,
+                                      ::llvm::orc::JITDylib& dylib,
+                                      ::llvm::TargetMachine* target_machine,
+                                      ::uwvm2::non_img::uwvm_int::module_t const& mod,
+                                      ::fast_io::vector<::std::size_t> const& type_ids,
+                                      ::llvm::StringRef module_hash,
+                                      ::fast_io::vector<::std::size_t> const& function_indices,
+                                      ::fast_io::vector<::uwvm2::non_img::uwvm_int::native_function_t>& natives)
+        {
+            auto& lljit{*jit.lljit};
+
+            ::std::string key{};
+            if(jit.cache != nullptr)
+            {
+                key = get_cache_key(jit.target_key, module_hash, function_indices);
+                if(auto object{jit.cache->load(key)}; object != nullptr)
+                {
+                    if(take(lljit.addObjectFile(dylib, ::std::move(object))) && lookup_entries(lljit, dylib, function_indices, natives)) [[likely]]
+                    {
+                        return true;
+                    }
+                    // Its symbols are now defined in the dylib, it cannot be compiled again into it
+                    jit.cache->remove(key);
+                    return false;
+                }
+            }
+
+            auto context{::std::make_unique<::llvm::LLVMContext>()};
+            // The identifier is the key the cache stores the object under
+            auto module{::std::make_unique<::llvm::Module>(key, *context)};
+            module->setDataLayout(lljit.getDataLayout());
+            module->setTargetTriple(lljit.getTargetTriple().str());
+
+            // Declare all bodies first, a call may refer to a function defined later
+            ::fast_io::vector<::llvm::Function*> bodies(mod.functions.size());
+            for(auto const i: function_indices)
+            {
+                bodies.index_unchecked(i) = declare_body(*module, mod, i, ::llvm::GlobalValue::InternalLinkage);
+            }
+
+            for(auto const i: function_indices)
+            {
+                auto const body{bodies.index_unchecked(i)};
+                function_translation_t translation{.mod = mod, .type_ids = type_ids, .bodies = bodies, .function_index = i, .function = body};
+                if(!translation.translate()) [[unlikely]] { return false; }
+                define_entry(*module, mod, i, body);
+            }
+
+            // Returns true if the module is broken
+            if(::llvm::verifyModule(*module)) [[unlikely]] { return false; }
+
+            optimize_module(*module, target_machine);
+
+            if(!take(lljit.addIRModule(dylib, ::llvm::orc::ThreadSafeModule{::std::move(module), ::std::move(context)}))) [[unlikely]] { return false; }
+
+            return lookup_entries(lljit, dylib, function_indices, natives);
+        }
+    }  // namespace details
+
+    /// @brief      Compile every function of the module that is not imported and set function_t::native
+    /// @details    uwvm_int::compile_module must have run: the signatures it fills are reused and the interpreter stays the fallback for
+    ///             everything the jit does not handle. The functions call each other directly, imports and call_indirect go through the runtime.
+    /// @return     false if a body cannot be translated or LLVM fails, no function is changed then
+    inline bool compile_module(::uwvm2::non_img::uwvm_int::module_t& mod, jit_t& jit)
+    {
+        if(jit.lljit == nullptr) [[unlikely]] { return false; }
+
+        ::fast_io::vector<::std::size_t> function_indices{};
+        for(::std::size_t i{}; i != mod.functions.size(); ++i)
+        {
+            if(!mod.functions.index_unchecked(i).is_host()) { function_indices.push_back(i); }
+        }
+
+        auto const dylib{jit.create_dylib()};
+        if(dylib == nullptr) [[unlikely]] { return false; }
+
+        auto const module_hash{jit.cache == nullptr ? ::std::string{} : details::get_module_hash(mod)};
+
+        auto const type_ids{::uwvm2::non_img::uwvm_int::details::get_type_ids(mod)};
+
+        ::fast_io::vector<::uwvm2::non_img::uwvm_int::native_function_t> natives{};
+        if(!details::compile_functions(jit, *dylib, jit.target_machine.get(), mod, type_ids, module_hash, function_indices, natives)) [[unlikely]]
+        {
+            return false;
+        }
+
+        for(::std::size_t i{}; i != function_indices.size(); ++i)
+        {
+            mod.functions.index_unchecked(function_indices.index_unchecked(i)).native = natives.index_unchecked(i);
+        }
+        return true;
+    }
+#endif
+}  // namespace uwvm2::non_img::llvm_jit
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
@@ -0,0 +1,133 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.memory.linear;
+import uwvm2.non_img.uwvm_int;
+#else
+// std
+# include <cstddef>
+# include <cstdint>
+# include <memory>
+# include <type_traits>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# include <uwvm2/memory/linear/impl.h>
+# include <uwvm2/non-img/int/uwvm-int/impl.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::non_img::llvm_jit
+{
+#ifdef UWVM_USE_LLVM_JIT
+    /// @brief      Functions the generated code calls for what it does not inline
+    /// @details    They are defined as absolute symbols of the jit and referenced by name, so the machine code has no addresses of this process in
+    ///             it. A function that traps sets ctx->trap and returns it.
+    namespace runtime
+    {
+        using slot_t = ::uwvm2::non_img::uwvm_int::slot_t;
+        using trap_t = ::uwvm2::non_img::uwvm_int::trap_t;
+        using context_t = ::uwvm2::non_img::uwvm_int::context_t;
+
+        /// @brief  Call of a function that was not compiled with the caller (an import), the arguments are in fp[0, param_count)
+        inline trap_t call_function(context_t* ctx, slot_t* fp, ::std::size_t function_index) noexcept
+        {
+            auto const callee{::std::addressof(ctx->module->functions.index_unchecked(function_index))};
+            ::uwvm2::non_img::uwvm_int::details::invoke_function(callee, fp, ctx);
+            return ctx->trap;
+        }
+
+        /// @brief  call_indirect through table 0, the arguments are in fp[0, param_count)
+        inline trap_t call_indirect(context_t* ctx, slot_t* fp, ::std::size_t type_id, ::std::uint_least32_t element_index) noexcept
+        {
+            auto const elem_idx{static_cast<::std::size_t>(element_index)};
+            if(elem_idx >= ctx->table_size) [[unlikely]]
+            {
+                ::uwvm2::non_img::uwvm_int::details::raise_trap(ctx, trap_t::undefined_element);
+                return ctx->trap;
+            }
+
+            auto const callee{ctx->table_begin[elem_idx]};
+            if(callee == nullptr) [[unlikely]]
+            {
+                ::uwvm2::non_img::uwvm_int::details::raise_trap(ctx, trap_t::uninitialized_element);
+                return ctx->trap;
+            }
+            if(callee->type_id != type_id) [[unlikely]]
+            {
+                ::uwvm2::non_img::uwvm_int::details::raise_trap(ctx, trap_t::indirect_call_type_mismatch);
+                return ctx->trap;
+            }
+
+            ::uwvm2::non_img::uwvm_int::details::invoke_function(callee, fp, ctx);
+            return ctx->trap;
+        }
+
+        inline ::std::uint_least32_t memory_size(context_t* ctx) noexcept { return static_cast<::std::uint_least32_t>(ctx->memory->page_count()); }
+
+        /// @return The previous page count, 0xFFFF'FFFF (-1 as i32) if the memory cannot grow
+        inline ::std::uint_least32_t memory_grow(context_t* ctx, ::std::uint_least32_t delta) noexcept
+        {
+            auto const old_page{ctx->memory->grow(static_cast<::std::size_t>(delta))};
+            return old_page == ::uwvm2::memory::linear::grow_failed ? 0xFFFF'FFFFu : static_cast<::std::uint_least32_t>(old_page);
+        }
+    }  // namespace runtime
+
+    namespace details
+    {
+        struct runtime_symbol_t
+        {
+            char const* name{};
+            void* address{};
+        };
+
+        inline constexpr char const call_function_symbol[]{"uwvm_llvm_jit_call_function"};
+        inline constexpr char const call_indirect_symbol[]{"uwvm_llvm_jit_call_indirect"};
+        inline constexpr char const memory_size_symbol[]{"uwvm_llvm_jit_memory_size"};
+        inline constexpr char const memory_grow_symbol[]{"uwvm_llvm_jit_memory_grow"};
+
+        inline runtime_symbol_t const runtime_symbols[]{
+            {call_function_symbol, reinterpret_cast<void*>(&runtime::call_function)},
+            {call_indirect_symbol, reinterpret_cast<void*>(&runtime::call_indirect)},
+            {memory_size_symbol,   reinterpret_cast<void*>(&runtime::memory_size)  },
+            {memory_grow_symbol,   reinterpret_cast<void*>(&runtime::memory_grow)  }
+        };
+
+        // The generated code reads these structures by offset
+        static_assert(::std::is_standard_layout_v<::uwvm2::non_img::uwvm_int::context_t>);
+        static_assert(::std::is_standard_layout_v<::uwvm2::memory::linear::native_memory_t>);
+        static_assert(sizeof(::uwvm2::non_img::uwvm_int::trap_t) == sizeof(::std::uint_least32_t));
+    }  // namespace details
+#endif
+}  // namespace uwvm2::non_img::llvm_jit
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
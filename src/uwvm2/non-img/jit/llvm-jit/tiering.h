@@ -0,0 +1,235 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.non_img.uwvm_int;
+import :cache;
+import :engine;
+#else
+// std
+# include <cstddef>
+# include <cstdint>
+# include <atomic>
+# include <memory>
+# include <mutex>
+# include <condition_variable>
+# include <string>
+# include <thread>
+# include <vector>
+// llvm
+# ifdef UWVM_USE_LLVM_JIT
+#  include <llvm/ExecutionEngine/Orc/Core.h>
+#  include <llvm/Target/TargetMachine.h>
+# endif
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# include <fast_io_dsal/vector.h>
+# include <uwvm2/non-img/int/uwvm-int/impl.h>
+# include "cache.h"
+# include "engine.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::non_img::llvm_jit
+{
+#ifdef UWVM_USE_LLVM_JIT
+    /// @brief      Tiered execution: every function starts in uwvm-int, hot functions are compiled by background threads
+    /// @details    start() installs the tier_up hook of the module, so it must run before uwvm_int::compile_module for the loops to be counted.
+    ///             A function that reaches the threshold is queued once, a worker compiles it alone (its calls go through the runtime and find
+    ///             the native code of the callees that are already compiled) and publishes function_t::native with a release store. Frames that
+    ///             already run in the interpreter finish there, the next call runs the native code. The module must not run after stop().
+    struct tiering_t
+    {
+        enum class state_t : ::std::uint_least8_t
+        {
+            interpreted,
+            queued,
+            compiled,
+            /// @brief  The jit rejected it, it stays interpreted and is not requested again
+            failed
+        };
+
+        ::uwvm2::non_img::uwvm_int::module_t* mod{};
+        jit_t jit{};
+        /// @brief  All functions of the module are compiled into it, their entry symbols are unique
+        ::llvm::orc::JITDylib* dylib{};
+        ::fast_io::vector<::std::size_t> type_ids{};
+        /// @brief  Keys the objects of the functions when the jit has a cache
+        ::std::string module_hash{};
+
+        /// @brief  Guards the queue, the states and stopping
+        ::std::mutex mutex{};
+        ::std::condition_variable condition{};
+        /// @brief  Requests in order, pending[next_pending, size) are not taken yet. A function is queued at most once, so it does not grow
+        ///         beyond the function count. Not a fast_io::deque: its emplace_back skips construct_at for trivially constructible elements, so
+        ///         a pushed index is never stored.
+        ::fast_io::vector<::std::size_t> pending{};
+        ::std::size_t next_pending{};
+        ::fast_io::vector<state_t> states{};
+        bool stopping{};
+        ::std::vector<::std::thread> workers{};
+
+        inline tiering_t() noexcept = default;
+        tiering_t(tiering_t const&) = delete;
+        tiering_t& operator= (tiering_t const&) = delete;
+
+        inline ~tiering_t() { this->stop(); }
+
+        /// @brief  A function found in `cache` is loaded by the worker instead of compiled
+        /// @return false if the jit or the target machine of a worker cannot be created, the module then stays interpreted
+        inline bool start(::uwvm2::non_img::uwvm_int::module_t& module,
+                          ::std::size_t thread_count = 1uz,
+                          ::std::uint_least32_t threshold = ::uwvm2::non_img::uwvm_int::default_tier_up_threshold,
+                          code_cache_t* cache = nullptr)
+        {
+            if(this->mod != nullptr || thread_count == 0uz) [[unlikely]] { return false; }
+            if(!this->jit.init(cache)) [[unlikely]] { return false; }
+
+            this->dylib = this->jit.create_dylib();
+            if(this->dylib == nullptr) [[unlikely]] { return false; }
+
+            // TargetMachine is not shared between threads, each worker owns one
+            ::std::vector<::std::unique_ptr<::llvm::TargetMachine>> target_machines{};
+            target_machines.reserve(thread_count);
+            for(::std::size_t i{}; i != thread_count; ++i)
+            {
+                auto target_machine{details::create_target_machine()};
+                if(target_machine == nullptr) [[unlikely]] { return false; }
+                target_machines.push_back(::std::move(target_machine));
+            }
+
+            this->mod = ::std::addressof(module);
+            this->type_ids = ::uwvm2::non_img::uwvm_int::details::get_type_ids(module);
+            this->module_hash = cache == nullptr ? ::std::string{} : details::get_module_hash(module);
+            this->states = ::fast_io::vector<state_t>(module.functions.size());
+            this->pending.clear();
+            this->pending.reserve(module.functions.size());
+            this->next_pending = 0uz;
+            this->stopping = false;
+
+            module.tier_up = {.request = &tiering_t::request, .tier_context = this, .threshold = threshold};
+
+            this->workers.reserve(thread_count);
+            for(auto& target_machine: target_machines)
+            {
+                this->workers.emplace_back([this, target_machine = ::std::move(target_machine)] { this->run_worker(*target_machine); });
+            }
+            return true;
+        }
+
+        /// @brief  Where the function `index` is, the workers change it concurrently
+        inline state_t get_state(::std::size_t index) noexcept
+        {
+            ::std::lock_guard guard{this->mutex};
+            return this->states.index_unchecked(index);
+        }
+
+        /// @brief  Drop the pending requests and wait for the workers, then give the module back to the interpreter
+        inline void stop() noexcept
+        {
+            if(this->mod == nullptr) { return; }
+
+            {
+                ::std::lock_guard guard{this->mutex};
+                this->stopping = true;
+            }
+            this->condition.notify_all();
+            for(auto& worker: this->workers) { worker.join(); }
+            this->workers.clear();
+
+            // The native code is freed with the jit
+            for(::std::size_t i{}; i != this->states.size(); ++i)
+            {
+                if(this->states.index_unchecked(i) == state_t::compiled) { this->mod->functions.index_unchecked(i).native = nullptr; }
+            }
+            this->mod->tier_up = {};
+            this->mod = nullptr;
+        }
+
+        /// @brief  tier_up_t::request, called by the interpreter thread that made `func` hot
+        inline static void request(::uwvm2::non_img::uwvm_int::function_t const* func, void* tier_context) noexcept
+        {
+            auto const self{static_cast<tiering_t*>(tier_context)};
+            auto const index{static_cast<::std::size_t>(func - self->mod->functions.cbegin())};
+
+            {
+                ::std::lock_guard guard{self->mutex};
+                auto& state{self->states.index_unchecked(index)};
+                if(state != state_t::interpreted || self->stopping) { return; }
+                state = state_t::queued;
+                self->pending.push_back(index);
+            }
+            self->condition.notify_one();
+        }
+
+        inline void run_worker(::llvm::TargetMachine& target_machine)
+        {
+            for(;;)
+            {
+                ::std::size_t index;
+                {
+                    ::std::unique_lock lock{this->mutex};
+                    this->condition.wait(lock, [this] { return this->stopping || this->next_pending != this->pending.size(); });
+                    if(this->stopping) { return; }
+                    index = this->pending.index_unchecked(this->next_pending++);
+                }
+
+                ::fast_io::vector<::std::size_t> function_indices{};
+                function_indices.push_back(index);
+                ::fast_io::vector<::uwvm2::non_img::uwvm_int::native_function_t> natives{};
+                if(!details::compile_functions(this->jit,
+                                               *this->dylib,
+                                               ::std::addressof(target_machine),
+                                               *this->mod,
+                                               this->type_ids,
+                                               this->module_hash,
+                                               function_indices,
+                                               natives))
+                    [[unlikely]]
+                {
+                    ::std::lock_guard guard{this->mutex};
+                    this->states.index_unchecked(index) = state_t::failed;
+                    continue;
+                }
+
+                {
+                    ::std::lock_guard guard{this->mutex};
+                    this->states.index_unchecked(index) = state_t::compiled;
+                }
+                ::std::atomic_ref{this->mod->functions.index_unchecked(index).native}.store(natives.front_unchecked(), ::std::memory_order_release);
+            }
+        }
+    };
+#endif
+}  // namespace uwvm2::non_img::llvm_jit
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
@@ -0,0 +1,1360 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.parser.wasm.standard.wasm1.type;
+import uwvm2.parser.wasm.standard.wasm1.opcode;
+import uwvm2.memory.linear;
+import uwvm2.non_img.uwvm_int;
+import :runtime;
+#else
+// std
+# include <cstddef>
+# include <cstdint>
+# include <cmath>
+# include <string>
+# include <limits>
+// llvm
+# ifdef UWVM_USE_LLVM_JIT
+#  include <llvm/ADT/SmallVector.h>
+#  include <llvm/ADT/Twine.h>
+#  include <llvm/IR/BasicBlock.h>
+#  include <llvm/IR/Constants.h>
+#  include <llvm/IR/DerivedTypes.h>
+#  include <llvm/IR/Function.h>
+#  include <llvm/IR/IRBuilder.h>
+#  include <llvm/IR/Intrinsics.h>
+#  include <llvm/IR/LLVMContext.h>
+#  include <llvm/IR/MDBuilder.h>
+#  include <llvm/IR/Module.h>
+# endif
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# include <fast_io_dsal/vector.h>
+# include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/opcode/impl.h>
+# include <uwvm2/memory/linear/impl.h>
+# include <uwvm2/non-img/int/uwvm-int/impl.h>
+# include "runtime.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::non_img::llvm_jit
+{
+#ifdef UWVM_USE_LLVM_JIT
+    namespace details
+    {
+        using value_type = ::uwvm2::parser::wasm::standard::wasm1::type::value_type;
+        using slot_t = ::uwvm2::non_img::uwvm_int::slot_t;
+        using trap_t = ::uwvm2::non_img::uwvm_int::trap_t;
+        using context_t = ::uwvm2::non_img::uwvm_int::context_t;
+        using native_memory_t = ::uwvm2::memory::linear::native_memory_t;
+
+        inline constexpr ::std::size_t trap_count{static_cast<::std::size_t>(trap_t::host_trap) + 1uz};
+
+        /// @brief  Symbol of a function with its wasm signature: (context, frame, parameters) -> result
+        inline ::std::string body_symbol(::std::size_t function_index)
+        {
+            return (::llvm::Twine{"uwvm_wasm_function_"} + ::llvm::Twine{static_cast<::std::uint_least64_t>(function_index)}).str();
+        }
+
+        /// @brief  Symbol of the native_function_t of a function
+        inline ::std::string entry_symbol(::std::size_t function_index)
+        {
+            return (::llvm::Twine{"uwvm_native_function_"} + ::llvm::Twine{static_cast<::std::uint_least64_t>(function_index)}).str();
+        }
+
+        inline ::llvm::Type* get_value_type(::llvm::LLVMContext& context, value_type type) noexcept
+        {
+            switch(type)
+            {
+                case value_type::i32: return ::llvm::Type::getInt32Ty(context);
+                case value_type::i64: return ::llvm::Type::getInt64Ty(context);
+                case value_type::f32: return ::llvm::Type::getFloatTy(context);
+                case value_type::f64: return ::llvm::Type::getDoubleTy(context);
+                [[unlikely]] default: return nullptr;
+            }
+        }
+
+        inline ::llvm::PointerType* get_pointer_type(::llvm::LLVMContext& context) noexcept
+        {
+            return ::llvm::PointerType::getUnqual(::llvm::Type::getInt8Ty(context));
+        }
+
+        inline ::llvm::IntegerType* get_size_type(::llvm::LLVMContext& context) noexcept
+        {
+            return ::llvm::Type::getIntNTy(context, static_cast<unsigned>(sizeof(::std::size_t) * 8u));
+        }
+
+        /// @brief  Declare the function with the wasm signature, `linkage` is internal when all its callers are compiled with it
+        inline ::llvm::Function* declare_body(::llvm::Module& module,
+                                              ::uwvm2::non_img::uwvm_int::module_t const& mod,
+                                              ::std::size_t function_index,
+                                              ::llvm::GlobalValue::LinkageTypes linkage)
+        {
+            auto& context{module.getContext()};
+            auto const& func{mod.functions.index_unchecked(function_index)};
+            auto const& type{mod.types.index_unchecked(func.type_index)};
+
+            ::llvm::SmallVector<::llvm::Type*, 8u> params{get_pointer_type(context), get_pointer_type(context)};
+            for(auto curr{type.parameter_begin}; curr != type.parameter_end; ++curr) { params.push_back(get_value_type(context, *curr)); }
+            auto const result{type.result_begin == type.result_end ? ::llvm::Type::getVoidTy(context) : get_value_type(context, *type.result_begin)};
+
+            auto const body{::llvm::Function::Create(::llvm::FunctionType::get(result, params, false), linkage, body_symbol(function_index), module)};
+            body->addFnAttr(::llvm::Attribute::NoUnwind);
+            return body;
+        }
+
+        inline ::llvm::Value* to_slot(::llvm::IRBuilder<>& builder, ::llvm::Value* value)
+        {
+            auto const type{value->getType()};
+            if(type->isFloatTy()) { value = builder.CreateBitCast(value, builder.getInt32Ty()); }
+            else if(type->isDoubleTy()) { return builder.CreateBitCast(value, builder.getInt64Ty()); }
+            // i32 is stored zero extended, as by the interpreter
+            return builder.CreateZExt(value, builder.getInt64Ty());
+        }
+
+        inline ::llvm::Value* from_slot(::llvm::IRBuilder<>& builder, ::llvm::Value* slot, ::llvm::Type* type)
+        {
+            if(type->isIntegerTy(64u)) { return slot; }
+            if(type->isDoubleTy()) { return builder.CreateBitCast(slot, type); }
+            auto const low{builder.CreateTrunc(slot, builder.getInt32Ty())};
+            return type->isFloatTy() ? builder.CreateBitCast(low, type) : low;
+        }
+
+        /// @brief  Define the native_function_t of a function: the arguments are read from the frame and the result is written back
+        inline ::llvm::Function* define_entry(::llvm::Module& module,
+                                              ::uwvm2::non_img::uwvm_int::module_t const& mod,
+                                              ::std::size_t function_index,
+                                              ::llvm::Function* body)
+        {
+            auto& context{module.getContext()};
+            auto const& func{mod.functions.index_unchecked(function_index)};
+            auto const& type{mod.types.index_unchecked(func.type_index)};
+            auto const ptr_type{get_pointer_type(context)};
+
+            auto const entry{::llvm::Function::Create(::llvm::FunctionType::get(::llvm::Type::getVoidTy(context), {ptr_type, ptr_type}, false),
+                                                      ::llvm::GlobalValue::ExternalLinkage,
+                                                      entry_symbol(function_index),
+                                                      module)};
+            entry->addFnAttr(::llvm::Attribute::NoUnwind);
+
+            ::llvm::IRBuilder<> builder{::llvm::BasicBlock::Create(context, "entry", entry)};
+            auto const fp{builder.CreateBitCast(entry->getArg(0u), ::llvm::PointerType::getUnqual(builder.getInt64Ty()))};
+
+            ::llvm::SmallVector<::llvm::Value*, 8u> args{entry->getArg(1u), entry->getArg(0u)};
+            for(auto curr{type.parameter_begin}; curr != type.parameter_end; ++curr)
+            {
+                auto const slot_ptr{builder.CreateConstInBoundsGEP1_64(builder.getInt64Ty(), fp, static_cast<::std::uint_least64_t>(curr - type.parameter_begin))};
+                args.push_back(from_slot(builder, builder.CreateLoad(builder.getInt64Ty(), slot_ptr), get_value_type(context, *curr)));
+            }
+
+            auto const result{builder.CreateCall(body, args)};
+            // The result of a trapped call is undefined, nothing reads it
+            if(type.result_begin != type.result_end) { builder.CreateStore(to_slot(builder, result), fp); }
+            builder.CreateRetVoid();
+            return entry;
+        }
+
+        enum class control_kind_t : unsigned
+        {
+            block,
+            loop,
+            if_,
+            function
+        };
+
+        struct control_t
+        {
+            control_kind_t kind{};
+            ::std::size_t height{};
+            /// @brief  nullptr for the empty block type
+            ::llvm::Type* result_type{};
+            /// @brief  Branch target: the continuation after end, the header of a loop
+            ::llvm::BasicBlock* label{};
+            /// @brief  if: the else branch until else (or end) is reached
+            ::llvm::BasicBlock* else_block{};
+            /// @brief  The branches to the label store the result here, SROA turns it into a phi
+            ::llvm::AllocaInst* result{};
+            /// @brief  Starts in unreachable code, nothing is generated until its end
+            bool dead{};
+        };
+
+        /// @brief      Translate one validated function body to LLVM IR
+        /// @details    The operand stack only exists during the translation: it holds the values, locals and block results are allocas that SROA
+        ///             promotes. Calls to functions in `bodies` are direct, the others go through the runtime with the arguments in the frame.
+        ///             A trap stores its reason in the context and returns, the caller checks the context after each call. Bounds checks are
+        ///             emitted only when native_memory_t needs them, a guarded memory faults instead.
+        struct function_translation_t
+        {
+            ::uwvm2::non_img::uwvm_int::module_t const& mod;
+            ::fast_io::vector<::std::size_t> const& type_ids;
+            /// @brief  Bodies of the functions compiled with this one by function index, nullptr for the others
+            ::fast_io::vector<::llvm::Function*> const& bodies;
+            ::std::size_t function_index{};
+            ::llvm::Function* function{};
+
+            ::llvm::LLVMContext& context{function->getContext()};
+            ::llvm::IRBuilder<> builder{function->getContext()};
+            ::llvm::Type* i8_type{::llvm::Type::getInt8Ty(context)};
+            ::llvm::IntegerType* i32_type{::llvm::Type::getInt32Ty(context)};
+            ::llvm::IntegerType* i64_type{::llvm::Type::getInt64Ty(context)};
+            ::llvm::IntegerType* size_type{get_size_type(context)};
+            ::llvm::PointerType* ptr_type{get_pointer_type(context)};
+
+            ::llvm::Value* ctx{};
+            ::llvm::Value* fp{};
+            ::llvm::Value* globals{};
+            ::fast_io::vector<::llvm::AllocaInst*> locals{};
+            ::fast_io::vector<::llvm::Value*> operands{};
+            ::fast_io::vector<control_t> controls{};
+            bool unreachable{};
+
+            /// @brief  The branch at the end of the entry block, allocas and the first reads of the memory are inserted before it
+            ::llvm::Instruction* entry_end{};
+            /// @brief  Base and length of the memory, read again after each call when memory.grow can move the memory
+            ::llvm::AllocaInst* memory_begin{};
+            ::llvm::AllocaInst* memory_length{};
+            bool uses_memory{};
+            ::fast_io::vector<::llvm::Instruction*> memory_reload_points{};
+
+            ::llvm::BasicBlock* trap_blocks[trap_count]{};
+            ::llvm::BasicBlock* trapped_block{};
+
+            inline ::llvm::Value* context_field(::llvm::IRBuilder<>& b, ::std::size_t offset, ::llvm::Type* type)
+            {
+                auto const ptr{b.CreateConstInBoundsGEP1_64(this->i8_type, this->ctx, static_cast<::std::uint_least64_t>(offset))};
+                return b.CreateBitCast(ptr, ::llvm::PointerType::getUnqual(type));
+            }
+
+            inline ::llvm::AllocaInst* entry_alloca(::llvm::Type* type)
+            {
+                ::llvm::IRBuilder<> b{this->entry_end};
+                return b.CreateAlloca(type);
+            }
+
+            inline ::llvm::BasicBlock* new_block() { return ::llvm::BasicBlock::Create(this->context, "", this->function); }
+
+            inline void push(::llvm::Value* value) { this->operands.push_back(value); }
+
+            inline ::llvm::Value* pop() noexcept
+            {
+                auto const value{this->operands.back_unchecked()};
+                this->operands.pop_back_unchecked();
+                return value;
+            }
+
+            inline void return_undefined(::llvm::IRBuilder<>& b)
+            {
+                auto const result_type{this->function->getReturnType()};
+                if(result_type->isVoidTy()) { b.CreateRetVoid(); }
+                else
+                {
+                    b.CreateRet(::llvm::UndefValue::get(result_type));
+                }
+            }
+
+            /// @brief  Block that stores `trap` in the context and returns, one per trap and function
+            inline ::llvm::BasicBlock* trap_block(trap_t trap)
+            {
+                auto& block{this->trap_blocks[static_cast<::std::size_t>(trap)]};
+                if(block == nullptr)
+                {
+                    block = this->new_block();
+                    ::llvm::IRBuilder<> b{block};
+                    b.CreateStore(b.getInt32(static_cast<::std::uint_least32_t>(trap)), this->context_field(b, offsetof(context_t, trap), this->i32_type));
+                    this->return_undefined(b);
+                }
+                return block;
+            }
+
+            inline void branch_unlikely(::llvm::Value* condition, ::llvm::BasicBlock* target)
+            {
+                auto const next{this->new_block()};
+                this->builder.CreateCondBr(condition, target, next, ::llvm::MDBuilder{this->context}.createBranchWeights(1u, 1u << 20u));
+                this->builder.SetInsertPoint(next);
+            }
+
+            inline void trap_if(::llvm::Value* condition, trap_t trap) { this->branch_unlikely(condition, this->trap_block(trap)); }
+
+            /// @brief  After a call: return if the callee trapped, ctx->trap is already set
+            inline void check_trapped(::llvm::Value* trap)
+            {
+                if(this->trapped_block == nullptr)
+                {
+                    this->trapped_block = this->new_block();
+                    ::llvm::IRBuilder<> b{this->trapped_block};
+                    this->return_undefined(b);
+                }
+                this->branch_unlikely(this->builder.CreateICmpNE(trap, this->builder.getInt32(0u)), this->trapped_block);
+            }
+
+            inline void set_unreachable() noexcept
+            {
+                this->unreachable = true;
+                this->operands.resize(this->controls.back_unchecked().height);
+            }
+
+            inline bool read_block_type(::uwvm2::non_img::uwvm_int::details::code_reader_t& reader, ::llvm::Type*& type) noexcept
+            {
+                ::std::uint_least8_t block_type;
+                if(!reader.read_byte(block_type)) [[unlikely]] { return false; }
+                if(block_type == 0x40u)
+                {
+                    type = nullptr;
+                    return true;
+                }
+                type = get_value_type(this->context, static_cast<value_type>(block_type));
+                return type != nullptr;
+            }
+
+            inline void push_control(control_kind_t kind, ::llvm::Type* result_type, ::llvm::BasicBlock* label, ::llvm::BasicBlock* else_block)
+            {
+                ::llvm::AllocaInst* result{};
+                if(!this->unreachable && kind != control_kind_t::loop && result_type != nullptr) { result = this->entry_alloca(result_type); }
+                this->controls.push_back(control_t{.kind = kind,
+                                                   .height = this->operands.size(),
+                                                   .result_type = result_type,
+                                                   .label = label,
+                                                   .else_block = else_block,
+                                                   .result = result,
+                                                   .dead = this->unreachable});
+            }
+
+            /// @brief  Store the values a branch to `target` carries (none for a loop)
+            inline void store_label_values(control_t const& target)
+            {
+                if(target.result != nullptr) { this->builder.CreateStore(this->operands.back_unchecked(), target.result); }
+            }
+
+            inline control_t& label_of(::std::size_t depth) noexcept { return this->controls.index_unchecked(this->controls.size() - 1uz - depth); }
+
+            /// @brief  Pointer to `size` bytes at address + offset, traps when they are out of bounds
+            inline ::llvm::Value* memory_address(::llvm::Value* address, ::std::size_t offset, ::std::size_t size)
+            {
+                this->uses_memory = true;
+
+                // i32 address + u32 offset does not overflow 64 bits
+                auto const effective{this->builder.CreateAdd(this->builder.CreateZExt(address, this->i64_type),
+                                                             this->builder.getInt64(static_cast<::std::uint_least64_t>(offset)),
+                                                             "",
+                                                             true)};
+                if constexpr(native_memory_t::explicit_bounds_check)
+                {
+                    auto const length{this->builder.CreateZExtOrTrunc(this->builder.CreateLoad(this->size_type, this->memory_length), this->i64_type)};
+                    auto const end{this->builder.CreateAdd(effective, this->builder.getInt64(static_cast<::std::uint_least64_t>(size)), "", true)};
+                    this->trap_if(this->builder.CreateICmpUGT(end, length), trap_t::memory_out_of_bounds);
+                }
+
+                auto const begin{this->builder.CreateLoad(this->ptr_type, this->memory_begin)};
+                return this->builder.CreateInBoundsGEP(this->i8_type, begin, this->builder.CreateZExtOrTrunc(effective, this->size_type));
+            }
+
+            /// @brief  Read the base and the length of the memory at the entry and after the points where memory.grow may have moved it
+            inline void load_memory(::llvm::Instruction* before)
+            {
+                ::llvm::IRBuilder<> b{before};
+                auto const memory{b.CreateLoad(this->ptr_type, this->context_field(b, offsetof(context_t, memory), this->ptr_type))};
+                auto const field{[&](::std::size_t offset, ::llvm::Type* type)
+                                 {
+                                     auto const ptr{b.CreateConstInBoundsGEP1_64(this->i8_type, memory, static_cast<::std::uint_least64_t>(offset))};
+                                     return b.CreateLoad(type, b.CreateBitCast(ptr, ::llvm::PointerType::getUnqual(type)));
+                                 }};
+                b.CreateStore(field(offsetof(native_memory_t, memory_begin), this->ptr_type), this->memory_begin);
+                b.CreateStore(field(offsetof(native_memory_t, memory_length), this->size_type), this->memory_length);
+            }
+
+            /// @brief  Mark the instruction after a call that may have grown the memory
+            inline void reload_memory_here()
+            {
+                if constexpr(native_memory_t::explicit_bounds_check)
+                {
+                    // The next instruction does not exist yet, a placeholder marks the point (the builder would fold a constant add)
+                    auto const zero{this->builder.getInt32(0u)};
+                    this->memory_reload_points.push_back(this->builder.Insert(::llvm::BinaryOperator::Create(::llvm::Instruction::Add, zero, zero)));
+                }
+            }
+
+            inline bool load(::uwvm2::non_img::uwvm_int::details::code_reader_t& reader, ::llvm::Type* stored, ::llvm::Type* result, bool is_signed)
+            {
+                ::std::size_t align, offset;
+                if(!reader.read_u32(align) || !reader.read_u32(offset)) [[unlikely]] { return false; }
+                if(this->unreachable) { return true; }
+
+                auto const size{static_cast<::std::size_t>(stored->getPrimitiveSizeInBits() / 8u)};
+                auto const ptr{this->builder.CreateBitCast(this->memory_address(this->pop(), offset, size), ::llvm::PointerType::getUnqual(stored))};
+                ::llvm::Value* value{this->builder.CreateAlignedLoad(stored, ptr, ::llvm::MaybeAlign{1u})};
+                if(stored != result) { value = is_signed ? this->builder.CreateSExt(value, result) : this->builder.CreateZExt(value, result); }
+                this->push(value);
+                return true;
+            }
+
+            /// @brief  The value is truncated to `stored` when it is narrower
+            inline bool store(::uwvm2::non_img::uwvm_int::details::code_reader_t& reader, ::llvm::Type* stored)
+            {
+                ::std::size_t align, offset;
+                if(!reader.read_u32(align) || !reader.read_u32(offset)) [[unlikely]] { return false; }
+                if(this->unreachable) { return true; }
+
+                auto value{this->pop()};
+                auto const address{this->pop()};
+                if(value->getType() != stored) { value = this->builder.CreateTrunc(value, stored); }
+
+                auto const size{static_cast<::std::size_t>(stored->getPrimitiveSizeInBits() / 8u)};
+                auto const ptr{this->builder.CreateBitCast(this->memory_address(address, offset, size), ::llvm::PointerType::getUnqual(stored))};
+                this->builder.CreateAlignedStore(value, ptr, ::llvm::MaybeAlign{1u});
+                return true;
+            }
+
+            inline ::llvm::FunctionCallee runtime_function(char const* name, ::llvm::Type* result, ::llvm::ArrayRef<::llvm::Type*> params)
+            {
+                auto callee{this->function->getParent()->getOrInsertFunction(name, ::llvm::FunctionType::get(result, params, false))};
+                if(auto const f{::llvm::dyn_cast<::llvm::Function>(callee.getCallee())}; f != nullptr) { f->addFnAttr(::llvm::Attribute::NoUnwind); }
+                return callee;
+            }
+
+            /// @brief  Call through the runtime: the arguments are written to the frame and the results read from it
+            template <typename... Args>
+            inline void runtime_call(::uwvm2::non_img::uwvm_int::function_type_t const& type, char const* name, Args... args)
+            {
+                auto const param_count{static_cast<::std::size_t>(type.parameter_end - type.parameter_begin)};
+                auto const base{this->operands.size() - param_count};
+                auto const slots{this->builder.CreateBitCast(this->fp, ::llvm::PointerType::getUnqual(this->i64_type))};
+                for(::std::size_t i{}; i != param_count; ++i)
+                {
+                    auto const slot_ptr{this->builder.CreateConstInBoundsGEP1_64(this->i64_type, slots, static_cast<::std::uint_least64_t>(i))};
+                    this->builder.CreateStore(to_slot(this->builder, this->operands.index_unchecked(base + i)), slot_ptr);
+                }
+                this->operands.resize(base);
+
+                ::llvm::Type* const params[]{this->ptr_type, this->ptr_type, args->getType()...};
+                auto const trap{this->builder.CreateCall(this->runtime_function(name, this->i32_type, params), {this->ctx, this->fp, args...})};
+                this->check_trapped(trap);
+                this->reload_memory_here();
+
+                if(type.result_begin != type.result_end)
+                {
+                    auto const slot{this->builder.CreateLoad(this->i64_type, slots)};
+                    this->push(from_slot(this->builder, slot, get_value_type(this->context, *type.result_begin)));
+                }
+            }
+
+            /// @brief  Direct call of a function compiled with this one, the depth is counted as by the interpreter
+            inline void direct_call(::llvm::Function* callee)
+            {
+                auto const depth_ptr{this->context_field(this->builder, offsetof(context_t, call_depth), this->size_type)};
+                auto const depth{this->builder.CreateLoad(this->size_type, depth_ptr)};
+                auto const max_depth{this->builder.CreateLoad(this->size_type, this->context_field(this->builder, offsetof(context_t, max_call_depth), this->size_type))};
+                this->trap_if(this->builder.CreateICmpEQ(depth, max_depth), trap_t::call_stack_exhausted);
+                this->builder.CreateStore(this->builder.CreateAdd(depth, ::llvm::ConstantInt::get(this->size_type, 1u)), depth_ptr);
+
+                auto const param_count{static_cast<::std::size_t>(callee->arg_size() - 2u)};
+                auto const base{this->operands.size() - param_count};
+                ::llvm::SmallVector<::llvm::Value*, 8u> args{this->ctx, this->fp};
+                for(::std::size_t i{}; i != param_count; ++i) { args.push_back(this->operands.index_unchecked(base + i)); }
+                this->operands.resize(base);
+
+                auto const result{this->builder.CreateCall(callee, args)};
+                this->builder.CreateStore(depth, depth_ptr);
+                this->check_trapped(this->builder.CreateLoad(this->i32_type, this->context_field(this->builder, offsetof(context_t, trap), this->i32_type)));
+                this->reload_memory_here();
+
+                if(!callee->getReturnType()->isVoidTy()) { this->push(result); }
+            }
+
+            template <typename Create>
+            inline void unary(Create create)
+            {
+                if(this->unreachable) { return; }
+                auto const a{this->pop()};
+                this->push(create(a));
+            }
+
+            template <typename Create>
+            inline void binary(Create create)
+            {
+                if(this->unreachable) { return; }
+                auto const b{this->pop()};
+                auto const a{this->pop()};
+                this->push(create(a, b));
+            }
+
+            /// @brief  Comparisons produce an i32 0 or 1
+            inline void compare(::llvm::CmpInst::Predicate predicate)
+            {
+                this->binary([&](::llvm::Value* a, ::llvm::Value* b)
+                             { return this->builder.CreateZExt(this->builder.CreateCmp(predicate, a, b), this->i32_type); });
+            }
+
+            inline void eqz()
+            {
+                this->unary([&](::llvm::Value* a)
+                            { return this->builder.CreateZExt(this->builder.CreateICmpEQ(a, ::llvm::ConstantInt::get(a->getType(), 0u)), this->i32_type); });
+            }
+
+            /// @brief  The shift count is taken modulo the bit width
+            inline void shift(::llvm::Instruction::BinaryOps op)
+            {
+                this->binary(
+                    [&](::llvm::Value* a, ::llvm::Value* b)
+                    {
+                        auto const mask{::llvm::ConstantInt::get(a->getType(), a->getType()->getIntegerBitWidth() - 1u)};
+                        return this->builder.CreateBinOp(op, a, this->builder.CreateAnd(b, mask));
+                    });
+            }
+
+            inline void rotate(::llvm::Intrinsic::ID id)
+            {
+                this->binary([&](::llvm::Value* a, ::llvm::Value* b) { return this->builder.CreateIntrinsic(id, {a->getType()}, {a, a, b}); });
+            }
+
+            inline void count_bits(::llvm::Intrinsic::ID id)
+            {
+                this->unary(
+                    [&](::llvm::Value* a) -> ::llvm::Value*
+                    {
+                        if(id == ::llvm::Intrinsic::ctpop) { return this->builder.CreateUnaryIntrinsic(id, a); }
+                        // Defined for zero: the bit width
+                        return this->builder.CreateIntrinsic(id, {a->getType()}, {a, this->builder.getFalse()});
+                    });
+            }
+
+            /// @brief  div and rem trap on a zero divisor, div_s also on INT_MIN / -1
+            inline void divide(::llvm::Instruction::BinaryOps op)
+            {
+                if(this->unreachable) { return; }
+                auto const b{this->pop()};
+                auto a{this->pop()};
+                auto const type{::llvm::cast<::llvm::IntegerType>(a->getType())};
+
+                this->trap_if(this->builder.CreateICmpEQ(b, ::llvm::ConstantInt::get(type, 0u)), trap_t::integer_divide_by_zero);
+
+                auto divisor{b};
+                if(op == ::llvm::Instruction::SDiv)
+                {
+                    auto const min{::llvm::ConstantInt::get(type, ::llvm::APInt::getSignedMinValue(type->getBitWidth()))};
+                    auto const overflow{this->builder.CreateAnd(this->builder.CreateICmpEQ(a, min),
+                                                                this->builder.CreateICmpEQ(b, ::llvm::ConstantInt::getSigned(type, -1)))};
+                    this->trap_if(overflow, trap_t::integer_overflow);
+                }
+                else if(op == ::llvm::Instruction::SRem)
+                {
+                    // x rem -1 is 0, also for INT_MIN where srem is undefined
+                    divisor = this->builder.CreateSelect(this->builder.CreateICmpEQ(b, ::llvm::ConstantInt::getSigned(type, -1)),
+                                                         ::llvm::ConstantInt::get(type, 1u),
+                                                         b);
+                }
+
+                this->push(this->builder.CreateBinOp(op, a, divisor));
+            }
+
+            /// @brief  NaN if either operand is NaN, -0 is less than +0
+            inline void min_max(bool is_min)
+            {
+                this->binary(
+                    [&](::llvm::Value* a, ::llvm::Value* b)
+                    {
+                        auto const type{a->getType()};
+                        auto const bits_type{this->builder.getIntNTy(type->getPrimitiveSizeInBits())};
+                        auto const a_bits{this->builder.CreateBitCast(a, bits_type)};
+                        auto const b_bits{this->builder.CreateBitCast(b, bits_type)};
+                        auto const equal{this->builder.CreateBitCast(is_min ? this->builder.CreateOr(a_bits, b_bits) : this->builder.CreateAnd(a_bits, b_bits), type)};
+                        auto const ordered{this->builder.CreateSelect(is_min ? this->builder.CreateFCmpOLT(a, b) : this->builder.CreateFCmpOGT(a, b), a, b)};
+                        auto const value{this->builder.CreateSelect(this->builder.CreateFCmpOEQ(a, b), equal, ordered)};
+                        return this->builder.CreateSelect(this->builder.CreateFCmpUNO(a, b), this->builder.CreateFAdd(a, b), value);
+                    });
+            }
+
+            inline void float_unary(::llvm::Intrinsic::ID id)
+            {
+                this->unary([&](::llvm::Value* a) { return this->builder.CreateUnaryIntrinsic(id, a); });
+            }
+
+            inline void convert(::llvm::Instruction::CastOps op, ::llvm::Type* type)
+            {
+                this->unary([&](::llvm::Value* a) { return this->builder.CreateCast(op, a, type); });
+            }
+
+            /// @brief  iNN.trunc_fMM_s/u: NaN is an invalid conversion, a truncated value outside of the integer range overflows
+            inline void trunc(::llvm::IntegerType* type, bool is_signed)
+            {
+                if(this->unreachable) { return; }
+                auto const value{this->pop()};
+
+                this->trap_if(this->builder.CreateFCmpUNO(value, value), trap_t::invalid_conversion_to_integer);
+
+                // f32 and f64 convert to double exactly, the bounds are powers of two
+                auto const bits{type->getBitWidth()};
+                auto const lower{is_signed ? -::std::ldexp(1.0, static_cast<int>(bits - 1u)) : 0.0};
+                auto const upper{::std::ldexp(1.0, static_cast<int>(is_signed ? bits - 1u : bits))};
+                auto const as_double{this->builder.CreateFPExt(value, this->builder.getDoubleTy())};
+                auto const t{this->builder.CreateUnaryIntrinsic(::llvm::Intrinsic::trunc, as_double)};
+                auto const in_range{this->builder.CreateAnd(this->builder.CreateFCmpOGE(t, ::llvm::ConstantFP::get(this->builder.getDoubleTy(), lower)),
+                                                            this->builder.CreateFCmpOLT(t, ::llvm::ConstantFP::get(this->builder.getDoubleTy(), upper)))};
+                this->trap_if(this->builder.CreateNot(in_range), trap_t::integer_overflow);
+
+                this->push(is_signed ? this->builder.CreateFPToSI(value, type) : this->builder.CreateFPToUI(value, type));
+            }
+
+            inline bool translate()
+            {
+                using op_basic = ::uwvm2::parser::wasm::standard::wasm1::opcode::op_basic;
+
+                auto const& func{this->mod.functions.index_unchecked(this->function_index)};
+                auto const& type{this->mod.types.index_unchecked(func.type_index)};
+                auto& builder_{this->builder};
+
+                // Entry: the locals and the pointers that do not change
+                auto const entry{this->new_block()};
+                auto const start{this->new_block()};
+                builder_.SetInsertPoint(entry);
+                this->entry_end = builder_.CreateBr(start);
+                builder_.SetInsertPoint(this->entry_end);
+
+                this->ctx = this->function->getArg(0u);
+                this->fp = this->function->getArg(1u);
+
+                for(auto curr{type.parameter_begin}; curr != type.parameter_end; ++curr)
+                {
+                    auto const local{builder_.CreateAlloca(get_value_type(this->context, *curr))};
+                    builder_.CreateStore(this->function->getArg(static_cast<unsigned>(curr - type.parameter_begin) + 2u), local);
+                    this->locals.push_back(local);
+                }
+                for(auto curr{func.body.local_begin}; curr != func.body.local_end; ++curr)
+                {
+                    auto const local_type{get_value_type(this->context, curr->type)};
+                    if(local_type == nullptr) [[unlikely]] { return false; }
+                    for(::std::uint_least32_t i{}; i != curr->count; ++i)
+                    {
+                        auto const local{builder_.CreateAlloca(local_type)};
+                        builder_.CreateStore(::llvm::Constant::getNullValue(local_type), local);
+                        this->locals.push_back(local);
+                    }
+                }
+                if(this->locals.size() != func.local_count) [[unlikely]] { return false; }
+
+                this->globals = builder_.CreateLoad(this->ptr_type, this->context_field(builder_, offsetof(context_t, globals), this->ptr_type));
+                this->memory_begin = builder_.CreateAlloca(this->ptr_type);
+                this->memory_length = builder_.CreateAlloca(this->size_type);
+
+                builder_.SetInsertPoint(start);
+
+                // The function is the outermost label, its end is the final return
+                auto const result_type{type.result_begin == type.result_end ? nullptr : get_value_type(this->context, *type.result_begin)};
+                this->push_control(control_kind_t::function, result_type, this->new_block(), nullptr);
+
+                ::uwvm2::non_img::uwvm_int::details::code_reader_t reader{func.body.expr_begin, func.body.code_end};
+
+                while(!this->controls.empty())
+                {
+                    ::std::uint_least8_t opcode;
+                    if(!reader.read_byte(opcode)) [[unlikely]] { return false; }
+
+                    switch(static_cast<op_basic>(opcode))
+                    {
+                        // Control
+                        case op_basic::unreachable:
+                        {
+                            if(this->unreachable) { break; }
+                            builder_.CreateBr(this->trap_block(trap_t::unreachable));
+                            this->set_unreachable();
+                            break;
+                        }
+                        case op_basic::nop:
+                        {
+                            break;
+                        }
+                        case op_basic::block:
+                        {
+                            ::llvm::Type* block_type;
+                            if(!this->read_block_type(reader, block_type)) [[unlikely]] { return false; }
+                            this->push_control(control_kind_t::block, block_type, this->unreachable ? nullptr : this->new_block(), nullptr);
+                            break;
+                        }
+                        case op_basic::loop:
+                        {
+                            ::llvm::Type* block_type;
+                            if(!this->read_block_type(reader, block_type)) [[unlikely]] { return false; }
+                            ::llvm::BasicBlock* header{};
+                            if(!this->unreachable)
+                            {
+                                header = this->new_block();
+                                builder_.CreateBr(header);
+                                builder_.SetInsertPoint(header);
+                            }
+                            this->push_control(control_kind_t::loop, block_type, header, nullptr);
+                            break;
+                        }
+                        case op_basic::if_:
+                        {
+                            ::llvm::Type* block_type;
+                            if(!this->read_block_type(reader, block_type)) [[unlikely]] { return false; }
+                            if(this->unreachable)
+                            {
+                                this->push_control(control_kind_t::if_, block_type, nullptr, nullptr);
+                                break;
+                            }
+
+                            auto const condition{builder_.CreateICmpNE(this->pop(), builder_.getInt32(0u))};
+                            auto const then_block{this->new_block()};
+                            auto const else_block{this->new_block()};
+                            builder_.CreateCondBr(condition, then_block, else_block);
+                            builder_.SetInsertPoint(then_block);
+                            this->push_control(control_kind_t::if_, block_type, this->new_block(), else_block);
+                            break;
+                        }
+                        case op_basic::else_:
+                        {
+                            auto& frame{this->controls.back_unchecked()};
+                            if(frame.dead) { break; }
+
+                            if(!this->unreachable)
+                            {
+                                this->store_label_values(frame);
+                                builder_.CreateBr(frame.label);
+                            }
+                            builder_.SetInsertPoint(frame.else_block);
+                            frame.else_block = nullptr;
+                            this->operands.resize(frame.height);
+                            this->unreachable = false;
+                            break;
+                        }
+                        case op_basic::end:
+                        {
+                            auto const frame{this->controls.back_unchecked()};
+                            this->controls.pop_back_unchecked();
+                            if(frame.dead) { break; }
+
+                            if(frame.kind == control_kind_t::loop)
+                            {
+                                // Falls through with its result on the stack, nothing branches to its end
+                                if(this->unreachable) { this->operands.resize(frame.height); }
+                                break;
+                            }
+
+                            if(!this->unreachable)
+                            {
+                                this->store_label_values(frame);
+                                builder_.CreateBr(frame.label);
+                            }
+                            if(frame.else_block != nullptr)
+                            {
+                                // if without else, it has no result
+                                builder_.SetInsertPoint(frame.else_block);
+                                builder_.CreateBr(frame.label);
+                            }
+
+                            this->operands.resize(frame.height);
+                            if(frame.label->hasNPredecessors(0u))
+                            {
+                                frame.label->eraseFromParent();
+                                this->unreachable = true;
+                                break;
+                            }
+
+                            builder_.SetInsertPoint(frame.label);
+                            this->unreachable = false;
+                            if(frame.result != nullptr) { this->push(builder_.CreateLoad(frame.result_type, frame.result)); }
+                            break;
+                        }
+                        case op_basic::br:
+                        {
+                            ::std::size_t depth;
+                            if(!reader.read_u32(depth)) [[unlikely]] { return false; }
+                            if(this->unreachable) { break; }
+                            if(depth >= this->controls.size()) [[unlikely]] { return false; }
+
+                            auto const& target{this->label_of(depth)};
+                            this->store_label_values(target);
+                            builder_.CreateBr(target.label);
+                            this->set_unreachable();
+                            break;
+                        }
+                        case op_basic::br_if:
+                        {
+                            ::std::size_t depth;
+                            if(!reader.read_u32(depth)) [[unlikely]] { return false; }
+                            if(this->unreachable) { break; }
+                            if(depth >= this->controls.size()) [[unlikely]] { return false; }
+
+                            auto const condition{builder_.CreateICmpNE(this->pop(), builder_.getInt32(0u))};
+                            auto const& target{this->label_of(depth)};
+                            this->store_label_values(target);
+                            auto const next{this->new_block()};
+                            builder_.CreateCondBr(condition, target.label, next);
+                            builder_.SetInsertPoint(next);
+                            break;
+                        }
+                        case op_basic::br_table:
+                        {
+                            ::std::size_t label_count;
+                            if(!reader.read_u32(label_count)) [[unlikely]] { return false; }
+
+                            ::fast_io::vector<::std::size_t> depths{};
+                            for(::std::size_t i{}; i != label_count + 1uz; ++i)
+                            {
+                                ::std::size_t depth;
+                                if(!reader.read_u32(depth)) [[unlikely]] { return false; }
+                                if(depth >= this->controls.size()) [[unlikely]] { return false; }
+                                depths.push_back(depth);
+                            }
+                            if(this->unreachable) { break; }
+
+                            auto const index{this->pop()};
+                            for(auto const depth: depths) { this->store_label_values(this->label_of(depth)); }
+
+                            auto const table{builder_.CreateSwitch(index, this->label_of(depths.back_unchecked()).label, static_cast<unsigned>(label_count))};
+                            for(::std::size_t i{}; i != label_count; ++i)
+                            {
+                                table->addCase(builder_.getInt32(static_cast<::std::uint_least32_t>(i)), this->label_of(depths.index_unchecked(i)).label);
+                            }
+                            this->set_unreachable();
+                            break;
+                        }
+                        case op_basic::return_:
+                        {
+                            if(this->unreachable) { break; }
+                            auto const& target{this->controls.front_unchecked()};
+                            this->store_label_values(target);
+                            builder_.CreateBr(target.label);
+                            this->set_unreachable();
+                            break;
+                        }
+                        case op_basic::call:
+                        {
+                            ::std::size_t callee_idx;
+                            if(!reader.read_u32(callee_idx)) [[unlikely]] { return false; }
+                            if(this->unreachable) { break; }
+                            if(callee_idx >= this->mod.functions.size()) [[unlikely]] { return false; }
+
+                            if(auto const callee{this->bodies.index_unchecked(callee_idx)}; callee != nullptr) { this->direct_call(callee); }
+                            else
+                            {
+                                auto const& callee_type{this->mod.types.index_unchecked(this->mod.functions.index_unchecked(callee_idx).type_index)};
+                                this->runtime_call(callee_type, call_function_symbol, ::llvm::ConstantInt::get(this->size_type, callee_idx));
+                            }
+                            break;
+                        }
+                        case op_basic::call_indirect:
+                        {
+                            ::std::size_t type_idx;
+                            ::std::uint_least8_t table_idx;
+                            if(!reader.read_u32(type_idx) || !reader.read_byte(table_idx)) [[unlikely]] { return false; }
+                            if(this->unreachable) { break; }
+                            if(type_idx >= this->mod.types.size()) [[unlikely]] { return false; }
+
+                            auto const element_index{this->pop()};
+                            this->runtime_call(this->mod.types.index_unchecked(type_idx),
+                                               call_indirect_symbol,
+                                               ::llvm::ConstantInt::get(this->size_type, this->type_ids.index_unchecked(type_idx)),
+                                               element_index);
+                            break;
+                        }
+
+                        // Parametric
+                        case op_basic::drop:
+                        {
+                            if(!this->unreachable) { this->pop(); }
+                            break;
+                        }
+                        case op_basic::select:
+                        {
+                            if(this->unreachable) { break; }
+                            auto const condition{builder_.CreateICmpNE(this->pop(), builder_.getInt32(0u))};
+                            auto const b{this->pop()};
+                            auto const a{this->pop()};
+                            this->push(builder_.CreateSelect(condition, a, b));
+                            break;
+                        }
+
+                        // Variable
+                        case op_basic::local_get: [[fallthrough]];
+                        case op_basic::local_set: [[fallthrough]];
+                        case op_basic::local_tee:
+                        {
+                            ::std::size_t local_idx;
+                            if(!reader.read_u32(local_idx)) [[unlikely]] { return false; }
+                            if(this->unreachable) { break; }
+                            if(local_idx >= this->locals.size()) [[unlikely]] { return false; }
+
+                            auto const local{this->locals.index_unchecked(local_idx)};
+                            if(static_cast<op_basic>(opcode) == op_basic::local_get) { this->push(builder_.CreateLoad(local->getAllocatedType(), local)); }
+                            else if(static_cast<op_basic>(opcode) == op_basic::local_set) { builder_.CreateStore(this->pop(), local); }
+                            else
+                            {
+                                builder_.CreateStore(this->operands.back_unchecked(), local);
+                            }
+                            break;
+                        }
+                        case op_basic::global_get: [[fallthrough]];
+                        case op_basic::global_set:
+                        {
+                            ::std::size_t global_idx;
+                            if(!reader.read_u32(global_idx)) [[unlikely]] { return false; }
+                            if(this->unreachable) { break; }
+                            if(global_idx >= this->mod.global_types.size()) [[unlikely]] { return false; }
+
+                            auto const slots{builder_.CreateBitCast(this->globals, ::llvm::PointerType::getUnqual(this->i64_type))};
+                            auto const slot_ptr{builder_.CreateConstInBoundsGEP1_64(this->i64_type, slots, static_cast<::std::uint_least64_t>(global_idx))};
+                            if(static_cast<op_basic>(opcode) == op_basic::global_get)
+                            {
+                                auto const global_type{get_value_type(this->context, this->mod.global_types.index_unchecked(global_idx))};
+                                this->push(from_slot(builder_, builder_.CreateLoad(this->i64_type, slot_ptr), global_type));
+                            }
+                            else
+                            {
+                                builder_.CreateStore(to_slot(builder_, this->pop()), slot_ptr);
+                            }
+                            break;
+                        }
+
+                        // Memory
+                        case op_basic::i32_load:
+                        {
+                            if(!this->load(reader, this->i32_type, this->i32_type, false)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::i64_load:
+                        {
+                            if(!this->load(reader, this->i64_type, this->i64_type, false)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::f32_load:
+                        {
+                            if(!this->load(reader, builder_.getFloatTy(), builder_.getFloatTy(), false)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::f64_load:
+                        {
+                            if(!this->load(reader, builder_.getDoubleTy(), builder_.getDoubleTy(), false)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::i32_load8_s:
+                        {
+                            if(!this->load(reader, builder_.getInt8Ty(), this->i32_type, true)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::i32_load8_u:
+                        {
+                            if(!this->load(reader, builder_.getInt8Ty(), this->i32_type, false)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::i32_load16_s:
+                        {
+                            if(!this->load(reader, builder_.getInt16Ty(), this->i32_type, true)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::i32_load16_u:
+                        {
+                            if(!this->load(reader, builder_.getInt16Ty(), this->i32_type, false)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::i64_load8_s:
+                        {
+                            if(!this->load(reader, builder_.getInt8Ty(), this->i64_type, true)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::i64_load8_u:
+                        {
+                            if(!this->load(reader, builder_.getInt8Ty(), this->i64_type, false)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::i64_load16_s:
+                        {
+                            if(!this->load(reader, builder_.getInt16Ty(), this->i64_type, true)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::i64_load16_u:
+                        {
+                            if(!this->load(reader, builder_.getInt16Ty(), this->i64_type, false)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::i64_load32_s:
+                        {
+                            if(!this->load(reader, this->i32_type, this->i64_type, true)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::i64_load32_u:
+                        {
+                            if(!this->load(reader, this->i32_type, this->i64_type, false)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::i32_store:
+                        {
+                            if(!this->store(reader, this->i32_type)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::i64_store:
+                        {
+                            if(!this->store(reader, this->i64_type)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::f32_store:
+                        {
+                            if(!this->store(reader, builder_.getFloatTy())) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::f64_store:
+                        {
+                            if(!this->store(reader, builder_.getDoubleTy())) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::i32_store8: [[fallthrough]];
+                        case op_basic::i64_store8:
+                        {
+                            if(!this->store(reader, builder_.getInt8Ty())) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::i32_store16: [[fallthrough]];
+                        case op_basic::i64_store16:
+                        {
+                            if(!this->store(reader, builder_.getInt16Ty())) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::i64_store32:
+                        {
+                            if(!this->store(reader, this->i32_type)) [[unlikely]] { return false; }
+                            break;
+                        }
+                        case op_basic::memory_size:
+                        {
+                            ::std::uint_least8_t memory_idx;
+                            if(!reader.read_byte(memory_idx)) [[unlikely]] { return false; }
+                            if(this->unreachable) { break; }
+                            this->push(builder_.CreateCall(this->runtime_function(memory_size_symbol, this->i32_type, {this->ptr_type}), {this->ctx}));
+                            break;
+                        }
+                        case op_basic::memory_grow:
+                        {
+                            ::std::uint_least8_t memory_idx;
+                            if(!reader.read_byte(memory_idx)) [[unlikely]] { return false; }
+                            if(this->unreachable) { break; }
+                            auto const delta{this->pop()};
+                            this->push(builder_.CreateCall(this->runtime_function(memory_grow_symbol, this->i32_type, {this->ptr_type, this->i32_type}),
+                                                           {this->ctx, delta}));
+                            this->reload_memory_here();
+                            break;
+                        }
+
+                        // Numeric
+                        case op_basic::i32_const:
+                        {
+                            ::std::uint_least64_t v;
+                            if(!reader.read_leb<32u, true>(v)) [[unlikely]] { return false; }
+                            if(!this->unreachable) { this->push(builder_.getInt32(static_cast<::std::uint_least32_t>(v & 0xFFFF'FFFFu))); }
+                            break;
+                        }
+                        case op_basic::i64_const:
+                        {
+                            ::std::uint_least64_t v;
+                            if(!reader.read_leb<64u, true>(v)) [[unlikely]] { return false; }
+                            if(!this->unreachable) { this->push(builder_.getInt64(v)); }
+                            break;
+                        }
+                        case op_basic::f32_const:
+                        {
+                            ::std::uint_least64_t v;
+                            if(!reader.read_fixed<4u>(v)) [[unlikely]] { return false; }
+                            if(!this->unreachable) { this->push(builder_.CreateBitCast(builder_.getInt32(static_cast<::std::uint_least32_t>(v)), builder_.getFloatTy())); }
+                            break;
+                        }
+                        case op_basic::f64_const:
+                        {
+                            ::std::uint_least64_t v;
+                            if(!reader.read_fixed<8u>(v)) [[unlikely]] { return false; }
+                            if(!this->unreachable) { this->push(builder_.CreateBitCast(builder_.getInt64(v), builder_.getDoubleTy())); }
+                            break;
+                        }
+
+                        case op_basic::i32_eqz: [[fallthrough]];
+                        case op_basic::i64_eqz:
+                        {
+                            this->eqz();
+                            break;
+                        }
+
+                            // clang-format off
+#define UWVM_LLVM_JIT_COMPARE(opname, predicate)                                                                                                               \
+    case op_basic::opname: this->compare(::llvm::CmpInst::predicate); break
+#define UWVM_LLVM_JIT_BINARY(opname, create)                                                                                                                   \
+    case op_basic::opname: this->binary([&](::llvm::Value* a, ::llvm::Value* b) { return builder_.create(a, b); }); break
+#define UWVM_LLVM_JIT_SHIFT(opname, op)                                                                                                                        \
+    case op_basic::opname: this->shift(::llvm::Instruction::op); break
+#define UWVM_LLVM_JIT_DIVIDE(opname, op)                                                                                                                       \
+    case op_basic::opname: this->divide(::llvm::Instruction::op); break
+#define UWVM_LLVM_JIT_FLOAT_UNARY(opname, id)                                                                                                                  \
+    case op_basic::opname: this->float_unary(::llvm::Intrinsic::id); break
+#define UWVM_LLVM_JIT_CONVERT(opname, op, type)                                                                                                                \
+    case op_basic::opname: this->convert(::llvm::Instruction::op, builder_.type()); break
+#define UWVM_LLVM_JIT_TRUNC(opname, type, is_signed)                                                                                                           \
+    case op_basic::opname: this->trunc(builder_.type(), is_signed); break
+                            // clang-format on
+
+                            UWVM_LLVM_JIT_COMPARE(i32_eq, ICMP_EQ);
+                            UWVM_LLVM_JIT_COMPARE(i32_ne, ICMP_NE);
+                            UWVM_LLVM_JIT_COMPARE(i32_lt_s, ICMP_SLT);
+                            UWVM_LLVM_JIT_COMPARE(i32_lt_u, ICMP_ULT);
+                            UWVM_LLVM_JIT_COMPARE(i32_gt_s, ICMP_SGT);
+                            UWVM_LLVM_JIT_COMPARE(i32_gt_u, ICMP_UGT);
+                            UWVM_LLVM_JIT_COMPARE(i32_le_s, ICMP_SLE);
+                            UWVM_LLVM_JIT_COMPARE(i32_le_u, ICMP_ULE);
+                            UWVM_LLVM_JIT_COMPARE(i32_ge_s, ICMP_SGE);
+                            UWVM_LLVM_JIT_COMPARE(i32_ge_u, ICMP_UGE);
+
+                            UWVM_LLVM_JIT_COMPARE(i64_eq, ICMP_EQ);
+                            UWVM_LLVM_JIT_COMPARE(i64_ne, ICMP_NE);
+                            UWVM_LLVM_JIT_COMPARE(i64_lt_s, ICMP_SLT);
+                            UWVM_LLVM_JIT_COMPARE(i64_lt_u, ICMP_ULT);
+                            UWVM_LLVM_JIT_COMPARE(i64_gt_s, ICMP_SGT);
+                            UWVM_LLVM_JIT_COMPARE(i64_gt_u, ICMP_UGT);
+                            UWVM_LLVM_JIT_COMPARE(i64_le_s, ICMP_SLE);
+                            UWVM_LLVM_JIT_COMPARE(i64_le_u, ICMP_ULE);
+                            UWVM_LLVM_JIT_COMPARE(i64_ge_s, ICMP_SGE);
+                            UWVM_LLVM_JIT_COMPARE(i64_ge_u, ICMP_UGE);
+
+                            // ne is unordered: NaN != x
+                            UWVM_LLVM_JIT_COMPARE(f32_eq, FCMP_OEQ);
+                            UWVM_LLVM_JIT_COMPARE(f32_ne, FCMP_UNE);
+                            UWVM_LLVM_JIT_COMPARE(f32_lt, FCMP_OLT);
+                            UWVM_LLVM_JIT_COMPARE(f32_gt, FCMP_OGT);
+                            UWVM_LLVM_JIT_COMPARE(f32_le, FCMP_OLE);
+                            UWVM_LLVM_JIT_COMPARE(f32_ge, FCMP_OGE);
+
+                            UWVM_LLVM_JIT_COMPARE(f64_eq, FCMP_OEQ);
+                            UWVM_LLVM_JIT_COMPARE(f64_ne, FCMP_UNE);
+                            UWVM_LLVM_JIT_COMPARE(f64_lt, FCMP_OLT);
+                            UWVM_LLVM_JIT_COMPARE(f64_gt, FCMP_OGT);
+                            UWVM_LLVM_JIT_COMPARE(f64_le, FCMP_OLE);
+                            UWVM_LLVM_JIT_COMPARE(f64_ge, FCMP_OGE);
+
+                        case op_basic::i32_clz: [[fallthrough]];
+                        case op_basic::i64_clz:
+                        {
+                            this->count_bits(::llvm::Intrinsic::ctlz);
+                            break;
+                        }
+                        case op_basic::i32_ctz: [[fallthrough]];
+                        case op_basic::i64_ctz:
+                        {
+                            this->count_bits(::llvm::Intrinsic::cttz);
+                            break;
+                        }
+                        case op_basic::i32_popcnt: [[fallthrough]];
+                        case op_basic::i64_popcnt:
+                        {
+                            this->count_bits(::llvm::Intrinsic::ctpop);
+                            break;
+                        }
+
+                            UWVM_LLVM_JIT_BINARY(i32_add, CreateAdd);
+                            UWVM_LLVM_JIT_BINARY(i32_sub, CreateSub);
+                            UWVM_LLVM_JIT_BINARY(i32_mul, CreateMul);
+                            UWVM_LLVM_JIT_DIVIDE(i32_div_s, SDiv);
+                            UWVM_LLVM_JIT_DIVIDE(i32_div_u, UDiv);
+                            UWVM_LLVM_JIT_DIVIDE(i32_rem_s, SRem);
+                            UWVM_LLVM_JIT_DIVIDE(i32_rem_u, URem);
+                            UWVM_LLVM_JIT_BINARY(i32_and, CreateAnd);
+                            UWVM_LLVM_JIT_BINARY(i32_or, CreateOr);
+                            UWVM_LLVM_JIT_BINARY(i32_xor, CreateXor);
+                            UWVM_LLVM_JIT_SHIFT(i32_shl, Shl);
+                            UWVM_LLVM_JIT_SHIFT(i32_shr_s, AShr);
+                            UWVM_LLVM_JIT_SHIFT(i32_shr_u, LShr);
+
+                            UWVM_LLVM_JIT_BINARY(i64_add, CreateAdd);
+                            UWVM_LLVM_JIT_BINARY(i64_sub, CreateSub);
+                            UWVM_LLVM_JIT_BINARY(i64_mul, CreateMul);
+                            UWVM_LLVM_JIT_DIVIDE(i64_div_s, SDiv);
+                            UWVM_LLVM_JIT_DIVIDE(i64_div_u, UDiv);
+                            UWVM_LLVM_JIT_DIVIDE(i64_rem_s, SRem);
+                            UWVM_LLVM_JIT_DIVIDE(i64_rem_u, URem);
+                            UWVM_LLVM_JIT_BINARY(i64_and, CreateAnd);
+                            UWVM_LLVM_JIT_BINARY(i64_or, CreateOr);
+                            UWVM_LLVM_JIT_BINARY(i64_xor, CreateXor);
+                            UWVM_LLVM_JIT_SHIFT(i64_shl, Shl);
+                            UWVM_LLVM_JIT_SHIFT(i64_shr_s, AShr);
+                            UWVM_LLVM_JIT_SHIFT(i64_shr_u, LShr);
+
+                        case op_basic::i32_rotl: [[fallthrough]];
+                        case op_basic::i64_rotl:
+                        {
+                            // A funnel shift of a value with itself is a rotation, the count is modulo the bit width
+                            this->rotate(::llvm::Intrinsic::fshl);
+                            break;
+                        }
+                        case op_basic::i32_rotr: [[fallthrough]];
+                        case op_basic::i64_rotr:
+                        {
+                            this->rotate(::llvm::Intrinsic::fshr);
+                            break;
+                        }
+
+                        case op_basic::f32_abs: [[fallthrough]];
+                        case op_basic::f64_abs:
+                        {
+                            this->float_unary(::llvm::Intrinsic::fabs);
+                            break;
+                        }
+                        case op_basic::f32_neg: [[fallthrough]];
+                        case op_basic::f64_neg:
+                        {
+                            this->unary([&](::llvm::Value* a) { return builder_.CreateFNeg(a); });
+                            break;
+                        }
+                        case op_basic::f32_ceil: [[fallthrough]];
+                        case op_basic::f64_ceil:
+                        {
+                            this->float_unary(::llvm::Intrinsic::ceil);
+                            break;
+                        }
+                        case op_basic::f32_floor: [[fallthrough]];
+                        case op_basic::f64_floor:
+                        {
+                            this->float_unary(::llvm::Intrinsic::floor);
+                            break;
+                        }
+                        case op_basic::f32_trunc: [[fallthrough]];
+                        case op_basic::f64_trunc:
+                        {
+                            this->float_unary(::llvm::Intrinsic::trunc);
+                            break;
+                        }
+                        case op_basic::f32_nearest: [[fallthrough]];
+                        case op_basic::f64_nearest:
+                        {
+                            // Round to nearest, ties to even (the default rounding mode)
+                            this->float_unary(::llvm::Intrinsic::nearbyint);
+                            break;
+                        }
+                        case op_basic::f32_sqrt: [[fallthrough]];
+                        case op_basic::f64_sqrt:
+                        {
+                            this->float_unary(::llvm::Intrinsic::sqrt);
+                            break;
+                        }
+
+                            UWVM_LLVM_JIT_BINARY(f32_add, CreateFAdd);
+                            UWVM_LLVM_JIT_BINARY(f32_sub, CreateFSub);
+                            UWVM_LLVM_JIT_BINARY(f32_mul, CreateFMul);
+                            UWVM_LLVM_JIT_BINARY(f32_div, CreateFDiv);
+                            UWVM_LLVM_JIT_BINARY(f64_add, CreateFAdd);
+                            UWVM_LLVM_JIT_BINARY(f64_sub, CreateFSub);
+                            UWVM_LLVM_JIT_BINARY(f64_mul, CreateFMul);
+                            UWVM_LLVM_JIT_BINARY(f64_div, CreateFDiv);
+
+                        case op_basic::f32_min: [[fallthrough]];
+                        case op_basic::f64_min:
+                        {
+                            this->min_max(true);
+                            break;
+                        }
+                        case op_basic::f32_max: [[fallthrough]];
+                        case op_basic::f64_max:
+                        {
+                            this->min_max(false);
+                            break;
+                        }
+                        case op_basic::f32_copysign: [[fallthrough]];
+                        case op_basic::f64_copysign:
+                        {
+                            this->binary([&](::llvm::Value* a, ::llvm::Value* b) { return builder_.CreateBinaryIntrinsic(::llvm::Intrinsic::copysign, a, b); });
+                            break;
+                        }
+
+                            UWVM_LLVM_JIT_CONVERT(i32_wrap_i64, Trunc, getInt32Ty);
+                            UWVM_LLVM_JIT_TRUNC(i32_trunc_f32_s, getInt32Ty, true);
+                            UWVM_LLVM_JIT_TRUNC(i32_trunc_f32_u, getInt32Ty, false);
+                            UWVM_LLVM_JIT_TRUNC(i32_trunc_f64_s, getInt32Ty, true);
+                            UWVM_LLVM_JIT_TRUNC(i32_trunc_f64_u, getInt32Ty, false);
+                            UWVM_LLVM_JIT_CONVERT(i64_extend_i32_s, SExt, getInt64Ty);
+                            UWVM_LLVM_JIT_CONVERT(i64_extend_i32_u, ZExt, getInt64Ty);
+                            UWVM_LLVM_JIT_TRUNC(i64_trunc_f32_s, getInt64Ty, true);
+                            UWVM_LLVM_JIT_TRUNC(i64_trunc_f32_u, getInt64Ty, false);
+                            UWVM_LLVM_JIT_TRUNC(i64_trunc_f64_s, getInt64Ty, true);
+                            UWVM_LLVM_JIT_TRUNC(i64_trunc_f64_u, getInt64Ty, false);
+                            UWVM_LLVM_JIT_CONVERT(f32_convert_i32_s, SIToFP, getFloatTy);
+                            UWVM_LLVM_JIT_CONVERT(f32_convert_i32_u, UIToFP, getFloatTy);
+                            UWVM_LLVM_JIT_CONVERT(f32_convert_i64_s, SIToFP, getFloatTy);
+                            UWVM_LLVM_JIT_CONVERT(f32_convert_i64_u, UIToFP, getFloatTy);
+                            UWVM_LLVM_JIT_CONVERT(f32_demote_f64, FPTrunc, getFloatTy);
+                            UWVM_LLVM_JIT_CONVERT(f64_convert_i32_s, SIToFP, getDoubleTy);
+                            UWVM_LLVM_JIT_CONVERT(f64_convert_i32_u, UIToFP, getDoubleTy);
+                            UWVM_LLVM_JIT_CONVERT(f64_convert_i64_s, SIToFP, getDoubleTy);
+                            UWVM_LLVM_JIT_CONVERT(f64_convert_i64_u, UIToFP, getDoubleTy);
+                            UWVM_LLVM_JIT_CONVERT(f64_promote_f32, FPExt, getDoubleTy);
+                            UWVM_LLVM_JIT_CONVERT(i32_reinterpret_f32, BitCast, getInt32Ty);
+                            UWVM_LLVM_JIT_CONVERT(i64_reinterpret_f64, BitCast, getInt64Ty);
+                            UWVM_LLVM_JIT_CONVERT(f32_reinterpret_i32, BitCast, getFloatTy);
+                            UWVM_LLVM_JIT_CONVERT(f64_reinterpret_i64, BitCast, getDoubleTy);
+
+#undef UWVM_LLVM_JIT_COMPARE
+#undef UWVM_LLVM_JIT_BINARY
+#undef UWVM_LLVM_JIT_SHIFT
+#undef UWVM_LLVM_JIT_DIVIDE
+#undef UWVM_LLVM_JIT_FLOAT_UNARY
+#undef UWVM_LLVM_JIT_CONVERT
+#undef UWVM_LLVM_JIT_TRUNC
+
+                        [[unlikely]] default:
+                        {
+                            // Not a wasm1 instruction
+                            return false;
+                        }
+                    }
+                }
+
+                if(reader.curr != reader.end) [[unlikely]] { return false; }
+
+                // The end of the function merged into the return block
+                if(!this->unreachable)
+                {
+                    if(result_type == nullptr) { builder_.CreateRetVoid(); }
+                    else
+                    {
+                        builder_.CreateRet(this->pop());
+                    }
+                }
+
+                if(this->uses_memory)
+                {
+                    this->load_memory(this->entry_end);
+                    for(auto const point: this->memory_reload_points) { this->load_memory(point); }
+                }
+                for(auto const point: this->memory_reload_points) { point->eraseFromParent(); }
+
+                return true;
+            }
+        };
+    }  // namespace details
+#endif
+}  // namespace uwvm2::non_img::llvm_jit
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
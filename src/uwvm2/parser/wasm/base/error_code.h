@@ -157,7 +157,24 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::base
         invalid_section_canonical_order,
         invalid_elem_kind,
         invalid_data_kind,
-        limit_type_max_lt_min
+        limit_type_max_lt_min,
+        illegal_opcode,
+        invalid_instruction_immediate,
+        operand_stack_underflow,
+        operand_type_mismatch,
+        invalid_label_index,
+        invalid_local_index,
+        invalid_global_index,
+        set_immutable_global,
+        invalid_function_index,
+        instruction_requires_missing_table,
+        instruction_requires_missing_memory,
+        illegal_memory_align,
+        illegal_block_type,
+        else_without_matching_if,
+        block_end_operand_count_mismatch,
+        code_body_unterminated,
+        illegal_reserved_byte
     };
 
     /// @brief used for duplicate_imports_of_the_same_import_type
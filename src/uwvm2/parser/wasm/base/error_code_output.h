@@ -640,6 +640,91 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::base
 #include "error_code_outputs/eco_limit_type_max_lt_min.h"
                 return;
             }
+            case ::uwvm2::parser::wasm::base::wasm_parse_error_code::illegal_opcode:
+            {
+#include "error_code_outputs/eco_illegal_opcode.h"
+                return;
+            }
+            case ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_instruction_immediate:
+            {
+#include "error_code_outputs/eco_invalid_instruction_immediate.h"
+                return;
+            }
+            case ::uwvm2::parser::wasm::base::wasm_parse_error_code::operand_stack_underflow:
+            {
+#include "error_code_outputs/eco_operand_stack_underflow.h"
+                return;
+            }
+            case ::uwvm2::parser::wasm::base::wasm_parse_error_code::operand_type_mismatch:
+            {
+#include "error_code_outputs/eco_operand_type_mismatch.h"
+                return;
+            }
+            case ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_label_index:
+            {
+#include "error_code_outputs/eco_invalid_label_index.h"
+                return;
+            }
+            case ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_local_index:
+            {
+#include "error_code_outputs/eco_invalid_local_index.h"
+                return;
+            }
+            case ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_global_index:
+            {
+#include "error_code_outputs/eco_invalid_global_index.h"
+                return;
+            }
+            case ::uwvm2::parser::wasm::base::wasm_parse_error_code::set_immutable_global:
+            {
+#include "error_code_outputs/eco_set_immutable_global.h"
+                return;
+            }
+            case ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_function_index:
+            {
+#include "error_code_outputs/eco_invalid_function_index.h"
+                return;
+            }
+            case ::uwvm2::parser::wasm::base::wasm_parse_error_code::instruction_requires_missing_table:
+            {
+#include "error_code_outputs/eco_instruction_requires_missing_table.h"
+                return;
+            }
+            case ::uwvm2::parser::wasm::base::wasm_parse_error_code::instruction_requires_missing_memory:
+            {
+#include "error_code_outputs/eco_instruction_requires_missing_memory.h"
+                return;
+            }
+            case ::uwvm2::parser::wasm::base::wasm_parse_error_code::illegal_memory_align:
+            {
+#include "error_code_outputs/eco_illegal_memory_align.h"
+                return;
+            }
+            case ::uwvm2::parser::wasm::base::wasm_parse_error_code::illegal_block_type:
+            {
+#include "error_code_outputs/eco_illegal_block_type.h"
+                return;
+            }
+            case ::uwvm2::parser::wasm::base::wasm_parse_error_code::else_without_matching_if:
+            {
+#include "error_code_outputs/eco_else_without_matching_if.h"
+                return;
+            }
+            case ::uwvm2::parser::wasm::base::wasm_parse_error_code::block_end_operand_count_mismatch:
+            {
+#include "error_code_outputs/eco_block_end_operand_count_mismatch.h"
+                return;
+            }
+            case ::uwvm2::parser::wasm::base::wasm_parse_error_code::code_body_unterminated:
+            {
+#include "error_code_outputs/eco_code_body_unterminated.h"
+                return;
+            }
+            case ::uwvm2::parser::wasm::base::wasm_parse_error_code::illegal_reserved_byte:
+            {
+#include "error_code_outputs/eco_illegal_reserved_byte.h"
+                return;
+            }
         }
     }
 
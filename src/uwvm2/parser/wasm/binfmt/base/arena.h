@@ -0,0 +1,330 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @brief       WebAssembly Release 1.0 (2019-07-20)
+ * @details     antecedent dependency: null
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2025-07-18
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifdef UWVM_MODULE
+import fast_io;
+#else
+// std
+# include <cstdint>
+# include <cstddef>
+# include <cstring>
+# include <type_traits>
+# include <memory>
+# include <limits>
+# include <utility>
+// import
+# include <fast_io.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::binfmt
+{
+    /// @brief      Bump allocator owned by a module storage
+    /// @details    Small allocations that live as long as the module (e.g. the local declarations of every function body) are carved out of large
+    ///             chunks, the whole module is released in one shot when the storage is destroyed, nothing is released individually.
+    ///             The chunks form a singly linked list whose head is the chunk being filled. Moving the arena only moves the list head, the addresses of
+    ///             allocated objects stay stable, so the arena (and the module storage that owns it) is trivially relocatable.
+    /// @note       Not thread-safe. Concurrent parsers allocate from their own arenas and splice them into the module arena with merge().
+    struct module_arena_t
+    {
+        struct chunk_t
+        {
+            chunk_t* next{};
+            // Allocated size, including the header
+            ::std::size_t size{};
+        };
+
+        inline static constexpr ::std::size_t default_chunk_size{64uz * 1024uz};
+        inline static constexpr ::std::size_t max_alignment{alignof(::std::max_align_t)};
+        inline static constexpr ::std::size_t chunk_header_size{(sizeof(chunk_t) + max_alignment - 1uz) & ~(max_alignment - 1uz)};
+        // Larger requests get a dedicated chunk, so that the free space of the current chunk is not wasted
+        inline static constexpr ::std::size_t dedicated_chunk_threshold{default_chunk_size / 4uz};
+
+        chunk_t* chunks{};
+        ::std::byte* curr{};
+        ::std::byte* end{};
+
+        inline constexpr module_arena_t() noexcept = default;
+
+        inline constexpr module_arena_t(module_arena_t const& other) noexcept = delete;
+
+        inline constexpr module_arena_t(module_arena_t&& other) noexcept : chunks{other.chunks}, curr{other.curr}, end{other.end}
+        {
+            other.chunks = nullptr;
+            other.curr = nullptr;
+            other.end = nullptr;
+        }
+
+        inline constexpr module_arena_t& operator= (module_arena_t const& other) noexcept = delete;
+
+        inline constexpr module_arena_t& operator= (module_arena_t&& other) noexcept
+        {
+            if(::std::addressof(other) == this) [[unlikely]] { return *this; }
+
+            this->release();
+
+            this->chunks = other.chunks;
+            this->curr = other.curr;
+            this->end = other.end;
+
+            other.chunks = nullptr;
+            other.curr = nullptr;
+            other.end = nullptr;
+
+            return *this;
+        }
+
+        inline constexpr ~module_arena_t() { this->release(); }
+
+        /// @brief Release all chunks, all memory allocated from the arena becomes invalid
+        inline constexpr void release() noexcept
+        {
+            for(auto c{this->chunks}; c != nullptr;)
+            {
+                auto const next{c->next};
+                ::fast_io::native_global_allocator::deallocate_n(c, c->size);
+                c = next;
+            }
+
+            this->chunks = nullptr;
+            this->curr = nullptr;
+            this->end = nullptr;
+        }
+
+        /// @brief Allocate size bytes aligned to alignment (a power of two not greater than max_alignment), never returns nullptr
+        [[nodiscard]] inline void* allocate(::std::size_t size, ::std::size_t alignment) noexcept
+        {
+            if(this->curr != nullptr) [[likely]]
+            {
+                auto const curr_uptr{reinterpret_cast<::std::uintptr_t>(this->curr)};
+                auto const padding{static_cast<::std::size_t>(((curr_uptr + (alignment - 1uz)) & ~static_cast<::std::uintptr_t>(alignment - 1uz)) - curr_uptr)};
+
+                if(static_cast<::std::size_t>(this->end - this->curr) >= padding && static_cast<::std::size_t>(this->end - this->curr) - padding >= size)
+                    [[likely]]
+                {
+                    auto const ret{this->curr + padding};
+                    this->curr = ret + size;
+                    return ret;
+                }
+            }
+
+            return this->allocate_slow(size);
+        }
+
+        /// @brief Allocate uninitialized storage for n objects of T
+        template <typename T>
+        [[nodiscard]] inline T* allocate_n(::std::size_t n) noexcept
+        {
+            static_assert(::std::is_trivially_destructible_v<T>, "objects in the arena are never destroyed");
+            static_assert(alignof(T) <= max_alignment);
+
+            constexpr ::std::size_t max_n{::std::numeric_limits<::std::size_t>::max() / sizeof(T)};
+            if(n > max_n) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+            return static_cast<T*>(this->allocate(n * sizeof(T), alignof(T)));
+        }
+
+        /// @brief Splice the chunks of other into this arena, other becomes empty. The free space of the current chunk of this arena is kept.
+        inline constexpr void merge(module_arena_t&& other) noexcept
+        {
+            if(other.chunks == nullptr) { return; }
+
+            if(this->chunks == nullptr)
+            {
+                *this = ::std::move(other);
+                return;
+            }
+
+            auto tail{other.chunks};
+            while(tail->next != nullptr) { tail = tail->next; }
+
+            tail->next = this->chunks->next;
+            this->chunks->next = other.chunks;
+
+            other.chunks = nullptr;
+            other.curr = nullptr;
+            other.end = nullptr;
+        }
+
+        inline ::std::byte* new_chunk(::std::size_t data_size) noexcept
+        {
+            if(data_size > ::std::numeric_limits<::std::size_t>::max() - chunk_header_size) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+            auto const size{chunk_header_size + data_size};
+
+            // The allocator returns memory aligned to at least max_alignment
+            auto const c{::new(::fast_io::native_global_allocator::allocate(size)) chunk_t{nullptr, size}};
+
+            return reinterpret_cast<::std::byte*>(c) + chunk_header_size;
+        }
+
+        inline static chunk_t* chunk_of(::std::byte* data) noexcept { return reinterpret_cast<chunk_t*>(data - chunk_header_size); }
+
+        inline ::std::byte* allocate_slow(::std::size_t size) noexcept
+        {
+            if(size > dedicated_chunk_threshold)
+            {
+                auto const data{this->new_chunk(size)};
+                auto const c{chunk_of(data)};
+
+                if(this->chunks == nullptr)
+                {
+                    // The dedicated chunk is full, the next small allocation starts a new chunk
+                    this->chunks = c;
+                    this->curr = nullptr;
+                    this->end = nullptr;
+                }
+                else
+                {
+                    // Insert after the head, the head stays the chunk being filled
+                    c->next = this->chunks->next;
+                    this->chunks->next = c;
+                }
+
+                return data;
+            }
+
+            auto const data{this->new_chunk(default_chunk_size)};
+            auto const c{chunk_of(data)};
+
+            c->next = this->chunks;
+            this->chunks = c;
+
+            // The data of a new chunk is aligned to max_alignment, no padding is needed
+            this->curr = data + size;
+            this->end = data + default_chunk_size;
+
+            return data;
+        }
+    };
+
+    /// @brief      Fixed capacity array allocated from a module_arena_t
+    /// @details    Used instead of ::fast_io::vector for per-module storage that is filled once during parsing. The storage belongs to the arena, the
+    ///             array itself is a trivially copyable view and is never freed individually.
+    template <typename T>
+    struct module_arena_array_t
+    {
+        static_assert(::std::is_trivially_copyable_v<T> && ::std::is_trivially_destructible_v<T>);
+
+        using value_type = T;
+        using pointer = T*;
+        using const_pointer = T const*;
+        using reference = T&;
+        using const_reference = T const&;
+        using iterator = T*;
+        using const_iterator = T const*;
+        using size_type = ::std::size_t;
+
+        T* begin_ptr{};
+        T* curr_ptr{};
+        T* end_ptr{};
+
+        /// @brief Grow the capacity to at least n, the old storage is left in the arena
+        inline void reserve(module_arena_t& arena, ::std::size_t n) noexcept
+        {
+            if(n <= this->capacity()) { return; }
+
+            auto const new_begin{arena.template allocate_n<T>(n)};
+            auto const old_size{this->size()};
+            if(old_size != 0uz) { ::std::memcpy(new_begin, this->begin_ptr, old_size * sizeof(T)); }
+
+            this->begin_ptr = new_begin;
+            this->curr_ptr = new_begin + old_size;
+            this->end_ptr = new_begin + n;
+        }
+
+        inline constexpr void push_back_unchecked(T const& value) noexcept
+        {
+            *this->curr_ptr = value;
+            ++this->curr_ptr;
+        }
+
+        inline constexpr void clear() noexcept { this->curr_ptr = this->begin_ptr; }
+
+        [[nodiscard]] inline constexpr ::std::size_t size() const noexcept { return static_cast<::std::size_t>(this->curr_ptr - this->begin_ptr); }
+
+        [[nodiscard]] inline constexpr ::std::size_t capacity() const noexcept { return static_cast<::std::size_t>(this->end_ptr - this->begin_ptr); }
+
+        [[nodiscard]] inline constexpr bool empty() const noexcept { return this->curr_ptr == this->begin_ptr; }
+
+        [[nodiscard]] inline constexpr T* data() noexcept { return this->begin_ptr; }
+
+        [[nodiscard]] inline constexpr T const* data() const noexcept { return this->begin_ptr; }
+
+        [[nodiscard]] inline constexpr T* begin() noexcept { return this->begin_ptr; }
+
+        [[nodiscard]] inline constexpr T const* begin() const noexcept { return this->begin_ptr; }
+
+        [[nodiscard]] inline constexpr T const* cbegin() const noexcept { return this->begin_ptr; }
+
+        [[nodiscard]] inline constexpr T* end() noexcept { return this->curr_ptr; }
+
+        [[nodiscard]] inline constexpr T const* end() const noexcept { return this->curr_ptr; }
+
+        [[nodiscard]] inline constexpr T const* cend() const noexcept { return this->curr_ptr; }
+
+        [[nodiscard]] inline constexpr T& index_unchecked(::std::size_t idx) noexcept { return this->begin_ptr[idx]; }
+
+        [[nodiscard]] inline constexpr T const& index_unchecked(::std::size_t idx) const noexcept { return this->begin_ptr[idx]; }
+
+        [[nodiscard]] inline constexpr T& operator[] (::std::size_t idx) noexcept
+        {
+            if(idx >= this->size()) [[unlikely]] { ::fast_io::fast_terminate(); }
+            return this->begin_ptr[idx];
+        }
+
+        [[nodiscard]] inline constexpr T const& operator[] (::std::size_t idx) const noexcept
+        {
+            if(idx >= this->size()) [[unlikely]] { ::fast_io::fast_terminate(); }
+            return this->begin_ptr[idx];
+        }
+    };
+}  // namespace uwvm2::parser::wasm::binfmt
+
+/// @brief Define container optimization operations for use with fast_io
+UWVM_MODULE_EXPORT namespace fast_io::freestanding
+{
+    template <>
+    struct is_trivially_copyable_or_relocatable<::uwvm2::parser::wasm::binfmt::module_arena_t>
+    {
+        inline static constexpr bool value = true;
+    };
+
+    template <>
+    struct is_zero_default_constructible<::uwvm2::parser::wasm::binfmt::module_arena_t>
+    {
+        inline static constexpr bool value = true;
+    };
+
+    template <typename T>
+    struct is_zero_default_constructible<::uwvm2::parser::wasm::binfmt::module_arena_array_t<T>>
+    {
+        inline static constexpr bool value = true;
+    };
+}
@@ -26,6 +26,8 @@ module;
 
 export module uwvm2.parser.wasm.binfmt.base;
 export import :base;
+export import :arena;
+export import :snapshot;
 
 #ifndef UWVM_MODULE
 # define UWVM_MODULE
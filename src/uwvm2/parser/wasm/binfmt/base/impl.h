@@ -26,4 +26,6 @@
 
 #ifndef UWVM_MODULE
 # include "base.h"
+# include "arena.h"
+# include "snapshot.h"
 #endif
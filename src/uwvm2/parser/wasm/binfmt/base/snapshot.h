@@ -0,0 +1,253 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @brief       WebAssembly Release 1.0 (2019-07-20)
+ * @details     antecedent dependency: null
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2025-07-18
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifdef UWVM_MODULE
+import fast_io;
+import fast_io_crypto;
+#else
+// std
+# include <cstdint>
+# include <cstddef>
+# include <cstring>
+# include <type_traits>
+# include <memory>
+# include <limits>
+# include <bit>
+# include <utility>
+// import
+# include <fast_io.h>
+# include <fast_io_crypto.h>
+# include <fast_io_dsal/vector.h>
+# include <fast_io_dsal/string_view.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::binfmt
+{
+    /// @brief SHA-256 digest of the module bytes, the key of a snapshot
+    struct snapshot_hash_t
+    {
+        inline static constexpr ::std::size_t digest_size{32uz};
+
+        ::std::byte digest[digest_size]{};
+    };
+
+    inline constexpr bool operator== (snapshot_hash_t const& h1, snapshot_hash_t const& h2) noexcept
+    {
+        for(::std::size_t i{}; i != snapshot_hash_t::digest_size; ++i)
+        {
+            if(h1.digest[i] != h2.digest[i]) { return false; }
+        }
+        return true;
+    }
+
+    /// @brief      Hash the module bytes
+    /// @details    A restored snapshot skips parsing and validation, the module it is applied to is only identified by this digest. So it must be
+    ///             collision resistant against a crafted module, not only against accidental changes: a cryptographic hash. fast_io uses the SHA
+    ///             instructions where the target has them.
+    inline ::uwvm2::parser::wasm::binfmt::snapshot_hash_t snapshot_content_hash(::std::byte const* begin, ::std::byte const* end) noexcept
+    {
+        ::fast_io::sha256_context context{};
+        context.update(begin, end);
+        context.do_final();
+
+        static_assert(::fast_io::sha256_context::digest_size == ::uwvm2::parser::wasm::binfmt::snapshot_hash_t::digest_size);
+
+        ::uwvm2::parser::wasm::binfmt::snapshot_hash_t ret{};
+        context.digest_to_byte_ptr(ret.digest);
+        return ret;
+    }
+
+    /// @brief Offset written in place of a null pointer
+    inline constexpr ::std::uint_least64_t snapshot_null_offset{::std::numeric_limits<::std::uint_least64_t>::max()};
+
+    /// @brief      Serializer of a parsed module storage
+    /// @details    Values are appended in native byte order without padding. A pointer into the module is written as its offset from module_begin, so the
+    ///             snapshot does not depend on where the module is mapped. Pointers between parts of the storage are written as indices by the sections.
+    struct snapshot_writer_t
+    {
+        ::fast_io::vector<::std::byte> buffer{};
+        ::std::byte const* module_begin{};
+        ::std::byte const* module_end{};
+
+        inline void write_bytes(void const* data, ::std::size_t n) noexcept
+        {
+            if(n == 0uz) { return; }
+
+            auto const size{this->buffer.size()};
+            if(auto const capacity{this->buffer.capacity()}; capacity - size < n)
+            {
+                this->buffer.reserve(capacity * 2uz < size + n ? size + n : capacity * 2uz);
+            }
+
+            ::std::memcpy(this->buffer.imp.curr_ptr, data, n);
+            this->buffer.imp.curr_ptr += n;
+        }
+
+        template <typename T>
+        inline void write(T const& value) noexcept
+        {
+            static_assert(::std::is_trivially_copyable_v<T>);
+            this->write_bytes(::std::addressof(value), sizeof(T));
+        }
+
+        inline void write_size(::std::size_t n) noexcept { this->write(static_cast<::std::uint_least64_t>(n)); }
+
+        /// @brief Write a pointer into the module, ptr must be null or in [module_begin, module_end]
+        template <typename T>
+        inline void write_module_ptr(T const* ptr) noexcept
+        {
+            if(ptr == nullptr)
+            {
+                this->write(snapshot_null_offset);
+                return;
+            }
+
+            auto const byte_ptr{reinterpret_cast<::std::byte const*>(ptr)};
+
+            // All views of a parsed storage refer to the module, anything else is a bug of the section
+            if(byte_ptr < this->module_begin || byte_ptr > this->module_end) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+            this->write(static_cast<::std::uint_least64_t>(byte_ptr - this->module_begin));
+        }
+
+        inline void write_module_string(::fast_io::u8string_view str) noexcept
+        {
+            this->write_module_ptr(str.data());
+            this->write_size(str.size());
+        }
+
+        /// @brief Write the size and the elements of an array of trivially copyable values without pointers
+        template <typename T>
+        inline void write_array(T const* data, ::std::size_t n) noexcept
+        {
+            static_assert(::std::is_trivially_copyable_v<T>);
+            this->write_size(n);
+            this->write_bytes(data, n * sizeof(T));
+        }
+    };
+
+    /// @brief      Deserializer of a snapshot written by snapshot_writer_t
+    /// @details    Every read is bounds checked. The first failure sets failed, subsequent reads return zero values, so callers only check failed at the
+    ///             points where a wrong value could cause an out of range access (counts and indices) and at the end. Offsets are checked against the
+    ///             module, a corrupted snapshot never produces a pointer outside of it.
+    struct snapshot_reader_t
+    {
+        ::std::byte const* curr{};
+        ::std::byte const* end{};
+        ::std::byte const* module_begin{};
+        ::std::byte const* module_end{};
+        bool failed{};
+
+        inline bool read_bytes(void* out, ::std::size_t n) noexcept
+        {
+            if(this->failed || static_cast<::std::size_t>(this->end - this->curr) < n) [[unlikely]]
+            {
+                this->failed = true;
+                return false;
+            }
+
+            if(n != 0uz) { ::std::memcpy(out, this->curr, n); }
+            this->curr += n;
+            return true;
+        }
+
+        template <typename T>
+        inline T read() noexcept
+        {
+            static_assert(::std::is_trivially_copyable_v<T>);
+            T value{};
+            this->read_bytes(::std::addressof(value), sizeof(T));
+            return value;
+        }
+
+        /// @brief Read a count of elements, each of which takes at least min_element_size bytes in the snapshot
+        /// @note  Fails if the rest of the snapshot cannot hold the elements, so the count can be used to reserve memory
+        inline ::std::size_t read_size(::std::size_t min_element_size) noexcept
+        {
+            auto const n{this->read<::std::uint_least64_t>()};
+            if(this->failed) [[unlikely]] { return 0uz; }
+
+            auto const remaining{static_cast<::std::uint_least64_t>(this->end - this->curr)};
+            if(min_element_size == 0uz ? n > static_cast<::std::uint_least64_t>(::std::numeric_limits<::std::size_t>::max())
+                                       : n > remaining / static_cast<::std::uint_least64_t>(min_element_size)) [[unlikely]]
+            {
+                this->failed = true;
+                return 0uz;
+            }
+
+            return static_cast<::std::size_t>(n);
+        }
+
+        template <typename T>
+        inline T const* read_module_ptr() noexcept
+        {
+            auto const offset{this->read<::std::uint_least64_t>()};
+            if(this->failed || offset == snapshot_null_offset) { return nullptr; }
+
+            if(offset > static_cast<::std::uint_least64_t>(this->module_end - this->module_begin)) [[unlikely]]
+            {
+                this->failed = true;
+                return nullptr;
+            }
+
+            return reinterpret_cast<T const*>(this->module_begin + offset);
+        }
+
+        inline ::fast_io::u8string_view read_module_string() noexcept
+        {
+            auto const ptr{this->read_module_ptr<char8_t>()};
+            auto const n{this->read<::std::uint_least64_t>()};
+            if(this->failed) [[unlikely]] { return {}; }
+
+            auto const available{ptr == nullptr ? 0u : static_cast<::std::uint_least64_t>(this->module_end - reinterpret_cast<::std::byte const*>(ptr))};
+            if(n > available) [[unlikely]]
+            {
+                this->failed = true;
+                return {};
+            }
+
+            return ::fast_io::u8string_view{ptr, static_cast<::std::size_t>(n)};
+        }
+
+        /// @brief Read an array written by snapshot_writer_t::write_array, replacing the contents of vec
+        template <typename T>
+        inline void read_array(::fast_io::vector<T>& vec) noexcept
+        {
+            static_assert(::std::is_trivially_copyable_v<T>);
+
+            auto const n{this->read_size(sizeof(T))};
+            vec.clear();
+            if(this->failed || n == 0uz) { return; }
+
+            vec.resize(n);
+            this->read_bytes(vec.data(), n * sizeof(T));
+        }
+    };
+}  // namespace uwvm2::parser::wasm::binfmt
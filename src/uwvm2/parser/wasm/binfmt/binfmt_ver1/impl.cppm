@@ -28,6 +28,8 @@ export module uwvm2.parser.wasm.binfmt.binfmt_ver1;
 export import :section;
 export import :def;
 export import :handler;
+export import :snapshot;
+export import :stream;
 
 #ifndef UWVM_MODULE
 # define UWVM_MODULE
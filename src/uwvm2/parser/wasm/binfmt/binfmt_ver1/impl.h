@@ -28,4 +28,6 @@
 # include "section.h"
 # include "def.h"
 # include "handler.h"
+# include "snapshot.h"
+# include "stream.h"
 #endif
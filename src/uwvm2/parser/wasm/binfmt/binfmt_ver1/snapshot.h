@@ -0,0 +1,232 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @brief       WebAssembly Release 1.0 (2019-07-20)
+ * @details     antecedent dependency: null
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2025-04-09
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#if !(__cpp_structured_bindings >= 202411L)
+# error "UWVM requires at least C++26 standard compiler. See https://en.cppreference.com/w/cpp/compiler_support/26#cpp_structured_bindings_202411L"
+#endif
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.parser.wasm.concepts;
+import uwvm2.parser.wasm.standard.wasm1.type;
+import uwvm2.parser.wasm.binfmt.base;
+import :section;
+import :def;
+#else
+// std
+# include <cstddef>
+# include <cstdint>
+# include <cstring>
+# include <concepts>
+# include <type_traits>
+# include <utility>
+# include <memory>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# include <fast_io_dsal/vector.h>
+# include <fast_io_dsal/tuple.h>
+# include <uwvm2/parser/wasm/concepts/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
+# include <uwvm2/parser/wasm/binfmt/base/impl.h>
+# include "section.h"
+# include "def.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::binfmt::ver1
+{
+    /// @brief      Define functions for writing and restoring a section in a snapshot
+    /// @details    The write function serializes the section of module_storage with snapshot_writer_t. The read function rebuilds the section in
+    ///             module_storage from snapshot_reader_t, reporting errors through reader.failed. Sections are read in the order of the section tuple, so a
+    ///             section can refer to the sections before it (e.g. imported functions refer to the type section).
+    template <typename Sec, typename... Fs>
+    concept has_binfmt_ver1_snapshot_define =
+        requires(::uwvm2::parser::wasm::concepts::feature_reserve_type_t<::std::remove_cvref_t<Sec>> ref,
+                 ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...>& module_storage,
+                 ::uwvm2::parser::wasm::binfmt::snapshot_writer_t& writer,
+                 ::uwvm2::parser::wasm::binfmt::snapshot_reader_t& reader) {
+            { define_binfmt_ver1_snapshot_write(ref, ::std::as_const(module_storage), writer) } -> ::std::same_as<void>;
+            { define_binfmt_ver1_snapshot_read(ref, module_storage, reader) } -> ::std::same_as<void>;
+        };
+
+    namespace details
+    {
+        template <typename... Fs, typename... Secs>
+        inline consteval bool check_binfmt_ver1_snapshot_define(::fast_io::tuple<Secs...> const*) noexcept
+        {
+            return (::uwvm2::parser::wasm::binfmt::ver1::has_binfmt_ver1_snapshot_define<Secs, Fs...> && ...);
+        }
+    }  // namespace details
+
+    /// @brief Snapshots are only available when every section of the feature set defines the snapshot functions
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+    inline constexpr bool binfmt_ver1_snapshot_supported{details::check_binfmt_ver1_snapshot_define<Fs...>(
+        static_cast<::uwvm2::parser::wasm::binfmt::ver1::splice_section_storage_structure_t<Fs...> const*>(nullptr))};
+
+    /// @brief      Header of a binfmt ver1 snapshot
+    /// @details    A snapshot is only valid for the same module bytes (module_size and module_hash), the same build of the parser (byte_order and
+    ///             storage_size) and the same parsing parameters (parameter_key). Followed by payload_size bytes of section data.
+    struct binfmt_ver1_snapshot_header_t
+    {
+        inline static constexpr char8_t magic_value[8]{u8'u', u8'w', u8'v', u8'm', u8's', u8'n', u8'a', u8'p'};
+        // Increase when the encoding of any section changes
+        inline static constexpr ::std::uint_least32_t current_format_version{2u};
+        inline static constexpr ::std::uint_least64_t byte_order_value{0x0102030405060708u};
+
+        char8_t magic[8]{};
+        ::std::uint_least32_t format_version{};
+        ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 binfmt_version{};
+        ::std::uint_least64_t byte_order{};
+        ::std::uint_least64_t storage_size{};
+        ::std::uint_least64_t parameter_key{};
+        ::std::uint_least64_t module_size{};
+        ::uwvm2::parser::wasm::binfmt::snapshot_hash_t module_hash{};
+        ::std::uint_least64_t payload_size{};
+    };
+
+    static_assert(::std::is_trivially_copyable_v<binfmt_ver1_snapshot_header_t>);
+
+    /// @brief      Serialize a parsed module storage
+    /// @details    module_hash is the snapshot_content_hash of the module bytes, parameter_key identifies the parsing parameters that affect the storage
+    ///             (e.g. lazy decoding of locals), both are recorded in the header and checked by read_binfmt_ver1_snapshot.
+    /// @return     the snapshot, empty if the feature set does not support snapshots (binfmt_ver1_snapshot_supported)
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+    inline ::fast_io::vector<::std::byte>
+        write_binfmt_ver1_snapshot(::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...> const& module_storage,
+                                   ::uwvm2::parser::wasm::binfmt::snapshot_hash_t module_hash,
+                                   ::std::uint_least64_t parameter_key) noexcept
+    {
+        using module_storage_t = ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...>;
+
+        if constexpr(!::uwvm2::parser::wasm::binfmt::ver1::binfmt_ver1_snapshot_supported<Fs...>) { return {}; }
+        else
+        {
+            ::uwvm2::parser::wasm::binfmt::snapshot_writer_t writer{};
+            writer.module_begin = module_storage.module_span.module_begin;
+            writer.module_end = module_storage.module_span.module_end;
+
+            binfmt_ver1_snapshot_header_t header{};
+            ::std::memcpy(header.magic, binfmt_ver1_snapshot_header_t::magic_value, sizeof(header.magic));
+            header.format_version = binfmt_ver1_snapshot_header_t::current_format_version;
+            header.binfmt_version = module_storage_t::binfmt_version;
+            header.byte_order = binfmt_ver1_snapshot_header_t::byte_order_value;
+            header.storage_size = sizeof(module_storage_t);
+            header.parameter_key = parameter_key;
+            header.module_size = static_cast<::std::uint_least64_t>(writer.module_end - writer.module_begin);
+            header.module_hash = module_hash;
+
+            // payload_size is filled in at the end
+            writer.write(header);
+
+            auto const& [... secs]{module_storage.sections};
+
+            // Each section is preceded by the size of its storage, which catches a reader built with a different feature set
+            ((writer.write(static_cast<::std::uint_least64_t>(sizeof(secs))),
+              define_binfmt_ver1_snapshot_write(::uwvm2::parser::wasm::concepts::feature_reserve_type<::std::remove_cvref_t<decltype(secs)>>,
+                                                module_storage,
+                                                writer)),
+             ...);
+
+            header.payload_size = static_cast<::std::uint_least64_t>(writer.buffer.size() - sizeof(header));
+            ::std::memcpy(writer.buffer.data(), ::std::addressof(header), sizeof(header));
+
+            return ::std::move(writer.buffer);
+        }
+    }
+
+    /// @brief      Restore a module storage from a snapshot of the same module
+    /// @details    Nothing is parsed or validated, module_storage refers to [module_begin, module_end) exactly as if the module had been parsed. The
+    ///             snapshot can be released afterwards.
+    /// @return     false if the snapshot does not belong to the module, was written by another build or is corrupted, module_storage is then reset to
+    ///             the default state and the module has to be parsed. Always false if the feature set does not support snapshots.
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+    inline bool read_binfmt_ver1_snapshot(::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...>& module_storage,
+                                          ::std::byte const* module_begin,
+                                          ::std::byte const* module_end,
+                                          ::uwvm2::parser::wasm::binfmt::snapshot_hash_t module_hash,
+                                          ::std::uint_least64_t parameter_key,
+                                          ::std::byte const* snapshot_begin,
+                                          ::std::byte const* snapshot_end) noexcept
+    {
+        using module_storage_t = ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...>;
+
+        if constexpr(!::uwvm2::parser::wasm::binfmt::ver1::binfmt_ver1_snapshot_supported<Fs...>) { return false; }
+        else
+        {
+            ::uwvm2::parser::wasm::binfmt::snapshot_reader_t reader{snapshot_begin, snapshot_end, module_begin, module_end, false};
+
+            auto const header{reader.read<binfmt_ver1_snapshot_header_t>()};
+
+            if(reader.failed || ::std::memcmp(header.magic, binfmt_ver1_snapshot_header_t::magic_value, sizeof(header.magic)) != 0 ||
+               header.format_version != binfmt_ver1_snapshot_header_t::current_format_version || header.binfmt_version != module_storage_t::binfmt_version ||
+               header.byte_order != binfmt_ver1_snapshot_header_t::byte_order_value || header.storage_size != sizeof(module_storage_t) ||
+               header.parameter_key != parameter_key || header.module_size != static_cast<::std::uint_least64_t>(module_end - module_begin) ||
+               header.module_hash != module_hash || header.payload_size != static_cast<::std::uint_least64_t>(reader.end - reader.curr))
+            {
+                return false;
+            }
+
+            module_storage = module_storage_t{};
+            module_storage.module_span.module_begin = module_begin;
+            module_storage.module_span.module_end = module_end;
+
+            auto& [... secs]{module_storage.sections};
+
+            (
+                [&]<typename Sec>(Sec&) constexpr noexcept
+                {
+                    if(reader.failed) { return; }
+
+                    if(reader.read<::std::uint_least64_t>() != static_cast<::std::uint_least64_t>(sizeof(Sec))) [[unlikely]]
+                    {
+                        reader.failed = true;
+                        return;
+                    }
+
+                    define_binfmt_ver1_snapshot_read(::uwvm2::parser::wasm::concepts::feature_reserve_type<Sec>, module_storage, reader);
+                }(secs),
+                ...);
+
+            if(reader.failed || reader.curr != reader.end) [[unlikely]]
+            {
+                module_storage = module_storage_t{};
+                return false;
+            }
+
+            return true;
+        }
+    }
+}  // namespace uwvm2::parser::wasm::binfmt::ver1
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
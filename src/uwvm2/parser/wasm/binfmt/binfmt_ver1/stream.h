@@ -0,0 +1,335 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @brief       WebAssembly Release 1.0 (2019-07-20)
+ * @details     antecedent dependency: null
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2025-07-20
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#if !(__cpp_structured_bindings >= 202411L)
+# error "UWVM requires at least C++26 standard compiler. See https://en.cppreference.com/w/cpp/compiler_support/26#cpp_structured_bindings_202411L"
+#endif
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.parser.wasm.base;
+import uwvm2.parser.wasm.concepts;
+import uwvm2.parser.wasm.standard.wasm1.type;
+import uwvm2.parser.wasm.binfmt.base;
+import :section;
+import :def;
+import :handler;
+#else
+// std
+# include <cstddef>
+# include <cstdint>
+# include <cstring>
+# include <climits>
+# include <concepts>
+# include <type_traits>
+# include <utility>
+# include <memory>
+# include <limits>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# include <fast_io_dsal/tuple.h>
+# include <uwvm2/parser/wasm/base/impl.h>
+# include <uwvm2/parser/wasm/concepts/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
+# include <uwvm2/parser/wasm/binfmt/base/impl.h>
+# include "section.h"
+# include "def.h"
+# include "handler.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::binfmt::ver1
+{
+    /// @brief      Push-style parser of wasm binfmt ver1, for modules that arrive in chunks (pipes, sockets)
+    /// @details    The bytes are appended to a contiguous buffer owned by the parser. Every section is handed to the same section handlers as
+    ///             wasm_binfmt_ver1_handle_func as soon as it is complete, so parsing overlaps with the transfer. finish() checks the end of the module
+    ///             and runs the final check, after that `storage` is the same as the result of wasm_binfmt_ver1_handle_func on the whole module.
+    ///
+    ///             The parsed storage points into the buffer. When the buffer has to grow, the bytes are moved and the sections parsed so far are parsed
+    ///             again from the new buffer (the capacity doubles, so every byte is parsed at most twice on average). A size hint passed to reserve()
+    ///             avoids this entirely.
+    ///
+    ///             Errors are reported the same way as wasm_binfmt_ver1_handle_func (err + throw), err.err_curr points into the buffer, which stays valid
+    ///             until the next push(). The parser must outlive `storage`.
+    /// @throws     ::fast_io::error
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+    struct wasm_binfmt_ver1_stream_parser_t
+    {
+        static_assert(sizeof...(Fs) != 0uz, "a stream without features has nothing to parse");
+
+        using module_storage_t = ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...>;
+        using feature_parameter_type = ::uwvm2::parser::wasm::concepts::feature_parameter_t<Fs...>;
+
+        inline static constexpr ::std::size_t header_size{8uz};
+        inline static constexpr ::std::size_t min_capacity{64uz * 1024uz};
+
+        // Declared before the buffer, the storage points into the buffer
+        module_storage_t storage{};
+
+        ::std::byte* buffer_begin{};
+        ::std::byte* buffer_curr{};
+        ::std::byte* buffer_end{};
+
+        // Bytes [buffer_begin, buffer_begin + parsed_size) have been handed to the section handlers
+        ::std::size_t parsed_size{};
+        ::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte max_section_id{};
+
+        feature_parameter_type const* fs_para{};
+
+        inline explicit constexpr wasm_binfmt_ver1_stream_parser_t(feature_parameter_type const& para) noexcept : fs_para{::std::addressof(para)} {}
+
+        inline constexpr wasm_binfmt_ver1_stream_parser_t(wasm_binfmt_ver1_stream_parser_t const&) noexcept = delete;
+        inline constexpr wasm_binfmt_ver1_stream_parser_t& operator= (wasm_binfmt_ver1_stream_parser_t const&) noexcept = delete;
+
+        inline constexpr ~wasm_binfmt_ver1_stream_parser_t()
+        {
+            // The storage refers to the buffer, release it first
+            this->storage = module_storage_t{};
+
+            if(this->buffer_begin != nullptr)
+            {
+                ::fast_io::native_global_allocator::deallocate_n(this->buffer_begin, static_cast<::std::size_t>(this->buffer_end - this->buffer_begin));
+            }
+        }
+
+        [[nodiscard]] inline constexpr ::std::byte const* module_begin() const noexcept { return this->buffer_begin; }
+
+        [[nodiscard]] inline constexpr ::std::byte const* module_end() const noexcept { return this->buffer_curr; }
+
+        [[nodiscard]] inline constexpr ::std::size_t size() const noexcept { return static_cast<::std::size_t>(this->buffer_curr - this->buffer_begin); }
+
+        /// @brief Make room for at least n bytes of module in total, e.g. the size announced by the sender
+        inline void reserve(::std::size_t n, ::uwvm2::parser::wasm::base::error_impl& err) UWVM_THROWS
+        {
+            if(n <= static_cast<::std::size_t>(this->buffer_end - this->buffer_begin)) { return; }
+
+            auto const new_begin{static_cast<::std::byte*>(::fast_io::native_global_allocator::allocate(n))};
+            auto const old_size{this->size()};
+            if(old_size != 0uz) { ::std::memcpy(new_begin, this->buffer_begin, old_size); }
+
+            // Release the storage before the bytes it points to
+            this->storage = module_storage_t{};
+
+            if(this->buffer_begin != nullptr)
+            {
+                ::fast_io::native_global_allocator::deallocate_n(this->buffer_begin, static_cast<::std::size_t>(this->buffer_end - this->buffer_begin));
+            }
+
+            this->buffer_begin = new_begin;
+            this->buffer_curr = new_begin + old_size;
+            this->buffer_end = new_begin + n;
+
+            // Parse the complete sections again from the new buffer
+            this->parsed_size = 0uz;
+            this->max_section_id = 0u;
+            this->advance(err, false);
+        }
+
+        /// @brief Append a chunk of the module and parse every section it completes
+        inline void push(::std::byte const* chunk_begin, ::std::byte const* chunk_end, ::uwvm2::parser::wasm::base::error_impl& err) UWVM_THROWS
+        {
+            auto const chunk_size{static_cast<::std::size_t>(chunk_end - chunk_begin)};
+            if(chunk_size == 0uz) { return; }
+
+            if(static_cast<::std::size_t>(this->buffer_end - this->buffer_curr) < chunk_size)
+            {
+                auto const old_capacity{static_cast<::std::size_t>(this->buffer_end - this->buffer_begin)};
+                auto const needed{this->size() + chunk_size};
+
+                auto new_capacity{old_capacity < min_capacity ? min_capacity : old_capacity};
+                while(new_capacity < needed)
+                {
+                    if(new_capacity > ::std::numeric_limits<::std::size_t>::max() / 2uz) [[unlikely]]
+                    {
+                        new_capacity = needed;
+                        break;
+                    }
+                    new_capacity *= 2uz;
+                }
+
+                // The chunk is appended after reserve, reserve parses again only what has already been parsed
+                this->reserve(new_capacity, err);
+            }
+
+            ::std::memcpy(this->buffer_curr, chunk_begin, chunk_size);
+            this->buffer_curr += chunk_size;
+
+            this->advance(err, false);
+        }
+
+        /// @brief All bytes have arrived: check the end of the module and run the final check
+        inline void finish(::uwvm2::parser::wasm::base::error_impl& err) UWVM_THROWS
+        {
+            this->advance(err, true);
+
+            // [00 61 73 6D 01 00 00 00] (module_end)
+            if(this->size() == header_size) [[unlikely]]
+            {
+                err.err_curr = this->buffer_curr;
+                err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::no_wasm_section_found;
+                ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+            }
+
+            if constexpr(has_final_check_handler<Fs...>)
+            {
+                constexpr ::uwvm2::parser::wasm::concepts::feature_reserve_type_t<final_final_check_t<Fs...>> final_adl{};
+                define_final_check(final_adl, this->storage, this->buffer_curr, err, *this->fs_para);
+            }
+        }
+
+        /// @brief      Hand every complete section to the section handlers
+        /// @details    at_end: the module is complete, an incomplete header or section is an error (the same errors as wasm_binfmt_ver1_handle_func).
+        ///             Otherwise it waits for more bytes.
+        inline void advance(::uwvm2::parser::wasm::base::error_impl& err, bool at_end) UWVM_THROWS
+        {
+            using char8_t_const_may_alias_ptr UWVM_GNU_MAY_ALIAS = char8_t const*;
+
+            auto const module_begin{this->buffer_begin};
+            auto const module_end{this->buffer_curr};
+
+            this->storage.module_span.module_begin = module_begin;
+            this->storage.module_span.module_end = module_end;
+
+            if(this->parsed_size == 0uz)
+            {
+                auto const available{static_cast<::std::size_t>(module_end - module_begin)};
+
+                if(available < header_size)
+                {
+                    if(!at_end) { return; }
+
+                    err.err_curr = module_begin;
+                    err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::illegal_wasm_file_format;
+                    ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                }
+
+                if(!::uwvm2::parser::wasm::binfmt::is_wasm_file_unchecked(module_begin)) [[unlikely]]
+                {
+                    err.err_curr = module_begin;
+                    err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::illegal_wasm_file_format;
+                    ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                }
+
+                this->parsed_size = header_size;
+            }
+
+            for(;;)
+            {
+                ::std::byte const* module_curr{module_begin + this->parsed_size};
+
+                // [... sec_id] sec_len ...
+                // [   safe   ] unsafe (could be the module_end)
+                //      ^^ module_curr
+
+                if(module_curr == module_end) { return; }
+
+                auto const sec_id_module_ptr{module_curr};  // for error
+
+                ::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte sec_id;
+                ::std::memcpy(::std::addressof(sec_id), module_curr, sizeof(::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte));
+
+                // Avoid high invalid byte problem for platforms with CHAR_BIT greater than 8
+#if CHAR_BIT > 8
+                sec_id = static_cast<decltype(sec_id)>(static_cast<::std::uint_least8_t>(sec_id) & 0xFFu);
+#endif
+
+                // All standard sections (except custom sections, id: 0) must be in canonical order. Checking a section again after waiting for its
+                // bytes is harmless, max_section_id is then equal to sec_id.
+                if(sec_id != 0u)
+                {
+                    if(sec_id < this->max_section_id) [[unlikely]]
+                    {
+                        err.err_curr = module_curr;
+                        err.err_selectable.u8arr[0] = sec_id;
+                        err.err_selectable.u8arr[1] = this->max_section_id;
+                        err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_section_canonical_order;
+                        ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                    }
+
+                    this->max_section_id = sec_id;
+                }
+
+                ++module_curr;
+
+                ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 sec_len;  // No initialization necessary
+                auto const [sec_len_next, sec_len_err]{::fast_io::parse_by_scan(reinterpret_cast<char8_t_const_may_alias_ptr>(module_curr),
+                                                                                reinterpret_cast<char8_t_const_may_alias_ptr>(module_end),
+                                                                                ::fast_io::mnp::leb128_get(sec_len))};
+
+                if(sec_len_err != ::fast_io::parse_code::ok) [[unlikely]]
+                {
+                    // The length may be cut by the end of the bytes received so far
+                    if(sec_len_err == ::fast_io::parse_code::end_of_file && !at_end) { return; }
+
+                    err.err_curr = module_curr;
+                    err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_section_length;
+                    ::uwvm2::parser::wasm::base::throw_wasm_parse_code(sec_len_err);
+                }
+
+                constexpr auto size_t_max{::std::numeric_limits<::std::size_t>::max()};
+                constexpr auto wasm_u32_max{::std::numeric_limits<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>::max()};
+                if constexpr(size_t_max < wasm_u32_max)
+                {
+                    if(sec_len > size_t_max) [[unlikely]]
+                    {
+                        err.err_curr = module_curr;
+                        err.err_selectable.u64 = static_cast<::std::uint_least64_t>(sec_len);
+                        err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::size_exceeds_the_maximum_value_of_size_t;
+                        ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                    }
+                }
+
+                module_curr = reinterpret_cast<::std::byte const*>(sec_len_next);
+
+                if(static_cast<::std::size_t>(module_end - module_curr) < static_cast<::std::size_t>(sec_len))
+                {
+                    if(!at_end) { return; }
+
+                    err.err_curr = module_curr;
+                    err.err_selectable.u32 = sec_len;
+                    err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::illegal_section_length;
+                    ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                }
+
+                auto const sec_end{module_curr + sec_len};
+
+                handle_all_binfmt_ver1_extensible_section(this->storage, sec_id, module_curr, sec_end, err, *this->fs_para, sec_id_module_ptr);
+
+                this->parsed_size = static_cast<::std::size_t>(sec_end - module_begin);
+            }
+        }
+    };
+}  // namespace uwvm2::parser::wasm::binfmt::ver1
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
@@ -33,6 +33,7 @@ import uwvm2.parser.wasm.standard.wasm1.opcode;
 import uwvm2.parser.wasm.binfmt.binfmt_ver1;
 import uwvm2.parser.wasm.text_format;
 import :def;
+import :parameter;
 import :feature_def;
 import :custom_section;
 import :type_section;
@@ -68,6 +69,7 @@ import :final_check;
 # include <uwvm2/parser/wasm/binfmt/binfmt_ver1/impl.h>
 # include <uwvm2/parser/wasm/text_format/impl.h>
 # include "def.h"
+# include "parameter.h"
 # include "feature_def.h"
 # include "custom_section.h"
 # include "type_section.h"
@@ -96,6 +98,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
         inline static constexpr ::fast_io::u8string_view feature_name{u8"WebAssembly Release 1.0 (2019-07-20)"};
         inline static constexpr ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 binfmt_version{1u};
 
+        // parameter
+        using parameter = ::uwvm2::parser::wasm::standard::wasm1::features::wasm1_feature_parameter_t;
+
         // binary format
         using text_format = ::uwvm2::parser::wasm::concepts::operation::type_replacer<
             ::uwvm2::parser::wasm::concepts::operation::root_of_replacement,
@@ -165,6 +170,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
     // feature
     static_assert(::uwvm2::parser::wasm::concepts::wasm_feature<wasm1>);
     static_assert(::uwvm2::parser::wasm::concepts::has_wasm_binfmt_parsering_strategy<wasm1>);
+    // parameter
+    static_assert(::uwvm2::parser::wasm::concepts::has_feature_parameter<wasm1>);
     // binary format
     static_assert(::uwvm2::parser::wasm::standard::wasm1::features::has_text_format<wasm1>);
     // type section
@@ -34,8 +34,15 @@ module;
 #include <memory>
 #include <bit>
 #include <numeric>
+#include <limits>
 // macro
 #include <uwvm2/utils/macro/push_macros.h>
+// multithread
+#ifdef UWVM_SUPPORT_MULTITHREAD
+# include <vector>
+# include <thread>
+# include <system_error>
+#endif
 // platform
 #if defined(_MSC_VER) && !defined(__clang__)
 # if !defined(_KERNEL_MODE) && defined(_M_AMD64)
@@ -35,8 +35,10 @@ import uwvm2.parser.wasm.concepts;
 import uwvm2.parser.wasm.standard.wasm1.type;
 import uwvm2.parser.wasm.standard.wasm1.section;
 import uwvm2.parser.wasm.standard.wasm1.opcode;
+import uwvm2.parser.wasm.binfmt.base;
 import uwvm2.parser.wasm.binfmt.binfmt_ver1;
 import :def;
+import :parameter;
 import :feature_def;
 import :types;
 #else
@@ -51,6 +53,12 @@ import :types;
 # include <limits>
 // macro
 # include <uwvm2/utils/macro/push_macros.h>
+// multithread
+# ifdef UWVM_SUPPORT_MULTITHREAD
+#  include <vector>
+#  include <thread>
+#  include <system_error>
+# endif
 // import
 # include <fast_io.h>
 # include <fast_io_dsal/vector.h>
@@ -63,8 +71,10 @@ import :types;
 # include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
 # include <uwvm2/parser/wasm/standard/wasm1/section/impl.h>
 # include <uwvm2/parser/wasm/standard/wasm1/opcode/impl.h>
+# include <uwvm2/parser/wasm/binfmt/base/impl.h>
 # include <uwvm2/parser/wasm/binfmt/binfmt_ver1/impl.h>
 # include "def.h"
+# include "parameter.h"
 # include "feature_def.h"
 # include "types.h"
 #endif
@@ -85,6 +95,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
         ::uwvm2::parser::wasm::standard::wasm1::section::section_span_view sec_span{};
 
         ::fast_io::vector<::uwvm2::parser::wasm::standard::wasm1::features::final_wasm_code_t<Fs...>> codes{};
+
+        // Branch targets of all function bodies, filled by the function body validator, see wasm1_code_metadata_t
+        ::fast_io::vector<::uwvm2::parser::wasm::standard::wasm1::features::wasm1_code_branch_target_t> branch_targets{};
     };
 
     /// @brief Define functions for value_type against wasm1 for checking value_type
@@ -98,110 +111,23 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
         return uwvm2::parser::wasm::standard::wasm1::features::is_valid_value_type(value_type);
     }
 
-    /// @brief Define the handler function for code_section
-    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
-    inline constexpr void handle_binfmt_ver1_extensible_section_define(
-        ::uwvm2::parser::wasm::concepts::feature_reserve_type_t<code_section_storage_t<Fs...>> sec_adl,
-        ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...> & module_storage,
-        ::std::byte const* const section_begin,
-        ::std::byte const* const section_end,
-        ::uwvm2::parser::wasm::base::error_impl& err,
-        [[maybe_unused]] ::uwvm2::parser::wasm::concepts::feature_parameter_t<Fs...> const& fs_para,
-        ::std::byte const* const sec_id_module_ptr) UWVM_THROWS
+    namespace details
     {
-#ifdef UWVM_TIMER
-        ::uwvm2::utils::debug::timer parsing_timer{u8"parse code section (id: 10)"};
-#endif
-        // Note that section_begin may be equal to section_end
-        // No explicit checking required because ::fast_io::parse_by_scan self-checking (::fast_io::parse_code::end_of_file)
-
-        // get code_section_storage_t from storages
-        auto& codesec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<code_section_storage_t<Fs...>>(module_storage.sections)};
-
-        // function section
-        auto const& funcsec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<function_section_storage_t>(module_storage.sections)};
-        auto const defined_func_count{static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>(funcsec.funcs.size())};
-
-        // check duplicate
-        if(codesec.sec_span.sec_begin) [[unlikely]]
-        {
-            err.err_curr = sec_id_module_ptr;
-            err.err_selectable.u8 = codesec.section_id;
-            err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::duplicate_section;
-            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
-        }
-
-        using wasm_byte_const_may_alias_ptr UWVM_GNU_MAY_ALIAS = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte const*;
-
-        codesec.sec_span.sec_begin = reinterpret_cast<wasm_byte_const_may_alias_ptr>(section_begin);
-        codesec.sec_span.sec_end = reinterpret_cast<wasm_byte_const_may_alias_ptr>(section_end);
-
-        auto section_curr{section_begin};
-
-        // [before_section ... ] | code_count ... code1 ...
-        // [        safe       ] | unsafe (could be the section_end)
-        //                         ^^ section_curr
-
-        ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 code_count;  // No initialization necessary
-
-        using char8_t_const_may_alias_ptr UWVM_GNU_MAY_ALIAS = char8_t const*;
-
-        auto const [code_count_next, code_count_err]{::fast_io::parse_by_scan(reinterpret_cast<char8_t_const_may_alias_ptr>(section_curr),
-                                                                              reinterpret_cast<char8_t_const_may_alias_ptr>(section_end),
-                                                                              ::fast_io::mnp::leb128_get(code_count))};
-
-        if(code_count_err != ::fast_io::parse_code::ok) [[unlikely]]
-        {
-            err.err_curr = section_curr;
-            err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_code_count;
-            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(code_count_err);
-        }
-
-        // [before_section ... | code_count ...] code1 ...
-        // [                 safe              ] unsafe (could be the section_end)
-        //                       ^^ section_curr
-
-        // Check that the number of codes is the same as the number of defined functions
-
-        if(code_count != defined_func_count) [[unlikely]]
-        {
-            err.err_curr = section_curr;
-            err.err_selectable.u32arr[0] = code_count;
-            err.err_selectable.u32arr[1] = defined_func_count;
-            err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::code_ne_defined_func;
-            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
-        }
-
-        codesec.codes.reserve(static_cast<::std::size_t>(code_count));
-
-        section_curr = reinterpret_cast<::std::byte const*>(code_count_next);  // never out of bounds
-
-        // [before_section ... | code_count ...] code1 ...
-        // [                 safe              ] unsafe (could be the section_end)
-        //                                       ^^ section_curr
-
-        ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 code_counter{};  // use for check
-
-        while(section_curr != section_end) [[likely]]
+        /// @brief Minimum number of function bodies before the code section is parsed in parallel
+        inline constexpr ::std::size_t code_section_parallel_min_code_count{64uz};
+        /// @brief Minimum number of code section bytes per thread, below which starting a thread costs more than it saves
+        inline constexpr ::std::size_t code_section_parallel_min_bytes_per_thread{16uz * 1024uz};
+
+        /// @brief Split out a function body by its body size prefix, without parsing the local declarations
+        /// @details Sets code.body.code_begin and code.body.code_end, returns a non-ok code after filling err on failure
+        template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        inline constexpr ::fast_io::parse_code split_code_body(::std::byte const* section_curr,
+                                                               ::std::byte const* const section_end,
+                                                               ::uwvm2::parser::wasm::standard::wasm1::features::final_wasm_code_t<Fs...>& code,
+                                                               ::uwvm2::parser::wasm::base::error_impl& err) noexcept
         {
-            // Ensuring the existence of valid information
-
-            // [ ... body_size] ... local_count ... locals ...
-            // [     safe     ] unsafe (could be the section_end)
-            //       ^^ section_curr
-
-            // check table counter
-            // Ensure content is available before counting (section_curr != section_end)
-            if(++code_counter > code_count) [[unlikely]]
-            {
-                err.err_curr = section_curr;
-                err.err_selectable.u32 = code_count;
-                err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::code_section_resolved_exceeded_the_actual_number;
-                ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
-            }
-
-            // storage table (need move)
-            ::uwvm2::parser::wasm::standard::wasm1::features::final_wasm_code_t<Fs...> code{};
+            using wasm_byte_const_may_alias_ptr UWVM_GNU_MAY_ALIAS = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte const*;
+            using char8_t_const_may_alias_ptr UWVM_GNU_MAY_ALIAS = char8_t const*;
 
             // [ ... body_size] ... local_count ... locals ...
             // [     safe     ] unsafe (could be the section_end)
@@ -217,7 +143,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
             {
                 err.err_curr = section_curr;
                 err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_code_body_size;
-                ::uwvm2::parser::wasm::base::throw_wasm_parse_code(body_size_err);
+                return body_size_err;
             }
 
             // [ ... body_size ...] local_count(code_body_begin) ... ...
@@ -235,7 +161,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
                     err.err_curr = section_curr;
                     err.err_selectable.u64 = static_cast<::std::uint_least64_t>(body_size);
                     err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::size_exceeds_the_maximum_value_of_size_t;
-                    ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                    return ::fast_io::parse_code::invalid;
                 }
             }
 
@@ -250,7 +176,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
                 err.err_curr = section_curr;
                 err.err_selectable.u32 = body_size;
                 err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::illegal_code_body_size;
-                ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                return ::fast_io::parse_code::invalid;
             }
 
             // [ ... body_size ...] local_count(code_body_begin) ... ...] (code_body_end)
@@ -278,6 +204,30 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
             //                                                            ^^ code_end
             //                                                            ^^ code.body.code_end
 
+            return ::fast_io::parse_code::ok;
+        }
+
+        /// @brief Parse the local declarations of a function body that has been split out by split_code_body
+        /// @details Only reads [code.body.code_begin, code.body.code_end) and writes code, so different function bodies can be parsed concurrently
+        ///          (each thread with its own arena). code.locals is allocated from arena.
+        ///          Sets code.locals, code.all_local_count and code.body.expr_begin, returns a non-ok code after filling err on failure
+        template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        inline constexpr ::fast_io::parse_code
+            parse_code_body_locals([[maybe_unused]] ::uwvm2::parser::wasm::concepts::feature_reserve_type_t<code_section_storage_t<Fs...>> sec_adl,
+                                   ::uwvm2::parser::wasm::standard::wasm1::features::final_wasm_code_t<Fs...>& code,
+                                   ::uwvm2::parser::wasm::binfmt::module_arena_t& arena,
+                                   ::uwvm2::parser::wasm::base::error_impl& err)
+        {
+            using wasm_byte_const_may_alias_ptr UWVM_GNU_MAY_ALIAS = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte const*;
+            using char8_t_const_may_alias_ptr UWVM_GNU_MAY_ALIAS = char8_t const*;
+
+            auto section_curr{reinterpret_cast<::std::byte const*>(code.body.code_begin)};
+            auto const code_end{reinterpret_cast<::std::byte const*>(code.body.code_end)};
+
+            // [ ... body_size ...] local_count(code_body_begin) ... ...] (code_body_end)
+            // [        safe      ]        .....                        ] unsafe (could be the section_end)
+            //                      ^^ section_curr                       ^^ code_end
+
             ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 local_count;
 
             auto const [local_count_next, local_count_err]{::fast_io::parse_by_scan(reinterpret_cast<char8_t_const_may_alias_ptr>(section_curr),
@@ -288,7 +238,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
             {
                 err.err_curr = section_curr;
                 err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_local_count;
-                ::uwvm2::parser::wasm::base::throw_wasm_parse_code(local_count_err);
+                return local_count_err;
             }
 
             // [ ... body_size ... local_count(code_body_begin) ...] clocal_n ... clocal_type next_clocal_n ... code ...]
@@ -296,6 +246,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
             //                     ^^ section_curr
 
             // The size_t of some platforms is smaller than u32, in these platforms you need to do a size check before conversion
+            constexpr auto size_t_max{::std::numeric_limits<::std::size_t>::max()};
+            constexpr auto wasm_u32_max{::std::numeric_limits<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>::max()};
             if constexpr(size_t_max < wasm_u32_max)
             {
                 // The size_t of current platforms is smaller than u32, in these platforms you need to do a size check before conversion
@@ -304,18 +256,24 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
                     err.err_curr = section_curr;
                     err.err_selectable.u64 = static_cast<::std::uint_least64_t>(local_count);
                     err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::size_exceeds_the_maximum_value_of_size_t;
-                    ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                    return ::fast_io::parse_code::invalid;
                 }
             }
 
-            code.locals.reserve(static_cast<::std::size_t>(local_count));
-
             section_curr = reinterpret_cast<::std::byte const*>(local_count_next);
 
             // [ ... body_size ... local_count(code_body_begin) ...] clocal_n ... clocal_type next_clocal_n ... code ...]
             // [                     safe                          ]   ......                                           ] unsafe
             //                                                       ^^ section_curr
 
+            // Each local declaration takes at least 2 bytes (clocal_n, clocal_type), so no more than this number of entries can be pushed. The
+            // declared local_count is not trusted beyond that, a larger count fails in the loop below.
+            {
+                auto const max_local_count{static_cast<::std::size_t>(code_end - section_curr) / 2uz};
+                code.locals.reserve(arena,
+                                    static_cast<::std::size_t>(local_count) < max_local_count ? static_cast<::std::size_t>(local_count) : max_local_count);
+            }
+
             // The final list of local variables obtained by concatenating all groups must not exceed u32max.
             ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 all_clocal_counter{};
 
@@ -337,7 +295,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
                 {
                     err.err_curr = section_curr;
                     err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_clocal_n;
-                    ::uwvm2::parser::wasm::base::throw_wasm_parse_code(clocal_n_err);
+                    return clocal_n_err;
                 }
 
                 // [ ... body_size ... local_count(code_body_begin) ... clocal_n ...] clocal_type next_clocal_n ... code ...]
@@ -353,7 +311,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
                         err.err_curr = section_curr;
                         err.err_selectable.u64 = static_cast<::std::uint_least64_t>(clocal_n);
                         err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::size_exceeds_the_maximum_value_of_size_t;
-                        ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                        return ::fast_io::parse_code::invalid;
                     }
                 }
 
@@ -362,7 +320,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
                 {
                     err.err_curr = section_curr;
                     err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::final_list_of_locals_exceeds_the_maximum_value_of_u32max;
-                    ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                    return ::fast_io::parse_code::invalid;
                 }
 
                 all_clocal_counter += clocal_n;
@@ -379,7 +337,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
                 {
                     err.err_curr = section_curr;
                     err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::code_missing_local_type;
-                    ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                    return ::fast_io::parse_code::invalid;
                 }
 
                 // [ ... body_size ... local_count(code_body_begin) ... clocal_n ... clocal_type] next_clocal_n ... code ...]
@@ -398,7 +356,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
                     err.err_selectable.u8 =
                         static_cast<::std::underlying_type_t<::uwvm2::parser::wasm::standard::wasm1::features::final_value_type_t<Fs...>>>(fvt);
                     err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::illegal_value_type;
-                    ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                    return ::fast_io::parse_code::invalid;
                 }
 
                 fle.type = fvt;
@@ -416,11 +374,334 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
 
             code.body.expr_begin = reinterpret_cast<wasm_byte_const_may_alias_ptr>(section_curr);
 
+            return ::fast_io::parse_code::ok;
+        }
+
+#ifdef UWVM_SUPPORT_MULTITHREAD
+        /// @brief Result of one worker of the parallel code section parser
+        struct code_section_parallel_result_t
+        {
+            ::uwvm2::parser::wasm::base::error_impl err{};
+            ::fast_io::parse_code code{};  // ok == 0
+            // Arena of the worker, merged into the module arena after joining
+            ::uwvm2::parser::wasm::binfmt::module_arena_t arena{};
+        };
+
+        /// @brief Parse the code section with multiple threads
+        /// @details The function bodies are first split serially by the body size prefixes (only one leb128 per function), then the local declarations
+        ///          are parsed by `thread_count` threads in contiguous chunks balanced by bytes. Each worker stops at its first error, the error with the
+        ///          lowest offset (lowest chunk, then the split error) is reported, so the diagnostic is the same as the serial parser.
+        template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        inline void parse_code_section_parallel(::uwvm2::parser::wasm::concepts::feature_reserve_type_t<code_section_storage_t<Fs...>> sec_adl,
+                                                code_section_storage_t<Fs...>& codesec,
+                                                ::uwvm2::parser::wasm::binfmt::module_arena_t& module_arena,
+                                                ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 const code_count,
+                                                ::std::byte const* section_curr,
+                                                ::std::byte const* const section_end,
+                                                ::uwvm2::parser::wasm::base::error_impl& err,
+                                                ::std::size_t const thread_count) UWVM_THROWS
+        {
+            // serial split
+
+            ::uwvm2::parser::wasm::base::error_impl split_err{};
+            ::fast_io::parse_code split_code{::fast_io::parse_code::ok};
+
+            ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 code_counter{};  // use for check
+
+            while(section_curr != section_end) [[likely]]
+            {
+                // check table counter
+                // Ensure content is available before counting (section_curr != section_end)
+                if(++code_counter > code_count) [[unlikely]]
+                {
+                    split_err.err_curr = section_curr;
+                    split_err.err_selectable.u32 = code_count;
+                    split_err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::code_section_resolved_exceeded_the_actual_number;
+                    split_code = ::fast_io::parse_code::invalid;
+                    break;
+                }
+
+                ::uwvm2::parser::wasm::standard::wasm1::features::final_wasm_code_t<Fs...> code{};
+
+                split_code = ::uwvm2::parser::wasm::standard::wasm1::features::details::split_code_body(section_curr, section_end, code, split_err);
+                if(split_code != ::fast_io::parse_code::ok) [[unlikely]] { break; }
+
+                section_curr = reinterpret_cast<::std::byte const*>(code.body.code_end);
+
+                codesec.codes.push_back_unchecked(::std::move(code));
+            }
+
+            // parallel parsing of local declarations (bodies before the split error are still parsed, their errors have lower offsets)
+
+            auto const codes_begin{codesec.codes.begin()};
+            auto const codes_size{codesec.codes.size()};
+
+            if(codes_size != 0uz) [[likely]]
+            {
+                auto const worker_count{thread_count < codes_size ? thread_count : codes_size};
+
+                // Contiguous chunks balanced by bytes: [chunk_bounds[i], chunk_bounds[i + 1])
+                auto const total_bytes{static_cast<::std::size_t>(codes_begin[codes_size - 1uz].body.code_end - codes_begin->body.code_begin)};
+                auto const bytes_per_worker{total_bytes / worker_count};
+
+                ::fast_io::vector<::std::size_t> chunk_bounds{};
+                chunk_bounds.reserve(worker_count + 1uz);
+                chunk_bounds.push_back_unchecked(0uz);
+
+                ::std::size_t accumulated_bytes{};
+                for(::std::size_t i{}; i != codes_size && chunk_bounds.size() != worker_count; ++i)
+                {
+                    accumulated_bytes += static_cast<::std::size_t>(codes_begin[i].body.code_end - codes_begin[i].body.code_begin);
+                    if(accumulated_bytes >= bytes_per_worker * chunk_bounds.size()) { chunk_bounds.push_back_unchecked(i + 1uz); }
+                }
+
+                chunk_bounds.push_back_unchecked(codes_size);
+
+                auto const chunk_count{chunk_bounds.size() - 1uz};
+
+                ::fast_io::vector<code_section_parallel_result_t> results{};
+                results.reserve(chunk_count);
+                for(::std::size_t i{}; i != chunk_count; ++i) { results.push_back_unchecked(code_section_parallel_result_t{}); }
+
+                auto const chunk_bounds_begin{chunk_bounds.cbegin()};
+                auto const results_begin{results.begin()};
+
+                auto const worker{[sec_adl, codes_begin, chunk_bounds_begin, results_begin](::std::size_t chunk) constexpr
+                                  {
+                                      auto& res{results_begin[chunk]};
+                                      for(auto i{chunk_bounds_begin[chunk]}; i != chunk_bounds_begin[chunk + 1uz]; ++i)
+                                      {
+                                          res.code = ::uwvm2::parser::wasm::standard::wasm1::features::details::parse_code_body_locals(sec_adl,
+                                                                                                                                       codes_begin[i],
+                                                                                                                                       res.arena,
+                                                                                                                                       res.err);
+                                          if(res.code != ::fast_io::parse_code::ok) [[unlikely]] { return; }
+                                      }
+                                  }};
+
+                {
+                    // The current thread handles chunk 0 and the chunks whose thread cannot be started
+                    ::std::vector<::std::thread> threads{};
+                    threads.reserve(chunk_count - 1uz);
+                    ::std::size_t unstarted_chunk{1uz};
+                    for(; unstarted_chunk < chunk_count; ++unstarted_chunk)
+                    {
+# ifdef __cpp_exceptions
+                        try
+# endif
+                        {
+                            threads.emplace_back(worker, unstarted_chunk);
+                        }
+# ifdef __cpp_exceptions
+                        catch(::std::system_error const&)
+                        {
+                            break;
+                        }
+# endif
+                    }
+
+                    worker(0uz);
+                    for(auto i{unstarted_chunk}; i < chunk_count; ++i) { worker(i); }
+
+                    for(auto& thread: threads) { thread.join(); }
+                }
+
+                // The locals of all function bodies now belong to the module
+                for(auto& res: results) { module_arena.merge(::std::move(res.arena)); }
+
+                // Deterministic: the first (lowest offset) error wins
+                for(auto const& res: results)
+                {
+                    if(res.code != ::fast_io::parse_code::ok) [[unlikely]]
+                    {
+                        err = res.err;
+                        ::uwvm2::parser::wasm::base::throw_wasm_parse_code(res.code);
+                    }
+                }
+            }
+
+            if(split_code != ::fast_io::parse_code::ok) [[unlikely]]
+            {
+                err = split_err;
+                ::uwvm2::parser::wasm::base::throw_wasm_parse_code(split_code);
+            }
+
+            // [... ] (section_end)
+            // [safe] unsafe (could be the section_end)
+            //        ^^ section_curr
+
+            // check code counter match
+            if(code_counter != code_count) [[unlikely]]
+            {
+                err.err_curr = section_curr;
+                err.err_selectable.u32arr[0] = code_counter;
+                err.err_selectable.u32arr[1] = code_count;
+                err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::code_section_resolved_not_match_the_actual_number;
+                ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+            }
+        }
+#endif
+    }  // namespace details
+
+    /// @brief Define the handler function for code_section
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+    inline constexpr void handle_binfmt_ver1_extensible_section_define(
+        ::uwvm2::parser::wasm::concepts::feature_reserve_type_t<code_section_storage_t<Fs...>> sec_adl,
+        ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...> & module_storage,
+        ::std::byte const* const section_begin,
+        ::std::byte const* const section_end,
+        ::uwvm2::parser::wasm::base::error_impl& err,
+        [[maybe_unused]] ::uwvm2::parser::wasm::concepts::feature_parameter_t<Fs...> const& fs_para,
+        ::std::byte const* const sec_id_module_ptr) UWVM_THROWS
+    {
+#ifdef UWVM_TIMER
+        ::uwvm2::utils::debug::timer parsing_timer{u8"parse code section (id: 10)"};
+#endif
+        // Note that section_begin may be equal to section_end
+        // No explicit checking required because ::fast_io::parse_by_scan self-checking (::fast_io::parse_code::end_of_file)
+
+        // get code_section_storage_t from storages
+        auto& codesec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<code_section_storage_t<Fs...>>(module_storage.sections)};
+
+        // function section
+        auto const& funcsec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<function_section_storage_t>(module_storage.sections)};
+        auto const defined_func_count{static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>(funcsec.funcs.size())};
+
+        // check duplicate
+        if(codesec.sec_span.sec_begin) [[unlikely]]
+        {
+            err.err_curr = sec_id_module_ptr;
+            err.err_selectable.u8 = codesec.section_id;
+            err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::duplicate_section;
+            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+        }
+
+        using wasm_byte_const_may_alias_ptr UWVM_GNU_MAY_ALIAS = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte const*;
+
+        codesec.sec_span.sec_begin = reinterpret_cast<wasm_byte_const_may_alias_ptr>(section_begin);
+        codesec.sec_span.sec_end = reinterpret_cast<wasm_byte_const_may_alias_ptr>(section_end);
+
+        // Link scan mode: only the span is recorded, the section is parsed by complete_link_scan
+        if(::uwvm2::parser::wasm::standard::wasm1::features::get_wasm1_feature_parameter(fs_para).link_scan_only) { return; }
+
+        auto section_curr{section_begin};
+
+        // [before_section ... ] | code_count ... code1 ...
+        // [        safe       ] | unsafe (could be the section_end)
+        //                         ^^ section_curr
+
+        ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 code_count;  // No initialization necessary
+
+        using char8_t_const_may_alias_ptr UWVM_GNU_MAY_ALIAS = char8_t const*;
+
+        auto const [code_count_next, code_count_err]{::fast_io::parse_by_scan(reinterpret_cast<char8_t_const_may_alias_ptr>(section_curr),
+                                                                              reinterpret_cast<char8_t_const_may_alias_ptr>(section_end),
+                                                                              ::fast_io::mnp::leb128_get(code_count))};
+
+        if(code_count_err != ::fast_io::parse_code::ok) [[unlikely]]
+        {
+            err.err_curr = section_curr;
+            err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_code_count;
+            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(code_count_err);
+        }
+
+        // [before_section ... | code_count ...] code1 ...
+        // [                 safe              ] unsafe (could be the section_end)
+        //                       ^^ section_curr
+
+        // Check that the number of codes is the same as the number of defined functions
+
+        if(code_count != defined_func_count) [[unlikely]]
+        {
+            err.err_curr = section_curr;
+            err.err_selectable.u32arr[0] = code_count;
+            err.err_selectable.u32arr[1] = defined_func_count;
+            err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::code_ne_defined_func;
+            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+        }
+
+        codesec.codes.reserve(static_cast<::std::size_t>(code_count));
+
+        section_curr = reinterpret_cast<::std::byte const*>(code_count_next);  // never out of bounds
+
+        // [before_section ... | code_count ...] code1 ...
+        // [                 safe              ] unsafe (could be the section_end)
+        //                                       ^^ section_curr
+
+        auto const wasm1_para{::uwvm2::parser::wasm::standard::wasm1::features::get_wasm1_feature_parameter(fs_para)};
+
+        // Lazy mode: only the spans of the function bodies are recorded, see get_code_with_decoded_locals
+        bool const lazy_locals{wasm1_para.code_section_lazy_locals};
+
+#ifdef UWVM_SUPPORT_MULTITHREAD
+        // Large code sections are split serially and then parsed in parallel
+        if(auto const parse_threads{wasm1_para.code_section_parse_threads}; !lazy_locals && parse_threads > 1uz)
+        {
+            auto const section_size{static_cast<::std::size_t>(section_end - section_curr)};
+            auto const max_threads_by_size{section_size / ::uwvm2::parser::wasm::standard::wasm1::features::details::code_section_parallel_min_bytes_per_thread};
+            auto const thread_count{parse_threads < max_threads_by_size ? parse_threads : max_threads_by_size};
+
+            if(static_cast<::std::size_t>(code_count) >= ::uwvm2::parser::wasm::standard::wasm1::features::details::code_section_parallel_min_code_count &&
+               thread_count > 1uz)
+            {
+                ::uwvm2::parser::wasm::standard::wasm1::features::details::parse_code_section_parallel(sec_adl,
+                                                                                                      codesec,
+                                                                                                      module_storage.arena,
+                                                                                                      code_count,
+                                                                                                      section_curr,
+                                                                                                      section_end,
+                                                                                                      err,
+                                                                                                      thread_count);
+                return;
+            }
+        }
+#endif
+
+        ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 code_counter{};  // use for check
+
+        while(section_curr != section_end) [[likely]]
+        {
+            // Ensuring the existence of valid information
+
+            // [ ... body_size] ... local_count ... locals ...
+            // [     safe     ] unsafe (could be the section_end)
+            //       ^^ section_curr
+
+            // check table counter
+            // Ensure content is available before counting (section_curr != section_end)
+            if(++code_counter > code_count) [[unlikely]]
+            {
+                err.err_curr = section_curr;
+                err.err_selectable.u32 = code_count;
+                err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::code_section_resolved_exceeded_the_actual_number;
+                ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+            }
+
+            // storage table (need move)
+            ::uwvm2::parser::wasm::standard::wasm1::features::final_wasm_code_t<Fs...> code{};
+
+            if(auto const split_code{::uwvm2::parser::wasm::standard::wasm1::features::details::split_code_body(section_curr, section_end, code, err)};
+               split_code != ::fast_io::parse_code::ok) [[unlikely]]
+            {
+                ::uwvm2::parser::wasm::base::throw_wasm_parse_code(split_code);
+            }
+
+            // In lazy mode, code.body.expr_begin remains nullptr until the local declarations are decoded
+            if(!lazy_locals)
+            {
+                if(auto const locals_code{
+                       ::uwvm2::parser::wasm::standard::wasm1::features::details::parse_code_body_locals(sec_adl, code, module_storage.arena, err)};
+                   locals_code != ::fast_io::parse_code::ok) [[unlikely]]
+                {
+                    ::uwvm2::parser::wasm::base::throw_wasm_parse_code(locals_code);
+                }
+            }
+
             // [ ...] (code_end)
             // [safe] unsafe (could be the section_end)
             //        ^^ section_curr
 
-            section_curr = reinterpret_cast<::std::byte const*>(code_end);
+            section_curr = reinterpret_cast<::std::byte const*>(code.body.code_end);
 
             // Subsequent boundary adjustments code_end to section_end
 
@@ -447,6 +728,52 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
             ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
         }
     }
+
+    /// @brief Whether the local declarations of the function body have been decoded
+    /// @details Always true unless the code section is parsed with wasm1_feature_parameter_t::code_section_lazy_locals
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+    inline constexpr bool is_code_locals_decoded(::uwvm2::parser::wasm::standard::wasm1::features::final_wasm_code_t<Fs...> const& code) noexcept
+    {
+        return code.body.expr_begin != nullptr;
+    }
+
+    /// @brief Get a function body whose local declarations are decoded
+    /// @details Local declarations of code sections parsed in lazy mode are decoded on the first call and cached in `codesec.codes`, subsequent calls
+    ///          return the cached result directly. Not thread-safe for the first touch of any function (the locals are allocated from arena).
+    /// @note    code_index must be less than codesec.codes.size(), arena is the arena of the module storage that owns codesec
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+    inline constexpr ::uwvm2::parser::wasm::standard::wasm1::features::final_wasm_code_t<Fs...> const&
+        get_code_with_decoded_locals(code_section_storage_t<Fs...>& codesec,
+                                     ::uwvm2::parser::wasm::binfmt::module_arena_t& arena,
+                                     ::std::size_t code_index,
+                                     ::uwvm2::parser::wasm::base::error_impl& err) UWVM_THROWS
+    {
+        auto& code{codesec.codes.index_unchecked(code_index)};
+
+        if(!::uwvm2::parser::wasm::standard::wasm1::features::is_code_locals_decoded(code)) [[unlikely]]
+        {
+            // Decoded in a scratch arena and copied on success: a malformed body leaves nothing in the module arena, however often it is touched,
+            // and the next touch reports the same error
+            ::uwvm2::parser::wasm::binfmt::module_arena_t scratch_arena{};
+            auto decoded{code};
+            if(auto const locals_code{::uwvm2::parser::wasm::standard::wasm1::features::details::parse_code_body_locals(
+                   ::uwvm2::parser::wasm::concepts::feature_reserve_type<code_section_storage_t<Fs...>>,
+                   decoded,
+                   scratch_arena,
+                   err)};
+               locals_code != ::fast_io::parse_code::ok) [[unlikely]]
+            {
+                ::uwvm2::parser::wasm::base::throw_wasm_parse_code(locals_code);
+            }
+
+            code.locals.reserve(arena, decoded.locals.size());
+            for(auto const& local: decoded.locals) { code.locals.push_back_unchecked(local); }
+            code.all_local_count = decoded.all_local_count;
+            code.body.expr_begin = decoded.body.expr_begin;
+        }
+
+        return code;
+    }
 }  // namespace uwvm2::parser::wasm::standard::wasm1::features
 
 /// @brief Define container optimization operations for use with fast_io
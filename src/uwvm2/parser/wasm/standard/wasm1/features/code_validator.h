@@ -0,0 +1,1228 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @brief       WebAssembly Release 1.0 (2019-07-20)
+ * @details     antecedent dependency: null
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2025-07-16
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifdef UWVM_MODULE
+import fast_io;
+# ifdef UWVM_TIMER
+import uwvm2.utils.debug;
+# endif
+import uwvm2.parser.wasm.base;
+import uwvm2.parser.wasm.concepts;
+import uwvm2.parser.wasm.standard.wasm1.type;
+import uwvm2.parser.wasm.standard.wasm1.section;
+import uwvm2.parser.wasm.standard.wasm1.opcode;
+import uwvm2.parser.wasm.binfmt.binfmt_ver1;
+import :def;
+import :feature_def;
+import :types;
+import :type_section;
+import :import_section;
+import :function_section;
+import :table_section;
+import :memory_section;
+import :global_section;
+import :code_section;
+#else
+// std
+# include <cstddef>
+# include <cstdint>
+# include <concepts>
+# include <type_traits>
+# include <utility>
+# include <memory>
+# include <limits>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# include <fast_io_dsal/array.h>
+# include <fast_io_dsal/vector.h>
+# ifdef UWVM_TIMER
+#  include <uwvm2/utils/debug/impl.h>
+# endif
+# include <uwvm2/parser/wasm/base/impl.h>
+# include <uwvm2/parser/wasm/concepts/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/section/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/opcode/impl.h>
+# include <uwvm2/parser/wasm/binfmt/binfmt_ver1/impl.h>
+# include "def.h"
+# include "feature_def.h"
+# include "types.h"
+# include "type_section.h"
+# include "import_section.h"
+# include "function_section.h"
+# include "table_section.h"
+# include "memory_section.h"
+# include "global_section.h"
+# include "code_section.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
+{
+    namespace details
+    {
+        /// @brief End of a chain of branch targets waiting for the end of a control frame
+        inline constexpr ::std::size_t code_validator_npos{::std::numeric_limits<::std::size_t>::max()};
+
+        /// @brief Control frame of the function body validator
+        template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        struct code_validator_control_frame_t
+        {
+            // Result types of the frame, also the label types unless the frame is a loop
+            ::uwvm2::parser::wasm::standard::wasm1::features::final_value_type_t<Fs...> const* result_begin{};
+            ::uwvm2::parser::wasm::standard::wasm1::features::final_value_type_t<Fs...> const* result_end{};
+            // First instruction of the loop body, which is the continuation of a loop
+            ::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte const* loop_begin{};
+            // Height of the operand stack when entering the frame
+            ::std::size_t operand_height{};
+            // First branch target waiting for the end of this frame, the chain is linked by code_validation_stack_t::pending_links
+            ::std::size_t pending_head{code_validator_npos};
+            // Branch target of the if (or else) instruction waiting for the else (or end) of this frame
+            ::std::size_t if_else_target{code_validator_npos};
+            // block, loop, if_, else_ (an if frame after its else), the frame of the function itself is a block
+            ::uwvm2::parser::wasm::standard::wasm1::opcode::op_basic kind{};
+            bool unreachable{};
+        };
+
+        /// @brief Block types are encoded in one byte, the result type of a block with a value type points into this table
+        template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        inline constexpr auto code_validator_block_result_table{[]() constexpr noexcept
+                                                                {
+                                                                    ::fast_io::array<::uwvm2::parser::wasm::standard::wasm1::features::final_value_type_t<Fs...>,
+                                                                                     256uz>
+                                                                        res{};
+                                                                    for(::std::size_t i{}; i != 256uz; ++i)
+                                                                    {
+                                                                        res.index_unchecked(i) =
+                                                                            static_cast<::uwvm2::parser::wasm::standard::wasm1::features::final_value_type_t<Fs...>>(i);
+                                                                    }
+                                                                    return res;
+                                                                }()};
+
+        /// @brief Signature of the numeric instructions (comparisons, arithmetic and conversions)
+        /// @details operand_count == 0 means the opcode is not a numeric instruction
+        struct code_validator_numeric_signature_t
+        {
+            ::uwvm2::parser::wasm::standard::wasm1::type::value_type operand{};
+            ::uwvm2::parser::wasm::standard::wasm1::type::value_type result{};
+            unsigned operand_count{};
+        };
+
+        /// @brief Signatures of all numeric instructions indexed by opcode
+        inline constexpr auto code_validator_numeric_signature_table{
+            []() constexpr noexcept
+            {
+                using value_type = ::uwvm2::parser::wasm::standard::wasm1::type::value_type;
+
+                ::fast_io::array<code_validator_numeric_signature_t, 256uz> res{};
+
+                auto const set_range{[&res](unsigned first, unsigned last, value_type operand, value_type result, unsigned operand_count) constexpr noexcept
+                                     {
+                                         for(auto i{first}; i <= last; ++i) { res.index_unchecked(i) = {operand, result, operand_count}; }
+                                     }};
+
+                // Comparisons
+                set_range(0x45u, 0x45u, value_type::i32, value_type::i32, 1u);  // i32.eqz
+                set_range(0x46u, 0x4fu, value_type::i32, value_type::i32, 2u);  // i32.eq ... i32.ge_u
+                set_range(0x50u, 0x50u, value_type::i64, value_type::i32, 1u);  // i64.eqz
+                set_range(0x51u, 0x5au, value_type::i64, value_type::i32, 2u);  // i64.eq ... i64.ge_u
+                set_range(0x5bu, 0x60u, value_type::f32, value_type::i32, 2u);  // f32.eq ... f32.ge
+                set_range(0x61u, 0x66u, value_type::f64, value_type::i32, 2u);  // f64.eq ... f64.ge
+                // Arithmetic
+                set_range(0x67u, 0x69u, value_type::i32, value_type::i32, 1u);  // i32.clz, i32.ctz, i32.popcnt
+                set_range(0x6au, 0x78u, value_type::i32, value_type::i32, 2u);  // i32.add ... i32.rotr
+                set_range(0x79u, 0x7bu, value_type::i64, value_type::i64, 1u);  // i64.clz, i64.ctz, i64.popcnt
+                set_range(0x7cu, 0x8au, value_type::i64, value_type::i64, 2u);  // i64.add ... i64.rotr
+                set_range(0x8bu, 0x91u, value_type::f32, value_type::f32, 1u);  // f32.abs ... f32.sqrt
+                set_range(0x92u, 0x98u, value_type::f32, value_type::f32, 2u);  // f32.add ... f32.copysign
+                set_range(0x99u, 0x9fu, value_type::f64, value_type::f64, 1u);  // f64.abs ... f64.sqrt
+                set_range(0xa0u, 0xa6u, value_type::f64, value_type::f64, 2u);  // f64.add ... f64.copysign
+                // Conversions
+                set_range(0xa7u, 0xa7u, value_type::i64, value_type::i32, 1u);  // i32.wrap_i64
+                set_range(0xa8u, 0xa9u, value_type::f32, value_type::i32, 1u);  // i32.trunc_f32_s, i32.trunc_f32_u
+                set_range(0xaau, 0xabu, value_type::f64, value_type::i32, 1u);  // i32.trunc_f64_s, i32.trunc_f64_u
+                set_range(0xacu, 0xadu, value_type::i32, value_type::i64, 1u);  // i64.extend_i32_s, i64.extend_i32_u
+                set_range(0xaeu, 0xafu, value_type::f32, value_type::i64, 1u);  // i64.trunc_f32_s, i64.trunc_f32_u
+                set_range(0xb0u, 0xb1u, value_type::f64, value_type::i64, 1u);  // i64.trunc_f64_s, i64.trunc_f64_u
+                set_range(0xb2u, 0xb3u, value_type::i32, value_type::f32, 1u);  // f32.convert_i32_s, f32.convert_i32_u
+                set_range(0xb4u, 0xb5u, value_type::i64, value_type::f32, 1u);  // f32.convert_i64_s, f32.convert_i64_u
+                set_range(0xb6u, 0xb6u, value_type::f64, value_type::f32, 1u);  // f32.demote_f64
+                set_range(0xb7u, 0xb8u, value_type::i32, value_type::f64, 1u);  // f64.convert_i32_s, f64.convert_i32_u
+                set_range(0xb9u, 0xbau, value_type::i64, value_type::f64, 1u);  // f64.convert_i64_s, f64.convert_i64_u
+                set_range(0xbbu, 0xbbu, value_type::f32, value_type::f64, 1u);  // f64.promote_f32
+                set_range(0xbcu, 0xbcu, value_type::f32, value_type::i32, 1u);  // i32.reinterpret_f32
+                set_range(0xbdu, 0xbdu, value_type::f64, value_type::i64, 1u);  // i64.reinterpret_f64
+                set_range(0xbeu, 0xbeu, value_type::i32, value_type::f32, 1u);  // f32.reinterpret_i32
+                set_range(0xbfu, 0xbfu, value_type::i64, value_type::f64, 1u);  // f64.reinterpret_i64
+
+                return res;
+            }()};
+
+        /// @brief Read an unsigned or signed leb128 immediate of an instruction
+        template <typename IntType>
+        inline constexpr ::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte const*
+            code_validator_read_leb128(::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte const* curr,
+                                       ::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte const* const code_end,
+                                       IntType& value,
+                                       ::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte const op_byte,
+                                       ::uwvm2::parser::wasm::base::error_impl& err) UWVM_THROWS
+        {
+            using wasm_byte_const_may_alias_ptr UWVM_GNU_MAY_ALIAS = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte const*;
+            using char8_t_const_may_alias_ptr UWVM_GNU_MAY_ALIAS = char8_t const*;
+
+            auto const [value_next, value_err]{::fast_io::parse_by_scan(reinterpret_cast<char8_t_const_may_alias_ptr>(curr),
+                                                                        reinterpret_cast<char8_t_const_may_alias_ptr>(code_end),
+                                                                        ::fast_io::mnp::leb128_get(value))};
+
+            if(value_err != ::fast_io::parse_code::ok) [[unlikely]]
+            {
+                err.err_curr = reinterpret_cast<::std::byte const*>(curr);
+                err.err_selectable.u8 = op_byte;
+                err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_instruction_immediate;
+                ::uwvm2::parser::wasm::base::throw_wasm_parse_code(value_err);
+            }
+
+            return reinterpret_cast<wasm_byte_const_may_alias_ptr>(value_next);
+        }
+    }  // namespace details
+
+    /// @brief      Working storage of the function body validator
+    /// @details    Created once and reused for every function body, the vectors only grow to the deepest function validated so far, so validating a
+    ///             function does not allocate.
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+    struct code_validation_stack_t
+    {
+        ::fast_io::vector<::uwvm2::parser::wasm::standard::wasm1::features::final_value_type_t<Fs...>> operand_stack{};
+        ::fast_io::vector<::uwvm2::parser::wasm::standard::wasm1::features::details::code_validator_control_frame_t<Fs...>> control_stack{};
+        // Branch targets of the current function, appended to code_section_storage_t::branch_targets when the function is valid
+        ::fast_io::vector<::uwvm2::parser::wasm::standard::wasm1::features::wasm1_code_branch_target_t> branch_targets{};
+        // Parallel to branch_targets, next branch target waiting for the end of the same control frame
+        ::fast_io::vector<::std::size_t> pending_links{};
+        // End (exclusive, counting the parameters) of the local index of each local declaration group, for binary search
+        ::fast_io::vector<::std::uint_least64_t> local_ends{};
+    };
+
+    /// @brief      Validate a function body and generate its metadata (wasm1_code_metadata_t)
+    /// @details    Single pass over the instruction stream with an operand stack and a control stack (WebAssembly Release 1.0 (2019-07-20) § 3.3,
+    ///             Appendix A.3). The local declarations of lazily parsed code sections are decoded first. Functions that have been validated are skipped.
+    /// @note       code_index must be less than codesec.codes.size()
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+    inline constexpr void validate_code_body(::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...> & module_storage,
+                                             ::std::size_t code_index,
+                                             code_validation_stack_t<Fs...> & stack,
+                                             ::uwvm2::parser::wasm::base::error_impl & err) UWVM_THROWS
+    {
+        using wasm_byte = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte;
+        using wasm_u32 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32;
+        using value_type_t = ::uwvm2::parser::wasm::standard::wasm1::features::final_value_type_t<Fs...>;
+        using op_basic = ::uwvm2::parser::wasm::standard::wasm1::opcode::op_basic;
+        using wasm1_value_type = ::uwvm2::parser::wasm::standard::wasm1::type::value_type;
+
+        // Type of the operands popped from the polymorphic stack of unreachable code, never a valid value type
+        constexpr value_type_t unknown_type{static_cast<value_type_t>(0u)};
+        constexpr value_type_t i32_type{static_cast<value_type_t>(wasm1_value_type::i32)};
+        constexpr value_type_t i64_type{static_cast<value_type_t>(wasm1_value_type::i64)};
+        constexpr value_type_t f32_type{static_cast<value_type_t>(wasm1_value_type::f32)};
+        constexpr value_type_t f64_type{static_cast<value_type_t>(wasm1_value_type::f64)};
+        constexpr wasm_byte empty_block_type{static_cast<wasm_byte>(::uwvm2::parser::wasm::standard::wasm1::type::result_type::empty)};
+
+        // code section
+        auto& codesec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<code_section_storage_t<Fs...>>(module_storage.sections)};
+
+        // Decode the local declarations of lazily parsed code sections
+        ::uwvm2::parser::wasm::standard::wasm1::features::get_code_with_decoded_locals(codesec, module_storage.arena, code_index, err);
+
+        auto& code{codesec.codes.index_unchecked(code_index)};
+
+        if(code.metadata.validated) { return; }
+
+        // type section
+        auto const& typesec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<type_section_storage_t<Fs...>>(module_storage.sections)};
+        auto const type_size{typesec.types.size()};
+
+        // import section
+        auto const& importsec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<import_section_storage_t<Fs...>>(module_storage.sections)};
+        // importdesc[0]: func, importdesc[1]: table, importdesc[2]: memory, importdesc[3]: global
+        constexpr ::std::size_t importdesc_count{importsec.importdesc_count};
+        static_assert(importdesc_count > 3uz);  // Ensure that subsequent index visits do not cross boundaries
+        auto const& imported_func{importsec.importdesc.index_unchecked(0uz)};
+        auto const imported_func_size{imported_func.size()};
+        auto const& imported_global{importsec.importdesc.index_unchecked(3uz)};
+        auto const imported_global_size{imported_global.size()};
+
+        // function section
+        auto const& funcsec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<function_section_storage_t>(module_storage.sections)};
+        // Addition does not overflow, pre-checked.
+        auto const all_func_size{imported_func_size + static_cast<::std::size_t>(funcsec.funcs.size())};
+
+        // table section
+        auto const& tablesec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<table_section_storage_t<Fs...>>(module_storage.sections)};
+        bool const has_table{importsec.importdesc.index_unchecked(1uz).size() + tablesec.tables.size() != 0uz};
+
+        // memory section
+        auto const& memorysec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<memory_section_storage_t<Fs...>>(module_storage.sections)};
+        bool const has_memory{importsec.importdesc.index_unchecked(2uz).size() + memorysec.memories.size() != 0uz};
+
+        // global section
+        auto const& globalsec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<global_section_storage_t<Fs...>>(module_storage.sections)};
+        auto const all_global_size{imported_global_size + globalsec.local_globals.size()};
+
+        auto const get_func_type{[&](::std::size_t func_idx) constexpr noexcept -> final_function_type<Fs...> const&
+                                 {
+                                     if(func_idx < imported_func_size) { return *(imported_func.index_unchecked(func_idx)->imports.storage.function); }
+                                     auto const type_idx{funcsec.funcs.index_unchecked(func_idx - imported_func_size)};
+                                     return typesec.types.index_unchecked(static_cast<::std::size_t>(type_idx));
+                                 }};
+
+        auto const get_global_type{[&](::std::size_t global_idx) constexpr noexcept -> final_global_type<Fs...> const&
+                                   {
+                                       if(global_idx < imported_global_size) { return imported_global.index_unchecked(global_idx)->imports.storage.global; }
+                                       return globalsec.local_globals.index_unchecked(global_idx - imported_global_size).global;
+                                   }};
+
+        // The function itself
+        auto const& func_type{get_func_type(imported_func_size + code_index)};
+
+        // locals: parameters first, then the local declaration groups
+        auto const param_begin{func_type.parameter.begin};
+        auto const param_size{static_cast<::std::size_t>(func_type.parameter.end - func_type.parameter.begin)};
+
+        auto& local_ends{stack.local_ends};
+        local_ends.clear();
+
+        auto all_local_size{static_cast<::std::uint_least64_t>(param_size)};
+        for(auto const& local_entry: code.locals)
+        {
+            all_local_size += local_entry.count;
+            local_ends.push_back(all_local_size);
+        }
+
+        auto const get_local_type{[&](::std::uint_least64_t local_idx) constexpr noexcept -> value_type_t
+                                  {
+                                      if(local_idx < param_size) { return param_begin[local_idx]; }
+
+                                      // The first group whose end is greater than local_idx
+                                      ::std::size_t left{};
+                                      ::std::size_t right{local_ends.size()};
+                                      while(left != right)
+                                      {
+                                          auto const mid{left + (right - left) / 2uz};
+                                          if(local_ends.index_unchecked(mid) <= local_idx) { left = mid + 1uz; }
+                                          else
+                                          {
+                                              right = mid;
+                                          }
+                                      }
+
+                                      return code.locals.index_unchecked(left).type;
+                                  }};
+
+        // Reuse the storage of the previous function
+        auto& operand_stack{stack.operand_stack};
+        operand_stack.clear();
+        auto& control_stack{stack.control_stack};
+        control_stack.clear();
+        auto& branch_targets{stack.branch_targets};
+        branch_targets.clear();
+        auto& pending_links{stack.pending_links};
+        pending_links.clear();
+
+        ::std::size_t max_operand_height{};
+        ::std::size_t max_control_height{};
+        bool is_leaf{true};
+
+        auto const push_operand{[&](value_type_t type) constexpr
+                                {
+                                    operand_stack.push_back(type);
+                                    if(operand_stack.size() > max_operand_height) { max_operand_height = operand_stack.size(); }
+                                }};
+
+        auto const pop_operand{[&](wasm_byte const* op_ptr) constexpr UWVM_THROWS -> value_type_t
+                               {
+                                   auto const& frame{control_stack.back_unchecked()};
+
+                                   if(operand_stack.size() == frame.operand_height) [[unlikely]]
+                                   {
+                                       // The operand stack of unreachable code is polymorphic
+                                       if(frame.unreachable) { return unknown_type; }
+
+                                       err.err_curr = reinterpret_cast<::std::byte const*>(op_ptr);
+                                       err.err_selectable.u8 = *op_ptr;
+                                       err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::operand_stack_underflow;
+                                       ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                                   }
+
+                                   auto const type{operand_stack.back_unchecked()};
+                                   operand_stack.pop_back_unchecked();
+                                   return type;
+                               }};
+
+        auto const pop_operand_expect{[&](wasm_byte const* op_ptr, value_type_t expected) constexpr UWVM_THROWS
+                                      {
+                                          auto const actual{pop_operand(op_ptr)};
+
+                                          if(actual != expected && actual != unknown_type) [[unlikely]]
+                                          {
+                                              err.err_curr = reinterpret_cast<::std::byte const*>(op_ptr);
+                                              err.err_selectable.u8arr[0] = static_cast<::std::underlying_type_t<value_type_t>>(expected);
+                                              err.err_selectable.u8arr[1] = static_cast<::std::underlying_type_t<value_type_t>>(actual);
+                                              err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::operand_type_mismatch;
+                                              ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                                          }
+                                      }};
+
+        auto const pop_operands_expect{[&](wasm_byte const* op_ptr, value_type_t const* types_begin, value_type_t const* types_end) constexpr UWVM_THROWS
+                                       {
+                                           for(auto types_curr{types_end}; types_curr != types_begin;)
+                                           {
+                                               --types_curr;
+                                               pop_operand_expect(op_ptr, *types_curr);
+                                           }
+                                       }};
+
+        auto const push_operands{[&](value_type_t const* types_begin, value_type_t const* types_end) constexpr
+                                 {
+                                     for(auto types_curr{types_begin}; types_curr != types_end; ++types_curr) { push_operand(*types_curr); }
+                                 }};
+
+        auto const push_control{[&](op_basic kind, value_type_t const* result_begin, value_type_t const* result_end, wasm_byte const* loop_begin) constexpr
+                                {
+                                    control_stack.push_back({.result_begin = result_begin,
+                                                             .result_end = result_end,
+                                                             .loop_begin = loop_begin,
+                                                             .operand_height = operand_stack.size(),
+                                                             .kind = kind});
+                                    if(control_stack.size() > max_control_height) { max_control_height = control_stack.size(); }
+                                }};
+
+        // The rest of the current block is unreachable
+        auto const set_unreachable{[&]() constexpr noexcept
+                                   {
+                                       auto& frame{control_stack.back_unchecked()};
+                                       operand_stack.resize(frame.operand_height);
+                                       frame.unreachable = true;
+                                   }};
+
+        auto const get_label{[&](wasm_u32 label, wasm_byte const* label_ptr) constexpr UWVM_THROWS -> ::uwvm2::parser::wasm::standard::wasm1::features::
+                                                                                                    details::code_validator_control_frame_t<Fs...>&
+                             {
+                                 if(static_cast<::std::size_t>(label) >= control_stack.size()) [[unlikely]]
+                                 {
+                                     err.err_curr = reinterpret_cast<::std::byte const*>(label_ptr);
+                                     err.err_selectable.u32arr[0] = label;
+                                     err.err_selectable.u32arr[1] = static_cast<wasm_u32>(control_stack.size());
+                                     err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_label_index;
+                                     ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                                 }
+
+                                 return control_stack.index_unchecked(control_stack.size() - 1uz - static_cast<::std::size_t>(label));
+                             }};
+
+        // The label types of a loop are its parameters, which are always empty in wasm1
+        auto const get_label_types_end{[](::uwvm2::parser::wasm::standard::wasm1::features::details::code_validator_control_frame_t<Fs...> const& frame) constexpr noexcept
+                                       { return frame.kind == op_basic::loop ? frame.result_begin : frame.result_end; }};
+
+        // Record a branch to the label, forward branches are resolved when the end of the label is reached
+        auto const add_branch_target{[&](::uwvm2::parser::wasm::standard::wasm1::features::details::code_validator_control_frame_t<Fs...>& frame,
+                                         wasm_byte const* instr) constexpr
+                                     {
+                                         if(frame.kind == op_basic::loop)
+                                         {
+                                             branch_targets.push_back({instr, frame.loop_begin});
+                                             pending_links.push_back(::uwvm2::parser::wasm::standard::wasm1::features::details::code_validator_npos);
+                                         }
+                                         else
+                                         {
+                                             pending_links.push_back(frame.pending_head);
+                                             frame.pending_head = branch_targets.size();
+                                             branch_targets.push_back({instr, nullptr});
+                                         }
+                                     }};
+
+        // The operands at the end (or else) of the current frame must be exactly its results
+        auto const check_frame_end{[&](wasm_byte const* op_ptr) constexpr UWVM_THROWS
+                                   {
+                                       auto const& frame{control_stack.back_unchecked()};
+
+                                       auto const result_count{static_cast<::std::size_t>(frame.result_end - frame.result_begin)};
+                                       auto const operand_count{operand_stack.size() - frame.operand_height};
+
+                                       if(operand_count > result_count || (!frame.unreachable && operand_count < result_count)) [[unlikely]]
+                                       {
+                                           err.err_curr = reinterpret_cast<::std::byte const*>(op_ptr);
+                                           err.err_selectable.u32arr[0] = static_cast<wasm_u32>(operand_count);
+                                           err.err_selectable.u32arr[1] = static_cast<wasm_u32>(result_count);
+                                           err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::block_end_operand_count_mismatch;
+                                           ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                                       }
+
+                                       pop_operands_expect(op_ptr, frame.result_begin, frame.result_end);
+                                   }};
+
+        auto const require_memory{[&](wasm_byte const* op_ptr) constexpr UWVM_THROWS
+                                  {
+                                      if(!has_memory) [[unlikely]]
+                                      {
+                                          err.err_curr = reinterpret_cast<::std::byte const*>(op_ptr);
+                                          err.err_selectable.u8 = *op_ptr;
+                                          err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::instruction_requires_missing_memory;
+                                          ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                                      }
+                                  }};
+
+        auto const code_end{code.body.code_end};
+        auto curr{code.body.expr_begin};
+
+        // [ ... body_size ... local_count ... locals ...] instr ... end] (code_end)
+        // [                     safe                    ] unsafe
+        //                                                 ^^ curr
+
+        // memarg: align and offset, the alignment must not be larger than the natural alignment
+        auto const read_memarg{[&](wasm_byte const* op_ptr, wasm_u32 natural_align) constexpr UWVM_THROWS
+                               {
+                                   require_memory(op_ptr);
+
+                                   auto const align_ptr{curr};
+                                   wasm_u32 align;
+                                   curr = ::uwvm2::parser::wasm::standard::wasm1::features::details::code_validator_read_leb128(curr, code_end, align, *op_ptr, err);
+
+                                   if(align > natural_align) [[unlikely]]
+                                   {
+                                       err.err_curr = reinterpret_cast<::std::byte const*>(align_ptr);
+                                       err.err_selectable.u32arr[0] = align;
+                                       err.err_selectable.u32arr[1] = natural_align;
+                                       err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::illegal_memory_align;
+                                       ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                                   }
+
+                                   wasm_u32 offset;
+                                   curr = ::uwvm2::parser::wasm::standard::wasm1::features::details::code_validator_read_leb128(curr, code_end, offset, *op_ptr, err);
+                               }};
+
+        // memory.size, memory.grow and call_indirect are followed by a reserved 0x00 byte
+        auto const read_reserved_byte{[&](wasm_byte const* op_ptr) constexpr UWVM_THROWS
+                                      {
+                                          if(curr == code_end) [[unlikely]]
+                                          {
+                                              err.err_curr = reinterpret_cast<::std::byte const*>(curr);
+                                              err.err_selectable.u8 = *op_ptr;
+                                              err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_instruction_immediate;
+                                              ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::end_of_file);
+                                          }
+
+                                          if(*curr != 0u) [[unlikely]]
+                                          {
+                                              err.err_curr = reinterpret_cast<::std::byte const*>(curr);
+                                              err.err_selectable.u8 = *curr;
+                                              err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::illegal_reserved_byte;
+                                              ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                                          }
+
+                                          ++curr;
+                                      }};
+
+        // Fixed size immediate (f32.const, f64.const)
+        auto const skip_immediate{[&](wasm_byte const* op_ptr, ::std::size_t size) constexpr UWVM_THROWS
+                                  {
+                                      if(static_cast<::std::size_t>(code_end - curr) < size) [[unlikely]]
+                                      {
+                                          err.err_curr = reinterpret_cast<::std::byte const*>(curr);
+                                          err.err_selectable.u8 = *op_ptr;
+                                          err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_instruction_immediate;
+                                          ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::end_of_file);
+                                      }
+
+                                      curr += size;
+                                  }};
+
+        // The frame of the function itself, the label types are the results of the function
+        push_control(op_basic::block, func_type.result.begin, func_type.result.end, nullptr);
+
+        for(;;)
+        {
+            if(curr == code_end) [[unlikely]]
+            {
+                err.err_curr = reinterpret_cast<::std::byte const*>(code_end);
+                err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::code_body_unterminated;
+                ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::end_of_file);
+            }
+
+            // [ ... instr ...] ... end] (code_end)
+            // [     safe     ] unsafe
+            //       ^^ curr
+
+            auto const op_ptr{curr};
+            auto const op_byte{*curr};
+            ++curr;
+
+            switch(static_cast<op_basic>(op_byte))
+            {
+                case op_basic::unreachable:
+                {
+                    set_unreachable();
+                    break;
+                }
+                case op_basic::nop:
+                {
+                    break;
+                }
+                case op_basic::block: [[fallthrough]];
+                case op_basic::loop: [[fallthrough]];
+                case op_basic::if_:
+                {
+                    if(curr == code_end) [[unlikely]]
+                    {
+                        err.err_curr = reinterpret_cast<::std::byte const*>(curr);
+                        err.err_selectable.u8 = op_byte;
+                        err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_instruction_immediate;
+                        ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::end_of_file);
+                    }
+
+                    // blocktype: 0x40 (empty) or a value type
+                    auto const block_type{*curr};
+
+                    value_type_t const* result_begin{};
+                    value_type_t const* result_end{};
+
+                    if(block_type != empty_block_type)
+                    {
+                        auto const& block_result{
+                            ::uwvm2::parser::wasm::standard::wasm1::features::details::code_validator_block_result_table<Fs...>.index_unchecked(
+                                static_cast<::std::size_t>(block_type))};
+
+                        // check value type
+                        static_assert(::uwvm2::parser::wasm::standard::wasm1::features::has_check_codesec_value_type<Fs...>);
+                        if(!define_check_codesec_value_type(::uwvm2::parser::wasm::concepts::feature_reserve_type<code_section_storage_t<Fs...>>,
+                                                            block_result)) [[unlikely]]
+                        {
+                            err.err_curr = reinterpret_cast<::std::byte const*>(curr);
+                            err.err_selectable.u8 = block_type;
+                            err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::illegal_block_type;
+                            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                        }
+
+                        result_begin = ::std::addressof(block_result);
+                        result_end = result_begin + 1u;
+                    }
+
+                    ++curr;
+
+                    auto const kind{static_cast<op_basic>(op_byte)};
+
+                    if(kind == op_basic::if_)
+                    {
+                        // The condition belongs to the enclosing frame
+                        pop_operand_expect(op_ptr, i32_type);
+
+                        push_control(kind, result_begin, result_end, nullptr);
+
+                        // Resolved by the else or end of this frame
+                        control_stack.back_unchecked().if_else_target = branch_targets.size();
+                        branch_targets.push_back({op_ptr, nullptr});
+                        pending_links.push_back(::uwvm2::parser::wasm::standard::wasm1::features::details::code_validator_npos);
+                    }
+                    else
+                    {
+                        push_control(kind, result_begin, result_end, curr);
+                    }
+
+                    break;
+                }
+                case op_basic::else_:
+                {
+                    if(control_stack.back_unchecked().kind != op_basic::if_) [[unlikely]]
+                    {
+                        err.err_curr = reinterpret_cast<::std::byte const*>(op_ptr);
+                        err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::else_without_matching_if;
+                        ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                    }
+
+                    check_frame_end(op_ptr);
+
+                    auto& frame{control_stack.back_unchecked()};
+
+                    // A false condition of the if jumps to the first instruction of the else branch
+                    branch_targets.index_unchecked(frame.if_else_target).target = curr;
+
+                    // The end of the if branch jumps over the else branch
+                    frame.if_else_target = branch_targets.size();
+                    branch_targets.push_back({op_ptr, nullptr});
+                    pending_links.push_back(::uwvm2::parser::wasm::standard::wasm1::features::details::code_validator_npos);
+
+                    frame.kind = op_basic::else_;
+                    frame.unreachable = false;
+
+                    break;
+                }
+                case op_basic::end:
+                {
+                    check_frame_end(op_ptr);
+
+                    auto const& frame{control_stack.back_unchecked()};
+
+                    // An if without else has an implicit empty else branch, which cannot produce the results
+                    if(frame.kind == op_basic::if_ && frame.result_begin != frame.result_end) [[unlikely]]
+                    {
+                        err.err_curr = reinterpret_cast<::std::byte const*>(op_ptr);
+                        err.err_selectable.u32arr[0] = 0u;
+                        err.err_selectable.u32arr[1] = static_cast<wasm_u32>(frame.result_end - frame.result_begin);
+                        err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::block_end_operand_count_mismatch;
+                        ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                    }
+
+                    // Resolve the forward branches to this frame, the continuation is after the end
+                    for(auto pending{frame.pending_head}; pending != ::uwvm2::parser::wasm::standard::wasm1::features::details::code_validator_npos;
+                        pending = pending_links.index_unchecked(pending))
+                    {
+                        branch_targets.index_unchecked(pending).target = curr;
+                    }
+
+                    if(frame.if_else_target != ::uwvm2::parser::wasm::standard::wasm1::features::details::code_validator_npos)
+                    {
+                        branch_targets.index_unchecked(frame.if_else_target).target = curr;
+                    }
+
+                    auto const result_begin{frame.result_begin};
+                    auto const result_end{frame.result_end};
+
+                    control_stack.pop_back_unchecked();
+
+                    if(control_stack.size() == 0uz)
+                    {
+                        // The end of the function must be the end of the function body
+
+                        // [ ... end] ...] (code_end)
+                        // [   safe ] unsafe
+                        //            ^^ curr
+
+                        if(curr != code_end) [[unlikely]]
+                        {
+                            err.err_curr = reinterpret_cast<::std::byte const*>(curr);
+                            err.err_selectable.u32 = static_cast<wasm_u32>(code_end - code.body.code_begin);
+                            err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::illegal_code_body_size;
+                            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                        }
+
+                        // Store the metadata
+
+                        auto& all_branch_targets{codesec.branch_targets};
+
+                        code.metadata.max_operand_stack_height = static_cast<wasm_u32>(max_operand_height);
+                        code.metadata.max_control_stack_height = static_cast<wasm_u32>(max_control_height);
+                        code.metadata.branch_target_begin = all_branch_targets.size();
+                        code.metadata.branch_target_count = branch_targets.size();
+                        code.metadata.is_leaf = is_leaf;
+
+                        all_branch_targets.reserve(all_branch_targets.size() + branch_targets.size());
+                        for(auto const& branch_target: branch_targets) { all_branch_targets.push_back_unchecked(branch_target); }
+
+                        code.metadata.validated = true;
+
+                        return;
+                    }
+
+                    push_operands(result_begin, result_end);
+
+                    break;
+                }
+                case op_basic::br:
+                {
+                    auto const label_ptr{curr};
+                    wasm_u32 label;
+                    curr = ::uwvm2::parser::wasm::standard::wasm1::features::details::code_validator_read_leb128(curr, code_end, label, op_byte, err);
+
+                    auto& target_frame{get_label(label, label_ptr)};
+                    pop_operands_expect(op_ptr, target_frame.result_begin, get_label_types_end(target_frame));
+                    add_branch_target(target_frame, op_ptr);
+
+                    set_unreachable();
+                    break;
+                }
+                case op_basic::br_if:
+                {
+                    auto const label_ptr{curr};
+                    wasm_u32 label;
+                    curr = ::uwvm2::parser::wasm::standard::wasm1::features::details::code_validator_read_leb128(curr, code_end, label, op_byte, err);
+
+                    auto& target_frame{get_label(label, label_ptr)};
+                    pop_operand_expect(op_ptr, i32_type);
+                    pop_operands_expect(op_ptr, target_frame.result_begin, get_label_types_end(target_frame));
+                    push_operands(target_frame.result_begin, get_label_types_end(target_frame));
+                    add_branch_target(target_frame, op_ptr);
+
+                    break;
+                }
+                case op_basic::br_table:
+                {
+                    wasm_u32 label_count;
+                    curr = ::uwvm2::parser::wasm::standard::wasm1::features::details::code_validator_read_leb128(curr, code_end, label_count, op_byte, err);
+
+                    pop_operand_expect(op_ptr, i32_type);
+
+                    // All labels (label_count labels and the default label) must have the same label types
+                    value_type_t const* expected_begin{};
+                    value_type_t const* expected_end{};
+
+                    for(::std::uint_least64_t label_counter{}; label_counter != static_cast<::std::uint_least64_t>(label_count) + 1u; ++label_counter)
+                    {
+                        auto const label_ptr{curr};
+                        wasm_u32 label;
+                        curr = ::uwvm2::parser::wasm::standard::wasm1::features::details::code_validator_read_leb128(curr, code_end, label, op_byte, err);
+
+                        auto& target_frame{get_label(label, label_ptr)};
+                        auto const types_begin{target_frame.result_begin};
+                        auto const types_end{get_label_types_end(target_frame)};
+
+                        if(label_counter == 0u)
+                        {
+                            expected_begin = types_begin;
+                            expected_end = types_end;
+                        }
+                        else
+                        {
+                            // wasm1 has at most one label type, "empty" is reported as the empty block type
+                            auto const expected_size{static_cast<::std::size_t>(expected_end - expected_begin)};
+                            auto const types_size{static_cast<::std::size_t>(types_end - types_begin)};
+
+                            bool same{expected_size == types_size};
+                            for(::std::size_t i{}; same && i != types_size; ++i) { same = expected_begin[i] == types_begin[i]; }
+
+                            if(!same) [[unlikely]]
+                            {
+                                err.err_curr = reinterpret_cast<::std::byte const*>(label_ptr);
+                                err.err_selectable.u8arr[0] =
+                                    expected_size == 0uz ? empty_block_type : static_cast<::std::underlying_type_t<value_type_t>>(*expected_begin);
+                                err.err_selectable.u8arr[1] =
+                                    types_size == 0uz ? empty_block_type : static_cast<::std::underlying_type_t<value_type_t>>(*types_begin);
+                                err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::operand_type_mismatch;
+                                ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                            }
+                        }
+
+                        // Each label records its own immediate as the instruction
+                        add_branch_target(target_frame, label_ptr);
+                    }
+
+                    pop_operands_expect(op_ptr, expected_begin, expected_end);
+
+                    set_unreachable();
+                    break;
+                }
+                case op_basic::return_:
+                {
+                    auto const& function_frame{control_stack.index_unchecked(0uz)};
+                    pop_operands_expect(op_ptr, function_frame.result_begin, function_frame.result_end);
+
+                    set_unreachable();
+                    break;
+                }
+                case op_basic::call:
+                {
+                    auto const func_idx_ptr{curr};
+                    wasm_u32 func_idx;
+                    curr = ::uwvm2::parser::wasm::standard::wasm1::features::details::code_validator_read_leb128(curr, code_end, func_idx, op_byte, err);
+
+                    if(static_cast<::std::size_t>(func_idx) >= all_func_size) [[unlikely]]
+                    {
+                        err.err_curr = reinterpret_cast<::std::byte const*>(func_idx_ptr);
+                        err.err_selectable.u32arr[0] = func_idx;
+                        err.err_selectable.u32arr[1] = static_cast<wasm_u32>(all_func_size);
+                        err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_function_index;
+                        ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                    }
+
+                    auto const& callee_type{get_func_type(static_cast<::std::size_t>(func_idx))};
+                    pop_operands_expect(op_ptr, callee_type.parameter.begin, callee_type.parameter.end);
+                    push_operands(callee_type.result.begin, callee_type.result.end);
+
+                    is_leaf = false;
+                    break;
+                }
+                case op_basic::call_indirect:
+                {
+                    auto const type_idx_ptr{curr};
+                    wasm_u32 type_idx;
+                    curr = ::uwvm2::parser::wasm::standard::wasm1::features::details::code_validator_read_leb128(curr, code_end, type_idx, op_byte, err);
+
+                    if(static_cast<::std::size_t>(type_idx) >= type_size) [[unlikely]]
+                    {
+                        err.err_curr = reinterpret_cast<::std::byte const*>(type_idx_ptr);
+                        err.err_selectable.u32 = type_idx;
+                        err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::illegal_type_index;
+                        ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                    }
+
+                    // wasm1 only has table 0
+                    read_reserved_byte(op_ptr);
+
+                    if(!has_table) [[unlikely]]
+                    {
+                        err.err_curr = reinterpret_cast<::std::byte const*>(op_ptr);
+                        err.err_selectable.u8 = op_byte;
+                        err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::instruction_requires_missing_table;
+                        ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                    }
+
+                    auto const& callee_type{typesec.types.index_unchecked(static_cast<::std::size_t>(type_idx))};
+                    pop_operand_expect(op_ptr, i32_type);
+                    pop_operands_expect(op_ptr, callee_type.parameter.begin, callee_type.parameter.end);
+                    push_operands(callee_type.result.begin, callee_type.result.end);
+
+                    is_leaf = false;
+                    break;
+                }
+                case op_basic::drop:
+                {
+                    pop_operand(op_ptr);
+                    break;
+                }
+                case op_basic::select:
+                {
+                    pop_operand_expect(op_ptr, i32_type);
+
+                    auto const type1{pop_operand(op_ptr)};
+                    auto const type2{pop_operand(op_ptr)};
+
+                    if(type1 != type2 && type1 != unknown_type && type2 != unknown_type) [[unlikely]]
+                    {
+                        err.err_curr = reinterpret_cast<::std::byte const*>(op_ptr);
+                        err.err_selectable.u8arr[0] = static_cast<::std::underlying_type_t<value_type_t>>(type1);
+                        err.err_selectable.u8arr[1] = static_cast<::std::underlying_type_t<value_type_t>>(type2);
+                        err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::operand_type_mismatch;
+                        ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                    }
+
+                    push_operand(type1 == unknown_type ? type2 : type1);
+                    break;
+                }
+                case op_basic::local_get: [[fallthrough]];
+                case op_basic::local_set: [[fallthrough]];
+                case op_basic::local_tee:
+                {
+                    auto const local_idx_ptr{curr};
+                    wasm_u32 local_idx;
+                    curr = ::uwvm2::parser::wasm::standard::wasm1::features::details::code_validator_read_leb128(curr, code_end, local_idx, op_byte, err);
+
+                    if(static_cast<::std::uint_least64_t>(local_idx) >= all_local_size) [[unlikely]]
+                    {
+                        err.err_curr = reinterpret_cast<::std::byte const*>(local_idx_ptr);
+                        err.err_selectable.u32arr[0] = local_idx;
+                        // local_idx is a u32, so the total number of locals here is less than u32max
+                        err.err_selectable.u32arr[1] = static_cast<wasm_u32>(all_local_size);
+                        err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_local_index;
+                        ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                    }
+
+                    auto const local_type{get_local_type(static_cast<::std::uint_least64_t>(local_idx))};
+
+                    switch(static_cast<op_basic>(op_byte))
+                    {
+                        case op_basic::local_get:
+                        {
+                            push_operand(local_type);
+                            break;
+                        }
+                        case op_basic::local_set:
+                        {
+                            pop_operand_expect(op_ptr, local_type);
+                            break;
+                        }
+                        default:
+                        {
+                            // local_tee
+                            pop_operand_expect(op_ptr, local_type);
+                            push_operand(local_type);
+                            break;
+                        }
+                    }
+
+                    break;
+                }
+                case op_basic::global_get: [[fallthrough]];
+                case op_basic::global_set:
+                {
+                    auto const global_idx_ptr{curr};
+                    wasm_u32 global_idx;
+                    curr = ::uwvm2::parser::wasm::standard::wasm1::features::details::code_validator_read_leb128(curr, code_end, global_idx, op_byte, err);
+
+                    if(static_cast<::std::size_t>(global_idx) >= all_global_size) [[unlikely]]
+                    {
+                        err.err_curr = reinterpret_cast<::std::byte const*>(global_idx_ptr);
+                        err.err_selectable.u32arr[0] = global_idx;
+                        err.err_selectable.u32arr[1] = static_cast<wasm_u32>(all_global_size);
+                        err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_global_index;
+                        ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                    }
+
+                    auto const& global_type{get_global_type(static_cast<::std::size_t>(global_idx))};
+                    auto const global_value_type{static_cast<value_type_t>(global_type.type)};
+
+                    if(static_cast<op_basic>(op_byte) == op_basic::global_get) { push_operand(global_value_type); }
+                    else
+                    {
+                        if(!global_type.is_mutable) [[unlikely]]
+                        {
+                            err.err_curr = reinterpret_cast<::std::byte const*>(global_idx_ptr);
+                            err.err_selectable.u32 = global_idx;
+                            err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::set_immutable_global;
+                            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                        }
+
+                        pop_operand_expect(op_ptr, global_value_type);
+                    }
+
+                    break;
+                }
+                // Loads: natural alignment (log2) and result type
+                case op_basic::i32_load:
+                {
+                    read_memarg(op_ptr, 2u);
+                    pop_operand_expect(op_ptr, i32_type);
+                    push_operand(i32_type);
+                    break;
+                }
+                case op_basic::i64_load:
+                {
+                    read_memarg(op_ptr, 3u);
+                    pop_operand_expect(op_ptr, i32_type);
+                    push_operand(i64_type);
+                    break;
+                }
+                case op_basic::f32_load:
+                {
+                    read_memarg(op_ptr, 2u);
+                    pop_operand_expect(op_ptr, i32_type);
+                    push_operand(f32_type);
+                    break;
+                }
+                case op_basic::f64_load:
+                {
+                    read_memarg(op_ptr, 3u);
+                    pop_operand_expect(op_ptr, i32_type);
+                    push_operand(f64_type);
+                    break;
+                }
+                case op_basic::i32_load8_s: [[fallthrough]];
+                case op_basic::i32_load8_u:
+                {
+                    read_memarg(op_ptr, 0u);
+                    pop_operand_expect(op_ptr, i32_type);
+                    push_operand(i32_type);
+                    break;
+                }
+                case op_basic::i32_load16_s: [[fallthrough]];
+                case op_basic::i32_load16_u:
+                {
+                    read_memarg(op_ptr, 1u);
+                    pop_operand_expect(op_ptr, i32_type);
+                    push_operand(i32_type);
+                    break;
+                }
+                case op_basic::i64_load8_s: [[fallthrough]];
+                case op_basic::i64_load8_u:
+                {
+                    read_memarg(op_ptr, 0u);
+                    pop_operand_expect(op_ptr, i32_type);
+                    push_operand(i64_type);
+                    break;
+                }
+                case op_basic::i64_load16_s: [[fallthrough]];
+                case op_basic::i64_load16_u:
+                {
+                    read_memarg(op_ptr, 1u);
+                    pop_operand_expect(op_ptr, i32_type);
+                    push_operand(i64_type);
+                    break;
+                }
+                case op_basic::i64_load32_s: [[fallthrough]];
+                case op_basic::i64_load32_u:
+                {
+                    read_memarg(op_ptr, 2u);
+                    pop_operand_expect(op_ptr, i32_type);
+                    push_operand(i64_type);
+                    break;
+                }
+                // Stores: natural alignment (log2) and operand type
+                case op_basic::i32_store:
+                {
+                    read_memarg(op_ptr, 2u);
+                    pop_operand_expect(op_ptr, i32_type);
+                    pop_operand_expect(op_ptr, i32_type);
+                    break;
+                }
+                case op_basic::i64_store:
+                {
+                    read_memarg(op_ptr, 3u);
+                    pop_operand_expect(op_ptr, i64_type);
+                    pop_operand_expect(op_ptr, i32_type);
+                    break;
+                }
+                case op_basic::f32_store:
+                {
+                    read_memarg(op_ptr, 2u);
+                    pop_operand_expect(op_ptr, f32_type);
+                    pop_operand_expect(op_ptr, i32_type);
+                    break;
+                }
+                case op_basic::f64_store:
+                {
+                    read_memarg(op_ptr, 3u);
+                    pop_operand_expect(op_ptr, f64_type);
+                    pop_operand_expect(op_ptr, i32_type);
+                    break;
+                }
+                case op_basic::i32_store8:
+                {
+                    read_memarg(op_ptr, 0u);
+                    pop_operand_expect(op_ptr, i32_type);
+                    pop_operand_expect(op_ptr, i32_type);
+                    break;
+                }
+                case op_basic::i32_store16:
+                {
+                    read_memarg(op_ptr, 1u);
+                    pop_operand_expect(op_ptr, i32_type);
+                    pop_operand_expect(op_ptr, i32_type);
+                    break;
+                }
+                case op_basic::i64_store8:
+                {
+                    read_memarg(op_ptr, 0u);
+                    pop_operand_expect(op_ptr, i64_type);
+                    pop_operand_expect(op_ptr, i32_type);
+                    break;
+                }
+                case op_basic::i64_store16:
+                {
+                    read_memarg(op_ptr, 1u);
+                    pop_operand_expect(op_ptr, i64_type);
+                    pop_operand_expect(op_ptr, i32_type);
+                    break;
+                }
+                case op_basic::i64_store32:
+                {
+                    read_memarg(op_ptr, 2u);
+                    pop_operand_expect(op_ptr, i64_type);
+                    pop_operand_expect(op_ptr, i32_type);
+                    break;
+                }
+                case op_basic::memory_size:
+                {
+                    read_reserved_byte(op_ptr);
+                    require_memory(op_ptr);
+                    push_operand(i32_type);
+                    break;
+                }
+                case op_basic::memory_grow:
+                {
+                    read_reserved_byte(op_ptr);
+                    require_memory(op_ptr);
+                    pop_operand_expect(op_ptr, i32_type);
+                    push_operand(i32_type);
+                    break;
+                }
+                case op_basic::i32_const:
+                {
+                    ::uwvm2::parser::wasm::standard::wasm1::type::wasm_i32 value;
+                    curr = ::uwvm2::parser::wasm::standard::wasm1::features::details::code_validator_read_leb128(curr, code_end, value, op_byte, err);
+                    push_operand(i32_type);
+                    break;
+                }
+                case op_basic::i64_const:
+                {
+                    ::uwvm2::parser::wasm::standard::wasm1::type::wasm_i64 value;
+                    curr = ::uwvm2::parser::wasm::standard::wasm1::features::details::code_validator_read_leb128(curr, code_end, value, op_byte, err);
+                    push_operand(i64_type);
+                    break;
+                }
+                case op_basic::f32_const:
+                {
+                    skip_immediate(op_ptr, 4uz);
+                    push_operand(f32_type);
+                    break;
+                }
+                case op_basic::f64_const:
+                {
+                    skip_immediate(op_ptr, 8uz);
+                    push_operand(f64_type);
+                    break;
+                }
+                default:
+                {
+                    // Comparisons, arithmetic and conversions
+                    auto const& signature{
+                        ::uwvm2::parser::wasm::standard::wasm1::features::details::code_validator_numeric_signature_table.index_unchecked(
+                            static_cast<::std::size_t>(op_byte))};
+
+                    if(signature.operand_count == 0u) [[unlikely]]
+                    {
+                        err.err_curr = reinterpret_cast<::std::byte const*>(op_ptr);
+                        err.err_selectable.u8 = op_byte;
+                        err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::illegal_opcode;
+                        ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                    }
+
+                    auto const operand_type{static_cast<value_type_t>(signature.operand)};
+                    for(unsigned i{}; i != signature.operand_count; ++i) { pop_operand_expect(op_ptr, operand_type); }
+                    push_operand(static_cast<value_type_t>(signature.result));
+
+                    break;
+                }
+            }
+        }
+    }
+
+    /// @brief      Validate all function bodies of the code section
+    /// @details    A single code_validation_stack_t is shared by all function bodies. Enabled in the final check by
+    ///             wasm1_feature_parameter_t::code_section_validate, and can also be called after parsing.
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+    inline constexpr void validate_code_section(::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...> & module_storage,
+                                                ::uwvm2::parser::wasm::base::error_impl & err) UWVM_THROWS
+    {
+#ifdef UWVM_TIMER
+        ::uwvm2::utils::debug::timer validating_timer{u8"validate code section"};
+#endif
+        auto const& codesec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<code_section_storage_t<Fs...>>(module_storage.sections)};
+        auto const code_size{codesec.codes.size()};
+
+        code_validation_stack_t<Fs...> stack{};
+
+        for(::std::size_t code_index{}; code_index != code_size; ++code_index)
+        {
+            ::uwvm2::parser::wasm::standard::wasm1::features::validate_code_body(module_storage, code_index, stack, err);
+        }
+    }
+}  // namespace uwvm2::parser::wasm::standard::wasm1::features
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
@@ -36,6 +36,7 @@ import uwvm2.parser.wasm.standard.wasm1.section;
 import uwvm2.parser.wasm.standard.wasm1.opcode;
 import uwvm2.parser.wasm.binfmt.binfmt_ver1;
 import :def;
+import :parameter;
 import :feature_def;
 import :types;
 #else
@@ -63,6 +64,7 @@ import :types;
 # include <uwvm2/parser/wasm/standard/wasm1/opcode/impl.h>
 # include <uwvm2/parser/wasm/binfmt/binfmt_ver1/impl.h>
 # include "def.h"
+# include "parameter.h"
 # include "feature_def.h"
 # include "types.h"
 #endif
@@ -295,6 +297,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
         datasec.sec_span.sec_begin = reinterpret_cast<wasm_byte_const_may_alias_ptr>(section_begin);
         datasec.sec_span.sec_end = reinterpret_cast<wasm_byte_const_may_alias_ptr>(section_end);
 
+        // Link scan mode: only the span is recorded, the section is parsed by complete_link_scan
+        if(::uwvm2::parser::wasm::standard::wasm1::features::get_wasm1_feature_parameter(fs_para).link_scan_only) { return; }
+
         auto section_curr{section_begin};
 
         // [before_section ... ] | data_count ...
@@ -36,8 +36,10 @@ import uwvm2.parser.wasm.standard.wasm1.section;
 import uwvm2.parser.wasm.standard.wasm1.opcode;
 import uwvm2.parser.wasm.binfmt.binfmt_ver1;
 import :def;
+import :parameter;
 import :feature_def;
 import :types;
+import :leb128_batch;
 #else
 // std
 # include <cstddef>
@@ -63,8 +65,10 @@ import :types;
 # include <uwvm2/parser/wasm/standard/wasm1/opcode/impl.h>
 # include <uwvm2/parser/wasm/binfmt/binfmt_ver1/impl.h>
 # include "def.h"
+# include "parameter.h"
 # include "feature_def.h"
 # include "types.h"
+# include "leb128_batch.h"
 #endif
 
 #ifndef UWVM_MODULE_EXPORT
@@ -234,49 +238,46 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
         // [                     safe                 ] unsafe (could be the section_end)
         //                                              ^^ section_curr
 
-        for(::std::size_t funcidx_counter{}; funcidx_counter != funcidx_count; ++funcidx_counter)
-        {
-            // [ ...] func_curr ... func_next ...
-            // [safe] unsafe (could be the section_end)
-            //        ^^ section_curr
-
-            // No boundary check is needed here, parse_by_scan comes with its own checks
-
-            ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 funcidx;
+        // Element segments can have a large number of funcidx, decode them in batches
 
-            auto const [funcidx_next, funcidx_err]{::fast_io::parse_by_scan(reinterpret_cast<char8_t_const_may_alias_ptr>(section_curr),
-                                                                            reinterpret_cast<char8_t_const_may_alias_ptr>(section_end),
-                                                                            ::fast_io::mnp::leb128_get(funcidx))};
+        auto const funcidx_result{::uwvm2::parser::wasm::standard::wasm1::features::decode_uleb128_u32_batch(
+            section_curr, section_end, wet.vec_funcidx.imp.curr_ptr, static_cast<::std::size_t>(funcidx_count), all_func_size)};
 
-            if(funcidx_err != ::fast_io::parse_code::ok) [[unlikely]]
-            {
-                err.err_curr = section_curr;
-                err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_elem_funcidx;
-                ::uwvm2::parser::wasm::base::throw_wasm_parse_code(funcidx_err);
-            }
+        wet.vec_funcidx.imp.curr_ptr += funcidx_result.decoded;
+        section_curr = funcidx_result.curr;
 
-            // [ ... func_curr ...] func_next ...
-            // [       safe       ] unsafe (could be the section_end)
-            //       ^^ section_curr
-
-            if(funcidx >= all_func_size) [[unlikely]]
-            {
-                err.err_curr = section_curr;
-                err.err_selectable.elem_func_index_exceeds_maxvul.idx = funcidx;
-                err.err_selectable.elem_func_index_exceeds_maxvul.maxval = all_func_size;
-                err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::elem_func_index_exceeds_maxvul;
-                ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
-            }
+        // [ ... func_curr ...] func_next ...
+        // [       safe       ] unsafe (could be the section_end)
+        //       ^^ section_curr (on error)
 
-            wet.vec_funcidx.push_back_unchecked(funcidx);
+        if(funcidx_result.exceeds_bound) [[unlikely]]
+        {
+            err.err_curr = section_curr;
+            err.err_selectable.elem_func_index_exceeds_maxvul.idx = funcidx_result.exceeding_value;
+            err.err_selectable.elem_func_index_exceeds_maxvul.maxval = all_func_size;
+            err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::elem_func_index_exceeds_maxvul;
+            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+        }
 
-            section_curr = reinterpret_cast<::std::byte const*>(funcidx_next);
+        if(funcidx_result.code != ::fast_io::parse_code::ok) [[unlikely]]
+        {
+            err.err_curr = section_curr;
+            err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_elem_funcidx;
+            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(funcidx_result.code);
+        }
 
-            // [ ... func_curr ...] func_next ...
-            // [       safe       ] unsafe (could be the section_end)
-            //                      ^^ section_curr
+        // The section ends before all funcidx are decoded
+        if(funcidx_result.decoded != static_cast<::std::size_t>(funcidx_count)) [[unlikely]]
+        {
+            err.err_curr = section_curr;
+            err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_elem_funcidx;
+            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::end_of_file);
         }
 
+        // [ ... func_last ...] next_table_idx ...
+        // [       safe       ] unsafe (could be the section_end)
+        //                      ^^ section_curr
+
         return section_curr;
     }
 
@@ -314,6 +315,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
         elemsec.sec_span.sec_begin = reinterpret_cast<wasm_byte_const_may_alias_ptr>(section_begin);
         elemsec.sec_span.sec_end = reinterpret_cast<wasm_byte_const_may_alias_ptr>(section_end);
 
+        // Link scan mode: only the span is recorded, the section is parsed by complete_link_scan
+        if(::uwvm2::parser::wasm::standard::wasm1::features::get_wasm1_feature_parameter(fs_para).link_scan_only) { return; }
+
         auto section_curr{section_begin};
 
         // [before_section ... ] | elem_count ...
@@ -33,7 +33,6 @@ module;
 #include <utility>
 #include <memory>
 #include <limits>
-#include <set>  /// @todo replace
 // macro
 #include <uwvm2/utils/macro/push_macros.h>
 
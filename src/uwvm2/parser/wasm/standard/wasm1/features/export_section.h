@@ -39,6 +39,7 @@ import :def;
 import :feature_def;
 import :import_section;
 import :types;
+import :name_hash_set;
 #else
 // std
 # include <cstddef>
@@ -49,7 +50,6 @@ import :types;
 # include <utility>
 # include <memory>
 # include <limits>
-# include <set>  /// @todo replace
 // macro
 # include <uwvm2/utils/macro/push_macros.h>
 // import
@@ -68,6 +68,7 @@ import :types;
 # include "feature_def.h"
 # include "import_section.h"
 # include "types.h"
+# include "name_hash_set.h"
 #endif
 
 #ifndef UWVM_MODULE_EXPORT
@@ -334,7 +335,14 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
             }
         }
 
-        exportsec.exports.reserve(static_cast<::std::size_t>(export_count));
+        // Each export takes at least 3 bytes (export_namelen, export_type and export_idx), so the section cannot hold more
+        // exports than this. The declared export_count is not trusted beyond that for allocations. The exports are pushed unchecked, which this
+        // bound still covers, a larger count fails in the loop below.
+        auto const max_export_count{static_cast<::std::size_t>(section_end - reinterpret_cast<::std::byte const*>(export_count_next)) / 3uz};
+        auto const export_reserve_count{static_cast<::std::size_t>(export_count) < max_export_count ? static_cast<::std::size_t>(export_count)
+                                                                                                    : max_export_count};
+
+        exportsec.exports.reserve(export_reserve_count);
 
         ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 export_counter{};  // use for check
 
@@ -349,8 +357,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
         ::fast_io::array<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32, exportdesc_count> exportdesc_counter{};  // use for reserve
         // desc counter
 
-        ::fast_io::array<::std::set<::fast_io::u8string_view> /* @todo use fast_io::set instead */, exportdesc_count>
-            duplicate_name_checker{};  // use for check duplicate name
+        // use for check duplicate name, pre-sized from the bounded export_count
+        ::uwvm2::parser::wasm::standard::wasm1::features::name_hash_set_t<::uwvm2::parser::wasm::standard::wasm1::features::export_name_key>
+            duplicate_name_checker{export_reserve_count};
 
         while(section_curr != section_end) [[likely]]
         {
@@ -502,9 +511,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
             ++exportdesc_counter.index_unchecked(fwet_export_type);
 
             // check duplicate name
-            auto& curr_name_set{duplicate_name_checker.index_unchecked(fwet_export_type)};
-
-            if(curr_name_set.contains(fwet.export_name)) [[unlikely]]
+            // The export counter has been checked, no more than export_count names are inserted
+            if(!duplicate_name_checker.insert({fwet.export_name, static_cast<::std::uint_least8_t>(fwet_export_type)})) [[unlikely]]
             {
                 err.err_curr = section_curr;
                 err.err_selectable.duplic_exports.export_name = fwet.export_name;
@@ -513,8 +521,6 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
                 ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
             }
 
-            curr_name_set.insert(fwet.export_name);  // std::set never throw (Disregarding new failures)
-
             ++section_curr;
 
             // [...  export_namelen ... export_name ... export_type] export_idx ... next_export
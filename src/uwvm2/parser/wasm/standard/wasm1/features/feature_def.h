@@ -34,6 +34,7 @@ import uwvm2.parser.wasm.concepts;
 import uwvm2.parser.wasm.standard.wasm1.type;
 import uwvm2.parser.wasm.standard.wasm1.section;
 import uwvm2.parser.wasm.standard.wasm1.opcode;
+import uwvm2.parser.wasm.binfmt.base;
 import uwvm2.parser.wasm.binfmt.binfmt_ver1;
 import :def;
 #else
@@ -60,6 +61,7 @@ import :def;
 # include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
 # include <uwvm2/parser/wasm/standard/wasm1/section/impl.h>
 # include <uwvm2/parser/wasm/standard/wasm1/opcode/impl.h>
+# include <uwvm2/parser/wasm/binfmt/base/impl.h>
 # include <uwvm2/parser/wasm/binfmt/binfmt_ver1/impl.h>
 # include "def.h"
 #endif
@@ -1046,12 +1048,42 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
         ::uwvm2::parser::wasm::standard::wasm1::features::final_value_type_t<Fs...> type{};
     };
 
+    /// @brief      Branch target resolved by the function body validator
+    /// @details    Entries of a function body are stored in the order of the instructions:
+    ///             if:        instr = if opcode, target = first instruction of the else branch (or after the matching end)
+    ///             else:      instr = else opcode, target = after the matching end
+    ///             br, br_if: instr = opcode, target = continuation of the label
+    ///             br_table:  one entry per label (including the default label), instr = label immediate
+    ///             The continuation of a loop is the first instruction of the loop body, the continuation of block, if and the function is after the
+    ///             matching end.
+    struct wasm1_code_branch_target_t
+    {
+        ::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte const* instr{};
+        ::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte const* target{};
+    };
+
+    /// @brief      Metadata of a function body, generated by the function body validator
+    /// @details    The branch targets of the function body are [branch_target_begin, branch_target_begin + branch_target_count) of
+    ///             code_section_storage_t::branch_targets.
+    struct wasm1_code_metadata_t
+    {
+        ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 max_operand_stack_height{};
+        ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 max_control_stack_height{};
+        ::std::size_t branch_target_begin{};
+        ::std::size_t branch_target_count{};
+        // Does not contain call and call_indirect
+        bool is_leaf{};
+        bool validated{};
+    };
+
     template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
     struct final_wasm_code_t UWVM_TRIVIALLY_RELOCATABLE_IF_ELIGIBLE
     {
         code_body_t body{};
-        ::fast_io::vector<final_local_entry_t<Fs...>> locals{};
+        // Allocated from the arena of the module storage
+        ::uwvm2::parser::wasm::binfmt::module_arena_array_t<final_local_entry_t<Fs...>> locals{};
         ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 all_local_count{};
+        wasm1_code_metadata_t metadata{};
     };
 
     /// @brief Define functions for checking value_type to provide extensibility
@@ -36,8 +36,12 @@ import uwvm2.parser.wasm.standard.wasm1.section;
 import uwvm2.parser.wasm.standard.wasm1.opcode;
 import uwvm2.parser.wasm.binfmt.binfmt_ver1;
 import :def;
+import :parameter;
 import :feature_def;
 import :types;
+import :function_section;
+import :code_section;
+import :code_validator;
 #else
 // std
 # include <cstddef>
@@ -63,8 +67,12 @@ import :types;
 # include <uwvm2/parser/wasm/standard/wasm1/opcode/impl.h>
 # include <uwvm2/parser/wasm/binfmt/binfmt_ver1/impl.h>
 # include "def.h"
+# include "parameter.h"
 # include "feature_def.h"
 # include "types.h"
+# include "function_section.h"
+# include "code_section.h"
+# include "code_validator.h"
 #endif
 
 #ifndef UWVM_MODULE_EXPORT
@@ -84,6 +92,11 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
                                              ::uwvm2::parser::wasm::base::error_impl& err,
                                              [[maybe_unused]] ::uwvm2::parser::wasm::concepts::feature_parameter_t<Fs...> const& fs_para) UWVM_THROWS
     {
+        auto const wasm1_para{::uwvm2::parser::wasm::standard::wasm1::features::get_wasm1_feature_parameter(fs_para)};
+
+        // Link scan mode: the code section has not been parsed yet, checked by complete_link_scan
+        if(wasm1_para.link_scan_only) { return; }
+
         // function section
         auto const& funcsec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<function_section_storage_t>(module_storage.sections)};
         auto const defined_func_count{static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>(funcsec.funcs.size())};
@@ -100,6 +113,12 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
             err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::code_ne_defined_func;
             ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
         }
+
+        // Function bodies can only be validated after all sections have been parsed
+        if(wasm1_para.code_section_validate)
+        {
+            ::uwvm2::parser::wasm::standard::wasm1::features::validate_code_section(module_storage, err);
+        }
     }
 }  // namespace uwvm2::parser::wasm::standard::wasm1::features
 
@@ -38,6 +38,7 @@ import uwvm2.parser.wasm.standard.wasm1.opcode;
 import uwvm2.parser.wasm.binfmt.binfmt_ver1;
 import :def;
 import :types;
+import :leb128_batch;
 import :feature_def;
 import :type_section;
 #else
@@ -79,6 +80,7 @@ import :type_section;
 # include <uwvm2/parser/wasm/binfmt/binfmt_ver1/impl.h>
 # include "def.h"
 # include "types.h"
+# include "leb128_batch.h"
 # include "feature_def.h"
 # include "type_section.h"
 #endif
@@ -7706,10 +7708,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
     }
 
     /// @brief      Maximum typeidx in [2^14, 2^16)
-    /// @details    Storing a typeidx takes up 2 bytes, typeidx corresponding uleb128 varies from 1-3 bytes, linear read/write, no simd optimization
+    /// @details    Storing a typeidx takes up 2 bytes, typeidx corresponding uleb128 varies from 1-3 bytes, decoded by decode_uleb128_u32_batch
     ///             Sequential scanning, correctly handling all cases of uleb128 u32, allowing up to 5 bytes.
-    ///             simd has basically no advantage in this area of processing
-    ///             If your wasm file has this many typeidx, please post an issue requesting the adaptation of simd!
     template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
     inline constexpr ::std::byte const* scan_function_section_impl_u16_3b(
         [[maybe_unused]] ::uwvm2::parser::wasm::concepts::feature_reserve_type_t<function_section_storage_t> sec_adl,
@@ -7739,64 +7739,45 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
         // [              safe                 ] unsafe (could be the section_end)
         //                                       ^^ section_curr
 
-        while(section_curr != section_end) [[likely]]
-        {
-            // Ensuring the existence of valid information
-
-            // [ ... typeidx1] ... typeidx2 ...
-            // [     safe    ] unsafe (could be the section_end)
-            //       ^^ section_curr
+        // Sequential decoding of the whole vector, see decode_uleb128_u32_batch
+        auto& typeidx_vector{functionsec.funcs.storage.typeidx_u16_vector};
 
-            // check function counter
-            // Ensure content is available before counting (section_curr != section_end)
-            if(++func_counter > func_count) [[unlikely]]
-            {
-                err.err_curr = section_curr;
-                err.err_selectable.u32 = func_count;
-                err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::func_section_resolved_exceeded_the_actual_number;
-                ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
-            }
-
-            // [ ... typeidx1] ... typeidx2 ...
-            // [     safe    ] unsafe (could be the section_end)
-            //       ^^ section_curr
-
-            ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 typeidx;  // No initialization necessary
-
-            using char8_t_const_may_alias_ptr UWVM_GNU_MAY_ALIAS = char8_t const*;
-
-            auto const [typeidx_next, typeidx_err]{::fast_io::parse_by_scan(reinterpret_cast<char8_t_const_may_alias_ptr>(section_curr),
-                                                                            reinterpret_cast<char8_t_const_may_alias_ptr>(section_end),
-                                                                            ::fast_io::mnp::leb128_get(typeidx))};
-
-            if(typeidx_err != ::fast_io::parse_code::ok) [[unlikely]]
-            {
-                err.err_curr = section_curr;
-                err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_type_index;
-                ::uwvm2::parser::wasm::base::throw_wasm_parse_code(typeidx_err);
-            }
+        auto const typeidx_result{::uwvm2::parser::wasm::standard::wasm1::features::decode_uleb128_u32_batch(
+            section_curr, section_end, typeidx_vector.imp.curr_ptr, static_cast<::std::size_t>(func_count - func_counter), type_section_count)};
 
-            // [ ... typeidx1 ...] typeidx2 ...
-            // [      safe       ] unsafe (could be the section_end)
-            //       ^^ section_curr
+        typeidx_vector.imp.curr_ptr += typeidx_result.decoded;
+        // decoded is not greater than func_count - func_counter
+        func_counter += static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>(typeidx_result.decoded);
+        section_curr = typeidx_result.curr;
 
-            // check: type_index should less than type_section_count
-            if(typeidx >= type_section_count) [[unlikely]]
-            {
-                err.err_curr = section_curr;
-                err.err_selectable.u32 = typeidx;
-                err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::illegal_type_index;
-                ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
-            }
+        // [ ... typeidx1 ...] typeidx2 ...
+        // [      safe       ] unsafe (could be the section_end)
+        //       ^^ section_curr (on error)
 
-            // write data, func_counter has been checked and is ready to be written.
-            functionsec.funcs.storage.typeidx_u16_vector.emplace_back_unchecked(static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u16>(typeidx));
+        // check: type_index should less than type_section_count
+        if(typeidx_result.exceeds_bound) [[unlikely]]
+        {
+            err.err_curr = section_curr;
+            err.err_selectable.u32 = typeidx_result.exceeding_value;
+            err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::illegal_type_index;
+            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+        }
 
-            section_curr = reinterpret_cast<::std::byte const*>(typeidx_next);
+        if(typeidx_result.code != ::fast_io::parse_code::ok) [[unlikely]]
+        {
+            err.err_curr = section_curr;
+            err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_type_index;
+            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(typeidx_result.code);
+        }
 
-            // [ ... typeidx1 ...] typeidx2 ...
-            // [      safe       ] unsafe (could be the section_end)
-            //                     ^^ section_curr
+        // check function counter
+        // All func_count typeidx have been decoded, but the section has not ended
+        if(section_curr != section_end) [[unlikely]]
+        {
+            err.err_curr = section_curr;
+            err.err_selectable.u32 = func_count;
+            err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::func_section_resolved_exceeded_the_actual_number;
+            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
         }
 
         // [before_section ... | func_count ... typeidx1 ... ...] (end)
@@ -7807,10 +7788,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
     }
 
     /// @brief      Maximum typeidx in [2^16, 2^32)
-    /// @details    Storing a typeidx takes up 4 bytes, typeidx corresponding uleb128 varies from 1-5 bytes, linear read/write, no simd optimization
+    /// @details    Storing a typeidx takes up 4 bytes, typeidx corresponding uleb128 varies from 1-5 bytes, decoded by decode_uleb128_u32_batch
     ///             Sequential scanning, correctly handling all cases of uleb128 u32, allowing up to 5 bytes.
-    ///             simd has basically no advantage in this area of processing
-    ///             If your wasm file has this many typeidx, please post an issue requesting the adaptation of simd!
     template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
     inline constexpr ::std::byte const* scan_function_section_impl_u32_5b(
         [[maybe_unused]] ::uwvm2::parser::wasm::concepts::feature_reserve_type_t<function_section_storage_t> sec_adl,
@@ -7839,64 +7818,45 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
         // [              safe                 ] unsafe (could be the section_end)
         //                                       ^^ section_curr
 
-        while(section_curr != section_end) [[likely]]
-        {
-            // Ensuring the existence of valid information
+        // Sequential decoding of the whole vector, see decode_uleb128_u32_batch
+        auto& typeidx_vector{functionsec.funcs.storage.typeidx_u32_vector};
 
-            // [ ... typeidx1] ... typeidx2 ...
-            // [     safe    ] unsafe (could be the section_end)
-            //       ^^ section_curr
+        auto const typeidx_result{::uwvm2::parser::wasm::standard::wasm1::features::decode_uleb128_u32_batch(
+            section_curr, section_end, typeidx_vector.imp.curr_ptr, static_cast<::std::size_t>(func_count - func_counter), type_section_count)};
 
-            // check function counter
-            // Ensure content is available before counting (section_curr != section_end)
-            if(++func_counter > func_count) [[unlikely]]
-            {
-                err.err_curr = section_curr;
-                err.err_selectable.u32 = func_count;
-                err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::func_section_resolved_exceeded_the_actual_number;
-                ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
-            }
+        typeidx_vector.imp.curr_ptr += typeidx_result.decoded;
+        // decoded is not greater than func_count - func_counter
+        func_counter += static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>(typeidx_result.decoded);
+        section_curr = typeidx_result.curr;
 
-            // [ ... typeidx1] ... typeidx2 ...
-            // [     safe    ] unsafe (could be the section_end)
-            //       ^^ section_curr
-
-            ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 typeidx;  // No initialization necessary
+        // [ ... typeidx1 ...] typeidx2 ...
+        // [      safe       ] unsafe (could be the section_end)
+        //       ^^ section_curr (on error)
 
-            using char8_t_const_may_alias_ptr UWVM_GNU_MAY_ALIAS = char8_t const*;
-
-            auto const [typeidx_next, typeidx_err]{::fast_io::parse_by_scan(reinterpret_cast<char8_t_const_may_alias_ptr>(section_curr),
-                                                                            reinterpret_cast<char8_t_const_may_alias_ptr>(section_end),
-                                                                            ::fast_io::mnp::leb128_get(typeidx))};
-
-            if(typeidx_err != ::fast_io::parse_code::ok) [[unlikely]]
-            {
-                err.err_curr = section_curr;
-                err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_type_index;
-                ::uwvm2::parser::wasm::base::throw_wasm_parse_code(typeidx_err);
-            }
-
-            // [ ... typeidx1 ...] typeidx2 ...
-            // [      safe       ] unsafe (could be the section_end)
-            //       ^^ section_curr
-
-            // check: type_index should less than type_section_count
-            if(typeidx >= type_section_count) [[unlikely]]
-            {
-                err.err_curr = section_curr;
-                err.err_selectable.u32 = typeidx;
-                err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::illegal_type_index;
-                ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
-            }
-
-            // write data, func_counter has been checked and is ready to be written.
-            functionsec.funcs.storage.typeidx_u32_vector.emplace_back_unchecked(typeidx);
+        // check: type_index should less than type_section_count
+        if(typeidx_result.exceeds_bound) [[unlikely]]
+        {
+            err.err_curr = section_curr;
+            err.err_selectable.u32 = typeidx_result.exceeding_value;
+            err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::illegal_type_index;
+            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+        }
 
-            section_curr = reinterpret_cast<::std::byte const*>(typeidx_next);
+        if(typeidx_result.code != ::fast_io::parse_code::ok) [[unlikely]]
+        {
+            err.err_curr = section_curr;
+            err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_type_index;
+            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(typeidx_result.code);
+        }
 
-            // [ ... typeidx1 ...] typeidx2 ...
-            // [      safe       ] unsafe (could be the section_end)
-            //                     ^^ section_curr
+        // check function counter
+        // All func_count typeidx have been decoded, but the section has not ended
+        if(section_curr != section_end) [[unlikely]]
+        {
+            err.err_curr = section_curr;
+            err.err_selectable.u32 = func_count;
+            err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::func_section_resolved_exceeded_the_actual_number;
+            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
         }
 
         // [before_section ... | func_count ... typeidx1 ... ...] (end)
@@ -8153,14 +8113,12 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
         {
             // storage: 2 byte
             // vectypeidx uleb128: most: 1 byte - 3 byte, may be redundant zeros (up to 5 byte)
-            // If your wasm file has this many typeidx, please post an issue requesting the adaptation of simd!
             section_curr = scan_function_section_impl_u16_3b(sec_adl, module_storage, section_curr, section_end, err, fs_para, func_counter, func_count);
         }
         else
         {
             // storage: 4 byte
             // vectypeidx uleb128: most: 1 byte - 5 byte
-            // If your wasm file has this many typeidx, please post an issue requesting the adaptation of simd!
             section_curr = scan_function_section_impl_u32_5b(sec_adl, module_storage, section_curr, section_end, err, fs_para, func_counter, func_count);
         }
 
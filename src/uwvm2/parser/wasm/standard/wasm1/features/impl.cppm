@@ -26,8 +26,11 @@ module;
 
 export module uwvm2.parser.wasm.standard.wasm1.features;
 export import :def;
+export import :parameter;
 export import :feature_def;
 export import :types;
+export import :name_hash_set;
+export import :leb128_batch;
 export import :custom_section;
 export import :type_section;
 export import :import_section;
@@ -39,8 +42,11 @@ export import :export_section;
 export import :start_section;
 export import :element_section;
 export import :code_section;
+export import :code_validator;
 export import :data_section;
 export import :final_check;
+export import :link_scan;
+export import :snapshot;
 export import :binfmt;
 
 #ifndef UWVM_MODULE
@@ -26,8 +26,11 @@
 
 #ifndef UWVM_MODULE
 # include "def.h"
+# include "parameter.h"
 # include "feature_def.h"
 # include "types.h"
+# include "name_hash_set.h"
+# include "leb128_batch.h"
 # include "custom_section.h"
 # include "type_section.h"
 # include "import_section.h"
@@ -39,7 +42,10 @@
 # include "start_section.h"
 # include "element_section.h"
 # include "code_section.h"
+# include "code_validator.h"
 # include "data_section.h"
 # include "final_check.h"
+# include "link_scan.h"
+# include "snapshot.h"
 # include "binfmt.h"
 #endif
@@ -40,6 +40,7 @@ import :def;
 import :types;
 import :feature_def;
 import :type_section;
+import :name_hash_set;
 #else
 // std
 # include <cstddef>
@@ -50,7 +51,6 @@ import :type_section;
 # include <utility>
 # include <memory>
 # include <limits>
-# include <set>  /// @todo use fast_io::set instead
 // macro
 # include <uwvm2/utils/macro/push_macros.h>
 // import
@@ -72,6 +72,7 @@ import :type_section;
 # include "types.h"
 # include "feature_def.h"
 # include "type_section.h"
+# include "name_hash_set.h"
 #endif
 
 #ifndef UWVM_MODULE_EXPORT
@@ -511,7 +512,14 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
             }
         }
 
-        importsec.imports.reserve(static_cast<::std::size_t>(import_count));
+        // Each import takes at least 3 bytes (module_namelen, extern_namelen and import_type, read by this loop itself), so the section cannot hold more
+        // imports than this. The declared import_count is not trusted beyond that for allocations. The imports are pushed unchecked, which this
+        // bound still covers, a larger count fails in the loop below.
+        auto const max_import_count{static_cast<::std::size_t>(section_end - reinterpret_cast<::std::byte const*>(import_count_next)) / 3uz};
+        auto const import_reserve_count{static_cast<::std::size_t>(import_count) < max_import_count ? static_cast<::std::size_t>(import_count)
+                                                                                                    : max_import_count};
+
+        importsec.imports.reserve(import_reserve_count);
 
         ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 import_counter{};  // use for check
 
@@ -526,8 +534,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
         ::fast_io::array<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32, importdesc_count> importdesc_counter{};  // use for reserve
         // desc counter
 
-        ::fast_io::array<::std::set<::uwvm2::parser::wasm::standard::wasm1::features::name_checker> /* @todo use fast_io::set instead */, importdesc_count>
-            duplicate_name_checker{};  // use for check duplicate name
+        // use for check duplicate name, pre-sized from the bounded import_count
+        ::uwvm2::parser::wasm::standard::wasm1::features::name_hash_set_t<::uwvm2::parser::wasm::standard::wasm1::features::import_name_key>
+            duplicate_name_checker{import_reserve_count};
 
         while(section_curr != section_end) [[likely]]
         {
@@ -760,11 +769,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
             ++importdesc_counter.index_unchecked(fit_import_type);
 
             // check duplicate name
-            auto& curr_name_set{duplicate_name_checker.index_unchecked(fit_import_type)};
-
-            ::uwvm2::parser::wasm::standard::wasm1::features::name_checker const curr_name_check{fit.module_name, fit.extern_name};
-
-            if(curr_name_set.contains(curr_name_check)) [[unlikely]]
+            // The import counter has been checked, no more than import_count names are inserted
+            if(!duplicate_name_checker.insert({{fit.module_name, fit.extern_name}, static_cast<::std::uint_least8_t>(fit_import_type)})) [[unlikely]]
             {
                 err.err_curr = section_curr;
                 err.err_selectable.duplic_imports.module_name = fit.module_name;
@@ -774,8 +780,6 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
                 ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
             }
 
-            curr_name_set.insert(curr_name_check);  // std::set never throw (Disregarding new failures)
-
             ++section_curr;
 
             // [...  module_namelen ... module_name ... extern_namelen ... extern_name ... import_type] extern_func ...
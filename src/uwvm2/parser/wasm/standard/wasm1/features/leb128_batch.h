@@ -0,0 +1,248 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @brief       WebAssembly Release 1.0 (2019-07-20)
+ * @details     antecedent dependency: null
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2025-07-16
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.parser.wasm.base;
+import uwvm2.parser.wasm.standard.wasm1.type;
+#else
+// std
+# include <cstddef>
+# include <cstdint>
+# include <cstring>
+# include <climits>
+# include <concepts>
+# include <type_traits>
+# include <memory>
+# include <bit>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# include <uwvm2/parser/wasm/base/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
+{
+    /// @brief      Result of decode_uleb128_u32_batch
+    /// @details    On success (code == ok), curr points after the last decoded value. On failure, curr points to the first byte of the value that could not
+    ///             be decoded, which is the err_curr the caller reports.
+    struct uleb128_batch_result_t
+    {
+        ::std::byte const* curr{};
+        // Number of values decoded and written
+        ::std::size_t decoded{};
+        ::fast_io::parse_code code{};
+        // The value at curr was decoded but is not less than the bound
+        bool exceeds_bound{};
+        ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 exceeding_value{};
+    };
+
+    /// @brief      Decode a vector of u32 uleb128 (indices) into an array
+    /// @details    Decodes up to count values from [curr, end) into out, each value must be less than bound. Stops without error when end is reached on a
+    ///             value boundary, the caller checks decoded against the declared count. out must have room for count values.
+    ///
+    ///             Index vectors are dominated by single-byte values. Blocks of 16 (simd) or 8 (swar) bytes without a continuation bit and without a value
+    ///             not less than the bound are widened and stored directly, the remaining values are decoded one by one, with the common 2-byte form
+    ///             decoded inline. The result is the same as decoding each value with ::fast_io::mnp::leb128_get.
+    ///
+    ///             UIntType can be narrower than u32 (e.g. u16 for typeidx less than 2^16) as long as bound fits into it.
+    /// @note       The specialized decoders of the function section (scan_function_section_impl_u8_1b, ...) also fuse the storage compression, this is the
+    ///             general form used by all other index vectors.
+    template <::std::unsigned_integral UIntType>
+    inline constexpr uleb128_batch_result_t decode_uleb128_u32_batch(::std::byte const* curr,
+                                                                     ::std::byte const* const end,
+                                                                     UIntType* out,
+                                                                     ::std::size_t const count,
+                                                                     ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 const bound) noexcept
+    {
+        using wasm_u32 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32;
+
+        ::std::size_t decoded{};
+
+        // [ ... value1 ... value2 ...] (end)
+        // [          unknown        ] unsafe (could be the end)
+        //       ^^ curr
+
+#if CHAR_BIT == 8
+# if __has_cpp_attribute(__gnu__::__vector_size__) && defined(__LITTLE_ENDIAN__) && UWVM_HAS_BUILTIN(__builtin_convertvector)
+        /// (Little Endian), [[gnu::vector_size]]
+        /// x86_64-sse2, aarch64-neon, loongarch-SX, wasm-wasmsimd128, ...
+
+        using u8x16simd [[__gnu__::__vector_size__(16)]] [[maybe_unused]] = ::std::uint8_t;
+        using u64x2simd [[__gnu__::__vector_size__(16)]] [[maybe_unused]] = ::std::uint64_t;
+        using outx16simd [[__gnu__::__vector_size__(16uz * sizeof(UIntType))]] [[maybe_unused]] = UIntType;
+
+        // A byte not less than 0x80 has a continuation bit, a single-byte value not less than the bound is out of range. Both are checked by one compare.
+        auto const simd_check_value{static_cast<::std::uint8_t>(bound < 0x80u ? bound : 0x80u)};
+        u8x16simd const simd_vector_check{simd_check_value, simd_check_value, simd_check_value, simd_check_value, simd_check_value, simd_check_value,
+                                          simd_check_value, simd_check_value, simd_check_value, simd_check_value, simd_check_value, simd_check_value,
+                                          simd_check_value, simd_check_value, simd_check_value, simd_check_value};
+
+        constexpr ::std::size_t block_size{16uz};
+# else
+        /// swar, all platforms (including msvc)
+
+        constexpr ::std::size_t block_size{8uz};
+# endif
+#endif
+
+        // Blocks containing a multi-byte value are decoded by the scalar path, the block path is retried after them
+        ::std::byte const* block_retry{curr};
+
+        while(decoded != count && curr != end)
+        {
+#if CHAR_BIT == 8
+            if(curr >= block_retry && count - decoded >= block_size && static_cast<::std::size_t>(end - curr) >= block_size)
+            {
+# if __has_cpp_attribute(__gnu__::__vector_size__) && defined(__LITTLE_ENDIAN__) && UWVM_HAS_BUILTIN(__builtin_convertvector)
+                // [ ... value1 ... (15) ...] ...
+                // [          safe          ] unsafe (could be the end)
+                //       ^^ curr
+                //       [ simd_vector_str  ]
+
+                u8x16simd simd_vector_str;  // No initialization necessary
+
+                ::std::memcpy(::std::addressof(simd_vector_str), curr, sizeof(u8x16simd));
+
+                auto const check_upper{::std::bit_cast<u64x2simd>(simd_vector_str >= simd_vector_check)};
+
+                if((check_upper[0u] | check_upper[1u]) == 0u) [[likely]]
+                {
+                    // all are single bytes, so there are 16
+                    auto const need_write{__builtin_convertvector(simd_vector_str, outx16simd)};
+                    ::std::memcpy(out + decoded, ::std::addressof(need_write), sizeof(outx16simd));
+
+                    decoded += block_size;
+                    curr += block_size;
+
+                    // [ ... value1 ... (15) ...] value17 ...
+                    // [          safe          ] unsafe (could be the end)
+                    //                            ^^ curr
+
+                    continue;
+                }
+# else
+                // [ ... value1 ... (7) ...] ...
+                // [          safe         ] unsafe (could be the end)
+                //       ^^ curr
+
+                ::std::uint_least64_t swar;  // No initialization necessary
+
+                ::std::memcpy(::std::addressof(swar), curr, sizeof(::std::uint_least64_t));
+
+                // Independent of endianness. With a bound less than 0x80 single bytes also need a range check, which is rare (very few functions), so
+                // the scalar path is used.
+                if(bound >= 0x80u && (swar & static_cast<::std::uint_least64_t>(0x8080808080808080u)) == 0u) [[likely]]
+                {
+                    // all are single bytes, so there are 8
+                    for(::std::size_t i{}; i != block_size; ++i)
+                    {
+                        out[decoded + i] = static_cast<UIntType>(::std::to_integer<::std::uint_least8_t>(curr[i]));
+                    }
+
+                    decoded += block_size;
+                    curr += block_size;
+
+                    continue;
+                }
+# endif
+
+                block_retry = curr + block_size;
+            }
+#endif
+
+            // [ ... value1] ... value2 ...
+            // [    safe   ] unsafe (could be the end)
+            //       ^^ curr
+
+            wasm_u32 value;  // No initialization necessary
+
+            ::std::byte const* value_next;  // No initialization necessary
+
+            auto const byte0{::std::to_integer<::std::uint_least8_t>(*curr)};
+
+#if CHAR_BIT > 8
+            // On platforms where CHAR_BIT is greater than 8, only the lower 8 bits are valid information, leave it to leb128_get
+            if(false)
+#else
+            if((byte0 & 0x80u) == 0u) [[likely]]
+#endif
+            {
+                // 1 byte
+                value = static_cast<wasm_u32>(byte0);
+                value_next = curr + 1u;
+            }
+#if CHAR_BIT == 8
+            else if(static_cast<::std::size_t>(end - curr) >= 2uz && (::std::to_integer<::std::uint_least8_t>(curr[1u]) & 0x80u) == 0u)
+            {
+                // 2 bytes, always a valid u32
+                value = static_cast<wasm_u32>(byte0 & 0x7Fu) | (static_cast<wasm_u32>(::std::to_integer<::std::uint_least8_t>(curr[1u])) << 7u);
+                value_next = curr + 2u;
+            }
+#endif
+            else
+            {
+                using char8_t_const_may_alias_ptr UWVM_GNU_MAY_ALIAS = char8_t const*;
+
+                auto const [leb_next, leb_err]{::fast_io::parse_by_scan(reinterpret_cast<char8_t_const_may_alias_ptr>(curr),
+                                                                        reinterpret_cast<char8_t_const_may_alias_ptr>(end),
+                                                                        ::fast_io::mnp::leb128_get(value))};
+
+                if(leb_err != ::fast_io::parse_code::ok) [[unlikely]] { return {curr, decoded, leb_err, false, 0u}; }
+
+                value_next = reinterpret_cast<::std::byte const*>(leb_next);
+            }
+
+            // [ ... value1 ...] value2 ...
+            // [      safe     ] unsafe (could be the end)
+            //       ^^ curr
+
+            if(value >= bound) [[unlikely]] { return {curr, decoded, ::fast_io::parse_code::invalid, true, value}; }
+
+            out[decoded] = static_cast<UIntType>(value);
+            ++decoded;
+
+            curr = value_next;
+
+            // [ ... value1 ...] value2 ...
+            // [      safe     ] unsafe (could be the end)
+            //                   ^^ curr
+        }
+
+        return {curr, decoded, ::fast_io::parse_code::ok, false, 0u};
+    }
+}  // namespace uwvm2::parser::wasm::standard::wasm1::features
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
@@ -0,0 +1,151 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @brief       WebAssembly Release 1.0 (2019-07-20)
+ * @details     antecedent dependency: null
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2025-07-19
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifdef UWVM_MODULE
+import fast_io;
+# ifdef UWVM_TIMER
+import uwvm2.utils.debug;
+# endif
+import uwvm2.parser.wasm.base;
+import uwvm2.parser.wasm.concepts;
+import uwvm2.parser.wasm.standard.wasm1.type;
+import uwvm2.parser.wasm.standard.wasm1.section;
+import uwvm2.parser.wasm.binfmt.binfmt_ver1;
+import :def;
+import :parameter;
+import :feature_def;
+import :types;
+import :element_section;
+import :code_section;
+import :data_section;
+import :final_check;
+#else
+// std
+# include <cstddef>
+# include <cstdint>
+# include <concepts>
+# include <type_traits>
+# include <utility>
+# include <memory>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# ifdef UWVM_TIMER
+#  include <uwvm2/utils/debug/impl.h>
+# endif
+# include <uwvm2/parser/wasm/base/impl.h>
+# include <uwvm2/parser/wasm/concepts/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/section/impl.h>
+# include <uwvm2/parser/wasm/binfmt/binfmt_ver1/impl.h>
+# include "def.h"
+# include "parameter.h"
+# include "feature_def.h"
+# include "types.h"
+# include "element_section.h"
+# include "code_section.h"
+# include "data_section.h"
+# include "final_check.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
+{
+    namespace details
+    {
+        /// @brief Parse a section skipped in link scan mode from its recorded span
+        template <typename SecStorage, ::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        inline constexpr void complete_link_scan_section(::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...> &
+                                                             module_storage,
+                                                         ::uwvm2::parser::wasm::base::error_impl& err,
+                                                         ::uwvm2::parser::wasm::concepts::feature_parameter_t<Fs...> const& fs_para) UWVM_THROWS
+        {
+            auto& sec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<SecStorage>(module_storage.sections)};
+
+            auto const sec_span{sec.sec_span};
+
+            // Section not present
+            if(sec_span.sec_begin == nullptr) { return; }
+
+            // Clear the span so that the handler does not treat it as a duplicate section
+            sec.sec_span = {};
+
+            auto const section_begin{reinterpret_cast<::std::byte const*>(sec_span.sec_begin)};
+            auto const section_end{reinterpret_cast<::std::byte const*>(sec_span.sec_end)};
+
+            // The position of the section id is not recorded, section_begin is used for errors that refer to the whole section
+            handle_binfmt_ver1_extensible_section_define(::uwvm2::parser::wasm::concepts::feature_reserve_type<SecStorage>,
+                                                         module_storage,
+                                                         section_begin,
+                                                         section_end,
+                                                         err,
+                                                         fs_para,
+                                                         section_begin);
+        }
+    }  // namespace details
+
+    /// @brief      Complete a module parsed in link scan mode (wasm1_feature_parameter_t::link_scan_only)
+    /// @details    Parses the element, code and data sections from the spans recorded during the link scan and runs the final check, the result is the
+    ///             same as parsing the module without link scan mode. fs_para must be the parameter used for the link scan, link_scan_only is ignored.
+    ///             Must be called at most once, and only on a storage produced in link scan mode.
+    /// @throws     ::fast_io::error
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+    inline constexpr void complete_link_scan(::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...> & module_storage,
+                                             ::uwvm2::parser::wasm::base::error_impl& err,
+                                             ::uwvm2::parser::wasm::concepts::feature_parameter_t<Fs...> const& fs_para) UWVM_THROWS
+    {
+#ifdef UWVM_TIMER
+        ::uwvm2::utils::debug::timer parsing_timer{u8"complete link scan"};
+#endif
+
+        auto full_para{fs_para};
+
+        if constexpr((has_wasm1_feature_parameter<Fs> || ...))
+        {
+            ::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<wasm1_feature_parameter_t>(full_para.parameters).link_scan_only = false;
+        }
+
+        // Canonical order, the same as the binfmt ver1 parser
+        details::complete_link_scan_section<element_section_storage_t<Fs...>>(module_storage, err, full_para);
+        details::complete_link_scan_section<code_section_storage_t<Fs...>>(module_storage, err, full_para);
+        details::complete_link_scan_section<data_section_storage_t<Fs...>>(module_storage, err, full_para);
+
+        if constexpr(::uwvm2::parser::wasm::binfmt::ver1::has_final_check_handler<Fs...>)
+        {
+            constexpr ::uwvm2::parser::wasm::concepts::feature_reserve_type_t<::uwvm2::parser::wasm::binfmt::ver1::final_final_check_t<Fs...>> final_adl{};
+            define_final_check(final_adl, module_storage, module_storage.module_span.module_end, err, full_para);
+        }
+    }
+}  // namespace uwvm2::parser::wasm::standard::wasm1::features
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
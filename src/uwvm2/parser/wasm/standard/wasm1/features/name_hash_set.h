@@ -0,0 +1,267 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @brief       WebAssembly Release 1.0 (2019-07-20)
+ * @details     antecedent dependency: null
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2025-07-16
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.parser.wasm.standard.wasm1.type;
+import :def;
+#else
+// std
+# include <cstddef>
+# include <cstdint>
+# include <cstring>
+# include <concepts>
+# include <type_traits>
+# include <utility>
+# include <memory>
+# include <limits>
+# include <bit>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# include <fast_io_dsal/vector.h>
+# include <fast_io_dsal/string_view.h>
+# include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
+# include "def.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
+{
+    namespace details
+    {
+        /// @brief Mix function of the name hash (the finalizer of murmurhash3)
+        inline constexpr ::std::uint_least64_t name_hash_mix(::std::uint_least64_t h) noexcept
+        {
+            h ^= h >> 33u;
+            h *= static_cast<::std::uint_least64_t>(0xff51afd7ed558ccdu);
+            h ^= h >> 33u;
+            h *= static_cast<::std::uint_least64_t>(0xc4ceb9fe1a85ec53u);
+            h ^= h >> 33u;
+            return h;
+        }
+
+        /// @brief Random key of the name hashes, drawn once per process
+        /// @details The names come from untrusted modules, a key they cannot know keeps them from being crafted to share the low bits of their
+        ///          hashes (which would make every insertion probe all the others). The address of a local is mixed in for the case where the
+        ///          system has no random source.
+        inline ::std::uint_least64_t name_hash_process_key() noexcept
+        {
+            static ::std::uint_least64_t const key{[]() noexcept -> ::std::uint_least64_t
+                                                   {
+                                                       ::std::uint_least64_t value{};
+#ifdef __cpp_exceptions
+                                                       try
+#endif
+                                                       {
+                                                           ::fast_io::native_white_hole white_hole{};
+                                                           ::fast_io::operations::read_all_bytes(
+                                                               white_hole,
+                                                               reinterpret_cast<::std::byte*>(::std::addressof(value)),
+                                                               reinterpret_cast<::std::byte*>(::std::addressof(value) + 1));
+                                                       }
+#ifdef __cpp_exceptions
+                                                       catch(...)
+                                                       {
+                                                       }
+#endif
+                                                       return name_hash_mix(value ^ static_cast<::std::uint_least64_t>(
+                                                                                        reinterpret_cast<::std::uintptr_t>(::std::addressof(value))));
+                                                   }()};
+            return key;
+        }
+
+        /// @brief Hash a name 8 bytes at a time, seed separates the kinds of the name
+        inline ::std::uint_least64_t name_hash(::fast_io::u8string_view name, ::std::uint_least64_t seed) noexcept
+        {
+            auto h{seed ^ name_hash_process_key() ^
+                   (static_cast<::std::uint_least64_t>(name.size()) * static_cast<::std::uint_least64_t>(0x9e3779b97f4a7c15u))};
+
+            auto curr{name.data()};
+            auto size{name.size()};
+
+            for(; size >= 8uz; size -= 8uz, curr += 8uz)
+            {
+                ::std::uint_least64_t word;  // No initialization necessary
+                ::std::memcpy(::std::addressof(word), curr, sizeof(word));
+                h = name_hash_mix(h ^ word);
+            }
+
+            if(size != 0uz)
+            {
+                ::std::uint_least64_t word{};
+                ::std::memcpy(::std::addressof(word), curr, size);
+                h = name_hash_mix(h ^ word);
+            }
+
+            return h;
+        }
+    }  // namespace details
+
+    /// @brief Key of the export name checker, names only need to be unique within the same export type
+    struct export_name_key
+    {
+        ::fast_io::u8string_view export_name{};
+        ::std::uint_least8_t type{};
+    };
+
+    inline constexpr bool operator== (export_name_key const& n1, export_name_key const& n2) noexcept
+    {
+        return n1.type == n2.type && n1.export_name == n2.export_name;
+    }
+
+    inline ::std::uint_least64_t hash_name_key(export_name_key const& key) noexcept
+    {
+        return ::uwvm2::parser::wasm::standard::wasm1::features::details::name_hash(key.export_name, static_cast<::std::uint_least64_t>(key.type));
+    }
+
+    /// @brief Key of the import name checker, names only need to be unique within the same import type
+    struct import_name_key
+    {
+        ::uwvm2::parser::wasm::standard::wasm1::features::name_checker name{};
+        ::std::uint_least8_t type{};
+    };
+
+    inline constexpr bool operator== (import_name_key const& n1, import_name_key const& n2) noexcept { return n1.type == n2.type && n1.name == n2.name; }
+
+    inline ::std::uint_least64_t hash_name_key(import_name_key const& key) noexcept
+    {
+        auto const module_hash{
+            ::uwvm2::parser::wasm::standard::wasm1::features::details::name_hash(key.name.module_name, static_cast<::std::uint_least64_t>(key.type))};
+        return ::uwvm2::parser::wasm::standard::wasm1::features::details::name_hash(key.name.extern_name, module_hash);
+    }
+
+    /// @brief      Insert-only open addressing hash set of names, used to check for duplicate import and export names
+    /// @details    Key is found through hash_name_key(key) and operator==, it may carry a payload that both ignore (the export index of the linker).
+    ///             The capacity is a power of two not less than twice the number of names, so the load factor stays at or below 0.5. The constructor
+    ///             only pre-sizes the table for the expected count (callers bound it by the bytes of the section, a declared count is not trusted), the
+    ///             table doubles when more names are inserted. Linear probing, a stored hash of 0 marks an empty slot. The names are views into the
+    ///             module, nothing is copied.
+    template <typename Key>
+    struct name_hash_set_t
+    {
+        struct slot_t
+        {
+            ::std::uint_least64_t hash{};
+            Key key{};
+        };
+
+        ::fast_io::vector<slot_t> slots{};
+        ::std::size_t mask{};
+        ::std::size_t size{};
+
+        inline constexpr name_hash_set_t() noexcept = default;
+
+        inline explicit name_hash_set_t(::std::size_t count) noexcept
+        {
+            if(count == 0uz) { return; }
+
+            // The largest power of two of size_t is the limit of bit_ceil, count * 2 must not exceed it
+            constexpr auto max_count{(::std::numeric_limits<::std::size_t>::max() >> 2u) + 1uz};
+            this->rehash(::std::bit_ceil((count < max_count ? count : max_count) * 2uz));
+        }
+
+        inline static ::std::uint_least64_t slot_hash(Key const& key) noexcept
+        {
+            auto const hash{hash_name_key(key)};
+            return hash | static_cast<::std::uint_least64_t>(hash == 0u);  // 0 marks an empty slot
+        }
+
+        /// @brief   Insert the key
+        /// @return  false if the key is already present, the stored key is kept
+        inline bool insert(Key const& key) noexcept
+        {
+            auto const hash{slot_hash(key)};
+
+            // The slots are at most half full after the insertion. Only a table of 2^(N-1) slots cannot double, it never holds that many names.
+            if(auto const capacity{this->slots.size()}; (this->size + 1uz) * 2uz > capacity) [[unlikely]]
+            {
+                this->rehash(capacity == 0uz ? 8uz : capacity * 2uz);
+            }
+
+            for(auto pos{static_cast<::std::size_t>(hash) & this->mask};; pos = (pos + 1uz) & this->mask)
+            {
+                auto& slot{this->slots.index_unchecked(pos)};
+
+                if(slot.hash == 0u)
+                {
+                    slot.hash = hash;
+                    slot.key = key;
+                    ++this->size;
+                    return true;
+                }
+
+                if(slot.hash == hash && slot.key == key) { return false; }
+            }
+        }
+
+        /// @brief   Find the key
+        /// @return  The stored key, nullptr if the key is not present
+        inline Key const* find(Key const& key) const noexcept
+        {
+            if(this->slots.empty()) { return nullptr; }
+
+            auto const hash{slot_hash(key)};
+
+            for(auto pos{static_cast<::std::size_t>(hash) & this->mask};; pos = (pos + 1uz) & this->mask)
+            {
+                auto const& slot{this->slots.index_unchecked(pos)};
+
+                if(slot.hash == 0u) { return nullptr; }
+
+                if(slot.hash == hash && slot.key == key) { return ::std::addressof(slot.key); }
+            }
+        }
+
+        /// @brief  Move all names into a table of `capacity` (a power of two) slots, the stored hashes are reused
+        inline void rehash(::std::size_t capacity) noexcept
+        {
+            auto const old_slots{::std::move(this->slots)};
+
+            this->slots = ::fast_io::vector<slot_t>{};
+            this->slots.resize(capacity);
+            this->mask = capacity - 1uz;
+
+            for(auto const& old_slot: old_slots)
+            {
+                if(old_slot.hash == 0u) { continue; }
+
+                auto pos{static_cast<::std::size_t>(old_slot.hash) & this->mask};
+                while(this->slots.index_unchecked(pos).hash != 0u) { pos = (pos + 1uz) & this->mask; }
+                this->slots.index_unchecked(pos) = old_slot;
+            }
+        }
+    };
+}  // namespace uwvm2::parser::wasm::standard::wasm1::features
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
@@ -0,0 +1,106 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @brief       WebAssembly Release 1.0 (2019-07-20)
+ * @details     antecedent dependency: null
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2025-07-16
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.parser.wasm.concepts;
+#else
+// std
+# include <cstddef>
+# include <cstdint>
+# include <concepts>
+# include <type_traits>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# include <fast_io_dsal/tuple.h>
+# include <uwvm2/parser/wasm/concepts/impl.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
+{
+    /// @brief      Parameters used to control the parsing of wasm1
+    /// @details    Stored in feature_parameter_t<Fs...> through `wasm1::parameter`. All-zero is the default behavior, so it can be stored in a union without
+    ///             any construction.
+    /// @see        uwvm2/parser/wasm/concepts/feature_parameter.h
+    struct wasm1_feature_parameter_t
+    {
+        /// @brief      Number of threads used to parse the code section
+        /// @details    0 and 1: serial parsing.
+        ///             Greater than 1: the code section is split serially by the body size prefixes, and then the local declarations of the function
+        ///             bodies are parsed concurrently. Only takes effect on platforms that support threads (UWVM_SUPPORT_MULTITHREAD).
+        ::std::size_t code_section_parse_threads{};
+
+        /// @brief      Lazy decoding of the local declarations of the code section
+        /// @details    false: the local declarations of all function bodies are decoded and checked during parsing.
+        ///             true: only the code_body_t span of each function body is recorded, the local declarations are decoded and cached the first time
+        ///             the function is touched (get_code_with_decoded_locals). Errors in local declarations are reported at that time.
+        bool code_section_lazy_locals{};
+
+        /// @brief      Validation of the function bodies
+        /// @details    true: the instruction streams of all function bodies are validated in the final check and wasm1_code_metadata_t is filled
+        ///             (validate_code_section). In lazy mode, this decodes the local declarations of all function bodies.
+        bool code_section_validate{};
+
+        /// @brief      Link scan mode, only the information needed to link the module is decoded
+        /// @details    false: all sections are parsed.
+        ///             true: the type, import, function, table, memory, global, export and start sections are parsed, the element, code and data
+        ///             sections are skipped over by span (only sec_span is recorded, duplicates and order are still checked). Custom sections are
+        ///             recorded as usual, their contents are never decoded by the parser. The skipped sections and the final check are completed by
+        ///             complete_link_scan, errors in them are reported at that time.
+        bool link_scan_only{};
+    };
+
+    static_assert(::std::is_trivially_copyable_v<wasm1_feature_parameter_t> && ::std::is_trivially_destructible_v<wasm1_feature_parameter_t>);
+
+    template <typename FeatureType>
+    concept has_wasm1_feature_parameter = requires { requires ::std::same_as<typename FeatureType::parameter, wasm1_feature_parameter_t>; };
+
+    /// @brief      Get a copy of the wasm1 parameter
+    /// @details    Features that do not contain wasm1 (no wasm1_feature_parameter_t in Fs...) get the default parameter.
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+    inline constexpr wasm1_feature_parameter_t get_wasm1_feature_parameter(::uwvm2::parser::wasm::concepts::feature_parameter_t<Fs...> const& fs_para) noexcept
+    {
+        if constexpr((has_wasm1_feature_parameter<Fs> || ...))
+        {
+            return ::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<wasm1_feature_parameter_t>(fs_para.parameters);
+        }
+        else
+        {
+            return {};
+        }
+    }
+}  // namespace uwvm2::parser::wasm::standard::wasm1::features
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
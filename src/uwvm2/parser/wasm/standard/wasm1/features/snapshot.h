@@ -0,0 +1,868 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @brief       WebAssembly Release 1.0 (2019-07-20)
+ * @details     antecedent dependency: null
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2025-07-16
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.parser.wasm.concepts;
+import uwvm2.parser.wasm.standard.wasm1.type;
+import uwvm2.parser.wasm.standard.wasm1.section;
+import uwvm2.parser.wasm.binfmt.base;
+import uwvm2.parser.wasm.binfmt.binfmt_ver1;
+import :def;
+import :feature_def;
+import :custom_section;
+import :type_section;
+import :import_section;
+import :function_section;
+import :table_section;
+import :memory_section;
+import :global_section;
+import :export_section;
+import :start_section;
+import :element_section;
+import :code_section;
+import :data_section;
+#else
+// std
+# include <cstddef>
+# include <cstdint>
+# include <concepts>
+# include <type_traits>
+# include <utility>
+# include <memory>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# include <fast_io_dsal/array.h>
+# include <fast_io_dsal/vector.h>
+# include <fast_io_dsal/string_view.h>
+# include <uwvm2/parser/wasm/concepts/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/section/impl.h>
+# include <uwvm2/parser/wasm/binfmt/base/impl.h>
+# include <uwvm2/parser/wasm/binfmt/binfmt_ver1/impl.h>
+# include "def.h"
+# include "feature_def.h"
+# include "custom_section.h"
+# include "type_section.h"
+# include "import_section.h"
+# include "function_section.h"
+# include "table_section.h"
+# include "memory_section.h"
+# include "global_section.h"
+# include "export_section.h"
+# include "start_section.h"
+# include "element_section.h"
+# include "code_section.h"
+# include "data_section.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+/// @brief      Snapshot functions of the wasm1 sections (see binfmt_ver1::has_binfmt_ver1_snapshot_define)
+/// @details    Views into the module are written as offsets, pointers into other parts of the storage as indices (imported functions into the type
+///             section, importdesc and exportdesc into their own section). The structures that are written as raw bytes only contain integers and
+///             enumerations. The snapshot is only defined for the wasm1 structures, a feature that replaces any of them has to provide its own functions,
+///             otherwise snapshots are unavailable for that feature set (binfmt_ver1_snapshot_supported).
+UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
+{
+    template <typename... Fs>
+    concept has_wasm1_snapshot_types =
+        ::std::same_as<final_extern_type_t<Fs...>, wasm1_final_extern_type<Fs...>> &&
+        ::std::same_as<final_table_type<Fs...>, ::uwvm2::parser::wasm::standard::wasm1::type::table_type> &&
+        ::std::same_as<final_memory_type<Fs...>, ::uwvm2::parser::wasm::standard::wasm1::type::memory_type> &&
+        ::std::same_as<final_global_type<Fs...>, ::uwvm2::parser::wasm::standard::wasm1::type::global_type> &&
+        ::std::same_as<final_export_type_t<Fs...>, wasm1_final_export_type<Fs...>> && ::std::same_as<final_element_type_t<Fs...>, wasm1_element_t<Fs...>> &&
+        ::std::same_as<final_data_type_t<Fs...>, wasm1_data_t<Fs...>>;
+
+    namespace details
+    {
+        inline void snapshot_write_section_span(::uwvm2::parser::wasm::binfmt::snapshot_writer_t& writer,
+                                                ::uwvm2::parser::wasm::standard::wasm1::section::section_span_view const& sec_span) noexcept
+        {
+            writer.write_module_ptr(sec_span.sec_begin);
+            writer.write_module_ptr(sec_span.sec_end);
+        }
+
+        inline ::uwvm2::parser::wasm::standard::wasm1::section::section_span_view
+            snapshot_read_section_span(::uwvm2::parser::wasm::binfmt::snapshot_reader_t& reader) noexcept
+        {
+            ::uwvm2::parser::wasm::standard::wasm1::section::section_span_view sec_span{};
+            sec_span.sec_begin = reader.read_module_ptr<::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte>();
+            sec_span.sec_end = reader.read_module_ptr<::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte>();
+            return sec_span;
+        }
+
+        /// @brief Write a vector of pointers into elements as indices
+        template <typename T>
+        inline void snapshot_write_desc(::uwvm2::parser::wasm::binfmt::snapshot_writer_t& writer,
+                                        ::fast_io::vector<T const*> const& desc,
+                                        ::fast_io::vector<T> const& elements) noexcept
+        {
+            writer.write_size(desc.size());
+            for(auto const p: desc) { writer.write(static_cast<::std::uint_least64_t>(p - elements.cbegin())); }
+        }
+
+        template <typename T>
+        inline void snapshot_read_desc(::uwvm2::parser::wasm::binfmt::snapshot_reader_t& reader,
+                                       ::fast_io::vector<T const*>& desc,
+                                       ::fast_io::vector<T> const& elements) noexcept
+        {
+            auto const n{reader.read_size(sizeof(::std::uint_least64_t))};
+            desc.reserve(n);
+
+            for(::std::size_t i{}; i != n; ++i)
+            {
+                auto const idx{reader.read<::std::uint_least64_t>()};
+                if(reader.failed || idx >= elements.size()) [[unlikely]]
+                {
+                    reader.failed = true;
+                    return;
+                }
+
+                desc.push_back_unchecked(elements.cbegin() + idx);
+            }
+        }
+    }  // namespace details
+
+    ////////////////////////////
+    /// @brief custom section ///
+    ////////////////////////////
+
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+    inline void define_binfmt_ver1_snapshot_write(::uwvm2::parser::wasm::concepts::feature_reserve_type_t<custom_section_storage_t>,
+                                                  ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...> const& module_storage,
+                                                  ::uwvm2::parser::wasm::binfmt::snapshot_writer_t& writer) noexcept
+    {
+        auto const& sec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<custom_section_storage_t>(module_storage.sections)};
+
+        writer.write_size(sec.customs.size());
+        for(auto const& cs: sec.customs)
+        {
+            details::snapshot_write_section_span(writer, cs.sec_span);
+            writer.write_module_string(cs.custom_name);
+            writer.write_module_ptr(cs.custom_begin);
+        }
+    }
+
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+    inline void define_binfmt_ver1_snapshot_read(::uwvm2::parser::wasm::concepts::feature_reserve_type_t<custom_section_storage_t>,
+                                                 ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...>& module_storage,
+                                                 ::uwvm2::parser::wasm::binfmt::snapshot_reader_t& reader) noexcept
+    {
+        auto& sec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<custom_section_storage_t>(module_storage.sections)};
+
+        // sec_span (16) + custom_name (16) + custom_begin (8)
+        auto const n{reader.read_size(40uz)};
+        sec.customs.reserve(n);
+
+        for(::std::size_t i{}; i != n; ++i)
+        {
+            ::uwvm2::parser::wasm::standard::wasm1::section::custom_section cs{};
+            cs.sec_span = details::snapshot_read_section_span(reader);
+            cs.custom_name = reader.read_module_string();
+            cs.custom_begin = reader.read_module_ptr<::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte>();
+            sec.customs.push_back_unchecked(cs);
+        }
+    }
+
+    //////////////////////////
+    /// @brief type section ///
+    //////////////////////////
+
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        requires (has_wasm1_snapshot_types<Fs...>)
+    inline void define_binfmt_ver1_snapshot_write(::uwvm2::parser::wasm::concepts::feature_reserve_type_t<type_section_storage_t<Fs...>>,
+                                                  ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...> const& module_storage,
+                                                  ::uwvm2::parser::wasm::binfmt::snapshot_writer_t& writer) noexcept
+    {
+        auto const& sec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<type_section_storage_t<Fs...>>(module_storage.sections)};
+
+        details::snapshot_write_section_span(writer, sec.sec_span);
+
+        writer.write_size(sec.types.size());
+        for(auto const& ft: sec.types)
+        {
+            writer.write_module_ptr(ft.parameter.begin);
+            writer.write_module_ptr(ft.parameter.end);
+            writer.write_module_ptr(ft.result.begin);
+            writer.write_module_ptr(ft.result.end);
+        }
+    }
+
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        requires (has_wasm1_snapshot_types<Fs...>)
+    inline void define_binfmt_ver1_snapshot_read(::uwvm2::parser::wasm::concepts::feature_reserve_type_t<type_section_storage_t<Fs...>>,
+                                                 ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...>& module_storage,
+                                                 ::uwvm2::parser::wasm::binfmt::snapshot_reader_t& reader) noexcept
+    {
+        using value_type_t = ::uwvm2::parser::wasm::standard::wasm1::features::final_value_type_t<Fs...>;
+
+        auto& sec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<type_section_storage_t<Fs...>>(module_storage.sections)};
+
+        sec.sec_span = details::snapshot_read_section_span(reader);
+
+        // 4 pointers
+        auto const n{reader.read_size(32uz)};
+        sec.types.reserve(n);
+
+        for(::std::size_t i{}; i != n; ++i)
+        {
+            ::uwvm2::parser::wasm::standard::wasm1::features::final_function_type<Fs...> ft{};
+            ft.parameter.begin = reader.read_module_ptr<value_type_t>();
+            ft.parameter.end = reader.read_module_ptr<value_type_t>();
+            ft.result.begin = reader.read_module_ptr<value_type_t>();
+            ft.result.end = reader.read_module_ptr<value_type_t>();
+            sec.types.push_back_unchecked(ft);
+        }
+    }
+
+    ////////////////////////////
+    /// @brief import section ///
+    ////////////////////////////
+
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        requires (has_wasm1_snapshot_types<Fs...>)
+    inline void define_binfmt_ver1_snapshot_write(::uwvm2::parser::wasm::concepts::feature_reserve_type_t<import_section_storage_t<Fs...>>,
+                                                  ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...> const& module_storage,
+                                                  ::uwvm2::parser::wasm::binfmt::snapshot_writer_t& writer) noexcept
+    {
+        using external_types = ::uwvm2::parser::wasm::standard::wasm1::type::external_types;
+
+        auto const& typesec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<type_section_storage_t<Fs...>>(module_storage.sections)};
+        auto const& sec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<import_section_storage_t<Fs...>>(module_storage.sections)};
+
+        details::snapshot_write_section_span(writer, sec.sec_span);
+
+        writer.write_size(sec.imports.size());
+        for(auto const& imp: sec.imports)
+        {
+            writer.write_module_string(imp.module_name);
+            writer.write_module_string(imp.extern_name);
+            writer.write(imp.imports.type);
+
+            switch(imp.imports.type)
+            {
+                case external_types::func:
+                {
+                    // Index into the type section
+                    writer.write(static_cast<::std::uint_least64_t>(imp.imports.storage.function - typesec.types.cbegin()));
+                    break;
+                }
+                case external_types::table:
+                {
+                    writer.write(imp.imports.storage.table);
+                    break;
+                }
+                case external_types::memory:
+                {
+                    writer.write(imp.imports.storage.memory);
+                    break;
+                }
+                case external_types::global:
+                {
+                    writer.write(imp.imports.storage.global);
+                    break;
+                }
+                [[unlikely]] default:
+                {
+                    // The parser never stores any other type
+                    ::fast_io::fast_terminate();
+                }
+            }
+        }
+
+        for(auto const& desc: sec.importdesc) { details::snapshot_write_desc(writer, desc, sec.imports); }
+    }
+
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        requires (has_wasm1_snapshot_types<Fs...>)
+    inline void define_binfmt_ver1_snapshot_read(::uwvm2::parser::wasm::concepts::feature_reserve_type_t<import_section_storage_t<Fs...>>,
+                                                 ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...>& module_storage,
+                                                 ::uwvm2::parser::wasm::binfmt::snapshot_reader_t& reader) noexcept
+    {
+        using external_types = ::uwvm2::parser::wasm::standard::wasm1::type::external_types;
+
+        // Restored before the import section
+        auto const& typesec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<type_section_storage_t<Fs...>>(module_storage.sections)};
+        auto& sec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<import_section_storage_t<Fs...>>(module_storage.sections)};
+
+        sec.sec_span = details::snapshot_read_section_span(reader);
+
+        // module_name (16) + extern_name (16) + type (1) + the smallest description (4)
+        auto const n{reader.read_size(37uz)};
+
+        // importdesc refers to the elements, the vector is never reallocated after this
+        sec.imports.reserve(n);
+
+        for(::std::size_t i{}; i != n; ++i)
+        {
+            ::uwvm2::parser::wasm::standard::wasm1::features::final_import_type<Fs...> imp{};
+            imp.module_name = reader.read_module_string();
+            imp.extern_name = reader.read_module_string();
+            imp.imports.type = reader.read<external_types>();
+
+            switch(imp.imports.type)
+            {
+                case external_types::func:
+                {
+                    auto const idx{reader.read<::std::uint_least64_t>()};
+                    if(reader.failed || idx >= typesec.types.size()) [[unlikely]]
+                    {
+                        reader.failed = true;
+                        return;
+                    }
+                    imp.imports.storage.function = typesec.types.cbegin() + idx;
+                    break;
+                }
+                case external_types::table:
+                {
+                    imp.imports.storage.table = reader.read<::uwvm2::parser::wasm::standard::wasm1::features::final_table_type<Fs...>>();
+                    break;
+                }
+                case external_types::memory:
+                {
+                    imp.imports.storage.memory = reader.read<::uwvm2::parser::wasm::standard::wasm1::features::final_memory_type<Fs...>>();
+                    break;
+                }
+                case external_types::global:
+                {
+                    imp.imports.storage.global = reader.read<::uwvm2::parser::wasm::standard::wasm1::features::final_global_type<Fs...>>();
+                    break;
+                }
+                [[unlikely]] default:
+                {
+                    reader.failed = true;
+                    return;
+                }
+            }
+
+            sec.imports.push_back_unchecked(imp);
+        }
+
+        for(auto& desc: sec.importdesc) { details::snapshot_read_desc(reader, desc, sec.imports); }
+    }
+
+    //////////////////////////////
+    /// @brief function section ///
+    //////////////////////////////
+
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+    inline void define_binfmt_ver1_snapshot_write(::uwvm2::parser::wasm::concepts::feature_reserve_type_t<function_section_storage_t>,
+                                                  ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...> const& module_storage,
+                                                  ::uwvm2::parser::wasm::binfmt::snapshot_writer_t& writer) noexcept
+    {
+        using vectypeidx_minimize_storage_mode = ::uwvm2::parser::wasm::standard::wasm1::features::vectypeidx_minimize_storage_mode;
+
+        auto const& sec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<function_section_storage_t>(module_storage.sections)};
+
+        details::snapshot_write_section_span(writer, sec.sec_span);
+
+        writer.write(sec.funcs.mode);
+
+        switch(sec.funcs.mode)
+        {
+            case vectypeidx_minimize_storage_mode::null:
+            {
+                break;
+            }
+            case vectypeidx_minimize_storage_mode::u8_view:
+            {
+                writer.write_module_ptr(sec.funcs.storage.typeidx_u8_view.begin);
+                writer.write_module_ptr(sec.funcs.storage.typeidx_u8_view.end);
+                break;
+            }
+            case vectypeidx_minimize_storage_mode::u8_vector:
+            {
+                writer.write_array(sec.funcs.storage.typeidx_u8_vector.data(), sec.funcs.storage.typeidx_u8_vector.size());
+                break;
+            }
+            case vectypeidx_minimize_storage_mode::u16_vector:
+            {
+                writer.write_array(sec.funcs.storage.typeidx_u16_vector.data(), sec.funcs.storage.typeidx_u16_vector.size());
+                break;
+            }
+            case vectypeidx_minimize_storage_mode::u32_vector:
+            {
+                writer.write_array(sec.funcs.storage.typeidx_u32_vector.data(), sec.funcs.storage.typeidx_u32_vector.size());
+                break;
+            }
+            [[unlikely]] default:
+            {
+                ::fast_io::fast_terminate();
+            }
+        }
+    }
+
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+    inline void define_binfmt_ver1_snapshot_read(::uwvm2::parser::wasm::concepts::feature_reserve_type_t<function_section_storage_t>,
+                                                 ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...>& module_storage,
+                                                 ::uwvm2::parser::wasm::binfmt::snapshot_reader_t& reader) noexcept
+    {
+        using vectypeidx_minimize_storage_mode = ::uwvm2::parser::wasm::standard::wasm1::features::vectypeidx_minimize_storage_mode;
+
+        auto& sec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<function_section_storage_t>(module_storage.sections)};
+
+        sec.sec_span = details::snapshot_read_section_span(reader);
+
+        auto const mode{reader.read<vectypeidx_minimize_storage_mode>()};
+        if(reader.failed) [[unlikely]] { return; }
+
+        switch(mode)
+        {
+            case vectypeidx_minimize_storage_mode::null:
+            {
+                break;
+            }
+            case vectypeidx_minimize_storage_mode::u8_view:
+            {
+                sec.funcs.change_mode(mode);
+                sec.funcs.storage.typeidx_u8_view.begin = reader.read_module_ptr<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u8>();
+                sec.funcs.storage.typeidx_u8_view.end = reader.read_module_ptr<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u8>();
+                break;
+            }
+            case vectypeidx_minimize_storage_mode::u8_vector:
+            {
+                sec.funcs.change_mode(mode);
+                reader.read_array(sec.funcs.storage.typeidx_u8_vector);
+                break;
+            }
+            case vectypeidx_minimize_storage_mode::u16_vector:
+            {
+                sec.funcs.change_mode(mode);
+                reader.read_array(sec.funcs.storage.typeidx_u16_vector);
+                break;
+            }
+            case vectypeidx_minimize_storage_mode::u32_vector:
+            {
+                sec.funcs.change_mode(mode);
+                reader.read_array(sec.funcs.storage.typeidx_u32_vector);
+                break;
+            }
+            [[unlikely]] default:
+            {
+                reader.failed = true;
+                break;
+            }
+        }
+    }
+
+    ///////////////////////////
+    /// @brief table section ///
+    ///////////////////////////
+
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        requires (has_wasm1_snapshot_types<Fs...>)
+    inline void define_binfmt_ver1_snapshot_write(::uwvm2::parser::wasm::concepts::feature_reserve_type_t<table_section_storage_t<Fs...>>,
+                                                  ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...> const& module_storage,
+                                                  ::uwvm2::parser::wasm::binfmt::snapshot_writer_t& writer) noexcept
+    {
+        auto const& sec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<table_section_storage_t<Fs...>>(module_storage.sections)};
+
+        details::snapshot_write_section_span(writer, sec.sec_span);
+        writer.write_array(sec.tables.data(), sec.tables.size());
+    }
+
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        requires (has_wasm1_snapshot_types<Fs...>)
+    inline void define_binfmt_ver1_snapshot_read(::uwvm2::parser::wasm::concepts::feature_reserve_type_t<table_section_storage_t<Fs...>>,
+                                                 ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...>& module_storage,
+                                                 ::uwvm2::parser::wasm::binfmt::snapshot_reader_t& reader) noexcept
+    {
+        auto& sec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<table_section_storage_t<Fs...>>(module_storage.sections)};
+
+        sec.sec_span = details::snapshot_read_section_span(reader);
+        reader.read_array(sec.tables);
+    }
+
+    ////////////////////////////
+    /// @brief memory section ///
+    ////////////////////////////
+
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        requires (has_wasm1_snapshot_types<Fs...>)
+    inline void define_binfmt_ver1_snapshot_write(::uwvm2::parser::wasm::concepts::feature_reserve_type_t<memory_section_storage_t<Fs...>>,
+                                                  ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...> const& module_storage,
+                                                  ::uwvm2::parser::wasm::binfmt::snapshot_writer_t& writer) noexcept
+    {
+        auto const& sec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<memory_section_storage_t<Fs...>>(module_storage.sections)};
+
+        details::snapshot_write_section_span(writer, sec.sec_span);
+        writer.write_array(sec.memories.data(), sec.memories.size());
+    }
+
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        requires (has_wasm1_snapshot_types<Fs...>)
+    inline void define_binfmt_ver1_snapshot_read(::uwvm2::parser::wasm::concepts::feature_reserve_type_t<memory_section_storage_t<Fs...>>,
+                                                 ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...>& module_storage,
+                                                 ::uwvm2::parser::wasm::binfmt::snapshot_reader_t& reader) noexcept
+    {
+        auto& sec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<memory_section_storage_t<Fs...>>(module_storage.sections)};
+
+        sec.sec_span = details::snapshot_read_section_span(reader);
+        reader.read_array(sec.memories);
+    }
+
+    ////////////////////////////
+    /// @brief global section ///
+    ////////////////////////////
+
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        requires (has_wasm1_snapshot_types<Fs...>)
+    inline void define_binfmt_ver1_snapshot_write(::uwvm2::parser::wasm::concepts::feature_reserve_type_t<global_section_storage_t<Fs...>>,
+                                                  ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...> const& module_storage,
+                                                  ::uwvm2::parser::wasm::binfmt::snapshot_writer_t& writer) noexcept
+    {
+        auto const& sec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<global_section_storage_t<Fs...>>(module_storage.sections)};
+
+        details::snapshot_write_section_span(writer, sec.sec_span);
+
+        writer.write_size(sec.local_globals.size());
+        for(auto const& g: sec.local_globals)
+        {
+            writer.write(g.global);
+            writer.write_module_ptr(g.expr.begin);
+            writer.write_module_ptr(g.expr.end);
+        }
+    }
+
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        requires (has_wasm1_snapshot_types<Fs...>)
+    inline void define_binfmt_ver1_snapshot_read(::uwvm2::parser::wasm::concepts::feature_reserve_type_t<global_section_storage_t<Fs...>>,
+                                                 ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...>& module_storage,
+                                                 ::uwvm2::parser::wasm::binfmt::snapshot_reader_t& reader) noexcept
+    {
+        using global_type_t = ::uwvm2::parser::wasm::standard::wasm1::features::final_global_type<Fs...>;
+
+        auto& sec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<global_section_storage_t<Fs...>>(module_storage.sections)};
+
+        sec.sec_span = details::snapshot_read_section_span(reader);
+
+        auto const n{reader.read_size(sizeof(global_type_t) + 16uz)};
+        sec.local_globals.reserve(n);
+
+        for(::std::size_t i{}; i != n; ++i)
+        {
+            ::uwvm2::parser::wasm::standard::wasm1::features::final_local_global_type<Fs...> g{};
+            g.global = reader.read<global_type_t>();
+            g.expr.begin = reader.read_module_ptr<::std::byte>();
+            g.expr.end = reader.read_module_ptr<::std::byte>();
+            sec.local_globals.push_back_unchecked(g);
+        }
+    }
+
+    ////////////////////////////
+    /// @brief export section ///
+    ////////////////////////////
+
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        requires (has_wasm1_snapshot_types<Fs...>)
+    inline void define_binfmt_ver1_snapshot_write(::uwvm2::parser::wasm::concepts::feature_reserve_type_t<export_section_storage_t<Fs...>>,
+                                                  ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...> const& module_storage,
+                                                  ::uwvm2::parser::wasm::binfmt::snapshot_writer_t& writer) noexcept
+    {
+        auto const& sec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<export_section_storage_t<Fs...>>(module_storage.sections)};
+
+        details::snapshot_write_section_span(writer, sec.sec_span);
+
+        writer.write_size(sec.exports.size());
+        for(auto const& exp: sec.exports)
+        {
+            writer.write_module_string(exp.export_name);
+            // All members of the union are indices
+            writer.write(exp.exports.storage.func_idx);
+            writer.write(exp.exports.type);
+        }
+
+        for(auto const& desc: sec.exportdesc) { details::snapshot_write_desc(writer, desc, sec.exports); }
+    }
+
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        requires (has_wasm1_snapshot_types<Fs...>)
+    inline void define_binfmt_ver1_snapshot_read(::uwvm2::parser::wasm::concepts::feature_reserve_type_t<export_section_storage_t<Fs...>>,
+                                                 ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...>& module_storage,
+                                                 ::uwvm2::parser::wasm::binfmt::snapshot_reader_t& reader) noexcept
+    {
+        auto& sec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<export_section_storage_t<Fs...>>(module_storage.sections)};
+
+        sec.sec_span = details::snapshot_read_section_span(reader);
+
+        // export_name (16) + index (4) + type (1)
+        auto const n{reader.read_size(21uz)};
+
+        // exportdesc refers to the elements, the vector is never reallocated after this
+        sec.exports.reserve(n);
+
+        for(::std::size_t i{}; i != n; ++i)
+        {
+            ::uwvm2::parser::wasm::standard::wasm1::features::final_wasm_export_type<Fs...> exp{};
+            exp.export_name = reader.read_module_string();
+            exp.exports.storage.func_idx = reader.read<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>();
+            exp.exports.type = reader.read<::uwvm2::parser::wasm::standard::wasm1::type::external_types>();
+
+            if(static_cast<::std::size_t>(exp.exports.type) >= sec.exportdesc_count) [[unlikely]]
+            {
+                reader.failed = true;
+                return;
+            }
+
+            sec.exports.push_back_unchecked(exp);
+        }
+
+        for(auto& desc: sec.exportdesc) { details::snapshot_read_desc(reader, desc, sec.exports); }
+    }
+
+    ///////////////////////////
+    /// @brief start section ///
+    ///////////////////////////
+
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+    inline void define_binfmt_ver1_snapshot_write(::uwvm2::parser::wasm::concepts::feature_reserve_type_t<start_section_storage_t>,
+                                                  ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...> const& module_storage,
+                                                  ::uwvm2::parser::wasm::binfmt::snapshot_writer_t& writer) noexcept
+    {
+        auto const& sec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<start_section_storage_t>(module_storage.sections)};
+
+        details::snapshot_write_section_span(writer, sec.sec_span);
+        writer.write(sec.start_idx);
+    }
+
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+    inline void define_binfmt_ver1_snapshot_read(::uwvm2::parser::wasm::concepts::feature_reserve_type_t<start_section_storage_t>,
+                                                 ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...>& module_storage,
+                                                 ::uwvm2::parser::wasm::binfmt::snapshot_reader_t& reader) noexcept
+    {
+        auto& sec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<start_section_storage_t>(module_storage.sections)};
+
+        sec.sec_span = details::snapshot_read_section_span(reader);
+        sec.start_idx = reader.read<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>();
+    }
+
+    /////////////////////////////
+    /// @brief element section ///
+    /////////////////////////////
+
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        requires (has_wasm1_snapshot_types<Fs...>)
+    inline void define_binfmt_ver1_snapshot_write(::uwvm2::parser::wasm::concepts::feature_reserve_type_t<element_section_storage_t<Fs...>>,
+                                                  ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...> const& module_storage,
+                                                  ::uwvm2::parser::wasm::binfmt::snapshot_writer_t& writer) noexcept
+    {
+        auto const& sec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<element_section_storage_t<Fs...>>(module_storage.sections)};
+
+        details::snapshot_write_section_span(writer, sec.sec_span);
+
+        writer.write_size(sec.elems.size());
+        for(auto const& elem: sec.elems)
+        {
+            writer.write(elem.type);
+            writer.write(elem.storage.table_idx.table_idx);
+            writer.write_module_ptr(elem.storage.table_idx.expr.begin);
+            writer.write_module_ptr(elem.storage.table_idx.expr.end);
+            writer.write_array(elem.storage.table_idx.vec_funcidx.data(), elem.storage.table_idx.vec_funcidx.size());
+        }
+    }
+
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        requires (has_wasm1_snapshot_types<Fs...>)
+    inline void define_binfmt_ver1_snapshot_read(::uwvm2::parser::wasm::concepts::feature_reserve_type_t<element_section_storage_t<Fs...>>,
+                                                 ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...>& module_storage,
+                                                 ::uwvm2::parser::wasm::binfmt::snapshot_reader_t& reader) noexcept
+    {
+        auto& sec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<element_section_storage_t<Fs...>>(module_storage.sections)};
+
+        sec.sec_span = details::snapshot_read_section_span(reader);
+
+        // type (4) + table_idx (4) + expr (16) + size of vec_funcidx (8)
+        auto const n{reader.read_size(32uz)};
+        sec.elems.reserve(n);
+
+        for(::std::size_t i{}; i != n && !reader.failed; ++i)
+        {
+            auto& elem{sec.elems.emplace_back_unchecked()};
+            elem.type = reader.read<::uwvm2::parser::wasm::standard::wasm1::features::wasm1_element_type_t>();
+            elem.storage.table_idx.table_idx = reader.read<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>();
+            elem.storage.table_idx.expr.begin = reader.read_module_ptr<::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte>();
+            elem.storage.table_idx.expr.end = reader.read_module_ptr<::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte>();
+            reader.read_array(elem.storage.table_idx.vec_funcidx);
+        }
+    }
+
+    //////////////////////////
+    /// @brief code section ///
+    //////////////////////////
+
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        requires (has_wasm1_snapshot_types<Fs...>)
+    inline void define_binfmt_ver1_snapshot_write(::uwvm2::parser::wasm::concepts::feature_reserve_type_t<code_section_storage_t<Fs...>>,
+                                                  ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...> const& module_storage,
+                                                  ::uwvm2::parser::wasm::binfmt::snapshot_writer_t& writer) noexcept
+    {
+        auto const& sec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<code_section_storage_t<Fs...>>(module_storage.sections)};
+
+        details::snapshot_write_section_span(writer, sec.sec_span);
+
+        writer.write_size(sec.codes.size());
+        for(auto const& code: sec.codes)
+        {
+            // expr_begin is null for bodies whose locals are not decoded yet (lazy mode), they stay lazy after restoring
+            writer.write_module_ptr(code.body.code_begin);
+            writer.write_module_ptr(code.body.expr_begin);
+            writer.write_module_ptr(code.body.code_end);
+            writer.write_array(code.locals.data(), code.locals.size());
+            writer.write(code.all_local_count);
+            writer.write(code.metadata);
+        }
+
+        writer.write_size(sec.branch_targets.size());
+        for(auto const& bt: sec.branch_targets)
+        {
+            writer.write_module_ptr(bt.instr);
+            writer.write_module_ptr(bt.target);
+        }
+    }
+
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        requires (has_wasm1_snapshot_types<Fs...>)
+    inline void define_binfmt_ver1_snapshot_read(::uwvm2::parser::wasm::concepts::feature_reserve_type_t<code_section_storage_t<Fs...>>,
+                                                 ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...>& module_storage,
+                                                 ::uwvm2::parser::wasm::binfmt::snapshot_reader_t& reader) noexcept
+    {
+        using wasm_byte = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte;
+        using local_entry_t = ::uwvm2::parser::wasm::standard::wasm1::features::final_local_entry_t<Fs...>;
+        using metadata_t = ::uwvm2::parser::wasm::standard::wasm1::features::wasm1_code_metadata_t;
+
+        auto& sec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<code_section_storage_t<Fs...>>(module_storage.sections)};
+
+        sec.sec_span = details::snapshot_read_section_span(reader);
+
+        // body (24) + size of locals (8) + all_local_count (4) + metadata
+        auto const n{reader.read_size(36uz + sizeof(metadata_t))};
+        sec.codes.reserve(n);
+
+        for(::std::size_t i{}; i != n && !reader.failed; ++i)
+        {
+            ::uwvm2::parser::wasm::standard::wasm1::features::final_wasm_code_t<Fs...> code{};
+            code.body.code_begin = reader.read_module_ptr<wasm_byte>();
+            code.body.expr_begin = reader.read_module_ptr<wasm_byte>();
+            code.body.code_end = reader.read_module_ptr<wasm_byte>();
+
+            // The locals are allocated from the arena of the restored storage, like the parser does
+            auto const local_count{reader.read_size(sizeof(local_entry_t))};
+            code.locals.reserve(module_storage.arena, local_count);
+            if(reader.read_bytes(code.locals.data(), local_count * sizeof(local_entry_t))) { code.locals.curr_ptr = code.locals.begin_ptr + local_count; }
+
+            code.all_local_count = reader.read<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>();
+            code.metadata = reader.read<metadata_t>();
+            sec.codes.push_back_unchecked(code);
+        }
+
+        // instr (8) + target (8)
+        auto const bt_n{reader.read_size(16uz)};
+        sec.branch_targets.reserve(bt_n);
+
+        for(::std::size_t i{}; i != bt_n; ++i)
+        {
+            ::uwvm2::parser::wasm::standard::wasm1::features::wasm1_code_branch_target_t bt{};
+            bt.instr = reader.read_module_ptr<wasm_byte>();
+            bt.target = reader.read_module_ptr<wasm_byte>();
+            sec.branch_targets.push_back_unchecked(bt);
+        }
+
+        // Users index branch_targets with the metadata without checking
+        for(auto const& code: sec.codes)
+        {
+            if(code.metadata.branch_target_count > bt_n || code.metadata.branch_target_begin > bt_n - code.metadata.branch_target_count) [[unlikely]]
+            {
+                reader.failed = true;
+                return;
+            }
+        }
+    }
+
+    //////////////////////////
+    /// @brief data section ///
+    //////////////////////////
+
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        requires (has_wasm1_snapshot_types<Fs...>)
+    inline void define_binfmt_ver1_snapshot_write(::uwvm2::parser::wasm::concepts::feature_reserve_type_t<data_section_storage_t<Fs...>>,
+                                                  ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...> const& module_storage,
+                                                  ::uwvm2::parser::wasm::binfmt::snapshot_writer_t& writer) noexcept
+    {
+        auto const& sec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<data_section_storage_t<Fs...>>(module_storage.sections)};
+
+        details::snapshot_write_section_span(writer, sec.sec_span);
+
+        writer.write_size(sec.datas.size());
+        for(auto const& data: sec.datas)
+        {
+            writer.write(data.type);
+            writer.write(data.storage.memory_idx.memory_idx);
+            writer.write_module_ptr(data.storage.memory_idx.expr.begin);
+            writer.write_module_ptr(data.storage.memory_idx.expr.end);
+            writer.write_module_ptr(data.storage.memory_idx.byte.begin);
+            writer.write_module_ptr(data.storage.memory_idx.byte.end);
+        }
+    }
+
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        requires (has_wasm1_snapshot_types<Fs...>)
+    inline void define_binfmt_ver1_snapshot_read(::uwvm2::parser::wasm::concepts::feature_reserve_type_t<data_section_storage_t<Fs...>>,
+                                                 ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...>& module_storage,
+                                                 ::uwvm2::parser::wasm::binfmt::snapshot_reader_t& reader) noexcept
+    {
+        using wasm_byte = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte;
+
+        auto& sec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<data_section_storage_t<Fs...>>(module_storage.sections)};
+
+        sec.sec_span = details::snapshot_read_section_span(reader);
+
+        // type (4) + memory_idx (4) + expr (16) + byte (16)
+        auto const n{reader.read_size(40uz)};
+        sec.datas.reserve(n);
+
+        for(::std::size_t i{}; i != n; ++i)
+        {
+            ::uwvm2::parser::wasm::standard::wasm1::features::wasm1_data_t<Fs...> data{};
+            data.type = reader.read<::uwvm2::parser::wasm::standard::wasm1::features::wasm1_data_type_t>();
+            data.storage.memory_idx.memory_idx = reader.read<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>();
+            data.storage.memory_idx.expr.begin = reader.read_module_ptr<wasm_byte>();
+            data.storage.memory_idx.expr.end = reader.read_module_ptr<wasm_byte>();
+            data.storage.memory_idx.byte.begin = reader.read_module_ptr<wasm_byte>();
+            data.storage.memory_idx.byte.end = reader.read_module_ptr<wasm_byte>();
+            sec.datas.push_back_unchecked(data);
+        }
+    }
+}  // namespace uwvm2::parser::wasm::standard::wasm1::features
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
@@ -29,7 +29,7 @@ module;
 #include <concepts>
 #include <type_traits>
 #include <utility>
-#include <map>  /// @todo use fast_io::string_hashmap instead
+#include <algorithm>
 // macro
 #include <uwvm2/utils/macro/push_macros.h>
 
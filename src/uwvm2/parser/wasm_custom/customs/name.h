@@ -39,7 +39,7 @@ import uwvm2.parser.wasm.standard;
 # include <concepts>
 # include <type_traits>
 # include <utility>
-# include <map>  /// @todo use fast_io::string_hashmap instead
+# include <algorithm>
 // macro
 # include <uwvm2/utils/macro/push_macros.h>
 // import
@@ -62,15 +62,123 @@ import uwvm2.parser.wasm.standard;
 
 UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm_custom::customs
 {
+    /// @brief Entry of a name map (index, name), the name is a view into the module
+    struct name_assoc_t
+    {
+        ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 index{};
+        ::fast_io::u8string_view name{};
+        // position of the index in the module, a duplicate is reported here
+        ::std::byte const* index_ptr{};
+    };
+
+    /// @brief Local names of one function: [local_begin, local_end) of name_storage_t::code_local_name_entries
+    struct name_local_range_t
+    {
+        ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 function_index{};
+        ::std::size_t local_begin{};
+        ::std::size_t local_end{};
+        // position of the function index in the module, a duplicate is reported here
+        ::std::byte const* function_index_ptr{};
+    };
+
+    /// @brief      Flat storage of the name section
+    /// @details    The name maps are stored as vectors sorted by index. The spec requires ascending indices, so every entry is appended in O(1) and
+    ///             looked up by binary search. Entries out of order are still accepted: a map that was not in order is stable-sorted once at the end of
+    ///             its subsection, so the first entry of an index wins and later ones are reported as duplicates. Either way a duplicate is reported at
+    ///             its index and skipped, the rest of the map is still parsed. The local names of all functions share one contiguous array (CSR),
+    ///             code_local_name only records the range of each function.
+    ///             A vector indexed directly by function index is not used, because the indices are not bounded by the size of the section.
     struct name_storage_t
     {
         ::fast_io::u8string_view module_name{};
-        ::std::map<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32, ::fast_io::u8string_view> function_name{};
-        ::std::map<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32,
-                   ::std::map<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32, ::fast_io::u8string_view>>
-            code_local_name{};
+        // sorted by function index
+        ::fast_io::vector<name_assoc_t> function_name{};
+        // sorted by function index
+        ::fast_io::vector<name_local_range_t> code_local_name{};
+        // each range is sorted by local index
+        ::fast_io::vector<name_assoc_t> code_local_name_entries{};
     };
 
+    namespace details
+    {
+        /// @brief Binary search in the sorted range [first, last), returns the first entry whose index is not less than index
+        template <typename T, typename GetIndex>
+        inline constexpr T const*
+            name_lower_bound(T const* first, T const* last, ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 index, GetIndex get_index) noexcept
+        {
+            auto len{static_cast<::std::size_t>(last - first)};
+            while(len != 0uz)
+            {
+                auto const half{len / 2uz};
+                if(get_index(first[half]) < index)
+                {
+                    first += half + 1uz;
+                    len -= half + 1uz;
+                }
+                else
+                {
+                    len = half;
+                }
+            }
+            return first;
+        }
+
+        /// @brief  Stable-sort vec[begin, size()) by index after entries were appended out of order, then remove every entry whose index is already
+        ///         present (the first one in the input is kept) and pass it to report
+        /// @note   O(n log n) once per map, instead of an insertion in place per entry out of order
+        template <typename T, typename GetIndex, typename Report>
+        inline void name_sort_unique(::fast_io::vector<T>& vec, ::std::size_t begin, GetIndex get_index, Report report) noexcept
+        {
+            auto const first{vec.begin() + begin};
+            auto const last{vec.end()};
+            ::std::ranges::stable_sort(first, last, {}, get_index);
+
+            auto out{first};
+            for(auto in{first}; in != last; ++in)
+            {
+                if(out != first && get_index(out[-1]) == get_index(*in)) [[unlikely]]
+                {
+                    report(*in);
+                    continue;
+                }
+                *out++ = *in;
+            }
+
+            vec.resize(static_cast<::std::size_t>(out - vec.begin()));
+        }
+    }  // namespace details
+
+    /// @brief Name of the function, empty if not named (a name cannot be empty)
+    inline constexpr ::fast_io::u8string_view find_function_name(name_storage_t const& ns,
+                                                                 ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 function_index) noexcept
+    {
+        auto const last{ns.function_name.cend()};
+        auto const pos{details::name_lower_bound(ns.function_name.cbegin(),
+                                                 last,
+                                                 function_index,
+                                                 [](name_assoc_t const& e) constexpr noexcept { return e.index; })};
+        return pos != last && pos->index == function_index ? pos->name : ::fast_io::u8string_view{};
+    }
+
+    /// @brief Name of the local of the function, empty if not named (a name cannot be empty)
+    inline constexpr ::fast_io::u8string_view find_code_local_name(name_storage_t const& ns,
+                                                                   ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 function_index,
+                                                                   ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 local_index) noexcept
+    {
+        auto const ranges_last{ns.code_local_name.cend()};
+        auto const range{details::name_lower_bound(ns.code_local_name.cbegin(),
+                                                   ranges_last,
+                                                   function_index,
+                                                   [](name_local_range_t const& e) constexpr noexcept { return e.function_index; })};
+        if(range == ranges_last || range->function_index != function_index) { return {}; }
+
+        auto const entries{ns.code_local_name_entries.cbegin()};
+        auto const last{entries + range->local_end};
+        auto const pos{
+            details::name_lower_bound(entries + range->local_begin, last, local_index, [](name_assoc_t const& e) constexpr noexcept { return e.index; })};
+        return pos != last && pos->index == local_index ? pos->name : ::fast_io::u8string_view{};
+    }
+
     enum class name_err_type_t : unsigned
     {
         invalid_name_map_length,
@@ -427,7 +535,16 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm_custom::customs
                     // [       safe        ] unsafe (could be the map_end)
                     //                       ^^ curr
 
+                    // Each name takes at least 3 bytes (func_idx, name_len, name), name_count is not trusted beyond that
+                    {
+                        constexpr ::std::size_t min_assoc_size{3uz};
+                        auto const max_name_count{static_cast<::std::size_t>(map_end - curr) / min_assoc_size};
+                        ns.function_name.reserve(static_cast<::std::size_t>(name_count) < max_name_count ? static_cast<::std::size_t>(name_count)
+                                                                                                          : max_name_count);
+                    }
+
                     bool ct_1{};
+                    bool function_name_sorted{true};
 
                     for(::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 name_counter{}; name_counter != name_count; ++name_counter)
                     {
@@ -554,12 +671,20 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm_custom::customs
 
                         // Subsequent parsing will not directly skip the parsing of this map.
 
-                        if(ns.function_name.contains(func_index)) [[unlikely]]
+                        // Ascending order (spec) only needs the last entry, a map out of order is checked for duplicates when it is sorted
+
+                        if(!ns.function_name.empty()) [[likely]]
                         {
-                            err.emplace_back(func_index_ptr, name_err_type_t::duplicate_func_idx, name_err_storage_t{.u32 = func_index});
-                            curr = map_end;
-                            // End of current paragraph
-                            continue;
+                            auto const last_func_index{ns.function_name.back_unchecked().index};
+
+                            if(last_func_index == func_index) [[unlikely]]
+                            {
+                                err.emplace_back(func_index_ptr, name_err_type_t::duplicate_func_idx, name_err_storage_t{.u32 = func_index});
+                                // End of current paragraph
+                                continue;
+                            }
+
+                            if(last_func_index > func_index) [[unlikely]] { function_name_sorted = false; }
                         }
 
                         // Check if it is legal utf-8
@@ -579,7 +704,19 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm_custom::customs
                             continue;
                         }
 
-                        ns.function_name.emplace(func_index, func_name_tmp);
+                        ns.function_name.push_back(name_assoc_t{func_index, func_name_tmp, func_index_ptr});
+                    }
+
+                    if(!function_name_sorted) [[unlikely]]
+                    {
+                        // The duplicate is reported at its index
+                        details::name_sort_unique(ns.function_name,
+                                                  0uz,
+                                                  [](name_assoc_t const& e) constexpr noexcept { return e.index; },
+                                                  [&err](name_assoc_t const& e) constexpr noexcept
+                                                  {
+                                                      err.emplace_back(e.index_ptr, name_err_type_t::duplicate_func_idx, name_err_storage_t{.u32 = e.index});
+                                                  });
                     }
 
                     if(ct_1) [[unlikely]]
@@ -654,6 +791,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm_custom::customs
                     //                        ^^ curr
 
                     bool ct_1{};
+                    bool code_local_name_sorted{true};
 
                     for(::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 local_counter{}; local_counter != local_count; ++local_counter)
                     {
@@ -728,9 +866,11 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm_custom::customs
                         // [                      safe                      ] unsafe (could be the map_end)
                         //                                                    ^^ curr
 
-                        ::std::map<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32, ::fast_io::u8string_view> ns_code_local_name_function_index{};
+                        // The local names of this function are appended to the shared array, discarded if the function is not stored
+                        auto const local_begin{ns.code_local_name_entries.size()};
 
                         bool ct_2{};
+                        bool local_names_sorted{true};
 
                         for(::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 function_local_counter{}; function_local_counter != function_local_count;
                             ++function_local_counter)
@@ -857,14 +997,22 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm_custom::customs
 
                             // Subsequent parsing will not directly skip the parsing of this map.
 
-                            if(ns_code_local_name_function_index.contains(function_local_index)) [[unlikely]]
+                            // Ascending order (spec) only needs the last entry, names out of order are checked for duplicates when they are sorted
+
+                            if(ns.code_local_name_entries.size() != local_begin) [[likely]]
                             {
-                                err.emplace_back(function_local_index_ptr,
-                                                 name_err_type_t::duplicate_code_local_name_function_index,
-                                                 name_err_storage_t{.u32 = function_local_index});
-                                curr = map_end;
-                                // End of current paragraph
-                                continue;
+                                auto const last_local_index{ns.code_local_name_entries.back_unchecked().index};
+
+                                if(last_local_index == function_local_index) [[unlikely]]
+                                {
+                                    err.emplace_back(function_local_index_ptr,
+                                                     name_err_type_t::duplicate_code_local_name_function_index,
+                                                     name_err_storage_t{.u32 = function_local_index});
+                                    // End of current paragraph
+                                    continue;
+                                }
+
+                                if(last_local_index > function_local_index) [[unlikely]] { local_names_sorted = false; }
                             }
 
                             // Check if it is legal utf-8
@@ -884,26 +1032,67 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm_custom::customs
                                 continue;
                             }
 
-                            ns_code_local_name_function_index.emplace(function_local_index, function_local_name_begin_tmp);
+                            ns.code_local_name_entries.push_back(name_assoc_t{function_local_index, function_local_name_begin_tmp, function_local_index_ptr});
                         }
 
                         if(ct_2) [[unlikely]]
                         {
+                            ns.code_local_name_entries.resize(local_begin);
                             ct_1 = true;
                             break;
                         }
 
+                        if(!local_names_sorted) [[unlikely]]
+                        {
+                            // The duplicate is reported at its index
+                            details::name_sort_unique(ns.code_local_name_entries,
+                                                      local_begin,
+                                                      [](name_assoc_t const& e) constexpr noexcept { return e.index; },
+                                                      [&err](name_assoc_t const& e) constexpr noexcept
+                                                      {
+                                                          err.emplace_back(e.index_ptr,
+                                                                           name_err_type_t::duplicate_code_local_name_function_index,
+                                                                           name_err_storage_t{.u32 = e.index});
+                                                      });
+                        }
+
                         // Subsequent parsing will not directly skip the parsing of this map.
 
-                        if(ns.code_local_name.contains(function_index)) [[unlikely]]
+                        auto const& ranges{ns.code_local_name};
+
+                        if(!ranges.empty()) [[likely]]
                         {
-                            err.emplace_back(function_index_ptr, name_err_type_t::duplicate_code_function_index, name_err_storage_t{.u32 = function_index});
-                            curr = map_end;
-                            // End of current paragraph
-                            continue;
+                            auto const last_function_index{ranges.back_unchecked().function_index};
+
+                            if(last_function_index == function_index) [[unlikely]]
+                            {
+                                ns.code_local_name_entries.resize(local_begin);
+                                err.emplace_back(function_index_ptr,
+                                                 name_err_type_t::duplicate_code_function_index,
+                                                 name_err_storage_t{.u32 = function_index});
+                                // End of current paragraph
+                                continue;
+                            }
+
+                            // Out of order, the ranges of the entries stay where they are, only the row table is sorted
+                            if(last_function_index > function_index) [[unlikely]] { code_local_name_sorted = false; }
                         }
 
-                        ns.code_local_name.emplace(function_index, ::std::move(ns_code_local_name_function_index));
+                        ns.code_local_name.push_back(name_local_range_t{function_index, local_begin, ns.code_local_name_entries.size(), function_index_ptr});
+                    }
+
+                    if(!code_local_name_sorted) [[unlikely]]
+                    {
+                        // The entries of a dropped range stay unreferenced in code_local_name_entries. The duplicate is reported at its function index.
+                        details::name_sort_unique(ns.code_local_name,
+                                                  0uz,
+                                                  [](name_local_range_t const& e) constexpr noexcept { return e.function_index; },
+                                                  [&err](name_local_range_t const& e) constexpr noexcept
+                                                  {
+                                                      err.emplace_back(e.function_index_ptr,
+                                                                       name_err_type_t::duplicate_code_function_index,
+                                                                       name_err_storage_t{.u32 = e.function_index});
+                                                  });
                     }
 
                     if(ct_1) [[unlikely]]
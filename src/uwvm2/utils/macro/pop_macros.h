@@ -31,6 +31,8 @@
 #pragma pop_macro("UWVM_GNU_USED")
 #pragma pop_macro("UWVM_NOT_SUPPORT_SPECIAL_CHAR")
 #pragma pop_macro("UWVM_SUPPORT_INSTALL_PATH")
+#pragma pop_macro("UWVM_SUPPORT_GUARDED_LINEAR_MEMORY")
+#pragma pop_macro("UWVM_SUPPORT_MULTITHREAD")
 #pragma pop_macro("UWVM_CAN_LOAD_DL")
 #pragma pop_macro("UWVM_GNU_MAY_ALIAS")
 #pragma pop_macro("UWVM_IF_NOT_CONSTEVAL")
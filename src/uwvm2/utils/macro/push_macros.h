@@ -393,6 +393,25 @@
 # define UWVM_CAN_LOAD_DL
 #endif
 
+/// @details      Allow or disallow creating threads (std::thread),
+///               single-threaded environments (such as dos and wasi without threads) fall back to serial processing
+#pragma push_macro("UWVM_SUPPORT_MULTITHREAD")
+#undef UWVM_SUPPORT_MULTITHREAD
+#if __has_include(<thread>) && !defined(__MSDOS__) && !defined(__DJGPP__) && (!defined(__wasi__) || defined(_REENTRANT))
+# define UWVM_SUPPORT_MULTITHREAD
+#endif
+
+/// @details      Guarded linear memory: the whole wasm32 address space and a guard are reserved per memory, out-of-bounds accesses fault instead
+///               of being checked. Needs a 64-bit address space, mmap/mprotect and sigaction. Define UWVM_LINEAR_MEMORY_BOUNDS_CHECK to force the
+///               explicit bounds-check memory (address-space-constrained hosts, e.g. a limited `ulimit -v`).
+#pragma push_macro("UWVM_SUPPORT_GUARDED_LINEAR_MEMORY")
+#undef UWVM_SUPPORT_GUARDED_LINEAR_MEMORY
+#if !defined(UWVM_LINEAR_MEMORY_BOUNDS_CHECK) && !defined(_WIN32) && !defined(__CYGWIN__) && !defined(__NEWLIB__) && !defined(_PICOLIBC__) &&            \
+    !(defined(__MSDOS__) || defined(__DJGPP__)) && !defined(__wasm__) && (defined(__SIZEOF_POINTER__) && __SIZEOF_POINTER__ >= 8) &&                      \
+    __has_include(<sys/mman.h>) && __has_include(<signal.h>)
+# define UWVM_SUPPORT_GUARDED_LINEAR_MEMORY
+#endif
+
 /// @details      Determine whether the operating system supports getting the path to the program binary itself.
 #pragma push_macro("UWVM_SUPPORT_INSTALL_PATH")
 #undef UWVM_SUPPORT_INSTALL_PATH
@@ -71,7 +71,10 @@ UWVM_MODULE_EXPORT namespace uwvm2::utils::madvise
         autosync,
         nocore,
         core,
-        protect
+        protect,
+        hugepage,
+        nohugepage,
+        populate_read
 #else
 # ifdef MADV_NORMAL
         normal = MADV_NORMAL
@@ -137,6 +140,26 @@ UWVM_MODULE_EXPORT namespace uwvm2::utils::madvise
         protect = MADV_PROTECT
 # else
         protect = -1
+# endif
+        ,
+# ifdef MADV_HUGEPAGE
+        hugepage = MADV_HUGEPAGE
+# else
+        hugepage = -1
+# endif
+        ,
+# ifdef MADV_NOHUGEPAGE
+        nohugepage = MADV_NOHUGEPAGE
+# else
+        nohugepage = -1
+# endif
+        ,
+# if defined(MADV_POPULATE_READ)
+        populate_read = MADV_POPULATE_READ
+# elif defined(__linux__)
+        populate_read = 22  // linux 5.14, not yet in older headers
+# else
+        populate_read = -1
 # endif
 #endif
     };
@@ -144,6 +167,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::utils::madvise
     /// @brief      madvise
     /// @details    Instructs the system to mmap Instructs the system to specify memory operations for mmap
     ///             No exception is thrown because this is an instructional message, not a command.
+    ///             Flags the system does not know (-1, or populate_read on kernels before 5.14) are rejected by the system and have no effect.
     inline void my_madvise([[maybe_unused]] void const* addr, [[maybe_unused]] ::std::size_t length, [[maybe_unused]] madvise_flag flag) noexcept
     {
 #if defined(_WIN32)
@@ -151,6 +175,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::utils::madvise
         // win10
         switch(flag)
         {
+            // There is no synchronous prefault, prefetch instead
+            case madvise_flag::populate_read: [[fallthrough]];
             case madvise_flag::willneed:
             {
                 // "va" will not be modified, the pass parameter requires
@@ -204,6 +230,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::utils::madvise
         // win8
         switch(flag)
         {
+            // There is no synchronous prefault, prefetch instead
+            case madvise_flag::populate_read: [[fallthrough]];
             case madvise_flag::willneed:
             {
                 // "va" will not be modified, the pass parameter requires
@@ -56,6 +56,12 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::cmdline
             // wasm
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasm_set_main_module_name),
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasm_preload_library),
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::wasm_parse_threads),
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::wasm_lazy_locals),
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::wasm_validate_code),
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::wasm_snapshot_cache),
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::wasm_preload_link_scan),
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::wasm_file_advice),
 #if (defined(_WIN32) || defined(__CYGWIN__)) && (!defined(__CYGWIN__) && !defined(__WINE__)) ||                                                                \
     ((!defined(_WIN32) || defined(__WINE__)) && (__has_include(<dlfcn.h>) && (defined(__CYGWIN__) || (!defined(__NEWLIB__) && !defined(__wasi__)))))
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasm_register_dl),
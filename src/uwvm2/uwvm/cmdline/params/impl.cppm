@@ -37,6 +37,12 @@ export import :debug_test;
 // wasm
 export import :wasm_set_main_module_name;
 export import :wasm_preload_library;
+export import :wasm_parse_threads;
+export import :wasm_lazy_locals;
+export import :wasm_validate_code;
+export import :wasm_snapshot_cache;
+export import :wasm_preload_link_scan;
+export import :wasm_file_advice;
 #if (defined(_WIN32) || defined(__CYGWIN__)) && (!defined(__CYGWIN__) && !defined(__WINE__)) ||                                                                \
     ((!defined(_WIN32) || defined(__WINE__)) && (__has_include(<dlfcn.h>) && (defined(__CYGWIN__) || (!defined(__NEWLIB__) && !defined(__wasi__)))))
 export import :wasm_register_dl;
@@ -37,6 +37,12 @@
 // wasm
 # include "wasm_set_main_module_name.h"
 # include "wasm_preload_library.h"
+# include "wasm_parse_threads.h"
+# include "wasm_lazy_locals.h"
+# include "wasm_validate_code.h"
+# include "wasm_snapshot_cache.h"
+# include "wasm_preload_link_scan.h"
+# include "wasm_file_advice.h"
 # if (defined(_WIN32) || defined(__CYGWIN__)) && (!defined(__CYGWIN__) && !defined(__WINE__)) ||                                                               \
      ((!defined(_WIN32) || defined(__WINE__)) && (__has_include(<dlfcn.h>) && (defined(__CYGWIN__) || (!defined(__NEWLIB__) && !defined(__wasi__)))))
 #  include "wasm_register_dl.h"
@@ -0,0 +1,62 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2025-07-16
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+// macro
+#include <uwvm2/utils/macro/push_macros.h>
+#include <uwvm2/uwvm/utils/ansies/uwvm_color_push_macro.h>
+// import
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.utils.cmdline;
+import uwvm2.parser.wasm.concepts;
+import uwvm2.parser.wasm.standard.wasm1.features;
+import uwvm2.uwvm.cmdline;
+import uwvm2.uwvm.wasm.storage;
+#else
+# include <fast_io.h>
+# include <uwvm2/utils/cmdline/impl.h>
+# include <uwvm2/parser/wasm/concepts/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/features/impl.h>
+# include <uwvm2/uwvm/cmdline/impl.h>
+# include <uwvm2/uwvm/wasm/storage/impl.h>
+#endif
+
+namespace uwvm2::uwvm::cmdline::params::details
+{
+    UWVM_GNU_COLD extern ::uwvm2::utils::cmdline::parameter_return_type
+        wasm_lazy_locals_callback([[maybe_unused]] ::uwvm2::utils::cmdline::parameter_parsing_results* para_begin,
+                                  [[maybe_unused]] ::uwvm2::utils::cmdline::parameter_parsing_results* para_curr,
+                                  [[maybe_unused]] ::uwvm2::utils::cmdline::parameter_parsing_results* para_end) noexcept
+    {
+        // Parameters are shared by all wasm files loaded later (execute wasm and preloaded wasm)
+        ::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<::uwvm2::parser::wasm::standard::wasm1::features::wasm1_feature_parameter_t>(
+            ::uwvm2::uwvm::wasm::storage::wasm_parameter.binfmt1_para.parameters)
+            .code_section_lazy_locals = true;
+
+        return ::uwvm2::utils::cmdline::parameter_return_type::def;
+    }
+
+}  // namespace uwvm2::uwvm::cmdline::params::details
+
+// macro
+#include <uwvm2/uwvm/utils/ansies/uwvm_color_pop_macro.h>
+#include <uwvm2/utils/macro/pop_macros.h>
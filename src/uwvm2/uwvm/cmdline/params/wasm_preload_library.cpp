@@ -30,22 +30,24 @@
 import fast_io;
 import uwvm2.utils.ansies;
 import uwvm2.utils.cmdline;
+import uwvm2.parser.wasm.concepts;
+import uwvm2.parser.wasm.standard.wasm1.features;
 import uwvm2.uwvm.io;
 import uwvm2.uwvm.utils.ansies;
 import uwvm2.uwvm.cmdline;
 import uwvm2.uwvm.wasm.base;
 import uwvm2.uwvm.wasm.storage;
-import uwvm2.uwvm.wasm.loader;
 #else
 # include <fast_io.h>
 # include <uwvm2/utils/ansies/impl.h>
 # include <uwvm2/utils/cmdline/impl.h>
+# include <uwvm2/parser/wasm/concepts/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/features/impl.h>
 # include <uwvm2/uwvm/io/impl.h>
 # include <uwvm2/uwvm/utils/ansies/impl.h>
 # include <uwvm2/uwvm/cmdline/impl.h>
 # include <uwvm2/uwvm/wasm/base/impl.h>
 # include <uwvm2/uwvm/wasm/storage/impl.h>
-# include <uwvm2/uwvm/wasm/loader/impl.h>
 #endif
 
 namespace uwvm2::uwvm::cmdline::params::details
@@ -121,23 +123,19 @@ namespace uwvm2::uwvm::cmdline::params::details
             rename_module_name = ::fast_io::u8string_view{currp2_str};
         }
 
-        auto& new_preloaded_wasm{::uwvm2::uwvm::wasm::storage::preloaded_wasm.emplace_back()};
+        auto preload_wasm_parameter{::uwvm2::uwvm::wasm::storage::wasm_parameter};
 
-        auto const load_wasm_file_rtl{
-            ::uwvm2::uwvm::wasm::loader::load_wasm_file(new_preloaded_wasm, file_name, rename_module_name, ::uwvm2::uwvm::wasm::storage::wasm_parameter)};
-
-        switch(load_wasm_file_rtl)
+        // --wasm-preload-link-scan: the element, code and data sections are parsed in load_and_check_modules
+        if(::uwvm2::uwvm::wasm::storage::wasm_preload_link_scan)
         {
-            [[likely]] case ::uwvm2::uwvm::wasm::loader::load_wasm_file_rtl::ok:
-            {
-                break;
-            }
-            [[unlikely]] default:
-            {
-                return ::uwvm2::utils::cmdline::parameter_return_type::return_m1_imme;
-            }
+            ::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<::uwvm2::parser::wasm::standard::wasm1::features::wasm1_feature_parameter_t>(
+                preload_wasm_parameter.binfmt1_para.parameters)
+                .link_scan_only = true;
         }
 
+        // The files are loaded concurrently by load_preloaded_wasm_files, the diagnostics are printed in command line order
+        ::uwvm2::uwvm::wasm::storage::preloaded_wasm_queue.push_back({file_name, rename_module_name, preload_wasm_parameter});
+
         return ::uwvm2::utils::cmdline::parameter_return_type::def;
     }
 
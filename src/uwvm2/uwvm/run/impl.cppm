@@ -24,6 +24,7 @@ module;
 
 export module uwvm2.uwvm.run;
 export import :retval;
+export import :link_modules;
 export import :load_and_check_modules;
 export import :run;
 
@@ -24,6 +24,7 @@
 
 #ifndef UWVM_MODULE
 # include "retval.h"
+# include "link_modules.h"
 # include "load_and_check_modules.h"
 # include "run.h"
 #endif
@@ -0,0 +1,257 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2025-07-20
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.uwvm.io;
+import uwvm2.utils.ansies;
+# if defined(UWVM_TIMER) || ((defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK))
+import uwvm2.utils.debug;
+# endif
+import uwvm2.utils.madvise;
+import uwvm2.parser.wasm.base;
+import uwvm2.parser.wasm.concepts;
+import uwvm2.parser.wasm.standard;
+import uwvm2.parser.wasm.binfmt.base;
+import uwvm2.uwvm.utils.ansies;
+import uwvm2.uwvm.utils.memory;
+import uwvm2.uwvm.cmdline;
+import uwvm2.uwvm.wasm;
+import :retval;
+#else
+// std
+# include <cstddef>
+# include <cstdint>
+# include <type_traits>
+# include <utility>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+# include <uwvm2/uwvm/utils/ansies/uwvm_color_push_macro.h>
+// import
+# include <fast_io.h>
+# include <uwvm2/uwvm/io/impl.h>
+# include <uwvm2/utils/ansies/impl.h>
+# if defined(UWVM_TIMER) || ((defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK))
+#  include <uwvm2/utils/debug/impl.h>
+# endif
+# include <uwvm2/utils/madvise/impl.h>
+# include <uwvm2/parser/wasm/base/impl.h>
+# include <uwvm2/parser/wasm/concepts/impl.h>
+# include <uwvm2/parser/wasm/standard/impl.h>
+# include <uwvm2/parser/wasm/binfmt/base/impl.h>
+# include <uwvm2/uwvm/utils/ansies/impl.h>
+# include <uwvm2/uwvm/utils/memory/impl.h>
+# include <uwvm2/uwvm/cmdline/impl.h>
+# include <uwvm2/uwvm/wasm/impl.h>
+# include "retval.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+UWVM_MODULE_EXPORT namespace uwvm2::uwvm::run
+{
+    namespace details
+    {
+        /// @brief Key of the export index: every export of every module is unique by (module name, export name, kind), link is not part of the key
+        struct link_export_key_t
+        {
+            ::uwvm2::parser::wasm::standard::wasm1::features::import_name_key name{};
+            ::uwvm2::uwvm::wasm::storage::import_link_t link{};
+        };
+
+        inline constexpr bool operator== (link_export_key_t const& k1, link_export_key_t const& k2) noexcept { return k1.name == k2.name; }
+
+        inline ::std::uint_least64_t hash_name_key(link_export_key_t const& key) noexcept
+        {
+            return ::uwvm2::parser::wasm::standard::wasm1::features::hash_name_key(key.name);
+        }
+
+        /// @brief The names are views into the modules, nothing is copied
+        using link_export_index_t = ::uwvm2::parser::wasm::standard::wasm1::features::name_hash_set_t<link_export_key_t>;
+
+        template <typename... Fs>
+        inline auto const& get_import_section(::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...> const& module_storage) noexcept
+        {
+            return ::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<
+                ::uwvm2::parser::wasm::standard::wasm1::features::import_section_storage_t<Fs...>>(module_storage.sections);
+        }
+
+        template <typename... Fs>
+        inline auto const& get_export_section(::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...> const& module_storage) noexcept
+        {
+            return ::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<
+                ::uwvm2::parser::wasm::standard::wasm1::features::export_section_storage_t<Fs...>>(module_storage.sections);
+        }
+
+        /// @brief The wasm file of a module, nullptr if it is not a binfmt ver1 wasm module
+        inline ::uwvm2::uwvm::wasm::type::wasm_file_t const* get_binfmt_ver1_wasm_file(::uwvm2::uwvm::wasm::storage::all_module_t const& mod) noexcept
+        {
+            switch(mod.type)
+            {
+                case ::uwvm2::uwvm::wasm::storage::module_type_t::exec_wasm: [[fallthrough]];
+                case ::uwvm2::uwvm::wasm::storage::module_type_t::preloaded_wasm:
+                {
+                    auto const wf{mod.module_storage_ptr.wf};
+                    return wf->binfmt_ver == 1u ? wf : nullptr;
+                }
+                [[unlikely]] default:
+                {
+                    return nullptr;
+                }
+            }
+        }
+    }  // namespace details
+
+    /// @brief      Bind every import of every module to an export, in one pass over the imports
+    /// @details    One hash index is built over the exports of all registered modules (all_module), every import is then looked up by (module name,
+    ///             import name, kind) and stored in import_links. Link time is linear in the number of imports and exports, the only allocations are the
+    ///             index and import_links, both sized up front.
+    ///             An import of a module that is not loaded stays unresolved (the host modules are not registered yet). An import of a loaded module
+    ///             that does not export the name with the same kind is an error.
+    /// @note       Only the kinds are matched here, the types of the imports are checked on instantiation.
+    inline int link_modules() noexcept
+    {
+        auto& all_module{::uwvm2::uwvm::wasm::storage::all_module};
+        auto& import_links{::uwvm2::uwvm::wasm::storage::import_links};
+
+        // count
+        ::std::size_t export_count{};
+        ::std::size_t import_count{};
+
+        for(auto const& curr_module: all_module)
+        {
+            if(auto const wf{details::get_binfmt_ver1_wasm_file(curr_module.second)}; wf != nullptr)
+            {
+                auto const& module_storage{wf->wasm_module_storage.wasm_binfmt_ver1_storage};
+                export_count += details::get_export_section(module_storage).exports.size();
+                import_count += details::get_import_section(module_storage).imports.size();
+            }
+#if (defined(_WIN32) || defined(__CYGWIN__)) && (!defined(__CYGWIN__) && !defined(__WINE__)) ||                                                                \
+    ((!defined(_WIN32) || defined(__WINE__)) && (__has_include(<dlfcn.h>) && (defined(__CYGWIN__) || (!defined(__NEWLIB__) && !defined(__wasi__)))))
+            else if(curr_module.second.type == ::uwvm2::uwvm::wasm::storage::module_type_t::preloaded_dl)
+            {
+                export_count += curr_module.second.module_storage_ptr.wd->wasm_dl_storage.capi_function_vec.function_size;
+            }
+#endif
+        }
+
+        // export index
+        details::link_export_index_t export_index(export_count);
+
+        for(auto const& curr_module: all_module)
+        {
+            auto const module_name{curr_module.first};
+
+            if(auto const wf{details::get_binfmt_ver1_wasm_file(curr_module.second)}; wf != nullptr)
+            {
+                // Export names are unique within a module (checked by the parser)
+                for(auto const& exp: details::get_export_section(wf->wasm_module_storage.wasm_binfmt_ver1_storage).exports)
+                {
+                    export_index.insert({.name = {{module_name, exp.export_name}, static_cast<::std::uint_least8_t>(exp.exports.type)},
+                                         .link = {.module = ::std::addressof(curr_module.second),
+                                                  .target = {.wasm_export = ::std::addressof(exp)},
+                                                  .type = ::uwvm2::uwvm::wasm::storage::import_link_type_t::wasm_export}});
+                }
+            }
+#if (defined(_WIN32) || defined(__CYGWIN__)) && (!defined(__CYGWIN__) && !defined(__WINE__)) ||                                                                \
+    ((!defined(_WIN32) || defined(__WINE__)) && (__has_include(<dlfcn.h>) && (defined(__CYGWIN__) || (!defined(__NEWLIB__) && !defined(__wasi__)))))
+            else if(curr_module.second.type == ::uwvm2::uwvm::wasm::storage::module_type_t::preloaded_dl)
+            {
+                auto const& function_vec{curr_module.second.module_storage_ptr.wd->wasm_dl_storage.capi_function_vec};
+
+                for(auto curr_func{function_vec.function_begin}, func_end{function_vec.function_begin + function_vec.function_size}; curr_func != func_end;
+                    ++curr_func)
+                {
+                    // Names provided by the dl are not checked for duplicates, the first function is used
+                    export_index.insert(
+                        {.name = {{module_name,
+                                   ::fast_io::u8string_view{reinterpret_cast<char8_t const*>(curr_func->func_name_ptr), curr_func->func_name_length}},
+                                  static_cast<::std::uint_least8_t>(::uwvm2::parser::wasm::standard::wasm1::type::external_types::func)},
+                         .link = {.module = ::std::addressof(curr_module.second),
+                                  .target = {.dl_function = curr_func},
+                                  .type = ::uwvm2::uwvm::wasm::storage::import_link_type_t::dl_function}});
+                }
+            }
+#endif
+        }
+
+        // resolve
+        import_links.clear();
+        import_links.reserve(import_count);
+
+        for(auto& curr_module: all_module)
+        {
+            curr_module.second.import_link_begin = import_links.size();
+
+            auto const wf{details::get_binfmt_ver1_wasm_file(curr_module.second)};
+            if(wf == nullptr) { continue; }
+
+            for(auto const& imp: details::get_import_section(wf->wasm_module_storage.wasm_binfmt_ver1_storage).imports)
+            {
+                if(auto const exp{export_index.find({.name = {{imp.module_name, imp.extern_name}, static_cast<::std::uint_least8_t>(imp.imports.type)}})};
+                   exp != nullptr) [[likely]]
+                {
+                    import_links.push_back_unchecked(exp->link);
+                    continue;
+                }
+
+                if(all_module.contains(imp.module_name)) [[unlikely]]
+                {
+                    ::fast_io::io::perr(::uwvm2::uwvm::u8log_output,
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                        u8"uwvm: ",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RED),
+                                        u8"[error] ",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                        u8"Module \"",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                        curr_module.first,
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                        u8"\" imports \"",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                        imp.module_name,
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                        u8"\".\"",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                        imp.extern_name,
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                        u8"\", which is not exported with the same kind.\n\n",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+                    return static_cast<int>(::uwvm2::uwvm::run::retval::unresolved_import);
+                }
+
+                import_links.push_back_unchecked({});
+            }
+        }
+
+        return static_cast<int>(::uwvm2::uwvm::run::retval::ok);
+    }
+}  // namespace uwvm2::uwvm::run
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/uwvm/utils/ansies/uwvm_color_pop_macro.h>
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
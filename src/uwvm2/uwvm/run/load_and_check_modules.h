@@ -39,6 +39,7 @@ import uwvm2.uwvm.utils.memory;
 import uwvm2.uwvm.cmdline;
 import uwvm2.uwvm.wasm;
 import :retval;
+import :link_modules;
 #else
 // std
 # include <cstddef>
@@ -65,6 +66,7 @@ import :retval;
 # include <uwvm2/uwvm/cmdline/impl.h>
 # include <uwvm2/uwvm/wasm/impl.h>
 # include "retval.h"
+# include "link_modules.h"
 #endif
 
 #ifndef UWVM_MODULE_EXPORT
@@ -88,7 +90,30 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::run
             }
         }
 
-        // preloaded wasm
+        // preloaded wasm: join the files queued by --wasm-preload-library, they are parsed concurrently
+        switch(::uwvm2::uwvm::wasm::loader::load_preloaded_wasm_files())
+        {
+            [[likely]] case ::uwvm2::uwvm::wasm::loader::load_wasm_file_rtl::ok:
+            {
+                break;
+            }
+            case ::uwvm2::uwvm::wasm::loader::load_wasm_file_rtl::load_error:
+            {
+                return static_cast<int>(::uwvm2::uwvm::run::retval::load_error);
+            }
+            case ::uwvm2::uwvm::wasm::loader::load_wasm_file_rtl::wasm_parser_error:
+            {
+                return static_cast<int>(::uwvm2::uwvm::run::retval::wasm_parser_error);
+            }
+            [[unlikely]] default:
+            {
+#if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
+                ::uwvm2::utils::debug::trap_and_inform_bug_pos();
+#endif
+                ::std::unreachable();
+            }
+        }
+
         for(auto const& lwc: ::uwvm2::uwvm::wasm::storage::preloaded_wasm)
         {
             if(::uwvm2::uwvm::wasm::storage::all_module.contains(lwc.module_name)) [[unlikely]]
@@ -169,34 +194,15 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::run
                                                            .type = ::uwvm2::uwvm::wasm::storage::module_type_t::exec_wasm});
         }
 
-        // Checking for import and export inequalities
+        // Bind the imports of all modules to the exports
+        if(auto const ret{::uwvm2::uwvm::run::link_modules()}; ret != static_cast<int>(::uwvm2::uwvm::run::retval::ok)) [[unlikely]] { return ret; }
 
-        for(auto const& curr_module: ::uwvm2::uwvm::wasm::storage::all_module)
+        // Preloaded wasm loaded in link scan mode (--wasm-preload-link-scan): the module graph has been checked, parse the remaining sections
+        for(auto& lwc: ::uwvm2::uwvm::wasm::storage::preloaded_wasm)
         {
-            switch(curr_module.second.type)
+            if(::uwvm2::uwvm::wasm::loader::complete_link_scan_wasm_file(lwc) != ::uwvm2::uwvm::wasm::loader::load_wasm_file_rtl::ok) [[unlikely]]
             {
-                case ::uwvm2::uwvm::wasm::storage::module_type_t::exec_wasm:
-                {
-                    /// @todo
-                    break;
-                }
-                case ::uwvm2::uwvm::wasm::storage::module_type_t::preloaded_wasm:
-                {
-                    /// @todo
-                    break;
-                }
-                case ::uwvm2::uwvm::wasm::storage::module_type_t::preloaded_dl:
-                {
-                    /// @todo
-                    break;
-                }
-                [[unlikely]] default:
-                {
-#if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
-                    ::uwvm2::utils::debug::trap_and_inform_bug_pos();
-#endif
-                    ::std::unreachable();
-                }
+                return static_cast<int>(::uwvm2::uwvm::run::retval::wasm_parser_error);
             }
         }
 
@@ -74,7 +74,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::run
 {
     inline int run() noexcept
     {
-        // The wasm preload has been fully parsed
+        // The wasm preload has been queued, it is loaded in load_and_check_modules
         // The dl preload has been fully registered
 
         if(!::uwvm2::uwvm::cmdline::wasm_file_ppos) [[unlikely]]
@@ -0,0 +1,197 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.utils.madvise;
+import uwvm2.uwvm.wasm.storage;
+#else
+// std
+# include <cstddef>
+# include <cstdint>
+# include <cstring>
+# include <climits>
+# include <memory>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/madvise/impl.h>
+# include <uwvm2/uwvm/wasm/storage/impl.h>
+#endif
+
+namespace uwvm2::uwvm::wasm::loader
+{
+    namespace details
+    {
+        // Advised ranges are aligned down to this boundary, it is a multiple of every supported page size (4 KiB, 16 KiB, 64 KiB)
+        inline constexpr ::std::size_t file_advice_alignment{64uz * 1024uz};
+
+        /// @brief Begin of the advised range of range_begin, aligned down to file_advice_alignment
+        inline ::std::byte const* align_advice_begin(::std::byte const* file_begin, ::std::byte const* range_begin) noexcept
+        {
+            // The mapping itself starts on a page boundary, never advise below it
+            auto const range_begin_uptr{reinterpret_cast<::std::uintptr_t>(range_begin)};
+            auto const aligned_uptr{range_begin_uptr & ~static_cast<::std::uintptr_t>(file_advice_alignment - 1uz)};
+            return aligned_uptr < reinterpret_cast<::std::uintptr_t>(file_begin) ? file_begin : range_begin - (range_begin_uptr - aligned_uptr);
+        }
+
+        inline void advise_file_range(::std::byte const* file_begin,
+                                      ::std::byte const* range_begin,
+                                      ::std::byte const* range_end,
+                                      ::uwvm2::utils::madvise::madvise_flag flag) noexcept
+        {
+            auto const aligned_begin{align_advice_begin(file_begin, range_begin)};
+            ::uwvm2::utils::madvise::my_madvise(aligned_begin, static_cast<::std::size_t>(range_end - aligned_begin), flag);
+        }
+
+        /// @brief Read a section length, returns nullptr on malformed input (the parser reports it later)
+        inline ::std::byte const* read_section_length(::std::byte const* curr, ::std::byte const* end, ::std::uint_least32_t& len) noexcept
+        {
+            ::std::uint_least32_t res{};
+            for(unsigned shift{}; shift != 35u; shift += 7u)
+            {
+                if(curr == end) [[unlikely]] { return nullptr; }
+
+                ::std::uint_least8_t byte;
+                ::std::memcpy(::std::addressof(byte), curr, sizeof(byte));
+#if CHAR_BIT > 8
+                byte = static_cast<::std::uint_least8_t>(byte & 0xFFu);
+#endif
+                ++curr;
+
+                res |= static_cast<::std::uint_least32_t>(byte & 0x7Fu) << shift;
+                if((byte & 0x80u) == 0u)
+                {
+                    len = res;
+                    return curr;
+                }
+            }
+
+            return nullptr;
+        }
+
+        /// @brief      Walk the sections of a binfmt ver1 module that are prefetched, in the order the parser touches them
+        /// @details    func(sec_begin, sec_end) is called for every non-empty, non-custom section in file order. Custom sections are skipped (only
+        ///             their header pages are touched by the walk), except the name section, which is read when the module name is resolved. Debug
+        ///             information in custom sections is often the largest part of a module and is never read by the loader. The walk stops at the
+        ///             first malformed section header (the parser reports it later).
+        /// @return     false if the file is not a binfmt ver1 module, func is not called then
+        template <typename Func>
+        inline bool for_each_binfmt_ver1_prefetch_section(::std::byte const* file_begin, ::std::byte const* file_end, Func&& func) noexcept
+        {
+            // magic + version
+            constexpr ::std::size_t header_size{8uz};
+            if(static_cast<::std::size_t>(file_end - file_begin) < header_size || ::std::memcmp(file_begin, u8"\0asm\x01\0\0\0", header_size) != 0)
+                [[unlikely]]
+            {
+                return false;
+            }
+
+            auto curr{file_begin + header_size};
+
+            while(curr != file_end)
+            {
+                ::std::uint_least8_t sec_id;
+                ::std::memcpy(::std::addressof(sec_id), curr, sizeof(sec_id));
+#if CHAR_BIT > 8
+                sec_id = static_cast<::std::uint_least8_t>(sec_id & 0xFFu);
+#endif
+                ++curr;
+
+                ::std::uint_least32_t sec_len;
+                auto const sec_begin{read_section_length(curr, file_end, sec_len)};
+                if(sec_begin == nullptr || static_cast<::std::size_t>(file_end - sec_begin) < sec_len) [[unlikely]] { return true; }
+
+                auto const sec_end{sec_begin + sec_len};
+
+                bool need_prefetch{sec_id != 0u};
+
+                if(!need_prefetch)
+                {
+                    // custom section: name length + name
+                    ::std::uint_least32_t name_len;
+                    if(auto const name_begin{read_section_length(sec_begin, sec_end, name_len)};
+                       name_begin != nullptr && name_len == 4u && static_cast<::std::size_t>(sec_end - name_begin) >= 4uz)
+                    {
+                        need_prefetch = ::std::memcmp(name_begin, u8"name", 4uz) == 0;
+                    }
+                }
+
+                if(need_prefetch && sec_begin != sec_end) { func(sec_begin, sec_end); }
+
+                curr = sec_end;
+            }
+
+            return true;
+        }
+
+        /// @brief  Prefetch the sections of a binfmt ver1 module section by section (for_each_binfmt_ver1_prefetch_section)
+        /// @return false if the file is not a binfmt ver1 module
+        inline bool advise_binfmt_ver1_sections(::std::byte const* file_begin, ::std::byte const* file_end) noexcept
+        {
+            return for_each_binfmt_ver1_prefetch_section(
+                file_begin,
+                file_end,
+                [file_begin](::std::byte const* sec_begin, ::std::byte const* sec_end) noexcept
+                { advise_file_range(file_begin, sec_begin, sec_end, ::uwvm2::utils::madvise::madvise_flag::willneed); });
+        }
+    }  // namespace details
+
+    /// @brief      Give the system the mapping advice selected by --wasm-file-advice
+    /// @details    default:       the whole file is prefetched asynchronously (willneed).
+    ///             hugepage:      transparent huge pages are requested for the mapping first, it must be advised before the pages are faulted in.
+    ///             section-order: binfmt ver1 modules are prefetched section by section instead of as a whole (advise_binfmt_ver1_sections).
+    ///             populate:      the page tables of the whole file are populated synchronously (MADV_POPULATE_READ), so the parser does not take
+    ///                            page faults. The prefetch is still issued first, on systems without populate it is all that remains.
+    ///             Must be called before anything reads the file (including the binfmt version detection), the first read faults in page 0.
+    inline void advise_wasm_file(void const* file_begin_ptr, ::std::size_t file_size) noexcept
+    {
+        if(file_size == 0uz) { return; }
+
+        auto const file_begin{reinterpret_cast<::std::byte const*>(file_begin_ptr)};
+        auto const file_end{file_begin + file_size};
+
+        if(::uwvm2::uwvm::wasm::storage::wasm_file_advice_hugepage)
+        {
+            ::uwvm2::utils::madvise::my_madvise(file_begin, file_size, ::uwvm2::utils::madvise::madvise_flag::hugepage);
+        }
+
+        // The walk reads the module header, after the huge page advice. Other binfmt versions fall back to the whole file.
+        if(!::uwvm2::uwvm::wasm::storage::wasm_file_advice_section_order || !details::advise_binfmt_ver1_sections(file_begin, file_end))
+        {
+            // Instructs to read the file all the way into memory
+            ::uwvm2::utils::madvise::my_madvise(file_begin, file_size, ::uwvm2::utils::madvise::madvise_flag::willneed);
+        }
+
+        if(::uwvm2::uwvm::wasm::storage::wasm_file_advice_populate)
+        {
+            ::uwvm2::utils::madvise::my_madvise(file_begin, file_size, ::uwvm2::utils::madvise::madvise_flag::populate_read);
+        }
+    }
+}  // namespace uwvm2::uwvm::wasm::loader
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
@@ -23,7 +23,10 @@
 module;
 
 export module uwvm2.uwvm.wasm.loader;
+export import :file_advice;
+export import :snapshot_cache;
 export import :wasm_file;
+export import :preload;
 #if (defined(_WIN32) || defined(__CYGWIN__)) && (!defined(__CYGWIN__) && !defined(__WINE__)) ||                                                                \
     ((!defined(_WIN32) || defined(__WINE__)) && (__has_include(<dlfcn.h>) && (defined(__CYGWIN__) || (!defined(__NEWLIB__) && !defined(__wasi__)))))
 export import :dl;
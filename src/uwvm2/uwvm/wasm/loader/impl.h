@@ -22,7 +22,10 @@
 #pragma once
 
 #ifndef UWVM_MODULE
+# include "file_advice.h"
+# include "snapshot_cache.h"
 # include "wasm_file.h"
+# include "preload.h"
 # if (defined(_WIN32) || defined(__CYGWIN__)) && (!defined(__CYGWIN__) && !defined(__WINE__)) ||                                                               \
      ((!defined(_WIN32) || defined(__WINE__)) && (__has_include(<dlfcn.h>) && (defined(__CYGWIN__) || (!defined(__NEWLIB__) && !defined(__wasi__)))))
 #  include "dl.h"
@@ -0,0 +1,180 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.parser.wasm.concepts;
+import uwvm2.parser.wasm.standard;
+import uwvm2.uwvm.wasm.type;
+import uwvm2.uwvm.wasm.storage;
+import :wasm_file;
+#else
+// std
+# include <cstddef>
+# include <cstdint>
+# include <memory>
+# include <utility>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// multithread
+# ifdef UWVM_SUPPORT_MULTITHREAD
+#  include <atomic>
+#  include <vector>
+#  include <thread>
+#  include <system_error>
+# endif
+// import
+# include <fast_io.h>
+# include <fast_io_dsal/vector.h>
+# include <uwvm2/parser/wasm/concepts/impl.h>
+# include <uwvm2/parser/wasm/standard/impl.h>
+# include <uwvm2/uwvm/wasm/type/impl.h>
+# include <uwvm2/uwvm/wasm/storage/impl.h>
+# include "wasm_file.h"
+#endif
+
+namespace uwvm2::uwvm::wasm::loader
+{
+    namespace details
+    {
+        /// @brief      Number of preloaded wasm files prepared concurrently
+        /// @details    Each file parses its code section with up to parse_threads threads (--wasm-parse-threads), so the hardware threads are divided
+        ///             between the two layers instead of running file_count * parse_threads threads.
+        inline constexpr ::std::size_t preload_worker_count(::std::size_t hardware_threads, ::std::size_t file_count, ::std::size_t parse_threads) noexcept
+        {
+            if(parse_threads > 1uz) { hardware_threads /= parse_threads; }
+            return hardware_threads < file_count ? hardware_threads : file_count;
+        }
+    }  // namespace details
+
+    /// @brief      Load the preloaded wasm files queued by --wasm-preload-library
+    /// @details    The files are opened and parsed concurrently (prepare_wasm_file), each worker takes the next file in the queue. The diagnostics are then
+    ///             printed and the loading is finished (load_prepared_wasm_file) in command line order, stopping at the first failure like loading the
+    ///             files one after another. If no thread can be created, the files are prepared by the current thread.
+    inline load_wasm_file_rtl load_preloaded_wasm_files() noexcept
+    {
+        auto const& queue{::uwvm2::uwvm::wasm::storage::preloaded_wasm_queue};
+        auto const file_count{queue.size()};
+
+        if(file_count == 0uz) { return load_wasm_file_rtl::ok; }
+
+        // The addresses of the wasm files must not change while they are prepared
+        auto& preloaded_wasm{::uwvm2::uwvm::wasm::storage::preloaded_wasm};
+        auto const first_file{preloaded_wasm.size()};
+        preloaded_wasm.reserve(first_file + file_count);
+        for(::std::size_t i{}; i != file_count; ++i) { preloaded_wasm.emplace_back_unchecked(); }
+
+        ::fast_io::vector<prepared_wasm_file_t> prepared{};
+        prepared.reserve(file_count);
+        for(::std::size_t i{}; i != file_count; ++i) { prepared.emplace_back_unchecked(); }
+
+        auto const queue_begin{queue.cbegin()};
+        auto const wasm_files_begin{preloaded_wasm.begin() + first_file};
+        auto const prepared_begin{prepared.begin()};
+
+#ifdef UWVM_SUPPORT_MULTITHREAD
+        ::std::size_t parse_threads{};
+        for(::std::size_t i{}; i != file_count; ++i)
+        {
+            auto const file_parse_threads{
+                ::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<
+                    ::uwvm2::parser::wasm::standard::wasm1::features::wasm1_feature_parameter_t>(queue_begin[i].wasm_parameter.binfmt1_para.parameters)
+                    .code_section_parse_threads};
+            if(file_parse_threads > parse_threads) { parse_threads = file_parse_threads; }
+        }
+
+        auto const worker_count{::uwvm2::uwvm::wasm::loader::details::preload_worker_count(
+            static_cast<::std::size_t>(::std::thread::hardware_concurrency()),
+            file_count,
+            parse_threads)};
+
+        if(worker_count > 1uz)
+        {
+            ::std::atomic_size_t next_file{};
+
+            auto const worker{[&next_file, file_count, queue_begin, wasm_files_begin, prepared_begin]() noexcept
+                              {
+                                  for(;;)
+                                  {
+                                      auto const i{next_file.fetch_add(1uz, ::std::memory_order_relaxed)};
+                                      if(i >= file_count) { return; }
+
+                                      auto const& entry{queue_begin[i]};
+                                      ::uwvm2::uwvm::wasm::loader::prepare_wasm_file(wasm_files_begin[i],
+                                                                                     entry.file_name,
+                                                                                     entry.wasm_parameter,
+                                                                                     prepared_begin[i]);
+                                  }
+                              }};
+
+            // The current thread is one of the workers
+            ::std::vector<::std::thread> threads{};
+            threads.reserve(worker_count - 1uz);
+            for(::std::size_t i{1uz}; i < worker_count; ++i)
+            {
+# ifdef __cpp_exceptions
+                try
+# endif
+                {
+                    threads.emplace_back(worker);
+                }
+# ifdef __cpp_exceptions
+                catch(::std::system_error const&)
+                {
+                    // The files are taken from next_file, so the threads already started (at least the current one) prepare the rest
+                    break;
+                }
+# endif
+            }
+
+            worker();
+
+            for(auto& thread: threads) { thread.join(); }
+        }
+        else
+#endif
+        {
+            for(::std::size_t i{}; i != file_count; ++i)
+            {
+                auto const& entry{queue_begin[i]};
+                ::uwvm2::uwvm::wasm::loader::prepare_wasm_file(wasm_files_begin[i], entry.file_name, entry.wasm_parameter, prepared_begin[i]);
+            }
+        }
+
+        for(::std::size_t i{}; i != file_count; ++i)
+        {
+            if(auto const rtl{::uwvm2::uwvm::wasm::loader::load_prepared_wasm_file(wasm_files_begin[i], queue_begin[i].rename_module_name, prepared_begin[i])};
+               rtl != load_wasm_file_rtl::ok) [[unlikely]]
+            {
+                return rtl;
+            }
+        }
+
+        return load_wasm_file_rtl::ok;
+    }
+}  // namespace uwvm2::uwvm::wasm::loader
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
@@ -0,0 +1,251 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.parser.wasm.concepts;
+import uwvm2.parser.wasm.standard;
+import uwvm2.parser.wasm.binfmt.base;
+import uwvm2.parser.wasm.binfmt.binfmt_ver1;
+import uwvm2.uwvm.wasm.feature;
+import uwvm2.uwvm.wasm.type;
+import uwvm2.uwvm.wasm.storage;
+#else
+// std
+# include <cstddef>
+# include <cstdint>
+# include <memory>
+# include <type_traits>
+# include <utility>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# include <fast_io_device.h>
+# include <fast_io_dsal/string_view.h>
+# include <uwvm2/parser/wasm/concepts/impl.h>
+# include <uwvm2/parser/wasm/standard/impl.h>
+# include <uwvm2/parser/wasm/binfmt/base/impl.h>
+# include <uwvm2/parser/wasm/binfmt/binfmt_ver1/impl.h>
+# include <uwvm2/uwvm/wasm/feature/impl.h>
+# include <uwvm2/uwvm/wasm/type/impl.h>
+# include <uwvm2/uwvm/wasm/storage/impl.h>
+#endif
+
+namespace uwvm2::uwvm::wasm::loader
+{
+    /// @brief      Identifies a snapshot in the cache
+    /// @details    The file name is derived from the content hash only, the parameters are checked against the header, a snapshot written with other
+    ///             parameters is simply replaced.
+    struct binfmt_ver1_snapshot_key_t
+    {
+        ::uwvm2::parser::wasm::binfmt::snapshot_hash_t module_hash{};
+        ::std::uint_least64_t parameter_key{};
+    };
+
+    /// @brief Parameters that change the contents of the parsed storage (the number of parsing threads does not)
+    inline constexpr ::std::uint_least64_t get_binfmt_ver1_snapshot_parameter_key(
+        ::uwvm2::uwvm::wasm::feature::wasm_binfmt_ver1_feature_parameter_storage_t const& binfmt1_para) noexcept
+    {
+        auto const& wasm1_para{
+            ::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<::uwvm2::parser::wasm::standard::wasm1::features::wasm1_feature_parameter_t>(
+                binfmt1_para.parameters)};
+
+        return static_cast<::std::uint_least64_t>(wasm1_para.code_section_lazy_locals) |
+               (static_cast<::std::uint_least64_t>(wasm1_para.code_section_validate) << 1u) |
+               (static_cast<::std::uint_least64_t>(wasm1_para.link_scan_only) << 2u);
+    }
+
+    inline binfmt_ver1_snapshot_key_t get_binfmt_ver1_snapshot_key(::uwvm2::uwvm::wasm::type::wasm_file_t const& wf) noexcept
+    {
+        return {::uwvm2::parser::wasm::binfmt::snapshot_content_hash(reinterpret_cast<::std::byte const*>(wf.wasm_file.cbegin()),
+                                                                    reinterpret_cast<::std::byte const*>(wf.wasm_file.cend())),
+                get_binfmt_ver1_snapshot_parameter_key(wf.wasm_parameter.binfmt1_para)};
+    }
+
+    namespace details
+    {
+        // 2 hex digits per byte of the digest + ".uwvmsnap" (or ".uwvmsnap." + 16 hex digits of the suffix + ".tmp") + null
+        inline constexpr ::std::size_t snapshot_file_name_max_size{::uwvm2::parser::wasm::binfmt::snapshot_hash_t::digest_size * 2uz + 30uz + 1uz};
+
+        struct snapshot_file_name_t
+        {
+            char8_t name[snapshot_file_name_max_size]{};
+            ::std::size_t size{};
+
+            inline constexpr ::fast_io::u8cstring_view view() const noexcept
+            {
+                return ::fast_io::u8cstring_view{::fast_io::containers::null_terminated, this->name, this->size};
+            }
+        };
+
+        inline constexpr char8_t snapshot_hex_digits[]{u8"0123456789abcdef"};
+
+        /// @brief <digest>.uwvmsnap
+        inline constexpr snapshot_file_name_t get_snapshot_file_name(::uwvm2::parser::wasm::binfmt::snapshot_hash_t module_hash) noexcept
+        {
+            snapshot_file_name_t ret{};
+            auto curr{ret.name};
+
+            for(auto const byte: module_hash.digest)
+            {
+                auto const value{static_cast<::std::size_t>(byte)};
+                *curr++ = snapshot_hex_digits[value >> 4u];
+                *curr++ = snapshot_hex_digits[value & 0xFu];
+            }
+
+            constexpr ::fast_io::u8string_view extension{u8".uwvmsnap"};
+            for(auto const c: extension) { *curr++ = c; }
+
+            *curr = u8'\0';
+            ret.size = static_cast<::std::size_t>(curr - ret.name);
+
+            return ret;
+        }
+
+        /// @brief      <digest>.uwvmsnap.<suffix>.tmp
+        /// @details    Every writer uses its own suffix, so a temporary file left by a writer that was killed never blocks the next one.
+        inline constexpr snapshot_file_name_t get_snapshot_temporary_file_name(::uwvm2::parser::wasm::binfmt::snapshot_hash_t module_hash,
+                                                                               ::std::uint_least64_t suffix) noexcept
+        {
+            auto ret{get_snapshot_file_name(module_hash)};
+            auto curr{ret.name + ret.size};
+
+            *curr++ = u8'.';
+            for(unsigned shift{64u}; shift != 0u;)
+            {
+                shift -= 4u;
+                *curr++ = snapshot_hex_digits[static_cast<::std::size_t>((suffix >> shift) & 0xFu)];
+            }
+
+            constexpr ::fast_io::u8string_view temporary_extension{u8".tmp"};
+            for(auto const c: temporary_extension) { *curr++ = c; }
+
+            *curr = u8'\0';
+            ret.size = static_cast<::std::size_t>(curr - ret.name);
+
+            return ret;
+        }
+    }  // namespace details
+
+    /// @brief      Restore the storage of wf from the snapshot cache
+    /// @details    wf.wasm_file must be loaded and wf must be binfmt ver1. Any failure (no cache directory, no snapshot, a snapshot of another module or
+    ///             build) only means that the module has to be parsed.
+    ///             A missing snapshot is reported by fast_io as an exception, without exceptions it would terminate the process, so the cache is only
+    ///             available when exceptions are enabled (--wasm-snapshot-cache is rejected otherwise).
+    /// @return     true if wf.wasm_module_storage.wasm_binfmt_ver1_storage was restored
+    inline bool load_binfmt_ver1_snapshot([[maybe_unused]] ::uwvm2::uwvm::wasm::type::wasm_file_t& wf,
+                                          [[maybe_unused]] binfmt_ver1_snapshot_key_t const& key) noexcept
+    {
+#ifdef __cpp_exceptions
+        if(::uwvm2::uwvm::wasm::storage::wasm_snapshot_cache_dir.empty()) { return false; }
+
+        auto const file_name{details::get_snapshot_file_name(key.module_hash)};
+
+        try
+        {
+            ::fast_io::dir_file cache_dir{::uwvm2::uwvm::wasm::storage::wasm_snapshot_cache_dir};
+            ::fast_io::native_file_loader const snapshot{::fast_io::at(cache_dir), file_name.view()};
+
+            // The snapshot is copied into the storage, the mapping is released on return
+            return ::uwvm2::parser::wasm::binfmt::ver1::read_binfmt_ver1_snapshot(wf.wasm_module_storage.wasm_binfmt_ver1_storage,
+                                                                                  reinterpret_cast<::std::byte const*>(wf.wasm_file.cbegin()),
+                                                                                  reinterpret_cast<::std::byte const*>(wf.wasm_file.cend()),
+                                                                                  key.module_hash,
+                                                                                  key.parameter_key,
+                                                                                  reinterpret_cast<::std::byte const*>(snapshot.cbegin()),
+                                                                                  reinterpret_cast<::std::byte const*>(snapshot.cend()));
+        }
+        catch(::fast_io::error)
+        {
+            return false;
+        }
+#else
+        return false;
+#endif
+    }
+
+    /// @brief      Write the parsed storage of wf into the snapshot cache
+    /// @details    The snapshot is written to a temporary file with a random suffix, created exclusively and renamed into place, so a concurrent loader
+    ///             never maps a partial snapshot and concurrent writers of the same module never share a file. Failures are ignored. Only available when
+    ///             exceptions are enabled, see load_binfmt_ver1_snapshot.
+    inline void store_binfmt_ver1_snapshot([[maybe_unused]] ::uwvm2::uwvm::wasm::type::wasm_file_t const& wf,
+                                           [[maybe_unused]] binfmt_ver1_snapshot_key_t const& key) noexcept
+    {
+#ifdef __cpp_exceptions
+        if(::uwvm2::uwvm::wasm::storage::wasm_snapshot_cache_dir.empty()) { return; }
+
+        auto const snapshot{::uwvm2::parser::wasm::binfmt::ver1::write_binfmt_ver1_snapshot(wf.wasm_module_storage.wasm_binfmt_ver1_storage,
+                                                                                            key.module_hash,
+                                                                                            key.parameter_key)};
+
+        // The feature set does not support snapshots
+        if(snapshot.empty()) { return; }
+
+        auto const file_name{details::get_snapshot_file_name(key.module_hash)};
+
+        try
+        {
+            ::std::uint_least64_t suffix{};
+            {
+                ::fast_io::native_white_hole white_hole{};
+                ::fast_io::operations::read_all_bytes(white_hole,
+                                                      reinterpret_cast<::std::byte*>(::std::addressof(suffix)),
+                                                      reinterpret_cast<::std::byte*>(::std::addressof(suffix) + 1));
+            }
+
+            auto const temporary_file_name{details::get_snapshot_temporary_file_name(key.module_hash, suffix)};
+
+            ::fast_io::dir_file cache_dir{::uwvm2::uwvm::wasm::storage::wasm_snapshot_cache_dir};
+
+            // excl: never write into a file of another writer, the suffix makes a collision practically impossible
+            ::fast_io::native_file temporary_file{::fast_io::at(cache_dir),
+                                                  temporary_file_name.view(),
+                                                  ::fast_io::open_mode::out | ::fast_io::open_mode::excl};
+
+            try
+            {
+                ::fast_io::operations::write_all_bytes(temporary_file, snapshot.cbegin(), snapshot.cend());
+                temporary_file.close();
+
+                ::fast_io::native_renameat(::fast_io::at(cache_dir), temporary_file_name.view(), ::fast_io::at(cache_dir), file_name.view());
+            }
+            catch(::fast_io::error)
+            {
+                // Do not leave a partial snapshot behind
+                ::fast_io::native_unlinkat(::fast_io::at(cache_dir), temporary_file_name.view());
+                throw;
+            }
+        }
+        catch(::fast_io::error)
+        {
+            // The cache is an optimization, the next run parses the module again
+        }
+#endif
+    }
+}  // namespace uwvm2::uwvm::wasm::loader
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
@@ -41,6 +41,8 @@ import uwvm2.uwvm.wasm.type;
 import uwvm2.uwvm.wasm.storage;
 import uwvm2.uwvm.wasm.feature;
 import uwvm2.uwvm.wasm.custom;
+import :file_advice;
+import :snapshot_cache;
 #else
 // std
 # include <cstddef>
@@ -69,6 +71,8 @@ import uwvm2.uwvm.wasm.custom;
 # include <uwvm2/uwvm/wasm/storage/impl.h>
 # include <uwvm2/uwvm/wasm/feature/impl.h>
 # include <uwvm2/uwvm/wasm/custom/impl.h>
+# include "file_advice.h"
+# include "snapshot_cache.h"
 #endif
 
 namespace uwvm2::uwvm::wasm::loader
@@ -80,15 +84,173 @@ namespace uwvm2::uwvm::wasm::loader
         wasm_parser_error
     };
 
-    inline constexpr load_wasm_file_rtl load_wasm_file(::uwvm2::uwvm::wasm::type::wasm_file_t& wf,
-                                                       ::fast_io::u8cstring_view load_file_name,
-                                                       ::fast_io::u8string_view rename_module_name,
-                                                       ::uwvm2::uwvm::wasm::type::wasm_parameter_u para) noexcept
+    /// @brief Result of prepare_wasm_file, the diagnostics are printed from it by load_prepared_wasm_file
+    struct prepared_wasm_file_t
+    {
+        // The file could not be opened
+        bool load_failed{};
+#ifdef __cpp_exceptions
+        ::fast_io::error load_err{};
+#endif
+        // binfmt ver1: the storage was restored from the snapshot cache
+        bool restored_from_snapshot{};
+        // binfmt ver1: parsing failed, the error is in parse_err
+        bool parse_failed{};
+        ::uwvm2::parser::wasm::base::error_impl parse_err{};
+    };
+
+    namespace details
+    {
+#ifndef UWVM_DISABLE_OUTPUT_WHEN_PARSE
+        /// @brief Print the parser error err of wf, followed by the memory indication at err.err_curr
+        inline void print_wasm_parse_error(::uwvm2::uwvm::wasm::type::wasm_file_t const& wf, ::uwvm2::parser::wasm::base::error_impl const& err) noexcept
+        {
+# if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
+            if(err.err_code == ::uwvm2::parser::wasm::base::wasm_parse_error_code::ok) [[unlikely]]
+            {
+                // The `ok` exception was thrown. It's a bug in the program.
+                ::uwvm2::utils::debug::trap_and_inform_bug_pos();
+            }
+# endif
+
+            // default print_memory
+            ::uwvm2::uwvm::utils::memory::print_memory const memory_printer{reinterpret_cast<::std::byte const*>(wf.wasm_file.cbegin()),
+                                                                            err.err_curr,
+                                                                            reinterpret_cast<::std::byte const*>(wf.wasm_file.cend())};
+
+            // set errout
+            ::uwvm2::parser::wasm::base::error_output_t errout;
+            errout.module_begin = reinterpret_cast<::std::byte const*>(wf.wasm_file.cbegin());
+            errout.err = err;
+            errout.flag.enable_ansi = static_cast<::std::uint_least8_t>(::uwvm2::uwvm::utils::ansies::put_color);
+# if defined(_WIN32) && (_WIN32_WINNT < 0x0A00 || defined(_WIN32_WINDOWS))
+            errout.flag.win32_use_text_attr = static_cast<::std::uint_least8_t>(!::uwvm2::uwvm::utils::ansies::log_win32_use_ansi_b);
+# endif
+
+            // Output the main information and memory indication
+            ::fast_io::io::perr(::uwvm2::uwvm::u8log_output,
+                                // 1
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                u8"uwvm: ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RED),
+                                u8"[error] ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8"Parsing error in WebAssembly File \"",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                wf.file_name,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8"\".\n",
+                                // 2
+                                errout,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8"\n"
+                                // 3
+                                u8"uwvm: ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_GREEN),
+                                u8"[info]  ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8"Parser Memory Indication: ",
+                                memory_printer,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL),
+                                u8"\n\n");
+        }
+#endif
+    }  // namespace details
+
+    /// @brief      Open, detect and parse a wasm file, without any output
+    /// @details    The expensive part of load_wasm_file. Different wf can be prepared concurrently (preloaded wasm files), the diagnostics are then
+    ///             printed in command line order by load_prepared_wasm_file.
+    inline void prepare_wasm_file(::uwvm2::uwvm::wasm::type::wasm_file_t& wf,
+                                  ::fast_io::u8cstring_view load_file_name,
+                                  ::uwvm2::uwvm::wasm::type::wasm_parameter_u para,
+                                  prepared_wasm_file_t& prepared) noexcept
     {
         wf.file_name = load_file_name;
 
         wf.wasm_parameter = para;
 
+#ifdef __cpp_exceptions
+        try
+#endif
+        {
+#ifdef UWVM_TIMER
+            ::uwvm2::utils::debug::timer parsing_timer{u8"file loader"};
+#endif
+
+            // On platforms where CHAR_BIT is greater than 8, there is no need to clear the utf-8 non-low 8 bits here
+            wf.wasm_file = ::fast_io::native_file_loader{load_file_name};
+        }
+#ifdef __cpp_exceptions
+        catch(::fast_io::error e)
+        {
+            prepared.load_failed = true;
+            prepared.load_err = e;
+            return;
+        }
+#endif
+
+        // Before the first read
+        // Instructs how to read the file into memory (--wasm-file-advice)
+        ::uwvm2::uwvm::wasm::loader::advise_wasm_file(wf.wasm_file.cbegin(), wf.wasm_file.size());
+
+        // binfmt_ver has to be modified by the change_binfmt_ver function.
+        wf.change_binfmt_ver(::uwvm2::parser::wasm::binfmt::detect_wasm_binfmt_version(reinterpret_cast<::std::byte const*>(wf.wasm_file.cbegin()),
+                                                                                       reinterpret_cast<::std::byte const*>(wf.wasm_file.cend())));
+
+        if(wf.binfmt_ver != 1u) { return; }
+
+        // A module loaded before with the same parameters is restored from the snapshot cache (--wasm-snapshot-cache), without being parsed or
+        // validated again
+        bool const use_snapshot_cache{!::uwvm2::uwvm::wasm::storage::wasm_snapshot_cache_dir.empty()};
+        ::uwvm2::uwvm::wasm::loader::binfmt_ver1_snapshot_key_t snapshot_key{};
+
+        if(use_snapshot_cache)
+        {
+#ifdef UWVM_TIMER
+            ::uwvm2::utils::debug::timer snapshot_timer{u8"load binfmt ver1 snapshot"};
+#endif
+
+            snapshot_key = ::uwvm2::uwvm::wasm::loader::get_binfmt_ver1_snapshot_key(wf);
+            prepared.restored_from_snapshot = ::uwvm2::uwvm::wasm::loader::load_binfmt_ver1_snapshot(wf, snapshot_key);
+        }
+
+        if(prepared.restored_from_snapshot) { return; }
+
+#if defined(__cpp_exceptions) && !defined(UWVM_TERMINATE_IMME_WHEN_PARSE)
+        try
+#endif
+        {
+            // parser
+#ifdef UWVM_TIMER
+            ::uwvm2::utils::debug::timer parsing_timer{u8"parse binfmt ver1"};
+#endif
+
+            wf.wasm_module_storage.wasm_binfmt_ver1_storage =
+                ::uwvm2::uwvm::wasm::feature::binfmt_ver1_handler(reinterpret_cast<::std::byte const*>(wf.wasm_file.cbegin()),
+                                                                  reinterpret_cast<::std::byte const*>(wf.wasm_file.cend()),
+                                                                  prepared.parse_err,
+                                                                  wf.wasm_parameter.binfmt1_para);
+        }
+#if defined(__cpp_exceptions) && !defined(UWVM_TERMINATE_IMME_WHEN_PARSE)
+        catch(::fast_io::error)
+        {
+            // catch fast_io::error (wasm parser error)
+            prepared.parse_failed = true;
+            return;
+        }
+#endif
+
+        if(use_snapshot_cache) { ::uwvm2::uwvm::wasm::loader::store_binfmt_ver1_snapshot(wf, snapshot_key); }
+    }
+
+    /// @brief      Print the diagnostics of a prepared wasm file and finish loading it (custom sections, module name)
+    /// @details    wf and prepared are the results of prepare_wasm_file.
+    inline constexpr load_wasm_file_rtl load_prepared_wasm_file(::uwvm2::uwvm::wasm::type::wasm_file_t& wf,
+                                                                ::fast_io::u8string_view rename_module_name,
+                                                                prepared_wasm_file_t const& prepared) noexcept
+    {
+        auto const load_file_name{wf.file_name};
+
         // verbose
         if(::uwvm2::uwvm::show_verbose) [[unlikely]]
         {
@@ -109,18 +271,7 @@ namespace uwvm2::uwvm::wasm::loader
         }
 
 #ifdef __cpp_exceptions
-        try
-#endif
-        {
-#ifdef UWVM_TIMER
-            ::uwvm2::utils::debug::timer parsing_timer{u8"file loader"};
-#endif
-
-            // On platforms where CHAR_BIT is greater than 8, there is no need to clear the utf-8 non-low 8 bits here
-            wf.wasm_file = ::fast_io::native_file_loader{load_file_name};
-        }
-#ifdef __cpp_exceptions
-        catch(::fast_io::error e)
+        if(prepared.load_failed) [[unlikely]]
         {
             ::fast_io::io::perr(::uwvm2::uwvm::u8log_output,
                                 ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
@@ -133,7 +284,7 @@ namespace uwvm2::uwvm::wasm::loader
                                 load_file_name,
                                 ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
                                 u8"\": ",
-                                e,
+                                prepared.load_err,
                                 ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL),
                                 u8"\n"
 # ifndef _WIN32  // Win32 automatically adds a newline (winnt and win9x)
@@ -145,10 +296,6 @@ namespace uwvm2::uwvm::wasm::loader
         }
 #endif
 
-        // binfmt_ver has to be modified by the change_binfmt_ver function.
-        wf.change_binfmt_ver(::uwvm2::parser::wasm::binfmt::detect_wasm_binfmt_version(reinterpret_cast<::std::byte const*>(wf.wasm_file.cbegin()),
-                                                                                       reinterpret_cast<::std::byte const*>(wf.wasm_file.cend())));
-
         // verbose
         if(::uwvm2::uwvm::show_verbose) [[unlikely]]
         {
@@ -172,10 +319,6 @@ namespace uwvm2::uwvm::wasm::loader
                                 ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
         }
 
-        // After detect
-        // Instructs to read the file all the way into memory
-        ::uwvm2::utils::madvise::my_madvise(wf.wasm_file.cbegin(), wf.wasm_file.size(), ::uwvm2::utils::madvise::madvise_flag::willneed);
-
         switch(wf.binfmt_ver)
         {
             [[unlikely]] case static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>(0u):
@@ -212,104 +355,63 @@ namespace uwvm2::uwvm::wasm::loader
             {
                 // handle exec (main) module
                 {
-                    // storage wasm err
-                    ::uwvm2::parser::wasm::base::error_impl execute_wasm_binfmt_ver1_storage_wasm_err{};
-
                     // parse wasm 1
 
-                    // verbose
-                    if(::uwvm2::uwvm::show_verbose) [[unlikely]]
+                    // The module is parsed (or restored from the snapshot cache) by prepare_wasm_file
+                    if(prepared.restored_from_snapshot)
                     {
-                        ::fast_io::io::perr(::uwvm2::uwvm::u8log_output,
-                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
-                                            u8"uwvm: ",
-                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_GREEN),
-                                            u8"[info]  ",
-                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                                            u8"Parsing WebAssembly file \"",
-                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
-                                            load_file_name,
-                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                                            u8"\". ",
-                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
-                                            u8"(verbose)\n",
-                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
-                    }
-
-#if defined(__cpp_exceptions) && !defined(UWVM_TERMINATE_IMME_WHEN_PARSE)
-                    try
-#endif
-                    {
-                        // parser
-#ifdef UWVM_TIMER
-                        ::uwvm2::utils::debug::timer parsing_timer{u8"parse binfmt ver1"};
-#endif
-
-                        wf.wasm_module_storage.wasm_binfmt_ver1_storage =
-                            ::uwvm2::uwvm::wasm::feature::binfmt_ver1_handler(reinterpret_cast<::std::byte const*>(wf.wasm_file.cbegin()),
-                                                                              reinterpret_cast<::std::byte const*>(wf.wasm_file.cend()),
-                                                                              execute_wasm_binfmt_ver1_storage_wasm_err,
-                                                                              wf.wasm_parameter.binfmt1_para);
+                        // verbose
+                        if(::uwvm2::uwvm::show_verbose) [[unlikely]]
+                        {
+                            ::fast_io::io::perr(::uwvm2::uwvm::u8log_output,
+                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                                u8"uwvm: ",
+                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_GREEN),
+                                                u8"[info]  ",
+                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                                u8"Restored WebAssembly file \"",
+                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                                load_file_name,
+                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                                u8"\" from the snapshot cache. ",
+                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
+                                                u8"(verbose)\n",
+                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+                        }
                     }
-#if defined(__cpp_exceptions) && !defined(UWVM_TERMINATE_IMME_WHEN_PARSE)
-                    catch(::fast_io::error)
+                    else
                     {
-# ifndef UWVM_DISABLE_OUTPUT_WHEN_PARSE
-
-                        // catch fast_io::error (wasm parser error)
-#  if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
-                        if(execute_wasm_binfmt_ver1_storage_wasm_err.err_code == ::uwvm2::parser::wasm::base::wasm_parse_error_code::ok) [[unlikely]]
+                        // verbose
+                        if(::uwvm2::uwvm::show_verbose) [[unlikely]]
                         {
-                            // The `ok` exception was thrown. It's a bug in the program.
-                            ::uwvm2::utils::debug::trap_and_inform_bug_pos();
+                            ::fast_io::io::perr(::uwvm2::uwvm::u8log_output,
+                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                                u8"uwvm: ",
+                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_GREEN),
+                                                u8"[info]  ",
+                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                                u8"Parsing WebAssembly file \"",
+                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                                load_file_name,
+                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                                u8"\". ",
+                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
+                                                u8"(verbose)\n",
+                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
                         }
-#  endif
-
-                        // default print_memory
-                        ::uwvm2::uwvm::utils::memory::print_memory const memory_printer{reinterpret_cast<::std::byte const*>(wf.wasm_file.cbegin()),
-                                                                                        execute_wasm_binfmt_ver1_storage_wasm_err.err_curr,
-                                                                                        reinterpret_cast<::std::byte const*>(wf.wasm_file.cend())};
-
-                        // set errout
-                        ::uwvm2::parser::wasm::base::error_output_t errout;
-                        errout.module_begin = reinterpret_cast<::std::byte const*>(wf.wasm_file.cbegin());
-                        errout.err = execute_wasm_binfmt_ver1_storage_wasm_err;
-                        errout.flag.enable_ansi = static_cast<::std::uint_least8_t>(::uwvm2::uwvm::utils::ansies::put_color);
-#  if defined(_WIN32) && (_WIN32_WINNT < 0x0A00 || defined(_WIN32_WINDOWS))
-                        errout.flag.win32_use_text_attr = static_cast<::std::uint_least8_t>(!::uwvm2::uwvm::utils::ansies::log_win32_use_ansi_b);
-#  endif
 
-                        // Output the main information and memory indication
-                        ::fast_io::io::perr(::uwvm2::uwvm::u8log_output,
-                                            // 1
-                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
-                                            u8"uwvm: ",
-                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RED),
-                                            u8"[error] ",
-                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                                            u8"Parsing error in WebAssembly File \"",
-                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
-                                            load_file_name,
-                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                                            u8"\".\n",
-                                            // 2
-                                            errout,
-                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                                            u8"\n"
-                                            // 3
-                                            u8"uwvm: ",
-                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_GREEN),
-                                            u8"[info]  ",
-                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                                            u8"Parser Memory Indication: ",
-                                            memory_printer,
-                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL),
-                                            u8"\n\n");
+#if defined(__cpp_exceptions) && !defined(UWVM_TERMINATE_IMME_WHEN_PARSE)
+                        if(prepared.parse_failed) [[unlikely]]
+                        {
+# ifndef UWVM_DISABLE_OUTPUT_WHEN_PARSE
+                            // wasm parser error
+                            ::uwvm2::uwvm::wasm::loader::details::print_wasm_parse_error(wf, prepared.parse_err);
 # endif
 
-                        return load_wasm_file_rtl::wasm_parser_error;
-                    }
+                            return load_wasm_file_rtl::wasm_parser_error;
+                        }
 #endif
+                    }
 
                     // verbose
                     if(::uwvm2::uwvm::show_verbose) [[unlikely]]
@@ -507,6 +609,74 @@ namespace uwvm2::uwvm::wasm::loader
         return load_wasm_file_rtl::ok;
     }
 
+    inline constexpr load_wasm_file_rtl load_wasm_file(::uwvm2::uwvm::wasm::type::wasm_file_t& wf,
+                                                       ::fast_io::u8cstring_view load_file_name,
+                                                       ::fast_io::u8string_view rename_module_name,
+                                                       ::uwvm2::uwvm::wasm::type::wasm_parameter_u para) noexcept
+    {
+        prepared_wasm_file_t prepared{};
+        ::uwvm2::uwvm::wasm::loader::prepare_wasm_file(wf, load_file_name, para, prepared);
+        return ::uwvm2::uwvm::wasm::loader::load_prepared_wasm_file(wf, rename_module_name, prepared);
+    }
+
+    /// @brief      Parse the sections skipped when wf was loaded in link scan mode (--wasm-preload-link-scan)
+    /// @details    Does nothing if wf was parsed completely.
+    inline constexpr load_wasm_file_rtl complete_link_scan_wasm_file(::uwvm2::uwvm::wasm::type::wasm_file_t& wf) noexcept
+    {
+        if(wf.binfmt_ver != 1u) [[unlikely]] { return load_wasm_file_rtl::ok; }
+
+        auto& wasm1_para{
+            ::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<::uwvm2::parser::wasm::standard::wasm1::features::wasm1_feature_parameter_t>(
+                wf.wasm_parameter.binfmt1_para.parameters)};
+
+        if(!wasm1_para.link_scan_only) { return load_wasm_file_rtl::ok; }
+
+        // verbose
+        if(::uwvm2::uwvm::show_verbose) [[unlikely]]
+        {
+            ::fast_io::io::perr(::uwvm2::uwvm::u8log_output,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                u8"uwvm: ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_GREEN),
+                                u8"[info]  ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8"Completing the link scan of WebAssembly file \"",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                wf.file_name,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8"\". ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
+                                u8"(verbose)\n",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+        }
+
+        ::uwvm2::parser::wasm::base::error_impl complete_link_scan_err{};
+
+#if defined(__cpp_exceptions) && !defined(UWVM_TERMINATE_IMME_WHEN_PARSE)
+        try
+#endif
+        {
+            ::uwvm2::parser::wasm::standard::wasm1::features::complete_link_scan(wf.wasm_module_storage.wasm_binfmt_ver1_storage,
+                                                                                 complete_link_scan_err,
+                                                                                 wf.wasm_parameter.binfmt1_para);
+        }
+#if defined(__cpp_exceptions) && !defined(UWVM_TERMINATE_IMME_WHEN_PARSE)
+        catch(::fast_io::error)
+        {
+# ifndef UWVM_DISABLE_OUTPUT_WHEN_PARSE
+            ::uwvm2::uwvm::wasm::loader::details::print_wasm_parse_error(wf, complete_link_scan_err);
+# endif
+
+            return load_wasm_file_rtl::wasm_parser_error;
+        }
+#endif
+
+        // The module is now the same as a completely parsed one
+        wasm1_para.link_scan_only = false;
+
+        return load_wasm_file_rtl::ok;
+    }
+
 }  // namespace uwvm2::uwvm::wasm::loader
 
 #ifndef UWVM_MODULE
@@ -22,6 +22,7 @@
 module;
 
 // std
+#include <cstddef>
 #include <map>  /// @todo replace
 
 export module uwvm2.uwvm.wasm.storage:all_module;
@@ -31,6 +31,7 @@ import uwvm2.uwvm.wasm.feature;
 import uwvm2.uwvm.wasm.type;
 #else
 // std
+# include <cstddef>
 # include <map>  /// @todo replace
 // import
 # include <fast_io.h>
@@ -72,6 +73,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::storage
     {
         module_storage_ptr_u module_storage_ptr{};
         module_type_t type{};
+        // The imports of the module are import_links[import_link_begin, import_link_begin + import count), filled by link_modules
+        ::std::size_t import_link_begin{};
     };
 
     inline ::std::map<::fast_io::u8string_view, all_module_t> all_module{};  // [global]
@@ -32,6 +32,7 @@ export import :local_preload;
 export import :preloaded_dl;
 #endif
 export import :all_module;
+export import :import_link;
 
 #ifndef UWVM_MODULE
 # define UWVM_MODULE
@@ -32,4 +32,5 @@
 #  include "preloaded_dl.h"
 # endif
 # include "all_module.h"
+# include "import_link.h"
 #endif
@@ -0,0 +1,105 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.parser.wasm.concepts;
+import uwvm2.parser.wasm.standard.wasm1.type;
+import uwvm2.parser.wasm.standard.wasm1.features;
+import uwvm2.parser.wasm.binfmt.binfmt_ver1;
+import uwvm2.uwvm.wasm.feature;
+import uwvm2.uwvm.wasm.type;
+import :all_module;
+#else
+// std
+# include <cstddef>
+# include <cstdint>
+// import
+# include <fast_io.h>
+# include <fast_io_dsal/vector.h>
+# include <uwvm2/parser/wasm/concepts/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/features/impl.h>
+# include <uwvm2/parser/wasm/binfmt/binfmt_ver1/impl.h>
+# include <uwvm2/uwvm/wasm/feature/impl.h>
+# include <uwvm2/uwvm/wasm/type/impl.h>
+# include "all_module.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::storage
+{
+    namespace details
+    {
+        template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        inline consteval auto get_binfmt_ver1_export_type(::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...> const*) noexcept
+        {
+            return ::uwvm2::parser::wasm::standard::wasm1::features::final_wasm_export_type<Fs...>{};
+        }
+
+        template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        inline consteval auto get_binfmt_ver1_import_type(::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...> const*) noexcept
+        {
+            return ::uwvm2::parser::wasm::standard::wasm1::features::final_import_type<Fs...>{};
+        }
+    }  // namespace details
+
+    /// @brief Export and import entries of the binfmt ver1 modules of uwvm (wasm_binfmt_ver1_module_storage_t)
+    using wasm_binfmt_ver1_export_t = decltype(details::get_binfmt_ver1_export_type(
+        static_cast<::uwvm2::uwvm::wasm::feature::wasm_binfmt_ver1_module_storage_t const*>(nullptr)));
+    using wasm_binfmt_ver1_import_t = decltype(details::get_binfmt_ver1_import_type(
+        static_cast<::uwvm2::uwvm::wasm::feature::wasm_binfmt_ver1_module_storage_t const*>(nullptr)));
+
+    enum class import_link_type_t : unsigned
+    {
+        unresolved,   // The module named by the import is not loaded (e.g. a host module that is provided later)
+        wasm_export,  // An export of a wasm module
+        dl_function   // A function of a dl module
+    };
+
+    union import_link_target_u
+    {
+        wasm_binfmt_ver1_export_t const* wasm_export;
+
+#if (defined(_WIN32) || defined(__CYGWIN__)) && (!defined(__CYGWIN__) && !defined(__WINE__)) ||                                                                \
+    ((!defined(_WIN32) || defined(__WINE__)) && (__has_include(<dlfcn.h>) && (defined(__CYGWIN__) || (!defined(__NEWLIB__) && !defined(__wasi__)))))
+        ::uwvm2::uwvm::wasm::type::capi_function_t const* dl_function;
+#endif
+    };
+
+    /// @brief What an import is bound to
+    struct import_link_t
+    {
+        // The exporting module, nullptr if unresolved
+        all_module_t const* module{};
+        import_link_target_u target{};
+        import_link_type_t type{};
+    };
+
+    // The imports of all modules, see all_module_t::import_link_begin
+    inline ::fast_io::vector<import_link_t> import_links{};  // [global]
+
+}  // namespace uwvm2::uwvm::wasm::storage
@@ -51,4 +51,15 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::storage
         ::uwvm2::uwvm::wasm::base::mode::objdump};  // [global] No global variable dependencies from other translation units
 
     inline ::uwvm2::uwvm::wasm::type::wasm_parameter_u wasm_parameter{};  // [global] No global variable dependencies from other translation units
+
+    // Directory of the parsed module snapshots, empty means disabled
+    inline ::fast_io::u8cstring_view wasm_snapshot_cache_dir{};  // [global] No global variable dependencies from other translation units
+
+    // Preloaded wasm files are parsed in link scan mode and completed after the module names have been checked
+    inline bool wasm_preload_link_scan{};  // [global] No global variable dependencies from other translation units
+
+    // Mapping advice of the loaded wasm files (--wasm-file-advice), the whole file is always prefetched (willneed) unless section_order is set
+    inline bool wasm_file_advice_populate{};       // [global] No global variable dependencies from other translation units
+    inline bool wasm_file_advice_hugepage{};       // [global] No global variable dependencies from other translation units
+    inline bool wasm_file_advice_section_order{};  // [global] No global variable dependencies from other translation units
 }  // namespace uwvm2::uwvm::wasm::storage
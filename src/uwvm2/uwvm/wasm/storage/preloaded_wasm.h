@@ -47,5 +47,17 @@ import uwvm2.uwvm.wasm.type;
 #endif
 UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::storage
 {
+    /// @brief A preloaded wasm file queued by "--wasm-preload-library", loaded by load_preloaded_wasm_files
+    struct preloaded_wasm_queue_entry_t
+    {
+        ::fast_io::u8cstring_view file_name{};
+        ::fast_io::u8string_view rename_module_name{};
+        // The parameters in effect at the position of the file on the command line
+        ::uwvm2::uwvm::wasm::type::wasm_parameter_u wasm_parameter{};
+    };
+
+    // In command line order
+    inline ::fast_io::vector<preloaded_wasm_queue_entry_t> preloaded_wasm_queue{};  // [global] No global variable dependencies from other translation units
+
     inline ::fast_io::vector<::uwvm2::uwvm::wasm::type::wasm_file_t> preloaded_wasm{};  // [global] No global variable dependencies from other translation units
 }  // namespace uwvm2::uwvm::wasm::storage
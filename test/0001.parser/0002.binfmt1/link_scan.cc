@@ -0,0 +1,202 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2025-07-19
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <type_traits>
+#include <concepts>
+#include <memory>
+#include <initializer_list>
+
+#include <uwvm2/utils/macro/push_macros.h>
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.parser.wasm.base;
+import uwvm2.parser.wasm.concepts;
+import uwvm2.parser.wasm.standard.wasm1.type;
+import uwvm2.parser.wasm.standard.wasm1.features;
+import uwvm2.parser.wasm.binfmt.binfmt_ver1;
+#else
+# include <fast_io.h>
+# include <fast_io_dsal/vector.h>
+# include <fast_io_dsal/tuple.h>
+# include <uwvm2/parser/wasm/base/impl.h>
+# include <uwvm2/parser/wasm/concepts/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/features/impl.h>
+# include <uwvm2/parser/wasm/binfmt/binfmt_ver1/impl.h>
+#endif
+
+namespace test
+{
+    using wasm1 = ::uwvm2::parser::wasm::standard::wasm1::features::wasm1;
+
+    inline void push_leb128(::fast_io::vector<::std::byte>& vec, ::std::uint_least32_t val)
+    {
+        do {
+            auto byte{static_cast<::std::uint_least8_t>(val & 0x7Fu)};
+            val >>= 7u;
+            if(val != 0u) { byte |= 0x80u; }
+            vec.push_back(static_cast<::std::byte>(byte));
+        }
+        while(val != 0u);
+    }
+
+    inline void push_bytes(::fast_io::vector<::std::byte>& vec, ::std::initializer_list<unsigned> bytes)
+    {
+        for(auto const i: bytes) { vec.push_back(static_cast<::std::byte>(i)); }
+    }
+
+    inline void push_section(::fast_io::vector<::std::byte>& vec, ::std::uint_least8_t id, ::fast_io::vector<::std::byte> const& content)
+    {
+        vec.push_back(static_cast<::std::byte>(id));
+        push_leb128(vec, static_cast<::std::uint_least32_t>(content.size()));
+        for(auto const i: content) { vec.push_back(i); }
+    }
+
+    /// @brief (module (type (func)) (func (export "f")) (func (local i32)) (memory 1) (data (i32.const 0) "ab"))
+    inline ::fast_io::vector<::std::byte> make_module(bool bad_local_type)
+    {
+        ::fast_io::vector<::std::byte> mod{};
+        push_bytes(mod, {0x00u, 0x61u, 0x73u, 0x6Du, 0x01u, 0x00u, 0x00u, 0x00u});
+
+        ::fast_io::vector<::std::byte> typesec{};
+        push_bytes(typesec, {0x01u, 0x60u, 0x00u, 0x00u});
+        push_section(mod, 1u, typesec);
+
+        ::fast_io::vector<::std::byte> funcsec{};
+        push_bytes(funcsec, {0x02u, 0x00u, 0x00u});
+        push_section(mod, 3u, funcsec);
+
+        ::fast_io::vector<::std::byte> memsec{};
+        push_bytes(memsec, {0x01u, 0x00u, 0x01u});
+        push_section(mod, 5u, memsec);
+
+        ::fast_io::vector<::std::byte> exportsec{};
+        push_bytes(exportsec, {0x01u, 0x01u, 0x66u, 0x00u, 0x00u});
+        push_section(mod, 7u, exportsec);
+
+        ::fast_io::vector<::std::byte> codesec{};
+        push_bytes(codesec, {0x02u});
+        push_bytes(codesec, {0x02u, 0x00u, 0x0Bu});
+        push_bytes(codesec, {0x04u, 0x01u, 0x01u, bad_local_type ? 0x00u : 0x7Fu, 0x0Bu});
+        push_section(mod, 10u, codesec);
+
+        ::fast_io::vector<::std::byte> datasec{};
+        push_bytes(datasec, {0x01u, 0x00u, 0x41u, 0x00u, 0x0Bu, 0x02u, 0x61u, 0x62u});
+        push_section(mod, 11u, datasec);
+
+        return mod;
+    }
+
+    inline ::uwvm2::parser::wasm::concepts::feature_parameter_t<wasm1> make_para(bool link_scan_only)
+    {
+        ::uwvm2::parser::wasm::concepts::feature_parameter_t<wasm1> para{};
+        ::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<::uwvm2::parser::wasm::standard::wasm1::features::wasm1_feature_parameter_t>(
+            para.parameters)
+            .link_scan_only = link_scan_only;
+        return para;
+    }
+
+    template <typename Sec, typename Storage>
+    inline auto const& get_section(Storage const& module_storage)
+    {
+        return ::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<Sec>(module_storage.sections);
+    }
+}  // namespace test
+
+int main()
+{
+    using namespace ::uwvm2::parser::wasm::standard::wasm1::features;
+
+    // Link scan: the linking information is available, the code and data sections are only spans. After completion the storage is the same as a
+    // complete parse.
+    {
+        auto const mod{::test::make_module(false)};
+
+        auto const full_para{::test::make_para(false)};
+        ::uwvm2::parser::wasm::base::error_impl full_err{};
+        auto const full{::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_handle_func<::test::wasm1>(mod.cbegin(), mod.cend(), full_err, full_para)};
+
+        auto const scan_para{::test::make_para(true)};
+        ::uwvm2::parser::wasm::base::error_impl scan_err{};
+        auto scan{::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_handle_func<::test::wasm1>(mod.cbegin(), mod.cend(), scan_err, scan_para)};
+
+        auto const& scan_exportsec{::test::get_section<export_section_storage_t<::test::wasm1>>(scan)};
+        auto const& scan_codesec{::test::get_section<code_section_storage_t<::test::wasm1>>(scan)};
+        auto const& scan_datasec{::test::get_section<data_section_storage_t<::test::wasm1>>(scan)};
+
+        if(scan_exportsec.exports.size() != 1uz || !scan_codesec.codes.empty() || scan_codesec.sec_span.sec_begin == nullptr ||
+           !scan_datasec.datas.empty() || scan_datasec.sec_span.sec_begin == nullptr) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+
+        ::uwvm2::parser::wasm::standard::wasm1::features::complete_link_scan(scan, scan_err, scan_para);
+
+        auto const& full_codesec{::test::get_section<code_section_storage_t<::test::wasm1>>(full)};
+        auto const& full_datasec{::test::get_section<data_section_storage_t<::test::wasm1>>(full)};
+
+        if(scan_codesec.codes.size() != 2uz || scan_codesec.codes.size() != full_codesec.codes.size() ||
+           scan_codesec.sec_span.sec_begin != full_codesec.sec_span.sec_begin || scan_datasec.datas.size() != full_datasec.datas.size()) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+
+        for(::std::size_t i{}; i != full_codesec.codes.size(); ++i)
+        {
+            auto const& s{scan_codesec.codes.index_unchecked(i)};
+            auto const& f{full_codesec.codes.index_unchecked(i)};
+            if(s.body.code_begin != f.body.code_begin || s.body.code_end != f.body.code_end || s.all_local_count != f.all_local_count) [[unlikely]]
+            {
+                ::fast_io::fast_terminate();
+            }
+        }
+    }
+
+#if defined(__cpp_exceptions) && !defined(UWVM_TERMINATE_IMME_WHEN_PARSE)
+    // Errors in the skipped sections are reported on completion
+    {
+        auto const mod{::test::make_module(true)};
+
+        auto const scan_para{::test::make_para(true)};
+        ::uwvm2::parser::wasm::base::error_impl scan_err{};
+        auto scan{::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_handle_func<::test::wasm1>(mod.cbegin(), mod.cend(), scan_err, scan_para)};
+
+        try
+        {
+            ::uwvm2::parser::wasm::standard::wasm1::features::complete_link_scan(scan, scan_err, scan_para);
+            ::fast_io::fast_terminate();
+        }
+        catch(::fast_io::error)
+        {
+        }
+
+        if(scan_err.err_code != ::uwvm2::parser::wasm::base::wasm_parse_error_code::illegal_value_type) [[unlikely]] { ::fast_io::fast_terminate(); }
+    }
+#endif
+}
+
+// macro
+#include <uwvm2/utils/macro/pop_macros.h>
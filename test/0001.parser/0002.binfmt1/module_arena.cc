@@ -0,0 +1,115 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2025-07-18
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <memory>
+#include <utility>
+
+#include <uwvm2/utils/macro/push_macros.h>
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.parser.wasm.binfmt.base;
+#else
+# include <fast_io.h>
+# include <fast_io_dsal/vector.h>
+# include <uwvm2/parser/wasm/binfmt/base/impl.h>
+#endif
+
+namespace test
+{
+    struct entry_t
+    {
+        ::std::uint_least32_t count{};
+        ::std::uint_least8_t type{};
+    };
+
+    inline ::std::size_t chunk_count(::uwvm2::parser::wasm::binfmt::module_arena_t const& arena) noexcept
+    {
+        ::std::size_t n{};
+        for(auto c{arena.chunks}; c != nullptr; c = c->next) { ++n; }
+        return n;
+    }
+}  // namespace test
+
+int main()
+{
+    using module_arena_t = ::uwvm2::parser::wasm::binfmt::module_arena_t;
+
+    module_arena_t arena{};
+
+    // Arrays filled once, grown across chunk boundaries
+    ::fast_io::vector<::uwvm2::parser::wasm::binfmt::module_arena_array_t<::test::entry_t>> arrays{};
+    for(::std::uint_least32_t i{}; i != 10000u; ++i)
+    {
+        ::uwvm2::parser::wasm::binfmt::module_arena_array_t<::test::entry_t> arr{};
+        arr.reserve(arena, i % 7u);
+        for(::std::uint_least32_t j{}; j != i % 7u; ++j) { arr.push_back_unchecked(::test::entry_t{i + j, static_cast<::std::uint_least8_t>(j)}); }
+
+        if(reinterpret_cast<::std::uintptr_t>(arr.data()) % alignof(::test::entry_t) != 0u) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        arrays.push_back(arr);
+    }
+
+    // Growing keeps the contents
+    {
+        ::uwvm2::parser::wasm::binfmt::module_arena_array_t<::test::entry_t> arr{};
+        arr.reserve(arena, 2uz);
+        arr.push_back_unchecked(::test::entry_t{1u, 2u});
+        arr.reserve(arena, 100000uz);  // dedicated chunk
+        if(arr.size() != 1uz || arr.capacity() != 100000uz || arr.index_unchecked(0uz).count != 1u) [[unlikely]] { ::fast_io::fast_terminate(); }
+    }
+
+    // Worker arenas are spliced in, moving the arena keeps the addresses
+    {
+        module_arena_t worker{};
+        auto const p{worker.allocate_n<double>(16uz)};
+        p[15] = 1.5;
+
+        auto const before{::test::chunk_count(arena)};
+        arena.merge(::std::move(worker));
+        if(worker.chunks != nullptr || ::test::chunk_count(arena) != before + 1uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        module_arena_t moved{::std::move(arena)};
+        if(arena.chunks != nullptr || p[15] != 1.5) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        arena = ::std::move(moved);
+    }
+
+    for(::std::uint_least32_t i{}; i != 10000u; ++i)
+    {
+        auto const& arr{arrays.index_unchecked(i)};
+        if(arr.size() != i % 7u) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        ::std::uint_least32_t j{};
+        for(auto const& e: arr)
+        {
+            if(e.count != i + j || e.type != j) [[unlikely]] { ::fast_io::fast_terminate(); }
+            ++j;
+        }
+    }
+}
+
+// macro
+#include <uwvm2/utils/macro/pop_macros.h>
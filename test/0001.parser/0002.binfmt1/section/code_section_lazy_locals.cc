@@ -0,0 +1,203 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2025-07-16
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <type_traits>
+#include <concepts>
+#include <memory>
+
+#include <uwvm2/utils/macro/push_macros.h>
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.parser.wasm.base;
+import uwvm2.parser.wasm.concepts;
+import uwvm2.parser.wasm.standard.wasm1.type;
+import uwvm2.parser.wasm.standard.wasm1.features;
+import uwvm2.parser.wasm.binfmt.binfmt_ver1;
+#else
+# include <fast_io.h>
+# include <fast_io_dsal/vector.h>
+# include <fast_io_dsal/tuple.h>
+# include <uwvm2/parser/wasm/base/impl.h>
+# include <uwvm2/parser/wasm/concepts/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/features/impl.h>
+# include <uwvm2/parser/wasm/binfmt/binfmt_ver1/impl.h>
+#endif
+
+namespace test
+{
+    using wasm1 = ::uwvm2::parser::wasm::standard::wasm1::features::wasm1;
+
+    inline constexpr ::std::size_t func_count{16uz};
+    inline constexpr ::std::size_t bad_local_type_func{6uz};
+
+    inline void push_leb128(::fast_io::vector<::std::byte>& vec, ::std::uint_least32_t val)
+    {
+        do {
+            auto byte{static_cast<::std::uint_least8_t>(val & 0x7Fu)};
+            val >>= 7u;
+            if(val != 0u) { byte |= 0x80u; }
+            vec.push_back(static_cast<::std::byte>(byte));
+        }
+        while(val != 0u);
+    }
+
+    inline void push_section(::fast_io::vector<::std::byte>& vec, ::std::uint_least8_t id, ::fast_io::vector<::std::byte> const& content)
+    {
+        vec.push_back(static_cast<::std::byte>(id));
+        push_leb128(vec, static_cast<::std::uint_least32_t>(content.size()));
+        for(auto const i: content) { vec.push_back(i); }
+    }
+
+    /// @brief (module) (type (func)) (func * func_count (local ...) nop ...), the locals of bad_local_type_func have an illegal value type
+    inline ::fast_io::vector<::std::byte> make_module()
+    {
+        ::fast_io::vector<::std::byte> mod{};
+        for(auto const i: {0x00u, 0x61u, 0x73u, 0x6Du, 0x01u, 0x00u, 0x00u, 0x00u}) { mod.push_back(static_cast<::std::byte>(i)); }
+
+        // type section: 1 type, func () -> ()
+        ::fast_io::vector<::std::byte> typesec{};
+        for(auto const i: {0x01u, 0x60u, 0x00u, 0x00u}) { typesec.push_back(static_cast<::std::byte>(i)); }
+        push_section(mod, 1u, typesec);
+
+        // function section: func_count * typeidx 0
+        ::fast_io::vector<::std::byte> funcsec{};
+        push_leb128(funcsec, static_cast<::std::uint_least32_t>(func_count));
+        for(::std::size_t i{}; i != func_count; ++i) { funcsec.push_back(::std::byte{}); }
+        push_section(mod, 3u, funcsec);
+
+        // code section: function i declares i % 4 groups, group j has i + j locals of type 0x7F - j
+        ::fast_io::vector<::std::byte> codesec{};
+        push_leb128(codesec, static_cast<::std::uint_least32_t>(func_count));
+        for(::std::size_t i{}; i != func_count; ++i)
+        {
+            ::fast_io::vector<::std::byte> body{};
+            auto const local_groups{static_cast<::std::uint_least32_t>(i % 4uz)};
+            push_leb128(body, local_groups);
+            for(::std::uint_least32_t j{}; j != local_groups; ++j)
+            {
+                push_leb128(body, static_cast<::std::uint_least32_t>(i + j));
+                body.push_back(i == bad_local_type_func ? ::std::byte{0x00u} : static_cast<::std::byte>(0x7Fu - j));
+            }
+            body.push_back(::std::byte{0x01u});  // nop
+            body.push_back(::std::byte{0x0Bu});  // end
+
+            push_leb128(codesec, static_cast<::std::uint_least32_t>(body.size()));
+            for(auto const j: body) { codesec.push_back(j); }
+        }
+        push_section(mod, 10u, codesec);
+
+        return mod;
+    }
+
+    inline auto parse(::fast_io::vector<::std::byte> const& mod, ::uwvm2::parser::wasm::base::error_impl& err)
+    {
+        ::uwvm2::parser::wasm::concepts::feature_parameter_t<wasm1> para{};
+        ::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<::uwvm2::parser::wasm::standard::wasm1::features::wasm1_feature_parameter_t>(
+            para.parameters)
+            .code_section_lazy_locals = true;
+        return ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_handle_func<wasm1>(mod.cbegin(), mod.cend(), err, para);
+    }
+}  // namespace test
+
+int main()
+{
+    namespace features = ::uwvm2::parser::wasm::standard::wasm1::features;
+
+    auto const mod{::test::make_module()};
+
+    // The illegal local type is not seen by the parser in lazy mode
+    ::uwvm2::parser::wasm::base::error_impl err{};
+    auto module_storage{::test::parse(mod, err)};
+    auto& codesec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<features::code_section_storage_t<::test::wasm1>>(module_storage.sections)};
+
+    if(codesec.codes.size() != ::test::func_count) [[unlikely]] { ::fast_io::fast_terminate(); }
+    for(auto const& code: codesec.codes)
+    {
+        if(features::is_code_locals_decoded(code) || !code.locals.empty() || code.all_local_count != 0u) [[unlikely]] { ::fast_io::fast_terminate(); }
+    }
+
+    // Decoding one function leaves the others untouched
+    {
+        auto const& code{features::get_code_with_decoded_locals(codesec, module_storage.arena, 7uz, err)};
+        // 3 groups: 7 i32, 8 i64, 9 f32
+        if(!features::is_code_locals_decoded(code) || code.locals.size() != 3uz || code.all_local_count != 24u) [[unlikely]] { ::fast_io::fast_terminate(); }
+        for(::std::size_t j{}; j != 3uz; ++j)
+        {
+            if(code.locals.index_unchecked(j).count != 7u + j ||
+               static_cast<::std::uint_least8_t>(code.locals.index_unchecked(j).type) != 0x7Fu - j) [[unlikely]]
+            {
+                ::fast_io::fast_terminate();
+            }
+        }
+        // expr_begin is after the local declarations: groups, 3 * (count, type)
+        if(code.body.expr_begin != code.body.code_begin + 7) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        for(::std::size_t i{}; i != ::test::func_count; ++i)
+        {
+            if(i != 7uz && features::is_code_locals_decoded(codesec.codes.index_unchecked(i))) [[unlikely]] { ::fast_io::fast_terminate(); }
+        }
+
+        // The second touch returns the cached result
+        auto const& again{features::get_code_with_decoded_locals(codesec, module_storage.arena, 7uz, err)};
+        if(::std::addressof(again) != ::std::addressof(code) || again.locals.size() != 3uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+    }
+
+    // A function without local declarations
+    {
+        auto const& code{features::get_code_with_decoded_locals(codesec, module_storage.arena, 4uz, err)};
+        if(!features::is_code_locals_decoded(code) || !code.locals.empty() || code.all_local_count != 0u) [[unlikely]] { ::fast_io::fast_terminate(); }
+    }
+
+#if defined(__cpp_exceptions) && !defined(UWVM_TERMINATE_IMME_WHEN_PARSE)
+    // The malformed local declarations are only reported when the function is touched, every time, and allocate nothing in the module arena
+    auto const arena_chunks{module_storage.arena.chunks};
+    auto const arena_curr{module_storage.arena.curr};
+    for(unsigned round{}; round != 3u; ++round)
+    {
+        ::uwvm2::parser::wasm::base::error_impl local_err{};
+        try
+        {
+            [[maybe_unused]] auto const& code{features::get_code_with_decoded_locals(codesec, module_storage.arena, ::test::bad_local_type_func, local_err)};
+            ::fast_io::fast_terminate();
+        }
+        catch(::fast_io::error)
+        {
+        }
+
+        auto const& code{codesec.codes.index_unchecked(::test::bad_local_type_func)};
+        if(local_err.err_code != ::uwvm2::parser::wasm::base::wasm_parse_error_code::illegal_value_type || features::is_code_locals_decoded(code) ||
+           !code.locals.empty() || code.locals.capacity() != 0uz || code.all_local_count != 0u) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+        if(module_storage.arena.chunks != arena_chunks || module_storage.arena.curr != arena_curr) [[unlikely]] { ::fast_io::fast_terminate(); }
+    }
+#endif
+}
+
+// macro
+#include <uwvm2/utils/macro/pop_macros.h>
@@ -0,0 +1,273 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2025-07-16
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <type_traits>
+#include <concepts>
+#include <memory>
+#include <cstdio>
+#include <thread>
+#include <system_error>
+
+#include <uwvm2/utils/macro/push_macros.h>
+
+// Threads cannot be started once the address space is exhausted, the sanitizers need more address space for their shadow memory
+#if defined(__linux__) && defined(__cpp_exceptions) && !defined(__SANITIZE_ADDRESS__) && !defined(__SANITIZE_THREAD__)
+# define UWVM_TEST_LIMIT_ADDRESS_SPACE
+# include <unistd.h>
+# include <sys/resource.h>
+#endif
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.parser.wasm.base;
+import uwvm2.parser.wasm.concepts;
+import uwvm2.parser.wasm.standard.wasm1.type;
+import uwvm2.parser.wasm.standard.wasm1.features;
+import uwvm2.parser.wasm.binfmt.binfmt_ver1;
+#else
+# include <fast_io.h>
+# include <fast_io_dsal/vector.h>
+# include <fast_io_dsal/tuple.h>
+# include <uwvm2/parser/wasm/base/impl.h>
+# include <uwvm2/parser/wasm/concepts/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/features/impl.h>
+# include <uwvm2/parser/wasm/binfmt/binfmt_ver1/impl.h>
+#endif
+
+namespace test
+{
+    using wasm1 = ::uwvm2::parser::wasm::standard::wasm1::features::wasm1;
+
+    inline constexpr ::std::size_t func_count{4096uz};
+
+    inline void push_leb128(::fast_io::vector<::std::byte>& vec, ::std::uint_least32_t val)
+    {
+        do {
+            auto byte{static_cast<::std::uint_least8_t>(val & 0x7Fu)};
+            val >>= 7u;
+            if(val != 0u) { byte |= 0x80u; }
+            vec.push_back(static_cast<::std::byte>(byte));
+        }
+        while(val != 0u);
+    }
+
+    inline void push_section(::fast_io::vector<::std::byte>& vec, ::std::uint_least8_t id, ::fast_io::vector<::std::byte> const& content)
+    {
+        vec.push_back(static_cast<::std::byte>(id));
+        push_leb128(vec, static_cast<::std::uint_least32_t>(content.size()));
+        for(auto const i: content) { vec.push_back(i); }
+    }
+
+    /// @brief (module) (type (func)) (func * func_count (local ...) nop ...)
+    inline ::fast_io::vector<::std::byte> make_module(::std::size_t bad_local_type_func)
+    {
+        ::fast_io::vector<::std::byte> mod{};
+        for(auto const i: {0x00u, 0x61u, 0x73u, 0x6Du, 0x01u, 0x00u, 0x00u, 0x00u}) { mod.push_back(static_cast<::std::byte>(i)); }
+
+        // type section: 1 type, func () -> ()
+        ::fast_io::vector<::std::byte> typesec{};
+        for(auto const i: {0x01u, 0x60u, 0x00u, 0x00u}) { typesec.push_back(static_cast<::std::byte>(i)); }
+        push_section(mod, 1u, typesec);
+
+        // function section: func_count * typeidx 0
+        ::fast_io::vector<::std::byte> funcsec{};
+        push_leb128(funcsec, static_cast<::std::uint_least32_t>(func_count));
+        for(::std::size_t i{}; i != func_count; ++i) { funcsec.push_back(::std::byte{}); }
+        push_section(mod, 3u, funcsec);
+
+        // code section: different local declarations and body sizes for each function
+        ::fast_io::vector<::std::byte> codesec{};
+        push_leb128(codesec, static_cast<::std::uint_least32_t>(func_count));
+        for(::std::size_t i{}; i != func_count; ++i)
+        {
+            ::fast_io::vector<::std::byte> body{};
+            auto const local_groups{static_cast<::std::uint_least32_t>(i % 4uz)};
+            push_leb128(body, local_groups);
+            for(::std::uint_least32_t j{}; j != local_groups; ++j)
+            {
+                push_leb128(body, static_cast<::std::uint_least32_t>(i + j));
+                // i32, i64, f32, f64
+                body.push_back(i == bad_local_type_func ? ::std::byte{0x00u} : static_cast<::std::byte>(0x7Fu - j));
+            }
+            for(::std::size_t j{}; j != i % 32uz; ++j) { body.push_back(::std::byte{0x01u}); }  // nop
+            body.push_back(::std::byte{0x0Bu});                                                 // end
+
+            push_leb128(codesec, static_cast<::std::uint_least32_t>(body.size()));
+            for(auto const j: body) { codesec.push_back(j); }
+        }
+        push_section(mod, 10u, codesec);
+
+        return mod;
+    }
+
+    inline auto parse(::fast_io::vector<::std::byte> const& mod, ::std::size_t threads, ::uwvm2::parser::wasm::base::error_impl& err)
+    {
+        ::uwvm2::parser::wasm::concepts::feature_parameter_t<wasm1> para{};
+        ::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<::uwvm2::parser::wasm::standard::wasm1::features::wasm1_feature_parameter_t>(
+            para.parameters)
+            .code_section_parse_threads = threads;
+        return ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_handle_func<wasm1>(mod.cbegin(), mod.cend(), err, para);
+    }
+
+    template <typename Module>
+    inline void check_same_codes(Module const& serial, Module const& parallel)
+    {
+        auto const& serial_codes{
+            ::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<
+                ::uwvm2::parser::wasm::standard::wasm1::features::code_section_storage_t<wasm1>>(serial.sections)
+                .codes};
+        auto const& parallel_codes{
+            ::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<
+                ::uwvm2::parser::wasm::standard::wasm1::features::code_section_storage_t<wasm1>>(parallel.sections)
+                .codes};
+
+        if(serial_codes.size() != func_count || parallel_codes.size() != func_count) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        for(::std::size_t i{}; i != func_count; ++i)
+        {
+            auto const& s{serial_codes.index_unchecked(i)};
+            auto const& p{parallel_codes.index_unchecked(i)};
+
+            if(s.body.code_begin != p.body.code_begin || s.body.expr_begin != p.body.expr_begin || s.body.code_end != p.body.code_end ||
+               s.all_local_count != p.all_local_count || s.locals.size() != p.locals.size()) [[unlikely]]
+            {
+                ::fast_io::fast_terminate();
+            }
+
+            for(::std::size_t j{}; j != s.locals.size(); ++j)
+            {
+                if(s.locals.index_unchecked(j).count != p.locals.index_unchecked(j).count ||
+                   s.locals.index_unchecked(j).type != p.locals.index_unchecked(j).type) [[unlikely]]
+                {
+                    ::fast_io::fast_terminate();
+                }
+            }
+        }
+    }
+
+#ifdef UWVM_TEST_LIMIT_ADDRESS_SPACE
+    /// @brief  Leave 4 MiB of address space, less than the stack of a thread
+    /// @return false if the limit cannot be set or a thread still starts
+    inline bool exhaust_thread_address_space(::rlimit const& old_limit)
+    {
+        long pages{};
+        if(auto const statm{::std::fopen("/proc/self/statm", "r")}; statm != nullptr)
+        {
+            if(::std::fscanf(statm, "%ld", ::std::addressof(pages)) != 1) { pages = 0; }
+            ::std::fclose(statm);
+        }
+        if(pages <= 0) { return false; }
+
+        auto limit{old_limit};
+        limit.rlim_cur = static_cast<::rlim_t>(pages) * static_cast<::rlim_t>(::sysconf(_SC_PAGESIZE)) + static_cast<::rlim_t>(4u * 1024u * 1024u);
+        if(limit.rlim_cur > old_limit.rlim_max || ::setrlimit(RLIMIT_AS, ::std::addressof(limit)) != 0) { return false; }
+
+        try
+        {
+            ::std::thread probe{[] {}};
+            probe.join();
+        }
+        catch(::std::system_error const&)
+        {
+            return true;
+        }
+
+        ::setrlimit(RLIMIT_AS, ::std::addressof(old_limit));
+        return false;
+    }
+#endif
+}  // namespace test
+
+int main()
+{
+    // The parallel parser must produce the same result as the serial parser
+    {
+        auto const mod{::test::make_module(SIZE_MAX)};
+
+        ::uwvm2::parser::wasm::base::error_impl serial_err{};
+        auto const serial{::test::parse(mod, 0uz, serial_err)};
+        ::uwvm2::parser::wasm::base::error_impl parallel_err{};
+        auto const parallel{::test::parse(mod, 4uz, parallel_err)};
+
+        ::test::check_same_codes(serial, parallel);
+    }
+
+#ifdef UWVM_TEST_LIMIT_ADDRESS_SPACE
+    // No worker thread can be started: the calling thread parses every chunk
+    {
+        auto const mod{::test::make_module(SIZE_MAX)};
+
+        ::uwvm2::parser::wasm::base::error_impl serial_err{};
+        auto const serial{::test::parse(mod, 0uz, serial_err)};
+
+        ::rlimit old_limit{};
+        if(::getrlimit(RLIMIT_AS, ::std::addressof(old_limit)) == 0 && ::test::exhaust_thread_address_space(old_limit))
+        {
+            ::uwvm2::parser::wasm::base::error_impl parallel_err{};
+            auto const parallel{::test::parse(mod, 4uz, parallel_err)};
+            ::setrlimit(RLIMIT_AS, ::std::addressof(old_limit));
+
+            ::test::check_same_codes(serial, parallel);
+        }
+    }
+#endif
+
+#if defined(__cpp_exceptions) && !defined(UWVM_TERMINATE_IMME_WHEN_PARSE)
+    // The parallel parser reports the same (lowest offset) error as the serial parser
+    {
+        auto const mod{::test::make_module(2023uz)};
+
+        ::uwvm2::parser::wasm::base::error_impl serial_err{};
+        try
+        {
+            [[maybe_unused]] auto const serial{::test::parse(mod, 0uz, serial_err)};
+            ::fast_io::fast_terminate();
+        }
+        catch(::fast_io::error)
+        {
+        }
+
+        ::uwvm2::parser::wasm::base::error_impl parallel_err{};
+        try
+        {
+            [[maybe_unused]] auto const parallel{::test::parse(mod, 4uz, parallel_err)};
+            ::fast_io::fast_terminate();
+        }
+        catch(::fast_io::error)
+        {
+        }
+
+        if(serial_err.err_code != ::uwvm2::parser::wasm::base::wasm_parse_error_code::illegal_value_type || serial_err.err_code != parallel_err.err_code ||
+           serial_err.err_curr != parallel_err.err_curr) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+    }
+#endif
+}
+
+// macro
+#include <uwvm2/utils/macro/pop_macros.h>
@@ -0,0 +1,202 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2025-07-16
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <type_traits>
+#include <concepts>
+#include <memory>
+#include <initializer_list>
+
+#include <uwvm2/utils/macro/push_macros.h>
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.parser.wasm.base;
+import uwvm2.parser.wasm.concepts;
+import uwvm2.parser.wasm.standard.wasm1.type;
+import uwvm2.parser.wasm.standard.wasm1.features;
+import uwvm2.parser.wasm.binfmt.binfmt_ver1;
+#else
+# include <fast_io.h>
+# include <fast_io_dsal/vector.h>
+# include <fast_io_dsal/tuple.h>
+# include <uwvm2/parser/wasm/base/impl.h>
+# include <uwvm2/parser/wasm/concepts/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/features/impl.h>
+# include <uwvm2/parser/wasm/binfmt/binfmt_ver1/impl.h>
+#endif
+
+namespace test
+{
+    using wasm1 = ::uwvm2::parser::wasm::standard::wasm1::features::wasm1;
+
+    inline void push_leb128(::fast_io::vector<::std::byte>& vec, ::std::uint_least32_t val)
+    {
+        do {
+            auto byte{static_cast<::std::uint_least8_t>(val & 0x7Fu)};
+            val >>= 7u;
+            if(val != 0u) { byte |= 0x80u; }
+            vec.push_back(static_cast<::std::byte>(byte));
+        }
+        while(val != 0u);
+    }
+
+    inline void push_section(::fast_io::vector<::std::byte>& vec, ::std::uint_least8_t id, ::fast_io::vector<::std::byte> const& content)
+    {
+        vec.push_back(static_cast<::std::byte>(id));
+        push_leb128(vec, static_cast<::std::uint_least32_t>(content.size()));
+        for(auto const i: content) { vec.push_back(i); }
+    }
+
+    inline void push_body(::fast_io::vector<::std::byte>& codesec, ::std::initializer_list<unsigned> instrs)
+    {
+        // no local declarations
+        push_leb128(codesec, static_cast<::std::uint_least32_t>(instrs.size() + 1uz));
+        codesec.push_back(::std::byte{});
+        for(auto const i: instrs) { codesec.push_back(static_cast<::std::byte>(i)); }
+    }
+
+    /// @brief (module) (type (func (param i32) (result i32))) (func $0 ...) (func $1 ...)
+    inline ::fast_io::vector<::std::byte> make_module(bool invalid)
+    {
+        ::fast_io::vector<::std::byte> mod{};
+        for(auto const i: {0x00u, 0x61u, 0x73u, 0x6Du, 0x01u, 0x00u, 0x00u, 0x00u}) { mod.push_back(static_cast<::std::byte>(i)); }
+
+        // type section: 1 type, func (i32) -> (i32)
+        ::fast_io::vector<::std::byte> typesec{};
+        for(auto const i: {0x01u, 0x60u, 0x01u, 0x7Fu, 0x01u, 0x7Fu}) { typesec.push_back(static_cast<::std::byte>(i)); }
+        push_section(mod, 1u, typesec);
+
+        // function section: 2 * typeidx 0
+        ::fast_io::vector<::std::byte> funcsec{};
+        for(auto const i: {0x02u, 0x00u, 0x00u}) { funcsec.push_back(static_cast<::std::byte>(i)); }
+        push_section(mod, 3u, funcsec);
+
+        ::fast_io::vector<::std::byte> codesec{};
+        push_leb128(codesec, 2u);
+
+        // local.get 0 if (result i32) i32.const 1 else local.get 0 i32.const 1 i32.sub end block br 0 end end
+        push_body(codesec, {0x20u, 0x00u, 0x04u, 0x7Fu, 0x41u, 0x01u, 0x05u, 0x20u, 0x00u, 0x41u, 0x01u, 0x6Bu, 0x0Bu, 0x02u, 0x40u, 0x0Cu, 0x00u, 0x0Bu, 0x0Bu});
+
+        if(invalid)
+        {
+            // i64.const 0 end: the result of the function is i32
+            push_body(codesec, {0x42u, 0x00u, 0x0Bu});
+        }
+        else
+        {
+            // local.get 0 call 0 end
+            push_body(codesec, {0x20u, 0x00u, 0x10u, 0x00u, 0x0Bu});
+        }
+
+        push_section(mod, 10u, codesec);
+
+        return mod;
+    }
+
+    inline auto parse(::fast_io::vector<::std::byte> const& mod, ::uwvm2::parser::wasm::base::error_impl& err)
+    {
+        ::uwvm2::parser::wasm::concepts::feature_parameter_t<wasm1> para{};
+        ::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<::uwvm2::parser::wasm::standard::wasm1::features::wasm1_feature_parameter_t>(
+            para.parameters)
+            .code_section_validate = true;
+        return ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_handle_func<wasm1>(mod.cbegin(), mod.cend(), err, para);
+    }
+}  // namespace test
+
+int main()
+{
+    // Metadata generated by the validator
+    {
+        auto const mod{::test::make_module(false)};
+
+        ::uwvm2::parser::wasm::base::error_impl err{};
+        auto const module_storage{::test::parse(mod, err)};
+
+        auto const& codesec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<
+            ::uwvm2::parser::wasm::standard::wasm1::features::code_section_storage_t<::test::wasm1>>(module_storage.sections)};
+
+        if(codesec.codes.size() != 2uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        auto const& func0{codesec.codes.index_unchecked(0uz)};
+        auto const& func1{codesec.codes.index_unchecked(1uz)};
+
+        if(!func0.metadata.validated || !func1.metadata.validated) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        if(func0.metadata.max_operand_stack_height != 2u || func0.metadata.max_control_stack_height != 2u || !func0.metadata.is_leaf) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+
+        if(func1.metadata.max_operand_stack_height != 1u || func1.metadata.max_control_stack_height != 1u || func1.metadata.is_leaf) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+
+        // if, else, br
+        if(func0.metadata.branch_target_begin != 0uz || func0.metadata.branch_target_count != 3uz || func1.metadata.branch_target_count != 0uz ||
+           codesec.branch_targets.size() != 3uz) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+
+        auto const expr{func0.body.expr_begin};
+        auto const& if_target{codesec.branch_targets.index_unchecked(0uz)};
+        auto const& else_target{codesec.branch_targets.index_unchecked(1uz)};
+        auto const& br_target{codesec.branch_targets.index_unchecked(2uz)};
+
+        if(if_target.instr != expr + 2 || if_target.target != expr + 7 || else_target.instr != expr + 6 || else_target.target != expr + 13 ||
+           br_target.instr != expr + 15 || br_target.target != expr + 18) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+    }
+
+#if defined(__cpp_exceptions) && !defined(UWVM_TERMINATE_IMME_WHEN_PARSE)
+    // The result of the function does not match
+    {
+        auto const mod{::test::make_module(true)};
+
+        ::uwvm2::parser::wasm::base::error_impl err{};
+        try
+        {
+            [[maybe_unused]] auto const module_storage{::test::parse(mod, err)};
+            ::fast_io::fast_terminate();
+        }
+        catch(::fast_io::error)
+        {
+        }
+
+        if(err.err_code != ::uwvm2::parser::wasm::base::wasm_parse_error_code::operand_type_mismatch || err.err_selectable.u8arr[0] != 0x7Fu ||
+           err.err_selectable.u8arr[1] != 0x7Eu) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+    }
+#endif
+}
+
+// macro
+#include <uwvm2/utils/macro/pop_macros.h>
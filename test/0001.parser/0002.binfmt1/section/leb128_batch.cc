@@ -0,0 +1,138 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2025-07-16
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <type_traits>
+#include <concepts>
+#include <memory>
+
+#include <uwvm2/utils/macro/push_macros.h>
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.parser.wasm.standard.wasm1.features;
+#else
+# include <fast_io.h>
+# include <fast_io_dsal/vector.h>
+# include <uwvm2/parser/wasm/standard/wasm1/features/impl.h>
+#endif
+
+namespace test
+{
+    inline void push_leb128(::fast_io::vector<::std::byte>& vec, ::std::uint_least32_t val, ::std::size_t padding)
+    {
+        do {
+            auto byte{static_cast<::std::uint_least8_t>(val & 0x7Fu)};
+            val >>= 7u;
+            if(val != 0u || padding != 0uz) { byte |= 0x80u; }
+            vec.push_back(static_cast<::std::byte>(byte));
+        }
+        while(val != 0u);
+
+        // Redundant zeros
+        for(; padding != 0uz; --padding) { vec.push_back(padding == 1uz ? ::std::byte{0x00u} : ::std::byte{0x80u}); }
+    }
+
+    inline constexpr ::std::uint_least32_t bound{1000000u};
+
+    /// @brief Mostly single-byte values with multi-byte values and redundant zeros in between
+    inline ::fast_io::vector<::std::byte> make_vector(::fast_io::vector<::std::uint_least32_t>& values, ::std::size_t count)
+    {
+        ::fast_io::vector<::std::byte> vec{};
+        ::std::uint_least32_t seed{12345u};
+        for(::std::size_t i{}; i != count; ++i)
+        {
+            seed = seed * 1103515245u + 12345u;
+            auto const kind{(seed >> 16u) % 64u};
+            ::std::uint_least32_t value{(seed >> 8u) % 128u};
+            ::std::size_t padding{};
+            if(kind == 0u) { value = (seed >> 4u) % bound; }
+            else if(kind == 1u) { value = (seed >> 8u) % 16384u; }
+            else if(kind == 2u) { padding = 1uz + (seed >> 12u) % 2uz; }
+            values.push_back(value);
+            push_leb128(vec, value, padding);
+        }
+        return vec;
+    }
+}  // namespace test
+
+int main()
+{
+    constexpr ::std::size_t count{100000uz};
+
+    ::fast_io::vector<::std::uint_least32_t> values{};
+    auto const vec{::test::make_vector(values, count)};
+
+    // Same result as decoding each value with leb128_get
+    {
+        ::fast_io::vector<::std::uint_least32_t> out{};
+        out.resize(count);
+
+        auto const res{::uwvm2::parser::wasm::standard::wasm1::features::decode_uleb128_u32_batch(vec.cbegin(), vec.cend(), out.data(), count, ::test::bound)};
+
+        if(res.code != ::fast_io::parse_code::ok || res.decoded != count || res.curr != vec.cend()) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        for(::std::size_t i{}; i != count; ++i)
+        {
+            if(out.index_unchecked(i) != values.index_unchecked(i)) [[unlikely]] { ::fast_io::fast_terminate(); }
+        }
+    }
+
+    // Narrower output
+    {
+        ::fast_io::vector<::std::uint_least16_t> out{};
+        out.resize(count);
+
+        auto const res{::uwvm2::parser::wasm::standard::wasm1::features::decode_uleb128_u32_batch(vec.cbegin(), vec.cend(), out.data(), count, 128u)};
+
+        // Stops at the first value not less than 128
+        ::std::size_t first_exceeds{};
+        while(values.index_unchecked(first_exceeds) < 128u) { ++first_exceeds; }
+
+        if(!res.exceeds_bound || res.code == ::fast_io::parse_code::ok || res.decoded != first_exceeds ||
+           res.exceeding_value != values.index_unchecked(first_exceeds)) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        for(::std::size_t i{}; i != first_exceeds; ++i)
+        {
+            if(out.index_unchecked(i) != values.index_unchecked(i)) [[unlikely]] { ::fast_io::fast_terminate(); }
+        }
+    }
+
+    // Truncated value at the end
+    {
+        ::fast_io::vector<::std::uint_least32_t> out{};
+        out.resize(2uz);
+
+        ::std::byte const truncated[]{::std::byte{0x01u}, ::std::byte{0x80u}};
+        auto const res{::uwvm2::parser::wasm::standard::wasm1::features::decode_uleb128_u32_batch(truncated, truncated + 2u, out.data(), 2uz, ::test::bound)};
+
+        if(res.code == ::fast_io::parse_code::ok || res.exceeds_bound || res.decoded != 1uz || res.curr != truncated + 1u) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+    }
+}
+
+// macro
+#include <uwvm2/utils/macro/pop_macros.h>
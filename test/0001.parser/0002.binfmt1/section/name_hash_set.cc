@@ -0,0 +1,296 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2025-07-16
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <type_traits>
+#include <concepts>
+#include <memory>
+#include <initializer_list>
+
+#include <uwvm2/utils/macro/push_macros.h>
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.parser.wasm.base;
+import uwvm2.parser.wasm.concepts;
+import uwvm2.parser.wasm.standard.wasm1.type;
+import uwvm2.parser.wasm.standard.wasm1.features;
+import uwvm2.parser.wasm.binfmt.binfmt_ver1;
+#else
+# include <fast_io.h>
+# include <fast_io_dsal/vector.h>
+# include <fast_io_dsal/string.h>
+# include <fast_io_dsal/string_view.h>
+# include <fast_io_dsal/tuple.h>
+# include <uwvm2/parser/wasm/base/impl.h>
+# include <uwvm2/parser/wasm/concepts/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/features/impl.h>
+# include <uwvm2/parser/wasm/binfmt/binfmt_ver1/impl.h>
+#endif
+
+namespace test
+{
+    using wasm1 = ::uwvm2::parser::wasm::standard::wasm1::features::wasm1;
+    namespace features = ::uwvm2::parser::wasm::standard::wasm1::features;
+
+    inline void push_leb128(::fast_io::vector<::std::byte>& vec, ::std::uint_least32_t val)
+    {
+        do {
+            auto byte{static_cast<::std::uint_least8_t>(val & 0x7Fu)};
+            val >>= 7u;
+            if(val != 0u) { byte |= 0x80u; }
+            vec.push_back(static_cast<::std::byte>(byte));
+        }
+        while(val != 0u);
+    }
+
+    inline void push_bytes(::fast_io::vector<::std::byte>& vec, ::std::initializer_list<unsigned> bytes)
+    {
+        for(auto const i: bytes) { vec.push_back(static_cast<::std::byte>(i)); }
+    }
+
+    inline void push_name(::fast_io::vector<::std::byte>& vec, ::fast_io::u8string_view name)
+    {
+        push_leb128(vec, static_cast<::std::uint_least32_t>(name.size()));
+        for(auto const c: name) { vec.push_back(static_cast<::std::byte>(c)); }
+    }
+
+    inline void push_section(::fast_io::vector<::std::byte>& vec, ::std::uint_least8_t id, ::fast_io::vector<::std::byte> const& content)
+    {
+        vec.push_back(static_cast<::std::byte>(id));
+        push_leb128(vec, static_cast<::std::uint_least32_t>(content.size()));
+        for(auto const i: content) { vec.push_back(i); }
+    }
+
+    /// @brief (module (type (func)) [import section] (func) [export section]), all imports and exports refer to function 0 or type 0
+    inline ::fast_io::vector<::std::byte> make_module(::fast_io::vector<::std::byte> const& importsec, ::fast_io::vector<::std::byte> const& exportsec)
+    {
+        ::fast_io::vector<::std::byte> mod{};
+        push_bytes(mod, {0x00u, 0x61u, 0x73u, 0x6Du, 0x01u, 0x00u, 0x00u, 0x00u});
+
+        ::fast_io::vector<::std::byte> typesec{};
+        push_bytes(typesec, {0x01u, 0x60u, 0x00u, 0x00u});
+        push_section(mod, 1u, typesec);
+
+        if(!importsec.empty()) { push_section(mod, 2u, importsec); }
+
+        ::fast_io::vector<::std::byte> funcsec{};
+        push_bytes(funcsec, {0x01u, 0x00u});
+        push_section(mod, 3u, funcsec);
+
+        if(!exportsec.empty()) { push_section(mod, 7u, exportsec); }
+
+        ::fast_io::vector<::std::byte> codesec{};
+        push_bytes(codesec, {0x01u, 0x02u, 0x00u, 0x0Bu});
+        push_section(mod, 10u, codesec);
+
+        return mod;
+    }
+
+    inline auto parse(::fast_io::vector<::std::byte> const& mod, ::uwvm2::parser::wasm::base::error_impl& err)
+    {
+        ::uwvm2::parser::wasm::concepts::feature_parameter_t<wasm1> para{};
+        return ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_handle_func<wasm1>(mod.cbegin(), mod.cend(), err, para);
+    }
+
+    /// @return the error code of the parse, ok if it succeeded
+    inline ::uwvm2::parser::wasm::base::wasm_parse_error_code parse_error(::fast_io::vector<::std::byte> const& mod)
+    {
+        ::uwvm2::parser::wasm::base::error_impl err{};
+#if defined(__cpp_exceptions) && !defined(UWVM_TERMINATE_IMME_WHEN_PARSE)
+        try
+#endif
+        {
+            [[maybe_unused]] auto const module_storage{parse(mod, err)};
+            return ::uwvm2::parser::wasm::base::wasm_parse_error_code::ok;
+        }
+#if defined(__cpp_exceptions) && !defined(UWVM_TERMINATE_IMME_WHEN_PARSE)
+        catch(::fast_io::error)
+        {
+            return err.err_code;
+        }
+#endif
+    }
+}  // namespace test
+
+int main()
+{
+    namespace features = ::test::features;
+
+    // The set itself: duplicates, kinds and growth
+    {
+        ::fast_io::vector<::fast_io::u8string> names{};
+        for(::std::size_t i{}; i != 5000uz; ++i) { names.push_back(::fast_io::u8concat_fast_io(u8"f", i)); }
+
+        // Pre-sized too small (0 and 1) and large enough, the table grows on demand and stays at most half full
+        for(auto const count: {0uz, 1uz, 5000uz})
+        {
+            features::name_hash_set_t<features::export_name_key> set{count};
+
+            for(auto const& name: names)
+            {
+                if(!set.insert({::fast_io::u8string_view{name.data(), name.size()}, 0u})) [[unlikely]] { ::fast_io::fast_terminate(); }
+            }
+            for(auto const& name: names)
+            {
+                // A duplicate of the same kind is found, the same name of another kind is not a duplicate
+                if(set.insert({::fast_io::u8string_view{name.data(), name.size()}, 0u}) ||
+                   !set.insert({::fast_io::u8string_view{name.data(), name.size()}, 3u})) [[unlikely]]
+                {
+                    ::fast_io::fast_terminate();
+                }
+            }
+
+            if(set.size != 10000uz || set.size * 2uz > set.slots.size() || set.mask != set.slots.size() - 1uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+            // find returns the stored key
+            for(auto const& name: names)
+            {
+                ::fast_io::u8string_view const name_view{name.data(), name.size()};
+                auto const found{set.find({name_view, 3u})};
+                if(found == nullptr || found->export_name != name_view || found->type != 3u || set.find({name_view, 1u}) != nullptr) [[unlikely]]
+                {
+                    ::fast_io::fast_terminate();
+                }
+            }
+        }
+
+        // An empty set finds nothing
+        {
+            features::name_hash_set_t<features::export_name_key> const set{};
+            if(set.find({u8"f", 0u}) != nullptr) [[unlikely]] { ::fast_io::fast_terminate(); }
+        }
+
+        // A full table of 8 slots: every probe sequence collides
+        {
+            features::name_hash_set_t<features::export_name_key> set{2uz};
+            for(::std::size_t i{}; i != 4uz; ++i)
+            {
+                auto const& name{names.index_unchecked(i)};
+                if(!set.insert({::fast_io::u8string_view{name.data(), name.size()}, 0u})) [[unlikely]] { ::fast_io::fast_terminate(); }
+            }
+            for(::std::size_t i{}; i != 4uz; ++i)
+            {
+                auto const& name{names.index_unchecked(i)};
+                if(set.insert({::fast_io::u8string_view{name.data(), name.size()}, 0u})) [[unlikely]] { ::fast_io::fast_terminate(); }
+            }
+        }
+
+        // The hashes are keyed once per process, a name keeps its hash
+        {
+            auto const key{features::details::name_hash_process_key()};
+            features::export_name_key const name{u8"f", 0u};
+            if(features::details::name_hash_process_key() != key || features::hash_name_key(name) != features::hash_name_key(name)) [[unlikely]]
+            {
+                ::fast_io::fast_terminate();
+            }
+        }
+
+        // The module name and the extern name are not concatenated
+        {
+            features::name_hash_set_t<features::import_name_key> set{};
+            if(!set.insert({{u8"ab", u8"c"}, 0u}) || !set.insert({{u8"a", u8"bc"}, 0u}) || set.insert({{u8"ab", u8"c"}, 0u})) [[unlikely]]
+            {
+                ::fast_io::fast_terminate();
+            }
+        }
+    }
+
+    // Duplicate names in a module
+    {
+        ::fast_io::vector<::std::byte> exportsec{};
+        ::test::push_leb128(exportsec, 2u);
+        ::test::push_name(exportsec, u8"f");
+        ::test::push_bytes(exportsec, {0x00u, 0x00u});
+        ::test::push_name(exportsec, u8"f");
+        ::test::push_bytes(exportsec, {0x00u, 0x00u});
+        if(::test::parse_error(::test::make_module({}, exportsec)) !=
+           ::uwvm2::parser::wasm::base::wasm_parse_error_code::duplicate_exports_of_the_same_export_type) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+
+        ::fast_io::vector<::std::byte> importsec{};
+        ::test::push_leb128(importsec, 3u);
+        for(auto const& [module_name, extern_name]:
+            {features::name_checker{u8"ab", u8"c"}, features::name_checker{u8"a", u8"bc"}, features::name_checker{u8"ab", u8"c"}})
+        {
+            ::test::push_name(importsec, module_name);
+            ::test::push_name(importsec, extern_name);
+            ::test::push_bytes(importsec, {0x00u, 0x00u});
+        }
+        if(::test::parse_error(::test::make_module(importsec, {})) !=
+           ::uwvm2::parser::wasm::base::wasm_parse_error_code::duplicate_imports_of_the_same_import_type) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+    }
+
+    // Many exports, the checker grows past its initial size
+    {
+        ::fast_io::vector<::std::byte> exportsec{};
+        ::test::push_leb128(exportsec, 3000u);
+        for(::std::size_t i{}; i != 3000uz; ++i)
+        {
+            auto const name{::fast_io::u8concat_fast_io(u8"export", i)};
+            ::test::push_name(exportsec, ::fast_io::u8string_view{name.data(), name.size()});
+            ::test::push_bytes(exportsec, {0x00u, 0x00u});
+        }
+
+        ::uwvm2::parser::wasm::base::error_impl err{};
+        auto const module_storage{::test::parse(::test::make_module({}, exportsec), err)};
+        auto const& exports{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<features::export_section_storage_t<::test::wasm1>>(
+                                module_storage.sections)
+                                .exports};
+        if(exports.size() != 3000uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+    }
+
+    // A declared count of u32max with a single entry: nothing is allocated for the declared count, the count mismatch is reported
+    {
+        ::fast_io::vector<::std::byte> exportsec{};
+        ::test::push_leb128(exportsec, 0xFFFF'FFFFu);
+        ::test::push_name(exportsec, u8"f");
+        ::test::push_bytes(exportsec, {0x00u, 0x00u});
+        if(::test::parse_error(::test::make_module({}, exportsec)) !=
+           ::uwvm2::parser::wasm::base::wasm_parse_error_code::export_section_resolved_not_match_the_actual_number) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+
+        ::fast_io::vector<::std::byte> importsec{};
+        ::test::push_leb128(importsec, 0xFFFF'FFFFu);
+        ::test::push_name(importsec, u8"m");
+        ::test::push_name(importsec, u8"f");
+        ::test::push_bytes(importsec, {0x00u, 0x00u});
+        if(::test::parse_error(::test::make_module(importsec, {})) !=
+           ::uwvm2::parser::wasm::base::wasm_parse_error_code::import_section_resolved_not_match_the_actual_number) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+    }
+}
+
+// macro
+#include <uwvm2/utils/macro/pop_macros.h>
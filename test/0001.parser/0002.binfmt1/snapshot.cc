@@ -0,0 +1,162 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2025-07-19
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <memory>
+#include <utility>
+
+#include <uwvm2/utils/macro/push_macros.h>
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.parser.wasm.binfmt.base;
+#else
+# include <fast_io.h>
+# include <fast_io_dsal/vector.h>
+# include <fast_io_dsal/string_view.h>
+# include <uwvm2/parser/wasm/binfmt/base/impl.h>
+#endif
+
+int main()
+{
+    using snapshot_writer_t = ::uwvm2::parser::wasm::binfmt::snapshot_writer_t;
+    using snapshot_reader_t = ::uwvm2::parser::wasm::binfmt::snapshot_reader_t;
+
+    ::std::byte module_bytes[256]{};
+    for(::std::size_t i{}; i != sizeof(module_bytes); ++i) { module_bytes[i] = static_cast<::std::byte>(i * 7u); }
+
+    auto const module_begin{module_bytes};
+    auto const module_end{module_bytes + sizeof(module_bytes)};
+
+    // The content hash depends on every byte
+    {
+        auto const h1{::uwvm2::parser::wasm::binfmt::snapshot_content_hash(module_begin, module_end)};
+        auto const h2{::uwvm2::parser::wasm::binfmt::snapshot_content_hash(module_begin, module_end)};
+        if(!(h1 == h2)) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        for(::std::size_t i{}; i != sizeof(module_bytes); ++i)
+        {
+            module_bytes[i] ^= ::std::byte{1u};
+            auto const h3{::uwvm2::parser::wasm::binfmt::snapshot_content_hash(module_begin, module_end)};
+            module_bytes[i] ^= ::std::byte{1u};
+            if(h1 == h3) [[unlikely]] { ::fast_io::fast_terminate(); }
+        }
+
+        // Length is part of the hash
+        if(::uwvm2::parser::wasm::binfmt::snapshot_content_hash(module_begin, module_end - 1) == h1) [[unlikely]] { ::fast_io::fast_terminate(); }
+    }
+
+    // The digest is SHA-256 (FIPS 180-2 test vector "abc")
+    {
+        constexpr ::std::uint_least8_t abc_digest[]{0xbau, 0x78u, 0x16u, 0xbfu, 0x8fu, 0x01u, 0xcfu, 0xeau, 0x41u, 0x41u, 0x40u,
+                                                    0xdeu, 0x5du, 0xaeu, 0x22u, 0x23u, 0xb0u, 0x03u, 0x61u, 0xa3u, 0x96u, 0x17u,
+                                                    0x7au, 0x9cu, 0xb4u, 0x10u, 0xffu, 0x61u, 0xf2u, 0x00u, 0x15u, 0xadu};
+        constexpr ::std::byte abc[]{::std::byte{0x61u}, ::std::byte{0x62u}, ::std::byte{0x63u}};
+
+        auto const h{::uwvm2::parser::wasm::binfmt::snapshot_content_hash(abc, abc + 3)};
+        for(::std::size_t i{}; i != sizeof(abc_digest); ++i)
+        {
+            if(h.digest[i] != static_cast<::std::byte>(abc_digest[i])) [[unlikely]] { ::fast_io::fast_terminate(); }
+        }
+    }
+
+    // Round trip
+    snapshot_writer_t writer{};
+    writer.module_begin = module_begin;
+    writer.module_end = module_end;
+
+    ::std::uint_least32_t const array[]{1u, 2u, 3u, 0xFFFFFFFFu};
+
+    writer.write(static_cast<::std::uint_least32_t>(42u));
+    writer.write_module_ptr(module_begin + 10);
+    writer.write_module_ptr(static_cast<::std::byte const*>(nullptr));
+    writer.write_module_ptr(module_end);
+    writer.write_module_string(::fast_io::u8string_view{reinterpret_cast<char8_t const*>(module_begin + 20), 5uz});
+    writer.write_array(array, 4uz);
+
+    {
+        snapshot_reader_t reader{writer.buffer.cbegin(), writer.buffer.cend(), module_begin, module_end, false};
+
+        if(reader.read<::std::uint_least32_t>() != 42u) [[unlikely]] { ::fast_io::fast_terminate(); }
+        if(reader.read_module_ptr<::std::byte>() != module_begin + 10) [[unlikely]] { ::fast_io::fast_terminate(); }
+        if(reader.read_module_ptr<::std::byte>() != nullptr) [[unlikely]] { ::fast_io::fast_terminate(); }
+        if(reader.read_module_ptr<::std::byte>() != module_end) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        auto const str{reader.read_module_string()};
+        if(reinterpret_cast<::std::byte const*>(str.data()) != module_begin + 20 || str.size() != 5uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        ::fast_io::vector<::std::uint_least32_t> vec{};
+        reader.read_array(vec);
+        if(vec.size() != 4uz || vec[3uz] != 0xFFFFFFFFu) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        if(reader.failed || reader.curr != reader.end) [[unlikely]] { ::fast_io::fast_terminate(); }
+    }
+
+    // A truncated snapshot fails and stays failed
+    {
+        snapshot_reader_t reader{writer.buffer.cbegin(), writer.buffer.cend() - 1, module_begin, module_end, false};
+
+        [[maybe_unused]] auto const v{reader.read<::std::uint_least32_t>()};
+        [[maybe_unused]] auto const p1{reader.read_module_ptr<::std::byte>()};
+        [[maybe_unused]] auto const p2{reader.read_module_ptr<::std::byte>()};
+        [[maybe_unused]] auto const p3{reader.read_module_ptr<::std::byte>()};
+        [[maybe_unused]] auto const str{reader.read_module_string()};
+
+        ::fast_io::vector<::std::uint_least32_t> vec{};
+        reader.read_array(vec);
+
+        if(!reader.failed) [[unlikely]] { ::fast_io::fast_terminate(); }
+        if(reader.read<::std::uint_least32_t>() != 0u) [[unlikely]] { ::fast_io::fast_terminate(); }
+    }
+
+    // Offsets outside of the module are rejected
+    {
+        snapshot_writer_t bad{};
+        bad.write(static_cast<::std::uint_least64_t>(sizeof(module_bytes) + 1uz));
+
+        snapshot_reader_t reader{bad.buffer.cbegin(), bad.buffer.cend(), module_begin, module_end, false};
+        if(reader.read_module_ptr<::std::byte>() != nullptr || !reader.failed) [[unlikely]] { ::fast_io::fast_terminate(); }
+    }
+
+    // A string running past the end of the module is rejected
+    {
+        snapshot_writer_t bad{};
+        bad.module_begin = module_begin;
+        bad.module_end = module_end;
+        bad.write_module_ptr(module_end - 2);
+        bad.write_size(3uz);
+
+        snapshot_reader_t reader{bad.buffer.cbegin(), bad.buffer.cend(), module_begin, module_end, false};
+        if(!reader.read_module_string().empty() || !reader.failed) [[unlikely]] { ::fast_io::fast_terminate(); }
+    }
+
+    // Counts larger than the rest of the snapshot are rejected before anything is allocated
+    {
+        snapshot_writer_t bad{};
+        bad.write_size(static_cast<::std::size_t>(-1));
+
+        snapshot_reader_t reader{bad.buffer.cbegin(), bad.buffer.cend(), module_begin, module_end, false};
+        if(reader.read_size(1uz) != 0uz || !reader.failed) [[unlikely]] { ::fast_io::fast_terminate(); }
+    }
+}
@@ -0,0 +1,217 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2025-07-20
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <type_traits>
+#include <concepts>
+#include <memory>
+#include <initializer_list>
+
+#include <uwvm2/utils/macro/push_macros.h>
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.parser.wasm.base;
+import uwvm2.parser.wasm.concepts;
+import uwvm2.parser.wasm.standard.wasm1.type;
+import uwvm2.parser.wasm.standard.wasm1.features;
+import uwvm2.parser.wasm.binfmt.binfmt_ver1;
+#else
+# include <fast_io.h>
+# include <fast_io_dsal/vector.h>
+# include <fast_io_dsal/tuple.h>
+# include <uwvm2/parser/wasm/base/impl.h>
+# include <uwvm2/parser/wasm/concepts/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/features/impl.h>
+# include <uwvm2/parser/wasm/binfmt/binfmt_ver1/impl.h>
+#endif
+
+namespace test
+{
+    using wasm1 = ::uwvm2::parser::wasm::standard::wasm1::features::wasm1;
+
+    inline void push_leb128(::fast_io::vector<::std::byte>& vec, ::std::uint_least32_t val)
+    {
+        do {
+            auto byte{static_cast<::std::uint_least8_t>(val & 0x7Fu)};
+            val >>= 7u;
+            if(val != 0u) { byte |= 0x80u; }
+            vec.push_back(static_cast<::std::byte>(byte));
+        }
+        while(val != 0u);
+    }
+
+    inline void push_bytes(::fast_io::vector<::std::byte>& vec, ::std::initializer_list<unsigned> bytes)
+    {
+        for(auto const i: bytes) { vec.push_back(static_cast<::std::byte>(i)); }
+    }
+
+    inline void push_section(::fast_io::vector<::std::byte>& vec, ::std::uint_least8_t id, ::fast_io::vector<::std::byte> const& content)
+    {
+        vec.push_back(static_cast<::std::byte>(id));
+        push_leb128(vec, static_cast<::std::uint_least32_t>(content.size()));
+        for(auto const i: content) { vec.push_back(i); }
+    }
+
+    /// @brief (module (type (func)) (func (export "f")) (func (local i32)) (memory 1) (data (i32.const 0) "ab"))
+    inline ::fast_io::vector<::std::byte> make_module()
+    {
+        ::fast_io::vector<::std::byte> mod{};
+        push_bytes(mod, {0x00u, 0x61u, 0x73u, 0x6Du, 0x01u, 0x00u, 0x00u, 0x00u});
+
+        ::fast_io::vector<::std::byte> typesec{};
+        push_bytes(typesec, {0x01u, 0x60u, 0x00u, 0x00u});
+        push_section(mod, 1u, typesec);
+
+        ::fast_io::vector<::std::byte> funcsec{};
+        push_bytes(funcsec, {0x02u, 0x00u, 0x00u});
+        push_section(mod, 3u, funcsec);
+
+        ::fast_io::vector<::std::byte> memsec{};
+        push_bytes(memsec, {0x01u, 0x00u, 0x01u});
+        push_section(mod, 5u, memsec);
+
+        ::fast_io::vector<::std::byte> exportsec{};
+        push_bytes(exportsec, {0x01u, 0x01u, 0x66u, 0x00u, 0x00u});
+        push_section(mod, 7u, exportsec);
+
+        // A large custom section, so that the section length takes several bytes and the buffer grows while it arrives
+        ::fast_io::vector<::std::byte> customsec{};
+        push_bytes(customsec, {0x03u, 0x61u, 0x62u, 0x63u});
+        for(::std::size_t i{}; i != 200000uz; ++i) { customsec.push_back(static_cast<::std::byte>(i)); }
+        push_section(mod, 0u, customsec);
+
+        ::fast_io::vector<::std::byte> codesec{};
+        push_bytes(codesec, {0x02u});
+        push_bytes(codesec, {0x02u, 0x00u, 0x0Bu});
+        push_bytes(codesec, {0x04u, 0x01u, 0x01u, 0x7Fu, 0x0Bu});
+        push_section(mod, 10u, codesec);
+
+        ::fast_io::vector<::std::byte> datasec{};
+        push_bytes(datasec, {0x01u, 0x00u, 0x41u, 0x00u, 0x0Bu, 0x02u, 0x61u, 0x62u});
+        push_section(mod, 11u, datasec);
+
+        return mod;
+    }
+
+    template <typename Sec, typename Storage>
+    inline auto const& get_section(Storage const& module_storage)
+    {
+        return ::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<Sec>(module_storage.sections);
+    }
+
+    /// @brief Push the module in chunks of chunk_size bytes and compare the result with a parse of the whole module
+    inline void check_stream(::fast_io::vector<::std::byte> const& mod, ::std::size_t chunk_size, ::std::size_t reserve_size)
+    {
+        using namespace ::uwvm2::parser::wasm::standard::wasm1::features;
+
+        ::uwvm2::parser::wasm::concepts::feature_parameter_t<wasm1> para{};
+
+        ::uwvm2::parser::wasm::base::error_impl full_err{};
+        auto const full{::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_handle_func<wasm1>(mod.cbegin(), mod.cend(), full_err, para)};
+
+        ::uwvm2::parser::wasm::base::error_impl stream_err{};
+        ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_stream_parser_t<wasm1> stream{para};
+        if(reserve_size != 0uz) { stream.reserve(reserve_size, stream_err); }
+
+        for(auto curr{mod.cbegin()}; curr != mod.cend();)
+        {
+            auto const left{static_cast<::std::size_t>(mod.cend() - curr)};
+            auto const n{left < chunk_size ? left : chunk_size};
+            stream.push(curr, curr + n, stream_err);
+            curr += n;
+        }
+
+        stream.finish(stream_err);
+
+        if(stream.size() != mod.size() || stream.storage.module_span.module_begin != stream.module_begin() ||
+           stream.storage.module_span.module_end != stream.module_end()) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+
+        auto const& full_exportsec{get_section<export_section_storage_t<wasm1>>(full)};
+        auto const& stream_exportsec{get_section<export_section_storage_t<wasm1>>(stream.storage)};
+        auto const& full_codesec{get_section<code_section_storage_t<wasm1>>(full)};
+        auto const& stream_codesec{get_section<code_section_storage_t<wasm1>>(stream.storage)};
+        auto const& full_datasec{get_section<data_section_storage_t<wasm1>>(full)};
+        auto const& stream_datasec{get_section<data_section_storage_t<wasm1>>(stream.storage)};
+
+        if(stream_exportsec.exports.size() != full_exportsec.exports.size() || stream_codesec.codes.size() != full_codesec.codes.size() ||
+           stream_datasec.datas.size() != full_datasec.datas.size()) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+
+        // The spans point to the same offsets of the module in the buffer of the stream
+        for(::std::size_t i{}; i != full_codesec.codes.size(); ++i)
+        {
+            auto const& s{stream_codesec.codes.index_unchecked(i)};
+            auto const& f{full_codesec.codes.index_unchecked(i)};
+            if(s.body.code_begin - stream.module_begin() != f.body.code_begin - mod.cbegin() ||
+               s.body.code_end - stream.module_begin() != f.body.code_end - mod.cbegin() || s.all_local_count != f.all_local_count) [[unlikely]]
+            {
+                ::fast_io::fast_terminate();
+            }
+        }
+    }
+}  // namespace test
+
+int main()
+{
+    auto const mod{::test::make_module()};
+
+    // Byte by byte, in odd chunks, in one chunk, and with the size known in advance (no parse again on growth)
+    ::test::check_stream(mod, 1uz, 0uz);
+    ::test::check_stream(mod, 7uz, 0uz);
+    ::test::check_stream(mod, 4096uz, 0uz);
+    ::test::check_stream(mod, mod.size(), 0uz);
+    ::test::check_stream(mod, 4096uz, mod.size());
+
+#if defined(__cpp_exceptions) && !defined(UWVM_TERMINATE_IMME_WHEN_PARSE)
+    // A truncated module is only an error when the stream ends
+    {
+        ::uwvm2::parser::wasm::concepts::feature_parameter_t<::test::wasm1> para{};
+        ::uwvm2::parser::wasm::base::error_impl err{};
+        ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_stream_parser_t<::test::wasm1> stream{para};
+
+        stream.push(mod.cbegin(), mod.cend() - 3, err);
+
+        try
+        {
+            stream.finish(err);
+            ::fast_io::fast_terminate();
+        }
+        catch(::fast_io::error)
+        {
+        }
+
+        if(err.err_code != ::uwvm2::parser::wasm::base::wasm_parse_error_code::illegal_section_length) [[unlikely]] { ::fast_io::fast_terminate(); }
+    }
+#endif
+}
+
+// macro
+#include <uwvm2/utils/macro/pop_macros.h>
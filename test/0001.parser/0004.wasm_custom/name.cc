@@ -0,0 +1,302 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2025-07-16
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <initializer_list>
+
+#include <uwvm2/utils/macro/push_macros.h>
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.parser.wasm_custom;
+#else
+# include <fast_io.h>
+# include <fast_io_dsal/vector.h>
+# include <fast_io_dsal/string.h>
+# include <fast_io_dsal/string_view.h>
+# include <uwvm2/parser/wasm_custom/impl.h>
+#endif
+
+namespace test
+{
+    namespace customs = ::uwvm2::parser::wasm_custom::customs;
+
+    inline void push_leb128(::fast_io::vector<::std::byte>& vec, ::std::uint_least32_t val)
+    {
+        do {
+            auto byte{static_cast<::std::uint_least8_t>(val & 0x7Fu)};
+            val >>= 7u;
+            if(val != 0u) { byte |= 0x80u; }
+            vec.push_back(static_cast<::std::byte>(byte));
+        }
+        while(val != 0u);
+    }
+
+    inline void push_name(::fast_io::vector<::std::byte>& vec, ::fast_io::u8string_view name)
+    {
+        push_leb128(vec, static_cast<::std::uint_least32_t>(name.size()));
+        for(auto const c: name) { vec.push_back(static_cast<::std::byte>(c)); }
+    }
+
+    inline void push_subsection(::fast_io::vector<::std::byte>& vec, ::std::uint_least8_t id, ::fast_io::vector<::std::byte> const& content)
+    {
+        vec.push_back(static_cast<::std::byte>(id));
+        push_leb128(vec, static_cast<::std::uint_least32_t>(content.size()));
+        for(auto const i: content) { vec.push_back(i); }
+    }
+
+    struct name_entry_t
+    {
+        ::std::uint_least32_t index{};
+        ::fast_io::u8string_view name{};
+    };
+
+    /// @brief Content of a name map: count, (index, name) ...
+    inline ::fast_io::vector<::std::byte> make_name_map(::std::initializer_list<name_entry_t> entries)
+    {
+        ::fast_io::vector<::std::byte> map{};
+        push_leb128(map, static_cast<::std::uint_least32_t>(entries.size()));
+        for(auto const& [index, name]: entries)
+        {
+            push_leb128(map, index);
+            push_name(map, name);
+        }
+        return map;
+    }
+
+    inline bool has_error(::fast_io::vector<customs::name_err_t> const& err, customs::name_err_type_t type, ::std::uint_least32_t index) noexcept
+    {
+        for(auto const& e: err)
+        {
+            if(e.type == type && e.err.u32 == index) { return true; }
+        }
+        return false;
+    }
+
+    /// @brief Offset of the reported error in the section, or SIZE_MAX if it was not reported
+    inline ::std::size_t error_offset(::fast_io::vector<customs::name_err_t> const& err,
+                                      ::fast_io::vector<::std::byte> const& sec,
+                                      customs::name_err_type_t type,
+                                      ::std::uint_least32_t index) noexcept
+    {
+        for(auto const& e: err)
+        {
+            if(e.type == type && e.err.u32 == index) { return static_cast<::std::size_t>(e.curr - sec.cbegin()); }
+        }
+        return SIZE_MAX;
+    }
+
+    template <typename T, typename GetIndex>
+    inline bool is_strictly_ascending(::fast_io::vector<T> const& vec, GetIndex get_index) noexcept
+    {
+        for(::std::size_t i{1uz}; i < vec.size(); ++i)
+        {
+            if(!(get_index(vec.index_unchecked(i - 1uz)) < get_index(vec.index_unchecked(i)))) { return false; }
+        }
+        return true;
+    }
+}  // namespace test
+
+int main()
+{
+    namespace customs = ::test::customs;
+
+    // Function names out of order with a duplicate that is not adjacent: the first one is kept
+    {
+        ::fast_io::vector<::std::byte> sec{};
+        ::test::push_subsection(sec, 1u, ::test::make_name_map({{5u, u8"a"}, {3u, u8"b"}, {5u, u8"c"}, {1u, u8"d"}, {9u, u8"e"}}));
+
+        customs::name_storage_t ns{};
+        ::fast_io::vector<customs::name_err_t> err{};
+        customs::parse_name_storage(ns, sec.cbegin(), sec.cend(), err);
+
+        if(ns.function_name.size() != 4uz || !::test::is_strictly_ascending(ns.function_name, [](customs::name_assoc_t const& e) { return e.index; }))
+            [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+        if(customs::find_function_name(ns, 1u) != u8"d" || customs::find_function_name(ns, 3u) != u8"b" || customs::find_function_name(ns, 5u) != u8"a" ||
+           customs::find_function_name(ns, 9u) != u8"e" || !customs::find_function_name(ns, 2u).empty()) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+        if(err.size() != 1uz || !::test::has_error(err, customs::name_err_type_t::duplicate_func_idx, 5u)) [[unlikely]] { ::fast_io::fast_terminate(); }
+    }
+
+    // An adjacent duplicate is reported while parsing, at its index, and the rest of the map is kept
+    {
+        ::fast_io::vector<::std::byte> sec{};
+        ::test::push_subsection(sec, 1u, ::test::make_name_map({{2u, u8"x"}, {2u, u8"y"}, {4u, u8"z"}}));
+
+        customs::name_storage_t ns{};
+        ::fast_io::vector<customs::name_err_t> err{};
+        customs::parse_name_storage(ns, sec.cbegin(), sec.cend(), err);
+
+        if(customs::find_function_name(ns, 2u) != u8"x" || customs::find_function_name(ns, 4u) != u8"z") [[unlikely]] { ::fast_io::fast_terminate(); }
+        // id, size, count, (2, "x"), then the second index 2
+        if(err.size() != 1uz || ::test::error_offset(err, sec, customs::name_err_type_t::duplicate_func_idx, 2u) != 6uz) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+    }
+
+    // A duplicate found by the sort of an out-of-order map is reported the same way as an adjacent one
+    {
+        ::fast_io::vector<::std::byte> sec{};
+        ::test::push_subsection(sec, 1u, ::test::make_name_map({{5u, u8"a"}, {3u, u8"b"}, {5u, u8"c"}, {7u, u8"d"}}));
+
+        customs::name_storage_t ns{};
+        ::fast_io::vector<customs::name_err_t> err{};
+        customs::parse_name_storage(ns, sec.cbegin(), sec.cend(), err);
+
+        if(ns.function_name.size() != 3uz || customs::find_function_name(ns, 5u) != u8"a" || customs::find_function_name(ns, 7u) != u8"d") [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+        // id, size, count, (5, "a"), (3, "b"), then the second index 5
+        if(err.size() != 1uz || ::test::error_offset(err, sec, customs::name_err_type_t::duplicate_func_idx, 5u) != 9uz) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+    }
+
+    // Local names out of order: the duplicate local and the duplicate function are reported at their index
+    {
+        ::fast_io::vector<::std::byte> local_map{};
+        ::test::push_leb128(local_map, 3u);
+        // function 4: locals 1, 0, 1
+        ::test::push_leb128(local_map, 4u);
+        auto const f4{::test::make_name_map({{1u, u8"p"}, {0u, u8"q"}, {1u, u8"r"}})};
+        for(auto const i: f4) { local_map.push_back(i); }
+        // function 2: local 0
+        ::test::push_leb128(local_map, 2u);
+        auto const f2{::test::make_name_map({{0u, u8"s"}})};
+        for(auto const i: f2) { local_map.push_back(i); }
+        // function 4 again
+        ::test::push_leb128(local_map, 4u);
+        auto const f4_again{::test::make_name_map({{0u, u8"t"}})};
+        for(auto const i: f4_again) { local_map.push_back(i); }
+
+        ::fast_io::vector<::std::byte> sec{};
+        ::test::push_subsection(sec, 2u, local_map);
+
+        customs::name_storage_t ns{};
+        ::fast_io::vector<customs::name_err_t> err{};
+        customs::parse_name_storage(ns, sec.cbegin(), sec.cend(), err);
+
+        if(customs::find_code_local_name(ns, 4u, 0u) != u8"q" || customs::find_code_local_name(ns, 4u, 1u) != u8"p" ||
+           customs::find_code_local_name(ns, 2u, 0u) != u8"s") [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+        // id, size, count, 4, local count, (1, "p"), (0, "q"), then the second local 1
+        // ... (1, "r"), 2, local count, (0, "s"), then the second function 4
+        if(err.size() != 2uz || ::test::error_offset(err, sec, customs::name_err_type_t::duplicate_code_local_name_function_index, 1u) != 11uz ||
+           ::test::error_offset(err, sec, customs::name_err_type_t::duplicate_code_function_index, 4u) != 19uz) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+    }
+
+    // Local names: functions and locals out of order, a duplicate local and a duplicate function
+    {
+        ::fast_io::vector<::std::byte> local_map{};
+        ::test::push_leb128(local_map, 4u);
+        // function 7: locals 2, 0, 1, 0
+        ::test::push_leb128(local_map, 7u);
+        auto const f7{::test::make_name_map({{2u, u8"l2"}, {0u, u8"l0"}, {1u, u8"l1"}, {0u, u8"dup"}})};
+        for(auto const i: f7) { local_map.push_back(i); }
+        // function 3: local 4
+        ::test::push_leb128(local_map, 3u);
+        auto const f3{::test::make_name_map({{4u, u8"m4"}})};
+        for(auto const i: f3) { local_map.push_back(i); }
+        // function 7 again
+        ::test::push_leb128(local_map, 7u);
+        auto const f7_again{::test::make_name_map({{9u, u8"n9"}})};
+        for(auto const i: f7_again) { local_map.push_back(i); }
+        // function 5: no locals
+        ::test::push_leb128(local_map, 5u);
+        ::test::push_leb128(local_map, 0u);
+
+        ::fast_io::vector<::std::byte> sec{};
+        ::test::push_subsection(sec, 2u, local_map);
+
+        customs::name_storage_t ns{};
+        ::fast_io::vector<customs::name_err_t> err{};
+        customs::parse_name_storage(ns, sec.cbegin(), sec.cend(), err);
+
+        if(ns.code_local_name.size() != 3uz ||
+           !::test::is_strictly_ascending(ns.code_local_name, [](customs::name_local_range_t const& e) { return e.function_index; })) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+        if(customs::find_code_local_name(ns, 7u, 0u) != u8"l0" || customs::find_code_local_name(ns, 7u, 1u) != u8"l1" ||
+           customs::find_code_local_name(ns, 7u, 2u) != u8"l2" || !customs::find_code_local_name(ns, 7u, 9u).empty() ||
+           customs::find_code_local_name(ns, 3u, 4u) != u8"m4" || !customs::find_code_local_name(ns, 5u, 0u).empty()) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+        if(err.size() != 2uz || !::test::has_error(err, customs::name_err_type_t::duplicate_code_local_name_function_index, 0u) ||
+           !::test::has_error(err, customs::name_err_type_t::duplicate_code_function_index, 7u)) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+    }
+
+    // Many names in descending order: sorted once at the end of the subsection, not inserted in place one by one
+    {
+        constexpr ::std::uint_least32_t count{200000u};
+
+        ::fast_io::vector<::fast_io::u8string> names{};
+        names.reserve(count);
+        ::fast_io::vector<::std::byte> map{};
+        ::test::push_leb128(map, count);
+        for(auto i{count}; i != 0u; --i)
+        {
+            names.push_back(::fast_io::u8concat_fast_io(u8"f", i - 1u));
+            auto const& name{names.back()};
+            ::test::push_leb128(map, i - 1u);
+            ::test::push_name(map, ::fast_io::u8string_view{name.data(), name.size()});
+        }
+
+        ::fast_io::vector<::std::byte> sec{};
+        ::test::push_subsection(sec, 1u, map);
+
+        customs::name_storage_t ns{};
+        ::fast_io::vector<customs::name_err_t> err{};
+        customs::parse_name_storage(ns, sec.cbegin(), sec.cend(), err);
+
+        if(!err.empty() || ns.function_name.size() != count) [[unlikely]] { ::fast_io::fast_terminate(); }
+        for(::std::uint_least32_t i{}; i != count; ++i)
+        {
+            auto const& expected{names.index_unchecked(count - 1u - i)};
+            if(customs::find_function_name(ns, i) != ::fast_io::u8string_view{expected.data(), expected.size()}) [[unlikely]]
+            {
+                ::fast_io::fast_terminate();
+            }
+        }
+    }
+}
+
+// macro
+#include <uwvm2/utils/macro/pop_macros.h>
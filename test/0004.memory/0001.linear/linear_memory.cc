@@ -0,0 +1,208 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <uwvm2/utils/macro/push_macros.h>
+
+#ifdef UWVM_SUPPORT_GUARDED_LINEAR_MEMORY
+# include <csetjmp>
+#endif
+
+// The address space limit also limits the shadow memory of the sanitizers
+#if defined(__linux__) && !defined(__SANITIZE_ADDRESS__) && !defined(__SANITIZE_THREAD__)
+# define UWVM_TEST_LIMIT_ADDRESS_SPACE
+# include <sys/resource.h>
+#endif
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.memory.linear;
+#else
+# include <fast_io.h>
+# include <uwvm2/memory/linear/impl.h>
+#endif
+
+namespace test
+{
+    using namespace ::uwvm2::memory::linear;
+
+    template <typename Memory>
+    inline void check_memory_common()
+    {
+        Memory mem{};
+
+        // min > max
+        if(mem.init(3uz, 2uz)) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        if(!mem.init(1uz, 4uz)) [[unlikely]] { ::fast_io::fast_terminate(); }
+        if(mem.page_count() != 1uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        // zero filled
+        for(auto i{mem.memory_begin}; i != mem.memory_begin + mem.memory_length; ++i)
+        {
+            if(*i != ::std::byte{}) [[unlikely]] { ::fast_io::fast_terminate(); }
+        }
+
+        *mem.get_address(wasm_page_size - 1uz, 1uz) = ::std::byte{0x5a};
+
+        if(mem.grow(0uz) != 1uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+        if(mem.grow(2uz) != 1uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+        if(mem.grow(2uz) != grow_failed) [[unlikely]] { ::fast_io::fast_terminate(); }
+        if(mem.grow(1uz) != 3uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+        if(mem.page_count() != 4uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        // contents are kept, new pages are zero filled
+        if(*mem.get_address(wasm_page_size - 1uz, 1uz) != ::std::byte{0x5a}) [[unlikely]] { ::fast_io::fast_terminate(); }
+        if(*mem.get_address(4uz * wasm_page_size - 1uz, 1uz) != ::std::byte{}) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        Memory moved{::std::move(mem)};
+        if(moved.page_count() != 4uz || mem.memory_begin != nullptr) [[unlikely]] { ::fast_io::fast_terminate(); }
+    }
+
+#ifdef UWVM_TEST_LIMIT_ADDRESS_SPACE
+    /// @brief  Grow mem beyond a 1 GiB address space: running out of memory is a failed memory.grow, the memory is unchanged
+    template <typename Memory>
+    inline void check_grow_out_of_memory(Memory& mem, ::std::size_t delta_page)
+    {
+        *mem.get_address(0uz, 1uz) = ::std::byte{0x5a};
+        auto const old_page{mem.page_count()};
+
+        struct ::rlimit old_limit{};
+        if(::getrlimit(RLIMIT_AS, ::std::addressof(old_limit)) != 0) { return; }
+
+        auto limit{old_limit};
+        limit.rlim_cur = static_cast<::rlim_t>(1024u * 1024u * 1024u);
+        if(::setrlimit(RLIMIT_AS, ::std::addressof(limit)) != 0) { return; }
+
+        auto const res{mem.grow(delta_page)};
+
+        ::setrlimit(RLIMIT_AS, ::std::addressof(old_limit));
+
+        if(res != grow_failed || mem.page_count() != old_page || *mem.get_address(0uz, 1uz) != ::std::byte{0x5a}) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+    }
+#endif
+
+#ifdef UWVM_SUPPORT_GUARDED_LINEAR_MEMORY
+    inline ::sigjmp_buf trap_env;
+
+    inline void trap(void*) noexcept { ::siglongjmp(trap_env, 1); }
+
+    /// @brief  Returns true if the store trapped
+    inline bool store_traps(::std::byte* addr) noexcept
+    {
+        if(sigsetjmp(trap_env, 1) == 0)
+        {
+            *static_cast<::std::byte volatile*>(addr) = ::std::byte{1};
+            return false;
+        }
+        return true;
+    }
+#endif
+}  // namespace test
+
+int main()
+{
+    ::test::check_memory_common<::test::allocator_memory_t>();
+
+    // explicit bounds checks
+    {
+        ::test::allocator_memory_t mem{};
+        if(!mem.init(1uz, 1uz)) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        if(mem.get_address(::test::wasm_page_size - 8uz, 8uz) == nullptr) [[unlikely]] { ::fast_io::fast_terminate(); }
+        if(mem.get_address(::test::wasm_page_size - 7uz, 8uz) != nullptr) [[unlikely]] { ::fast_io::fast_terminate(); }
+        if(mem.get_address(0xFFFF'FFFFu + 0xFFFF'FFFFull, 1uz) != nullptr) [[unlikely]] { ::fast_io::fast_terminate(); }
+    }
+
+#ifdef UWVM_TEST_LIMIT_ADDRESS_SPACE
+    // out of memory
+    {
+        ::test::allocator_memory_t mem{};
+        if(!mem.init(1uz, ::test::wasm32_max_page)) [[unlikely]] { ::fast_io::fast_terminate(); }
+        ::test::check_grow_out_of_memory(mem, ::test::wasm32_max_page - 1uz);
+
+        ::test::custom_page_memory_t byte_mem{};
+        if(!byte_mem.init(1uz, 0xFFFF'FFFFuz, 0u)) [[unlikely]] { ::fast_io::fast_terminate(); }
+        ::test::check_grow_out_of_memory(byte_mem, 0xFFFF'FFFEuz);
+
+        // The memory can still grow by what is available
+        if(byte_mem.grow(1024uz) != 1uz || *byte_mem.get_address(1024uz, 1uz) != ::std::byte{}) [[unlikely]] { ::fast_io::fast_terminate(); }
+    }
+#endif
+
+    // custom-page-sizes: 1-byte pages
+    {
+        ::test::custom_page_memory_t mem{};
+        if(mem.init(0uz, 16uz, 1u)) [[unlikely]] { ::fast_io::fast_terminate(); }
+        if(!mem.init(3uz, 100uz, 0u)) [[unlikely]] { ::fast_io::fast_terminate(); }
+        if(mem.memory_length != 3uz || mem.page_count() != 3uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        *mem.get_address(2uz, 1uz) = ::std::byte{0x5a};
+        if(mem.get_address(2uz, 2uz) != nullptr) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        for(::std::size_t i{3uz}; i != 100uz; ++i)
+        {
+            if(mem.grow(1uz) != i) [[unlikely]] { ::fast_io::fast_terminate(); }
+        }
+
+        // the allocation never exceeds the maximum
+        if(mem.grow(1uz) != ::test::grow_failed || mem.memory_capacity != 100uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        if(*mem.get_address(2uz, 1uz) != ::std::byte{0x5a} || *mem.get_address(99uz, 1uz) != ::std::byte{}) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+
+        // 64 KiB pages behave like allocator_memory_t
+        if(!mem.init(1uz, ::test::wasm32_max_page, 16u) || mem.memory_length != ::test::wasm_page_size) [[unlikely]] { ::fast_io::fast_terminate(); }
+    }
+
+#ifdef UWVM_SUPPORT_GUARDED_LINEAR_MEMORY
+    if(!::test::install_memory_fault_handler(::test::trap)) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+    ::test::check_memory_common<::test::mmap_memory_t>();
+
+    // out-of-bounds accesses fault in the guard
+    {
+        ::test::mmap_memory_t mem{};
+        // The reservation can fail on address-space-constrained hosts, the runtime falls back to explicit bounds checks there
+        if(!mem.init(1uz, ::test::wasm32_max_page)) { return 0; }
+
+        if(::test::store_traps(mem.get_address(0uz, 1uz))) [[unlikely]] { ::fast_io::fast_terminate(); }
+        if(!::test::store_traps(mem.get_address(::test::wasm_page_size, 1uz))) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        if(mem.grow(1uz) != 1uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+        if(::test::store_traps(mem.get_address(::test::wasm_page_size, 1uz))) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        // the largest wasm32 effective address
+        if(!::test::store_traps(mem.get_address(0xFFFF'FFFFu + 0xFFFF'FFFFull, 1uz))) [[unlikely]] { ::fast_io::fast_terminate(); }
+    }
+#endif
+}
+
+// macro
+#include <uwvm2/utils/macro/pop_macros.h>
@@ -0,0 +1,141 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <uwvm2/utils/macro/push_macros.h>
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.memory.linear;
+#else
+# include <fast_io.h>
+# include <fast_io_dsal/vector.h>
+# include <uwvm2/memory/linear/impl.h>
+#endif
+
+namespace test
+{
+    using namespace ::uwvm2::memory::linear;
+
+    template <typename Memory>
+    inline void check_instantiate(memory_image_t const& img)
+    {
+        Memory a{};
+        Memory b{};
+        if(!a.init(17uz, 32uz) || !b.init(17uz, 32uz)) [[unlikely]] { ::fast_io::fast_terminate(); }
+        if(!img.instantiate(a) || !img.instantiate(b)) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        if(a.memory_begin[99] != ::std::byte{} || a.memory_begin[100] != ::std::byte{3} || a.memory_begin[102] != ::std::byte{9} ||
+           a.memory_begin[106] != ::std::byte{3}) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+
+        // instances do not share writes
+        a.memory_begin[100] = ::std::byte{7};
+        if(b.memory_begin[100] != ::std::byte{3}) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        // memory.grow behind the image
+        if(a.grow(1uz) != 17uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+        a.memory_begin[17uz * wasm_page_size] = ::std::byte{1};
+
+        // segments out of bounds trap
+        Memory c{};
+        if(!c.init(1uz, 32uz) || img.instantiate(c)) [[unlikely]] { ::fast_io::fast_terminate(); }
+    }
+}  // namespace test
+
+int main()
+{
+    // offset expressions
+    {
+        ::std::byte const e1[]{::std::byte{0x41u}, ::std::byte{0x80u}, ::std::byte{0x80u}, ::std::byte{0x04u}, ::std::byte{0x0Bu}};
+        ::std::byte const e2[]{::std::byte{0x41u}, ::std::byte{0x7Fu}, ::std::byte{0x0Bu}};
+        ::std::byte const e3[]{::std::byte{0x23u}, ::std::byte{0x00u}, ::std::byte{0x0Bu}};
+
+        ::std::size_t offset{};
+        if(!::test::decode_i32_const_offset(e1, e1 + 5, offset) || offset != 65536uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+        if(!::test::decode_i32_const_offset(e2, e2 + 3, offset) || offset != 0xFFFF'FFFFuz) [[unlikely]] { ::fast_io::fast_terminate(); }
+        if(::test::decode_i32_const_offset(e3, e3 + 3, offset)) [[unlikely]] { ::fast_io::fast_terminate(); }
+    }
+
+    // 1 MiB segment, large enough to be mapped
+    ::fast_io::vector<::std::byte> big{};
+    for(::std::size_t i{}; i != 1024uz * 1024uz; ++i) { big.push_back(::std::byte{3}); }
+    ::std::byte const small[]{::std::byte{9}, ::std::byte{9}, ::std::byte{9}, ::std::byte{9}};
+
+    constexpr ::std::size_t max_length{32uz * ::test::wasm_page_size};
+
+    ::test::memory_image_t img{};
+    if(!img.add_segment(100uz, big.cbegin(), big.cend(), max_length) || !img.add_segment(102uz, small, small + 4, max_length)) [[unlikely]]
+    {
+        ::fast_io::fast_terminate();
+    }
+    img.build();
+
+    ::test::check_instantiate<::test::allocator_memory_t>(img);
+#ifdef UWVM_SUPPORT_GUARDED_LINEAR_MEMORY
+    ::test::check_instantiate<::test::mmap_memory_t>(img);
+#endif
+
+    // A segment that ends beyond the maximum never fits, also when offset + size wraps on 32-bit hosts
+    {
+        ::test::memory_image_t oob{};
+        if(!oob.add_segment(0xFFFF'FFFFuz, small, small + 4, max_length)) [[unlikely]] { ::fast_io::fast_terminate(); }
+        // empty segments are checked as well
+        ::test::memory_image_t empty_oob{};
+        if(!empty_oob.add_segment(max_length + 1uz, small, small, max_length)) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        ::test::allocator_memory_t mem{};
+        if(!mem.init(32uz, 32uz) || oob.instantiate(mem) || empty_oob.instantiate(mem) || mem.memory_begin[0] != ::std::byte{}) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+
+        // A segment that ends exactly at the maximum fits
+        ::test::memory_image_t at_end{};
+        if(!at_end.add_segment(max_length - 4uz, small, small + 4, max_length) || !at_end.instantiate(mem) ||
+           mem.memory_begin[max_length - 1uz] != ::std::byte{9}) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+    }
+
+    // The image ends at the first segment without a constant offset, the later segments are left to the runtime to keep the order
+    {
+        ::test::memory_image_t partial{};
+        if(!partial.add_segment(0uz, small, small + 4, max_length)) [[unlikely]] { ::fast_io::fast_terminate(); }
+        partial.add_runtime_segment();
+        if(partial.add_segment(200uz, small, small + 4, max_length) || partial.segments.size() != 1uz || partial.image_length != 4uz) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+
+        partial.clear();
+        if(!partial.add_segment(200uz, small, small + 4, max_length)) [[unlikely]] { ::fast_io::fast_terminate(); }
+    }
+}
+
+// macro
+#include <uwvm2/utils/macro/pop_macros.h>
@@ -0,0 +1,73 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <uwvm2/utils/macro/push_macros.h>
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.memory.linear;
+import uwvm2.memory.multiple;
+#else
+# include <fast_io.h>
+# include <uwvm2/memory/linear/impl.h>
+# include <uwvm2/memory/multiple/impl.h>
+#endif
+
+int main()
+{
+    constexpr auto page_size{::uwvm2::memory::linear::wasm_page_size};
+
+    ::uwvm2::memory::multiple::multiple_memory_t<::uwvm2::memory::linear::allocator_memory_t> mem{};
+    mem.init(3uz);
+
+    if(mem.memory_count() != 3uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+    if(!mem.init_memory(0uz, 1uz, 2uz) || !mem.init_memory(1uz, 0uz, 2uz) || !mem.init_memory(2uz, 2uz, 2uz)) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+    // memory 0 is the single-memory fast path
+    if(mem.get_memory0_address(page_size - 8uz, 8uz) == nullptr || mem.get_address(0uz, page_size - 7uz, 8uz) != nullptr) [[unlikely]]
+    {
+        ::fast_io::fast_terminate();
+    }
+
+    // secondary memories go through the descriptor table, which follows memory.grow
+    if(mem.get_address(1uz, 0uz, 1uz) != nullptr) [[unlikely]] { ::fast_io::fast_terminate(); }
+    if(mem.grow(1uz, 1uz) != 0uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+    if(mem.get_address(1uz, page_size - 1uz, 1uz) != mem.memory(1uz).memory_begin + (page_size - 1uz)) [[unlikely]] { ::fast_io::fast_terminate(); }
+    if(mem.grow(1uz, 2uz) != ::uwvm2::memory::linear::grow_failed) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+    if(mem.get_address(2uz, 2uz * page_size - 4uz, 4uz) == nullptr || mem.get_address(2uz, 2uz * page_size - 3uz, 4uz) != nullptr) [[unlikely]]
+    {
+        ::fast_io::fast_terminate();
+    }
+
+    // a module with one memory has no descriptor table
+    ::uwvm2::memory::multiple::native_multiple_memory_t single{};
+    single.init(1uz);
+    if(single.memory_count() != 1uz || !single.descriptors.empty()) [[unlikely]] { ::fast_io::fast_terminate(); }
+}
+
+// macro
+#include <uwvm2/utils/macro/pop_macros.h>
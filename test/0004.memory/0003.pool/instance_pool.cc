@@ -0,0 +1,151 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <initializer_list>
+
+#include <uwvm2/utils/macro/push_macros.h>
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.memory.linear;
+import uwvm2.memory.pool;
+#else
+# include <fast_io.h>
+# include <uwvm2/memory/linear/impl.h>
+# include <uwvm2/memory/pool/impl.h>
+#endif
+
+namespace test
+{
+    template <typename Memory>
+    inline void check_pool()
+    {
+        constexpr auto page_size{::uwvm2::memory::linear::wasm_page_size};
+
+        ::uwvm2::memory::pool::instance_pool_t<Memory> pool{};
+        if(!pool.init({.slot_count = 2uz, .memory_min_page = 1uz, .memory_max_page = 4uz, .table_size = 64uz, .global_size = 32uz, .stack_size = 4096uz}))
+            [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+
+        auto const a{pool.acquire()};
+        auto const b{pool.acquire()};
+        if(a == nullptr || b == nullptr || a == b || pool.acquire() != nullptr) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        // dirty the slot
+        if(a->memory.grow(2uz) != 1uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+        a->memory.memory_begin[0] = ::std::byte{1};
+        a->memory.memory_begin[3uz * page_size - 1uz] = ::std::byte{1};
+        a->table_begin[63] = ::std::byte{1};
+        a->global_begin[0] = ::std::byte{1};
+        b->table_begin[0] = ::std::byte{2};
+
+        pool.release(a);
+
+        // the warm slot is reused and is clean
+        auto const c{pool.acquire()};
+        if(c != a) [[unlikely]] { ::fast_io::fast_terminate(); }
+        if(c->memory.page_count() != 1uz || c->memory.memory_begin[0] != ::std::byte{} || c->table_begin[63] != ::std::byte{} ||
+           c->global_begin[0] != ::std::byte{} || b->table_begin[0] != ::std::byte{2}) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+
+        // grown pages are zero again
+        if(c->memory.grow(2uz) != 1uz || c->memory.memory_begin[3uz * page_size - 1uz] != ::std::byte{}) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        pool.release(b);
+        pool.release(c);
+    }
+
+    template <typename Memory>
+    inline void check_pool_layout()
+    {
+        // sizes that are not a multiple of the alignment still give aligned regions
+        {
+            ::uwvm2::memory::pool::instance_pool_t<Memory> pool{};
+            if(!pool.init({.slot_count = 3uz, .memory_min_page = 0uz, .memory_max_page = 1uz, .table_size = 3uz, .global_size = 5uz, .stack_size = 7uz}))
+                [[unlikely]]
+            {
+                ::fast_io::fast_terminate();
+            }
+
+            constexpr auto align{alignof(::std::max_align_t)};
+            for(auto const& slot: pool.slots)
+            {
+                for(auto const region: {slot.table_begin, slot.global_begin, slot.stack_begin})
+                {
+                    if(reinterpret_cast<::std::uintptr_t>(region) % align != 0uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+                }
+                if(slot.global_begin < slot.table_begin + 3uz || slot.stack_begin < slot.global_begin + 5uz ||
+                   slot.stack_begin + 7uz > pool.area_begin + pool.area_size) [[unlikely]]
+                {
+                    ::fast_io::fast_terminate();
+                }
+            }
+        }
+
+        // overflowing sizes are rejected instead of wrapping around
+        {
+            constexpr auto size_t_max{::std::numeric_limits<::std::size_t>::max()};
+
+            ::uwvm2::memory::pool::instance_pool_t<Memory> pool{};
+            if(pool.init({.slot_count = 1uz, .memory_min_page = 0uz, .memory_max_page = 1uz, .table_size = size_t_max, .global_size = 0uz, .stack_size = 0uz}))
+                [[unlikely]]
+            {
+                ::fast_io::fast_terminate();
+            }
+            if(pool.init({.slot_count = 1uz,
+                          .memory_min_page = 0uz,
+                          .memory_max_page = 1uz,
+                          .table_size = size_t_max / 2uz,
+                          .global_size = size_t_max / 2uz,
+                          .stack_size = 64uz})) [[unlikely]]
+            {
+                ::fast_io::fast_terminate();
+            }
+            if(pool.init({.slot_count = size_t_max / 64uz, .memory_min_page = 0uz, .memory_max_page = 1uz, .table_size = 64uz, .global_size = 64uz}))
+                [[unlikely]]
+            {
+                ::fast_io::fast_terminate();
+            }
+            if(!pool.slots.empty() || pool.area_begin != nullptr || pool.acquire() != nullptr) [[unlikely]] { ::fast_io::fast_terminate(); }
+        }
+    }
+}  // namespace test
+
+int main()
+{
+    ::test::check_pool<::uwvm2::memory::linear::allocator_memory_t>();
+    ::test::check_pool_layout<::uwvm2::memory::linear::allocator_memory_t>();
+#ifdef UWVM_SUPPORT_GUARDED_LINEAR_MEMORY
+    ::test::check_pool<::uwvm2::memory::linear::mmap_memory_t>();
+    ::test::check_pool_layout<::uwvm2::memory::linear::mmap_memory_t>();
+#endif
+}
+
+// macro
+#include <uwvm2/utils/macro/pop_macros.h>
@@ -0,0 +1,340 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <bit>
+#include <initializer_list>
+
+#include <uwvm2/utils/macro/push_macros.h>
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.parser.wasm.standard.wasm1.type;
+import uwvm2.memory.linear;
+import uwvm2.non_img.uwvm_int;
+#else
+# include <fast_io.h>
+# include <fast_io_dsal/vector.h>
+# include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
+# include <uwvm2/memory/linear/impl.h>
+# include <uwvm2/non-img/int/uwvm-int/impl.h>
+#endif
+
+namespace test
+{
+    namespace uwvm_int = ::uwvm2::non_img::uwvm_int;
+    using value_type = ::uwvm2::parser::wasm::standard::wasm1::type::value_type;
+
+    inline constexpr value_type i32_i32[2]{value_type::i32, value_type::i32};
+    inline constexpr value_type i64_1[1]{value_type::i64};
+    inline constexpr value_type f64_f64[2]{value_type::f64, value_type::f64};
+
+    inline void push_bytes(::fast_io::vector<::std::byte>& vec, ::std::initializer_list<unsigned> bytes)
+    {
+        for(auto const i: bytes) { vec.push_back(static_cast<::std::byte>(i)); }
+    }
+
+    inline uwvm_int::trap_t host_add(uwvm_int::slot_t* frame, [[maybe_unused]] void* host_context) noexcept
+    {
+        frame[0] = static_cast<::std::uint_least32_t>(frame[0] + frame[1]);
+        return uwvm_int::trap_t::none;
+    }
+
+    struct fixture_t
+    {
+        // The bodies must outlive the lowering only, they are kept for simplicity
+        ::fast_io::vector<::fast_io::vector<::std::byte>> bodies{};
+        uwvm_int::module_t mod{};
+        ::uwvm2::memory::linear::native_memory_t memory{};
+        uwvm_int::slot_t globals[1]{};
+        uwvm_int::function_t const* table[3]{};
+        uwvm_int::slot_t stack[4096]{};
+        uwvm_int::context_t ctx{};
+
+        inline void add_function(::std::size_t type_index, ::std::uint_least32_t local_count, ::std::initializer_list<unsigned> expr)
+        {
+            ::fast_io::vector<::std::byte> body{};
+            push_bytes(body, expr);
+            bodies.push_back(::std::move(body));
+            auto const& b{bodies.back_unchecked()};
+            mod.functions.push_back(uwvm_int::function_t{.type_index = type_index,
+                                                         .body = {.expr_begin = b.cbegin(), .code_end = b.cend(), .all_local_count = local_count}});
+        }
+
+        inline uwvm_int::trap_t call(::std::size_t function_index, ::std::initializer_list<uwvm_int::slot_t> args)
+        {
+            ::std::size_t i{};
+            for(auto const a: args) { stack[i++] = a; }
+            return uwvm_int::invoke(ctx, function_index);
+        }
+    };
+
+    /// @brief  Lower a module with one global and one function (i32) -> i32
+    inline bool compiles(::std::initializer_list<unsigned> expr)
+    {
+        fixture_t m{};
+        m.mod.types.push_back({i32_i32, i32_i32 + 1, i32_i32, i32_i32 + 1});
+        m.mod.global_types.push_back(value_type::i32);
+        m.add_function(0uz, 0u, expr);
+        return uwvm_int::compile_module(m.mod);
+    }
+}  // namespace test
+
+int main()
+{
+    using trap_t = ::test::uwvm_int::trap_t;
+
+    ::test::fixture_t f{};
+
+    // types
+    // 0: (i32 i32) -> i32, 1: (i64) -> i64, 2: () -> i32, 3: (i32) -> i32, 4: (f64 f64) -> f64, 5: () -> (), 6: (i32) -> (), 7: (i32) -> i32
+    f.mod.types.push_back({::test::i32_i32, ::test::i32_i32 + 2, ::test::i32_i32, ::test::i32_i32 + 1});
+    f.mod.types.push_back({::test::i64_1, ::test::i64_1 + 1, ::test::i64_1, ::test::i64_1 + 1});
+    f.mod.types.push_back({nullptr, nullptr, ::test::i32_i32, ::test::i32_i32 + 1});
+    f.mod.types.push_back({::test::i32_i32, ::test::i32_i32 + 1, ::test::i32_i32, ::test::i32_i32 + 1});
+    f.mod.types.push_back({::test::f64_f64, ::test::f64_f64 + 2, ::test::f64_f64, ::test::f64_f64 + 1});
+    f.mod.types.push_back({});
+    f.mod.types.push_back({::test::i32_i32, ::test::i32_i32 + 1, nullptr, nullptr});
+    f.mod.types.push_back({::test::i32_i32 + 1, ::test::i32_i32 + 2, ::test::i32_i32, ::test::i32_i32 + 1});
+
+    // globals: 0: i32
+    f.mod.global_types.push_back(::test::value_type::i32);
+
+    // 0: imported add
+    f.mod.functions.push_back({.type_index = 0uz, .host = {.call = ::test::host_add}});
+
+    // 1: factorial (i64) -> i64, recursive
+    // local.get 0, i64.eqz, if (result i64) i64.const 1 else local.get 0, local.get 0, i64.const 1, i64.sub, call 1, i64.mul end
+    f.add_function(1uz, 0u, {0x20, 0x00, 0x50, 0x04, 0x7E, 0x42, 0x01, 0x05, 0x20, 0x00, 0x20, 0x00, 0x42, 0x01, 0x7D, 0x10, 0x01, 0x7E, 0x0B, 0x0B});
+
+    // 2: sum 1..n (i32) -> i32 with a loop, local 1 is the sum
+    // block loop local.get 0 i32.eqz br_if 1 local.get 1 local.get 0 i32.add local.set 1 local.get 0 i32.const 1 i32.sub local.tee 0 drop br 0 end end
+    // local.get 1
+    f.add_function(3uz, 1u, {0x02, 0x40, 0x03, 0x40, 0x20, 0x00, 0x45, 0x0D, 0x01, 0x20, 0x01, 0x20, 0x00, 0x6A, 0x21, 0x01, 0x20, 0x00, 0x41,
+                             0x01, 0x6B, 0x22, 0x00, 0x1A, 0x0C, 0x00, 0x0B, 0x0B, 0x20, 0x01, 0x0B});
+
+    // 3: br_table (i32) -> i32: 0 -> 10, 1 -> 20, otherwise 30, with an extra value on the stack that the branch removes
+    // block block block i32.const 99 local.get 0 br_table 0 1 2 end i32.const 10 return end i32.const 20 return end i32.const 30
+    f.add_function(3uz, 0u, {0x02, 0x40, 0x02, 0x40, 0x02, 0x40, 0x41, 0xE3, 0x00, 0x20, 0x00, 0x0E, 0x02, 0x00, 0x01, 0x02, 0x0B, 0x41, 0x0A, 0x0F,
+                             0x0B, 0x41, 0x14, 0x0F, 0x0B, 0x41, 0x1E, 0x0B});
+
+    // 4: memory (i32) -> i32: store 0x12345678 at the address, load8_s of address + 3 (0x12), load16_u, add both
+    // local.get 0 i32.const 0x12345678 i32.store local.get 0 i32.load8_s offset=3 local.get 0 i32.load16_u offset=0 i32.add
+    f.add_function(3uz, 0u, {0x20, 0x00, 0x41, 0xF8, 0xAC, 0xD1, 0x91, 0x01, 0x36, 0x02, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x03, 0x20, 0x00, 0x2F, 0x01,
+                             0x00, 0x6A, 0x0B});
+
+    // 5: (i32 i32) -> i32: i32.div_s
+    f.add_function(0uz, 0u, {0x20, 0x00, 0x20, 0x01, 0x6D, 0x0B});
+
+    // 6: () -> i32: unreachable, followed by dead code
+    f.add_function(2uz, 0u, {0x00, 0x41, 0x01, 0x6A, 0x0B});
+
+    // 7: (i32) -> i32: call_indirect type 2 of element local 0
+    f.add_function(3uz, 0u, {0x20, 0x00, 0x11, 0x02, 0x00, 0x0B});
+
+    // 8: () -> i32: i32.const 42
+    f.add_function(2uz, 0u, {0x41, 0x2A, 0x0B});
+
+    // 9: (f64 f64) -> f64: f64.min
+    f.add_function(4uz, 0u, {0x20, 0x00, 0x20, 0x01, 0xA4, 0x0B});
+
+    // 10: () -> (): infinite recursion
+    f.add_function(5uz, 0u, {0x10, 0x0A, 0x0B});
+
+    // 11: (i32 i32) -> i32: call the import, add global 0, store the sum to global 0
+    // local.get 0 local.get 1 call 0 global.get 0 i32.add global.set 0 global.get 0
+    f.add_function(0uz, 0u, {0x20, 0x00, 0x20, 0x01, 0x10, 0x00, 0x23, 0x00, 0x6A, 0x24, 0x00, 0x23, 0x00, 0x0B});
+
+    // 12: (i32) -> i32: memory.grow, then block (result i32) with a value left under the result by br_if
+    // local.get 0 memory.grow 0 drop block (result i32) i32.const 7 i32.const 8 i32.const 1 br_if 0 drop end memory.size 0 i32.add
+    f.add_function(3uz, 0u, {0x20, 0x00, 0x40, 0x00, 0x1A, 0x02, 0x7F, 0x41, 0x07, 0x41, 0x08, 0x41, 0x01, 0x0D, 0x00, 0x1A, 0x0B, 0x3F, 0x00, 0x6A,
+                             0x0B});
+
+    // 13: (f64 f64) -> f64 with i32.trunc_f64_s of local 0 converted back: f64.convert_i32_s(i32.trunc_f64_s(local 0))
+    f.add_function(4uz, 0u, {0x20, 0x00, 0xAA, 0xB7, 0x0B});
+
+    // 14: (i32 i32) -> i32: local.set 1 while local 1 is still on the stack, (b - a) * (a + b)
+    // local.get 1 local.get 0 local.get 1 i32.add local.set 1 local.get 0 i32.sub local.get 1 i32.mul
+    f.add_function(0uz, 0u, {0x20, 0x01, 0x20, 0x00, 0x20, 0x01, 0x6A, 0x21, 0x01, 0x20, 0x00, 0x6B, 0x20, 0x01, 0x6C, 0x0B});
+
+    // 15: (i32 i32) -> i32: swap the locals through the stack, (b << 16) | a
+    // local.get 0 local.get 1 local.set 0 local.set 1 local.get 0 i32.const 16 i32.shl local.get 1 i32.or
+    f.add_function(0uz, 0u, {0x20, 0x00, 0x20, 0x01, 0x21, 0x00, 0x21, 0x01, 0x20, 0x00, 0x41, 0x10, 0x74, 0x20, 0x01, 0x72, 0x0B});
+
+    // 16: (i32) -> i32: the add writes local 0 directly, (a + 1) * 2
+    // local.get 0 i32.const 1 i32.add local.tee 0 local.get 0 i32.add
+    f.add_function(3uz, 0u, {0x20, 0x00, 0x41, 0x01, 0x6A, 0x22, 0x00, 0x20, 0x00, 0x6A, 0x0B});
+
+    // 17: (i32) -> i32: count local 1 up to local 0 with a fused compare and branch, then add 1 if it is above 10, 2 otherwise
+    // block loop local.get 1 i32.const 1 i32.add local.tee 1 local.get 0 i32.lt_s br_if 0 end end
+    // local.get 1 i32.const 10 i32.gt_u if (result i32) i32.const 1 else i32.const 2 end local.get 1 i32.add
+    f.add_function(3uz, 1u, {0x02, 0x40, 0x03, 0x40, 0x20, 0x01, 0x41, 0x01, 0x6A, 0x22, 0x01, 0x20, 0x00, 0x48, 0x0D, 0x00, 0x0B, 0x0B,
+                             0x20, 0x01, 0x41, 0x0A, 0x4B, 0x04, 0x7F, 0x41, 0x01, 0x05, 0x41, 0x02, 0x0B, 0x20, 0x01, 0x6A, 0x0B});
+
+    // 18: (i32 i32) -> i32: every result is read only by the next instruction, ((b * (a - b) + 3) through global 0 and memory 8) << 1 / a
+    // local.get 1 local.get 0 local.get 1 i32.sub i32.mul i32.const 3 i32.add global.set 0 i32.const 0 global.get 0 i32.store offset=8
+    // i32.const 8 i32.load i32.const 1 i32.shl local.get 0 i32.div_u
+    f.add_function(0uz, 0u, {0x20, 0x01, 0x20, 0x00, 0x20, 0x01, 0x6B, 0x6C, 0x41, 0x03, 0x6A, 0x24, 0x00, 0x41, 0x00, 0x23, 0x00, 0x36, 0x02, 0x08,
+                             0x41, 0x08, 0x28, 0x02, 0x00, 0x41, 0x01, 0x74, 0x20, 0x00, 0x6E, 0x0B});
+
+    // 19: type 7, the same signature as type 3 in other storage
+    f.add_function(7uz, 0u, {0x20, 0x00, 0x0B});
+
+    if(!::test::uwvm_int::compile_module(f.mod)) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+    // structurally equal types share the id of the first one
+    if(f.mod.functions.index_unchecked(19uz).type_id != 3uz || f.mod.functions.index_unchecked(7uz).type_id != 3uz) [[unlikely]]
+    {
+        ::fast_io::fast_terminate();
+    }
+
+    if(!f.memory.init(1uz, 4uz)) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+    f.table[0] = ::std::addressof(f.mod.functions.index_unchecked(8uz));
+    f.table[1] = ::std::addressof(f.mod.functions.index_unchecked(5uz));
+
+    f.ctx = {.module = ::std::addressof(f.mod),
+             .memory = ::std::addressof(f.memory),
+             .globals = f.globals,
+             .table_begin = f.table,
+             .table_size = 3uz,
+             .stack_begin = f.stack,
+             .stack_end = f.stack + 4096};
+
+    // factorial
+    if(f.call(1uz, {20u}) != trap_t::none || f.stack[0] != 2432902008176640000u) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+    // loop
+    if(f.call(2uz, {100u}) != trap_t::none || f.stack[0] != 5050u) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+    // br_table
+    if(f.call(3uz, {0u}) != trap_t::none || f.stack[0] != 10u) [[unlikely]] { ::fast_io::fast_terminate(); }
+    if(f.call(3uz, {1u}) != trap_t::none || f.stack[0] != 20u) [[unlikely]] { ::fast_io::fast_terminate(); }
+    if(f.call(3uz, {7u}) != trap_t::none || f.stack[0] != 30u) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+    // memory: 0x12 + 0x5678
+    if(f.call(4uz, {16u}) != trap_t::none || f.stack[0] != 0x568Au) [[unlikely]] { ::fast_io::fast_terminate(); }
+    if(f.memory.memory_begin[16] != ::std::byte{0x78u}) [[unlikely]] { ::fast_io::fast_terminate(); }
+    // the last bytes of the page are out of bounds for an i32 store, both with bounds checks and with guard pages
+    if(f.call(4uz, {65534u}) != trap_t::memory_out_of_bounds) [[unlikely]] { ::fast_io::fast_terminate(); }
+    if(f.call(4uz, {0xFFFF'FFF0u}) != trap_t::memory_out_of_bounds) [[unlikely]] { ::fast_io::fast_terminate(); }
+    if(f.call(4uz, {65532u}) != trap_t::none) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+    // div_s
+    if(f.call(5uz, {static_cast<::std::uint_least32_t>(-7), 2u}) != trap_t::none || f.stack[0] != static_cast<::std::uint_least32_t>(-3)) [[unlikely]]
+    {
+        ::fast_io::fast_terminate();
+    }
+    if(f.call(5uz, {1u, 0u}) != trap_t::integer_divide_by_zero) [[unlikely]] { ::fast_io::fast_terminate(); }
+    if(f.call(5uz, {0x8000'0000u, 0xFFFF'FFFFu}) != trap_t::integer_overflow) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+    // unreachable
+    if(f.call(6uz, {}) != trap_t::unreachable) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+    // call_indirect
+    if(f.call(7uz, {0u}) != trap_t::none || f.stack[0] != 42u) [[unlikely]] { ::fast_io::fast_terminate(); }
+    if(f.call(7uz, {1u}) != trap_t::indirect_call_type_mismatch) [[unlikely]] { ::fast_io::fast_terminate(); }
+    if(f.call(7uz, {2u}) != trap_t::uninitialized_element) [[unlikely]] { ::fast_io::fast_terminate(); }
+    if(f.call(7uz, {3u}) != trap_t::undefined_element) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+    // f64.min(-0, +0) is -0
+    if(f.call(9uz, {::std::bit_cast<::std::uint_least64_t>(-0.0), ::std::bit_cast<::std::uint_least64_t>(0.0)}) != trap_t::none ||
+       f.stack[0] != ::std::bit_cast<::std::uint_least64_t>(-0.0)) [[unlikely]]
+    {
+        ::fast_io::fast_terminate();
+    }
+
+    // call stack
+    if(f.call(10uz, {}) != trap_t::call_stack_exhausted || f.ctx.call_depth != 0uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+    // host function and globals
+    if(f.call(11uz, {3u, 4u}) != trap_t::none || f.stack[0] != 7u || f.call(11uz, {3u, 4u}) != trap_t::none || f.stack[0] != 14u) [[unlikely]]
+    {
+        ::fast_io::fast_terminate();
+    }
+
+    // memory.grow, br_if keeps 8 and drops 7: 8 + 3 pages
+    if(f.call(12uz, {2u}) != trap_t::none || f.stack[0] != 11u) [[unlikely]] { ::fast_io::fast_terminate(); }
+    if(f.call(12uz, {5u}) != trap_t::none || f.stack[0] != 11u) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+    // trunc
+    if(f.call(13uz, {::std::bit_cast<::std::uint_least64_t>(-2147483648.9), 0u}) != trap_t::none ||
+       f.stack[0] != ::std::bit_cast<::std::uint_least64_t>(-2147483648.0)) [[unlikely]]
+    {
+        ::fast_io::fast_terminate();
+    }
+    if(f.call(13uz, {::std::bit_cast<::std::uint_least64_t>(2147483648.0), 0u}) != trap_t::integer_overflow) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+    // local.set and local.tee on the register form
+    if(f.call(14uz, {3u, 10u}) != trap_t::none || f.stack[0] != 91u) [[unlikely]] { ::fast_io::fast_terminate(); }
+    if(f.call(15uz, {1u, 2u}) != trap_t::none || f.stack[0] != 0x2'0001u) [[unlikely]] { ::fast_io::fast_terminate(); }
+    if(f.call(16uz, {5u}) != trap_t::none || f.stack[0] != 12u) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+    // local.get emits nothing, the const is fused into the add of function 16 and the add is retargeted to local 0
+    if(f.mod.functions.index_unchecked(16uz).code.size() != 11uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+    // fused compare and br_if, fused compare with an immediate and if
+    if(f.call(17uz, {5u}) != trap_t::none || f.stack[0] != 7u) [[unlikely]] { ::fast_io::fast_terminate(); }
+    if(f.call(17uz, {20u}) != trap_t::none || f.stack[0] != 21u) [[unlikely]] { ::fast_io::fast_terminate(); }
+    if(f.call(17uz, {0u}) != trap_t::none || f.stack[0] != 3u) [[unlikely]] { ::fast_io::fast_terminate(); }
+    if(f.mod.functions.index_unchecked(17uz).code.size() != 27uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+    // results handed over in the accumulator, as the left and the right operand, to a fused immediate, a store and a load
+    if(f.call(18uz, {10u, 3u}) != trap_t::none || f.stack[0] != 4u || f.globals[0] != 24u) [[unlikely]] { ::fast_io::fast_terminate(); }
+    if(f.call(18uz, {1u, 3u}) != trap_t::none || f.stack[0] != 0xFFFF'FFFAu || f.memory.memory_begin[8] != ::std::byte{0xFDu}) [[unlikely]]
+    {
+        ::fast_io::fast_terminate();
+    }
+    if(f.call(18uz, {0u, 3u}) != trap_t::integer_divide_by_zero) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+    // malformed bodies are rejected instead of lowered
+    // local.get 0 / global.get 0 / local.get 0 if (result i32) i32.const 1 else i32.const 2 end
+    if(!::test::compiles({0x20, 0x00, 0x0B}) || !::test::compiles({0x23, 0x00, 0x0B}) ||
+       !::test::compiles({0x20, 0x00, 0x04, 0x7F, 0x41, 0x01, 0x05, 0x41, 0x02, 0x0B, 0x0B})) [[unlikely]]
+    {
+        ::fast_io::fast_terminate();
+    }
+    // drop, i32.add, local.set, global.set and i32.store without enough operands
+    if(::test::compiles({0x1A, 0x20, 0x00, 0x0B}) || ::test::compiles({0x20, 0x00, 0x6A, 0x0B}) || ::test::compiles({0x21, 0x00, 0x20, 0x00, 0x0B}) ||
+       ::test::compiles({0x24, 0x00, 0x20, 0x00, 0x0B}) || ::test::compiles({0x20, 0x00, 0x36, 0x02, 0x00, 0x20, 0x00, 0x0B})) [[unlikely]]
+    {
+        ::fast_io::fast_terminate();
+    }
+    // i32.eqz of a value below the block, br_if without a condition, call 0 without its argument
+    if(::test::compiles({0x20, 0x00, 0x02, 0x40, 0x45, 0x1A, 0x0B, 0x0B}) || ::test::compiles({0x02, 0x40, 0x0D, 0x00, 0x0B, 0x20, 0x00, 0x0B}) ||
+       ::test::compiles({0x10, 0x00, 0x0B})) [[unlikely]]
+    {
+        ::fast_io::fast_terminate();
+    }
+    // return and end without the result
+    if(::test::compiles({0x0F, 0x0B}) || ::test::compiles({0x0B})) [[unlikely]] { ::fast_io::fast_terminate(); }
+    // global.get 1 out of range, else of a block, a second else
+    if(::test::compiles({0x23, 0x01, 0x0B}) || ::test::compiles({0x02, 0x40, 0x05, 0x0B, 0x20, 0x00, 0x0B}) ||
+       ::test::compiles({0x20, 0x00, 0x04, 0x40, 0x05, 0x05, 0x0B, 0x20, 0x00, 0x0B})) [[unlikely]]
+    {
+        ::fast_io::fast_terminate();
+    }
+}
+
+// macro
+#include <uwvm2/utils/macro/pop_macros.h>
@@ -0,0 +1,200 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <initializer_list>
+
+#include <uwvm2/utils/macro/push_macros.h>
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.parser.wasm.standard.wasm1.type;
+import uwvm2.non_img.uwvm_int;
+import uwvm2.non_img.llvm_jit;
+#else
+# include <fast_io.h>
+# include <fast_io_dsal/vector.h>
+# include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
+# include <uwvm2/non-img/int/uwvm-int/impl.h>
+# include <uwvm2/non-img/jit/llvm-jit/impl.h>
+#endif
+
+#ifdef UWVM_USE_LLVM_JIT
+# include <llvm/ADT/SmallString.h>
+# include <llvm/Support/FileSystem.h>
+# include <llvm/Support/Path.h>
+# include <llvm/Support/raw_ostream.h>
+
+namespace test
+{
+    namespace uwvm_int = ::uwvm2::non_img::uwvm_int;
+    namespace llvm_jit = ::uwvm2::non_img::llvm_jit;
+    using value_type = ::uwvm2::parser::wasm::standard::wasm1::type::value_type;
+
+    inline constexpr value_type i32_i32[2]{value_type::i32, value_type::i32};
+    inline constexpr uwvm_int::local_entry_t one_i32[1]{{.count = 1u, .type = value_type::i32}};
+
+    // sum 1..n (i32) -> i32 with a loop, local 1 is the sum
+    inline constexpr ::std::byte sum_body[]{
+        ::std::byte{0x02}, ::std::byte{0x40}, ::std::byte{0x03}, ::std::byte{0x40}, ::std::byte{0x20}, ::std::byte{0x00}, ::std::byte{0x45}, ::std::byte{0x0D},
+        ::std::byte{0x01}, ::std::byte{0x20}, ::std::byte{0x01}, ::std::byte{0x20}, ::std::byte{0x00}, ::std::byte{0x6A}, ::std::byte{0x21}, ::std::byte{0x01},
+        ::std::byte{0x20}, ::std::byte{0x00}, ::std::byte{0x41}, ::std::byte{0x01}, ::std::byte{0x6B}, ::std::byte{0x22}, ::std::byte{0x00}, ::std::byte{0x1A},
+        ::std::byte{0x0C}, ::std::byte{0x00}, ::std::byte{0x0B}, ::std::byte{0x0B}, ::std::byte{0x20}, ::std::byte{0x01}, ::std::byte{0x0B}};
+
+    // (i32) -> i32: call 0 twice, sum(sum(n))
+    inline constexpr ::std::byte twice_body[]{::std::byte{0x20}, ::std::byte{0x00}, ::std::byte{0x10}, ::std::byte{0x00}, ::std::byte{0x10}, ::std::byte{0x00},
+                                              ::std::byte{0x0B}};
+
+    /// @brief  A fresh module for every jit, as a new process would load it
+    struct fixture_t
+    {
+        uwvm_int::module_t mod{};
+        uwvm_int::slot_t stack[4096]{};
+        uwvm_int::context_t ctx{};
+
+        inline fixture_t()
+        {
+            mod.types.push_back({i32_i32, i32_i32 + 1, i32_i32, i32_i32 + 1});
+            mod.functions.push_back(uwvm_int::function_t{
+                .type_index = 0uz,
+                .body = {.expr_begin = sum_body, .code_end = sum_body + sizeof(sum_body), .all_local_count = 1u, .local_begin = one_i32, .local_end = one_i32 + 1}
+            });
+            mod.functions.push_back(uwvm_int::function_t{
+                .type_index = 0uz,
+                .body = {.expr_begin = twice_body, .code_end = twice_body + sizeof(twice_body)}
+            });
+            ctx = {.module = ::std::addressof(mod), .stack_begin = stack, .stack_end = stack + 4096};
+        }
+
+        inline bool call(::std::size_t function_index, uwvm_int::slot_t arg, uwvm_int::slot_t result)
+        {
+            stack[0] = arg;
+            return uwvm_int::invoke(ctx, function_index) == uwvm_int::trap_t::none && stack[0] == result;
+        }
+
+        /// @brief  Compile the whole module with a new jit that uses `cache`
+        inline bool compile(llvm_jit::jit_t& jit, llvm_jit::code_cache_t& cache)
+        {
+            return uwvm_int::compile_module(mod) && jit.init(::std::addressof(cache)) && llvm_jit::compile_module(mod, jit);
+        }
+    };
+
+    inline ::std::size_t count_objects(::std::string const& directory, ::std::string& last)
+    {
+        ::std::size_t count{};
+        ::std::error_code ec{};
+        for(::llvm::sys::fs::directory_iterator it{directory, ec}, end{}; !ec && it != end; it.increment(ec))
+        {
+            if(::llvm::sys::path::extension(it->path()) == ".o")
+            {
+                ++count;
+                last = it->path();
+            }
+        }
+        return count;
+    }
+}  // namespace test
+
+int main()
+{
+    ::llvm::SmallString<128u> directory_path{};
+    if(::llvm::sys::fs::createUniqueDirectory("uwvm-llvm-jit-cache", directory_path)) [[unlikely]] { ::fast_io::fast_terminate(); }
+    ::std::string const directory{directory_path.str()};
+
+    ::test::llvm_jit::code_cache_t cache{directory};
+    if(!cache.init()) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+    ::std::string object_path{};
+
+    // Miss: compiled and stored as one object
+    {
+        ::test::fixture_t f{};
+        ::test::llvm_jit::jit_t jit{};
+        if(!f.compile(jit, cache) || !f.call(1uz, 4u, 55u)) [[unlikely]] { ::fast_io::fast_terminate(); }
+        if(::test::count_objects(directory, object_path) != 1uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+    }
+
+    // Hit: loaded into another jit, the file is not written again
+    {
+        ::llvm::sys::fs::file_status before{};
+        if(::llvm::sys::fs::status(object_path, before)) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        ::test::fixture_t f{};
+        ::test::llvm_jit::jit_t jit{};
+        if(!f.compile(jit, cache) || !f.call(1uz, 4u, 55u) || !f.call(0uz, 100u, 5050u)) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        ::llvm::sys::fs::file_status after{};
+        if(::llvm::sys::fs::status(object_path, after) || after.getUniqueID() != before.getUniqueID() ||
+           ::test::count_objects(directory, object_path) != 1uz) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+    }
+
+    // A corrupted object fails the compilation once and is removed
+    {
+        ::std::error_code ec{};
+        {
+            ::llvm::raw_fd_ostream stream{object_path, ec};
+            stream << "not an object";
+        }
+        if(ec) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        ::test::fixture_t f{};
+        ::test::llvm_jit::jit_t jit{};
+        if(f.compile(jit, cache) || ::llvm::sys::fs::exists(object_path)) [[unlikely]] { ::fast_io::fast_terminate(); }
+        // Still runs in the interpreter
+        if(!f.call(1uz, 4u, 55u)) [[unlikely]] { ::fast_io::fast_terminate(); }
+    }
+
+    // Tiered functions are stored one object each, next to the object of the whole module
+    {
+        ::test::fixture_t f{};
+        ::test::llvm_jit::tiering_t tiering{};
+        if(!tiering.start(f.mod, 1uz, 4u, ::std::addressof(cache)) || !::test::uwvm_int::compile_module(f.mod)) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        auto const is_compiled{[&f](::std::size_t function_index) noexcept
+                               { return ::std::atomic_ref{f.mod.functions.index_unchecked(function_index).native}.load(::std::memory_order_acquire) != nullptr; }};
+        for(unsigned i{}; !is_compiled(1uz) || !is_compiled(0uz); ++i)
+        {
+            if(i == 10000u || !f.call(1uz, 4u, 55u)) [[unlikely]] { ::fast_io::fast_terminate(); }
+            ::std::this_thread::sleep_for(::std::chrono::milliseconds{1});
+        }
+        tiering.stop();
+
+        if(::test::count_objects(directory, object_path) != 2uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+    }
+
+    ::llvm::sys::fs::remove_directories(directory);
+}
+#else
+int main() {}
+#endif
+
+// macro
+#include <uwvm2/utils/macro/pop_macros.h>
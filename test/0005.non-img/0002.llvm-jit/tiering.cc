@@ -0,0 +1,177 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <initializer_list>
+
+#include <uwvm2/utils/macro/push_macros.h>
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.parser.wasm.standard.wasm1.type;
+import uwvm2.memory.linear;
+import uwvm2.non_img.uwvm_int;
+import uwvm2.non_img.llvm_jit;
+#else
+# include <fast_io.h>
+# include <fast_io_dsal/vector.h>
+# include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
+# include <uwvm2/memory/linear/impl.h>
+# include <uwvm2/non-img/int/uwvm-int/impl.h>
+# include <uwvm2/non-img/jit/llvm-jit/impl.h>
+#endif
+
+#ifdef UWVM_USE_LLVM_JIT
+
+namespace test
+{
+    namespace uwvm_int = ::uwvm2::non_img::uwvm_int;
+    namespace llvm_jit = ::uwvm2::non_img::llvm_jit;
+    using value_type = ::uwvm2::parser::wasm::standard::wasm1::type::value_type;
+
+    inline constexpr value_type i32_i32[2]{value_type::i32, value_type::i32};
+    inline constexpr value_type i64_1[1]{value_type::i64};
+    inline constexpr uwvm_int::local_entry_t one_i32[1]{{.count = 1u, .type = value_type::i32}};
+
+    inline void push_bytes(::fast_io::vector<::std::byte>& vec, ::std::initializer_list<unsigned> bytes)
+    {
+        for(auto const i: bytes) { vec.push_back(static_cast<::std::byte>(i)); }
+    }
+
+    inline uwvm_int::trap_t host_add(uwvm_int::slot_t* frame, [[maybe_unused]] void* host_context) noexcept
+    {
+        frame[0] = static_cast<::std::uint_least32_t>(frame[0] + frame[1]);
+        return uwvm_int::trap_t::none;
+    }
+
+    struct fixture_t
+    {
+        ::fast_io::vector<::fast_io::vector<::std::byte>> bodies{};
+        uwvm_int::module_t mod{};
+        uwvm_int::slot_t stack[4096]{};
+        uwvm_int::context_t ctx{};
+
+        inline void add_function(::std::size_t type_index, bool has_local, ::std::initializer_list<unsigned> expr)
+        {
+            ::fast_io::vector<::std::byte> body{};
+            push_bytes(body, expr);
+            bodies.push_back(::std::move(body));
+            auto const& b{bodies.back_unchecked()};
+            mod.functions.push_back(uwvm_int::function_t{.type_index = type_index,
+                                                         .body = {.expr_begin = b.cbegin(),
+                                                                  .code_end = b.cend(),
+                                                                  .all_local_count = has_local ? 1u : 0u,
+                                                                  .local_begin = one_i32,
+                                                                  .local_end = one_i32 + (has_local ? 1 : 0)}});
+        }
+
+        inline bool call(::std::size_t function_index, ::std::initializer_list<uwvm_int::slot_t> args, uwvm_int::slot_t result)
+        {
+            ::std::size_t i{};
+            for(auto const a: args) { stack[i++] = a; }
+            return uwvm_int::invoke(ctx, function_index) == uwvm_int::trap_t::none && stack[0] == result;
+        }
+
+        /// @brief  Keep calling until the workers installed the native code
+        inline bool call_until_compiled(::std::size_t function_index, ::std::initializer_list<uwvm_int::slot_t> args, uwvm_int::slot_t result)
+        {
+            auto const& func{mod.functions.index_unchecked(function_index)};
+            for(unsigned i{}; i != 10000u; ++i)
+            {
+                if(!call(function_index, args, result)) [[unlikely]] { return false; }
+                if(::std::atomic_ref{func.native}.load(::std::memory_order_acquire) != nullptr) { return call(function_index, args, result); }
+                ::std::this_thread::sleep_for(::std::chrono::milliseconds{1});
+            }
+            return false;
+        }
+    };
+}  // namespace test
+
+int main()
+{
+    ::test::fixture_t f{};
+
+    // 0: (i32 i32) -> i32, 1: (i64) -> i64, 2: (i32) -> i32
+    f.mod.types.push_back({::test::i32_i32, ::test::i32_i32 + 2, ::test::i32_i32, ::test::i32_i32 + 1});
+    f.mod.types.push_back({::test::i64_1, ::test::i64_1 + 1, ::test::i64_1, ::test::i64_1 + 1});
+    f.mod.types.push_back({::test::i32_i32, ::test::i32_i32 + 1, ::test::i32_i32, ::test::i32_i32 + 1});
+
+    // 0: imported add
+    f.mod.functions.push_back({.type_index = 0uz, .host = {.call = ::test::host_add}});
+
+    // 1: factorial (i64) -> i64, recursive
+    f.add_function(1uz, false, {0x20, 0x00, 0x50, 0x04, 0x7E, 0x42, 0x01, 0x05, 0x20, 0x00, 0x20, 0x00, 0x42, 0x01, 0x7D, 0x10, 0x01, 0x7E, 0x0B, 0x0B});
+
+    // 2: sum 1..n (i32) -> i32 with a loop, hot after one call through its loop counter
+    f.add_function(2uz, true, {0x02, 0x40, 0x03, 0x40, 0x20, 0x00, 0x45, 0x0D, 0x01, 0x20, 0x01, 0x20, 0x00, 0x6A, 0x21, 0x01, 0x20, 0x00, 0x41,
+                               0x01, 0x6B, 0x22, 0x00, 0x1A, 0x0C, 0x00, 0x0B, 0x0B, 0x20, 0x01, 0x0B});
+
+    // 3: (i32 i32) -> i32: sum 1..(a + b) through the import and function 2, without a loop: hot by its calls
+    f.add_function(0uz, false, {0x20, 0x00, 0x20, 0x01, 0x10, 0x00, 0x10, 0x02, 0x0B});
+
+    // 4: (i32) -> i32: local.get 0, one i32 local without its entry: the interpreter does not read the local types, the jit rejects it
+    f.add_function(2uz, false, {0x20, 0x00, 0x0B});
+    f.mod.functions.back_unchecked().body.all_local_count = 1u;
+
+    {
+        ::test::llvm_jit::tiering_t tiering{};
+        // Before compile_module, so the loops are counted
+        if(!tiering.start(f.mod, 2uz, 16u)) [[unlikely]] { ::fast_io::fast_terminate(); }
+        if(!::test::uwvm_int::compile_module(f.mod)) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        f.ctx = {.module = ::std::addressof(f.mod), .stack_begin = f.stack, .stack_end = f.stack + 4096};
+
+        // Cold functions stay in the interpreter
+        if(!f.call(3uz, {1u, 2u}, 6u) || f.mod.functions.index_unchecked(3uz).native != nullptr) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        if(!f.call_until_compiled(2uz, {100u}, 5050u)) [[unlikely]] { ::fast_io::fast_terminate(); }
+        if(!f.call_until_compiled(3uz, {40u, 60u}, 5050u)) [[unlikely]] { ::fast_io::fast_terminate(); }
+        if(!f.call_until_compiled(1uz, {20u}, 2432902008176640000u)) [[unlikely]] { ::fast_io::fast_terminate(); }
+        if(f.ctx.call_depth != 0uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        // A function that fails to compile is not left queued, it keeps running in the interpreter
+        bool failed{};
+        for(unsigned i{}; i != 10000u && !failed; ++i)
+        {
+            if(!f.call(4uz, {7u}, 7u)) [[unlikely]] { ::fast_io::fast_terminate(); }
+            failed = tiering.get_state(4uz) == ::test::llvm_jit::tiering_t::state_t::failed;
+            if(!failed) { ::std::this_thread::sleep_for(::std::chrono::milliseconds{1}); }
+        }
+        if(!failed || f.mod.functions.index_unchecked(4uz).native != nullptr || !f.call(4uz, {7u}, 7u)) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        tiering.stop();
+        if(f.mod.functions.index_unchecked(2uz).native != nullptr || f.mod.tier_up.request != nullptr) [[unlikely]] { ::fast_io::fast_terminate(); }
+    }
+
+    // Back in the interpreter after the jit is gone
+    if(!f.call(3uz, {40u, 60u}, 5050u)) [[unlikely]] { ::fast_io::fast_terminate(); }
+}
+#else
+int main() {}
+#endif
+
+// macro
+#include <uwvm2/utils/macro/pop_macros.h>
@@ -0,0 +1,175 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2025-07-19
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <type_traits>
+#include <memory>
+#include <initializer_list>
+
+#include <uwvm2/utils/macro/push_macros.h>
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.uwvm.wasm.loader;
+#else
+# include <fast_io.h>
+# include <fast_io_dsal/vector.h>
+# include <uwvm2/uwvm/wasm/loader/file_advice.h>
+#endif
+
+namespace test
+{
+    struct range_t
+    {
+        ::std::size_t begin;
+        ::std::size_t end;
+    };
+
+    inline void push_bytes(::fast_io::vector<::std::byte>& vec, ::std::initializer_list<unsigned> bytes)
+    {
+        for(auto const i: bytes) { vec.push_back(static_cast<::std::byte>(i)); }
+    }
+
+    /// @brief Section with a two byte length (0x80 | len, len >> 7) and len bytes of content
+    inline void push_section(::fast_io::vector<::std::byte>& vec, unsigned id, unsigned len, ::std::initializer_list<unsigned> prefix = {})
+    {
+        push_bytes(vec, {id, 0x80u | (len & 0x7Fu), len >> 7u});
+        push_bytes(vec, prefix);
+        for(auto i{prefix.size()}; i < len; ++i) { vec.push_back(::std::byte{}); }
+    }
+
+    /// @brief Offsets of the sections walked by for_each_binfmt_ver1_prefetch_section, or nothing if it returned false
+    inline ::fast_io::vector<range_t> walk(::fast_io::vector<::std::byte> const& file, bool& is_ver1)
+    {
+        ::fast_io::vector<range_t> ranges{};
+        auto const file_begin{file.cbegin()};
+        is_ver1 = ::uwvm2::uwvm::wasm::loader::details::for_each_binfmt_ver1_prefetch_section(
+            file_begin,
+            file.cend(),
+            [&ranges, file_begin](::std::byte const* sec_begin, ::std::byte const* sec_end) noexcept
+            { ranges.push_back({static_cast<::std::size_t>(sec_begin - file_begin), static_cast<::std::size_t>(sec_end - file_begin)}); });
+        return ranges;
+    }
+
+    inline bool same_ranges(::fast_io::vector<range_t> const& ranges, ::std::initializer_list<range_t> expected)
+    {
+        if(ranges.size() != expected.size()) { return false; }
+        auto curr{ranges.cbegin()};
+        for(auto const& i: expected)
+        {
+            if(curr->begin != i.begin || curr->end != i.end) { return false; }
+            ++curr;
+        }
+        return true;
+    }
+}  // namespace test
+
+int main()
+{
+    ::fast_io::vector<::std::byte> file{};
+    ::test::push_bytes(file, {0x00u, 0x61u, 0x73u, 0x6Du, 0x01u, 0x00u, 0x00u, 0x00u});
+    // type section [11, 21)
+    ::test::push_section(file, 1u, 10u);
+    // custom section "producers" [24, 224), skipped
+    ::test::push_section(file, 0u, 200u, {0x09u, 0x70u, 0x72u, 0x6Fu, 0x64u, 0x75u, 0x63u, 0x65u, 0x72u, 0x73u});
+    // empty start section, skipped
+    ::test::push_section(file, 8u, 0u);
+    // code section [230, 330)
+    ::test::push_section(file, 10u, 100u);
+    // custom section "name" [333, 353)
+    ::test::push_section(file, 0u, 20u, {0x04u, 0x6Eu, 0x61u, 0x6Du, 0x65u});
+    // custom section "nam" [356, 376), skipped
+    ::test::push_section(file, 0u, 20u, {0x03u, 0x6Eu, 0x61u, 0x6Du});
+
+    // The sections are walked in file order
+    {
+        bool is_ver1{};
+        auto const ranges{::test::walk(file, is_ver1)};
+        if(!is_ver1 || !::test::same_ranges(ranges, {{11uz, 21uz}, {230uz, 330uz}, {333uz, 353uz}})) [[unlikely]] { ::fast_io::fast_terminate(); }
+    }
+
+    // A truncated section stops the walk, the sections before it are still prefetched
+    {
+        auto truncated{file};
+        ::test::push_section(truncated, 11u, 50u);
+        truncated.resize(truncated.size() - 1uz);
+
+        bool is_ver1{};
+        auto const ranges{::test::walk(truncated, is_ver1)};
+        if(!is_ver1 || !::test::same_ranges(ranges, {{11uz, 21uz}, {230uz, 330uz}, {333uz, 353uz}})) [[unlikely]] { ::fast_io::fast_terminate(); }
+    }
+
+    // A malformed section length stops the walk
+    {
+        auto malformed{file};
+        ::test::push_bytes(malformed, {11u, 0x80u, 0x80u, 0x80u, 0x80u, 0x80u, 0x00u});
+        ::test::push_section(malformed, 1u, 10u);
+
+        bool is_ver1{};
+        auto const ranges{::test::walk(malformed, is_ver1)};
+        if(!is_ver1 || ranges.size() != 3uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+    }
+
+    // Other binfmt versions and files shorter than the header are not walked
+    {
+        auto ver2{file};
+        ver2.index_unchecked(4uz) = ::std::byte{0x02u};
+
+        bool is_ver1{true};
+        auto const ranges{::test::walk(ver2, is_ver1)};
+        if(is_ver1 || !ranges.empty()) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        auto header_only{file};
+        header_only.resize(7uz);
+        is_ver1 = true;
+        if(::test::walk(header_only, is_ver1).size() != 0uz || is_ver1) [[unlikely]] { ::fast_io::fast_terminate(); }
+    }
+
+    // The advised ranges are aligned down, but never below the mapping
+    {
+        using ::uwvm2::uwvm::wasm::loader::details::align_advice_begin;
+        using ::uwvm2::uwvm::wasm::loader::details::file_advice_alignment;
+
+        ::fast_io::vector<::std::byte> buffer{};
+        buffer.resize(file_advice_alignment * 3uz);
+        auto const buffer_begin{buffer.cbegin()};
+
+        // First aligned address in the buffer
+        auto const buffer_begin_uptr{reinterpret_cast<::std::uintptr_t>(buffer_begin)};
+        auto const aligned{buffer_begin + ((file_advice_alignment - buffer_begin_uptr % file_advice_alignment) % file_advice_alignment)};
+
+        if(align_advice_begin(buffer_begin, aligned) != aligned || align_advice_begin(buffer_begin, aligned + 1uz) != aligned ||
+           align_advice_begin(buffer_begin, aligned + (file_advice_alignment - 1uz)) != aligned ||
+           align_advice_begin(buffer_begin, aligned + file_advice_alignment) != aligned + file_advice_alignment) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+
+        // The mapping begins after the aligned address
+        if(align_advice_begin(aligned + 16uz, aligned + 100uz) != aligned + 16uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        // The advice itself is only a hint, it must not fail on any range
+        ::uwvm2::uwvm::wasm::loader::details::advise_binfmt_ver1_sections(file.cbegin(), file.cend());
+    }
+}
@@ -0,0 +1,147 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2025-07-19
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <type_traits>
+#include <memory>
+#include <initializer_list>
+
+#include <uwvm2/utils/macro/push_macros.h>
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.parser.wasm.concepts;
+import uwvm2.parser.wasm.standard;
+import uwvm2.uwvm.wasm.type;
+import uwvm2.uwvm.wasm.storage;
+import uwvm2.uwvm.wasm.loader;
+#else
+# include <fast_io.h>
+# include <fast_io_device.h>
+# include <fast_io_dsal/vector.h>
+# include <fast_io_dsal/string.h>
+# include <uwvm2/parser/wasm/concepts/impl.h>
+# include <uwvm2/parser/wasm/standard/impl.h>
+# include <uwvm2/uwvm/wasm/type/impl.h>
+# include <uwvm2/uwvm/wasm/storage/impl.h>
+# include <uwvm2/uwvm/wasm/loader/impl.h>
+#endif
+
+namespace test
+{
+    // (module)
+    inline constexpr char8_t empty_module[]{u8'\0', u8'a', u8's', u8'm', u8'\x01', u8'\0', u8'\0', u8'\0'};
+
+    inline ::fast_io::u8cstring_view as_cstring_view(::fast_io::u8string const& str) noexcept
+    {
+        return ::fast_io::u8cstring_view{::fast_io::containers::null_terminated, str.c_str(), str.size()};
+    }
+
+    inline void write_file(::fast_io::u8cstring_view file_name, bool valid)
+    {
+        ::fast_io::u8obuf_file file{file_name};
+        if(valid) { ::fast_io::io::print(file, ::fast_io::mnp::strvw(empty_module, empty_module + sizeof(empty_module))); }
+        else { ::fast_io::io::print(file, u8"not a wasm file"); }
+    }
+
+    inline void queue_file(::fast_io::u8cstring_view file_name)
+    {
+        ::uwvm2::uwvm::wasm::storage::preloaded_wasm_queue.push_back({file_name, {}, ::uwvm2::uwvm::wasm::storage::wasm_parameter});
+    }
+
+    inline void reset()
+    {
+        ::uwvm2::uwvm::wasm::storage::preloaded_wasm_queue.clear();
+        ::uwvm2::uwvm::wasm::storage::preloaded_wasm.clear();
+    }
+}  // namespace test
+
+int main()
+{
+    using ::uwvm2::uwvm::wasm::loader::load_wasm_file_rtl;
+    using ::uwvm2::uwvm::wasm::loader::details::preload_worker_count;
+
+    // The hardware threads are divided between the files and the code section threads of each file
+    static_assert(preload_worker_count(8uz, 100uz, 0uz) == 8uz);
+    static_assert(preload_worker_count(8uz, 100uz, 1uz) == 8uz);
+    static_assert(preload_worker_count(8uz, 3uz, 0uz) == 3uz);
+    static_assert(preload_worker_count(8uz, 100uz, 4uz) == 2uz);
+    static_assert(preload_worker_count(8uz, 100uz, 16uz) == 0uz);
+    static_assert(preload_worker_count(0uz, 100uz, 0uz) == 0uz);
+
+    constexpr ::std::size_t file_count{32uz};
+
+    ::fast_io::vector<::fast_io::u8string> file_names{};
+    for(::std::size_t i{}; i != file_count + 1uz; ++i)
+    {
+        file_names.push_back(::fast_io::u8concat_fast_io(u8"preload_test_", i, u8".wasm"));
+        ::test::write_file(::test::as_cstring_view(file_names.back_unchecked()), i != file_count);
+    }
+
+    // All files are prepared concurrently and loaded in command line order, also with the code section parallel parsing enabled
+    for(::std::size_t const parse_threads: {0uz, 2uz, 1024uz})
+    {
+        ::test::reset();
+        ::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<::uwvm2::parser::wasm::standard::wasm1::features::wasm1_feature_parameter_t>(
+            ::uwvm2::uwvm::wasm::storage::wasm_parameter.binfmt1_para.parameters)
+            .code_section_parse_threads = parse_threads;
+
+        for(::std::size_t i{}; i != file_count; ++i) { ::test::queue_file(::test::as_cstring_view(file_names.index_unchecked(i))); }
+
+        if(::uwvm2::uwvm::wasm::loader::load_preloaded_wasm_files() != load_wasm_file_rtl::ok) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        auto const& preloaded_wasm{::uwvm2::uwvm::wasm::storage::preloaded_wasm};
+        if(preloaded_wasm.size() != file_count) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        for(::std::size_t i{}; i != file_count; ++i)
+        {
+            auto const& wf{preloaded_wasm.index_unchecked(i)};
+            // Without a name section, the module name is the file path
+            if(wf.binfmt_ver != 1u || wf.module_name != ::test::as_cstring_view(file_names.index_unchecked(i))) [[unlikely]] { ::fast_io::fast_terminate(); }
+        }
+    }
+
+#ifdef __cpp_exceptions
+    // The first failure in command line order is reported: a file that cannot be opened ...
+    {
+        ::test::reset();
+        ::test::queue_file(::test::as_cstring_view(file_names.index_unchecked(0uz)));
+        ::test::queue_file(u8"preload_test_missing.wasm");
+        ::test::queue_file(::test::as_cstring_view(file_names.index_unchecked(file_count)));
+
+        if(::uwvm2::uwvm::wasm::loader::load_preloaded_wasm_files() != load_wasm_file_rtl::load_error) [[unlikely]] { ::fast_io::fast_terminate(); }
+    }
+#endif
+
+    // ... or a file that is not a wasm module
+    {
+        ::test::reset();
+        ::test::queue_file(::test::as_cstring_view(file_names.index_unchecked(file_count)));
+        ::test::queue_file(::test::as_cstring_view(file_names.index_unchecked(0uz)));
+
+        if(::uwvm2::uwvm::wasm::loader::load_preloaded_wasm_files() != load_wasm_file_rtl::wasm_parser_error) [[unlikely]] { ::fast_io::fast_terminate(); }
+    }
+
+    ::test::reset();
+}
@@ -0,0 +1,158 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2025-07-19
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <type_traits>
+#include <memory>
+#include <initializer_list>
+
+#include <uwvm2/utils/macro/push_macros.h>
+
+#ifdef UWVM_MODULE
+import fast_io;
+import uwvm2.uwvm.wasm.type;
+import uwvm2.uwvm.wasm.storage;
+import uwvm2.uwvm.wasm.loader;
+import uwvm2.uwvm.run;
+#else
+# include <fast_io.h>
+# include <fast_io_device.h>
+# include <fast_io_dsal/vector.h>
+# include <uwvm2/uwvm/wasm/type/impl.h>
+# include <uwvm2/uwvm/wasm/storage/impl.h>
+# include <uwvm2/uwvm/wasm/loader/impl.h>
+# include <uwvm2/uwvm/run/impl.h>
+#endif
+
+namespace test
+{
+    inline void push_bytes(::fast_io::vector<char8_t>& vec, ::std::initializer_list<unsigned> bytes)
+    {
+        for(auto const i: bytes) { vec.push_back(static_cast<char8_t>(i)); }
+    }
+
+    inline void push_section(::fast_io::vector<char8_t>& vec, unsigned id, ::std::initializer_list<unsigned> content)
+    {
+        push_bytes(vec, {id, static_cast<unsigned>(content.size())});
+        push_bytes(vec, content);
+    }
+
+    /// @brief (module [import section] (func) [(memory 1)] [export section]), written to file_name
+    inline void write_module(::fast_io::u8cstring_view file_name,
+                             ::std::initializer_list<unsigned> importsec,
+                             bool define_memory,
+                             ::std::initializer_list<unsigned> exportsec)
+    {
+        ::fast_io::vector<char8_t> mod{};
+        push_bytes(mod, {0x00u, 0x61u, 0x73u, 0x6Du, 0x01u, 0x00u, 0x00u, 0x00u});
+        push_section(mod, 1u, {0x01u, 0x60u, 0x00u, 0x00u});
+        if(importsec.size() != 0uz) { push_section(mod, 2u, importsec); }
+        push_section(mod, 3u, {0x01u, 0x00u});
+        if(define_memory) { push_section(mod, 5u, {0x01u, 0x00u, 0x01u}); }
+        if(exportsec.size() != 0uz) { push_section(mod, 7u, exportsec); }
+        push_section(mod, 10u, {0x01u, 0x02u, 0x00u, 0x0Bu});
+
+        ::fast_io::u8obuf_file file{file_name};
+        ::fast_io::io::print(file, ::fast_io::mnp::strvw(mod.cbegin(), mod.cend()));
+    }
+
+    inline void load(::uwvm2::uwvm::wasm::type::wasm_file_t& wf, ::fast_io::u8cstring_view file_name, ::fast_io::u8string_view module_name)
+    {
+        if(::uwvm2::uwvm::wasm::loader::load_wasm_file(wf, file_name, module_name, ::uwvm2::uwvm::wasm::storage::wasm_parameter) !=
+           ::uwvm2::uwvm::wasm::loader::load_wasm_file_rtl::ok) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+
+        ::uwvm2::uwvm::wasm::storage::all_module.emplace(wf.module_name,
+                                                          ::uwvm2::uwvm::wasm::storage::all_module_t{
+                                                              .module_storage_ptr = {.wf = ::std::addressof(wf)},
+                                                              .type = ::uwvm2::uwvm::wasm::storage::module_type_t::preloaded_wasm});
+    }
+
+    inline bool is_export_link(::uwvm2::uwvm::wasm::storage::import_link_t const& link, ::fast_io::u8string_view module_name, ::fast_io::u8string_view name)
+    {
+        auto const& all_module{::uwvm2::uwvm::wasm::storage::all_module};
+        return link.type == ::uwvm2::uwvm::wasm::storage::import_link_type_t::wasm_export && link.module == ::std::addressof(all_module.at(module_name)) &&
+               link.target.wasm_export->export_name == name;
+    }
+}  // namespace test
+
+int main()
+{
+    // env: (export "f" (func 0)) (export "mem" (memory 0))
+    ::test::write_module(u8"link_test_env.wasm", {}, true, {0x02u, 0x01u, 0x66u, 0x00u, 0x00u, 0x03u, 0x6Du, 0x65u, 0x6Du, 0x02u, 0x00u});
+    // app: (import "env" "mem" (memory 1)) (import "env" "f" (func)) (import "host" "g" (func)), host is not loaded
+    ::test::write_module(u8"link_test_app.wasm",
+                         {0x03u, 0x03u, 0x65u, 0x6Eu, 0x76u, 0x03u, 0x6Du, 0x65u, 0x6Du, 0x02u, 0x00u, 0x01u, 0x03u, 0x65u, 0x6Eu,
+                          0x76u, 0x01u, 0x66u, 0x00u, 0x00u, 0x04u, 0x68u, 0x6Fu, 0x73u, 0x74u, 0x01u, 0x67u, 0x00u, 0x00u},
+                         false,
+                         {});
+    // missing: (import "env" "g" (func)), env does not export g
+    ::test::write_module(u8"link_test_missing.wasm", {0x01u, 0x03u, 0x65u, 0x6Eu, 0x76u, 0x01u, 0x67u, 0x00u, 0x00u}, false, {});
+    // kind: (import "env" "mem" (func)), env exports mem as a memory
+    ::test::write_module(u8"link_test_kind.wasm", {0x01u, 0x03u, 0x65u, 0x6Eu, 0x76u, 0x03u, 0x6Du, 0x65u, 0x6Du, 0x00u, 0x00u}, false, {});
+
+    ::uwvm2::uwvm::wasm::type::wasm_file_t env{};
+    ::uwvm2::uwvm::wasm::type::wasm_file_t app{};
+    ::uwvm2::uwvm::wasm::type::wasm_file_t missing{};
+    ::uwvm2::uwvm::wasm::type::wasm_file_t kind{};
+
+    auto& all_module{::uwvm2::uwvm::wasm::storage::all_module};
+    auto const& import_links{::uwvm2::uwvm::wasm::storage::import_links};
+
+    // Imports of loaded modules are bound to their exports, imports of modules that are not loaded stay unresolved
+    {
+        ::test::load(env, u8"link_test_env.wasm", u8"env");
+        ::test::load(app, u8"link_test_app.wasm", u8"app");
+
+        if(::uwvm2::uwvm::run::link_modules() != static_cast<int>(::uwvm2::uwvm::run::retval::ok)) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+        auto const app_links{import_links.cbegin() + all_module.at(u8"app").import_link_begin};
+        if(import_links.size() != 3uz || !::test::is_export_link(app_links[0], u8"env", u8"mem") || !::test::is_export_link(app_links[1], u8"env", u8"f") ||
+           app_links[2].type != ::uwvm2::uwvm::wasm::storage::import_link_type_t::unresolved || app_links[2].module != nullptr) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+    }
+
+    // An import of a loaded module that does not export the name, or not with the same kind, is reported
+    {
+        ::test::load(missing, u8"link_test_missing.wasm", u8"missing");
+        if(::uwvm2::uwvm::run::link_modules() != static_cast<int>(::uwvm2::uwvm::run::retval::unresolved_import)) [[unlikely]] { ::fast_io::fast_terminate(); }
+        all_module.erase(u8"missing");
+
+        ::test::load(kind, u8"link_test_kind.wasm", u8"kind");
+        if(::uwvm2::uwvm::run::link_modules() != static_cast<int>(::uwvm2::uwvm::run::retval::unresolved_import)) [[unlikely]] { ::fast_io::fast_terminate(); }
+        all_module.erase(u8"kind");
+
+        // Linking again without them succeeds
+        if(::uwvm2::uwvm::run::link_modules() != static_cast<int>(::uwvm2::uwvm::run::retval::ok) || import_links.size() != 3uz) [[unlikely]]
+        {
+            ::fast_io::fast_terminate();
+        }
+    }
+
+    all_module.clear();
+}
@@ -62,6 +62,11 @@ function def_build()
 		add_defines("UWVM_USE_UWVM_INT")
 	end
 
+    local uwvm_int_profile = get_config("uwvm-int-profile")
+	if uwvm_int_profile then
+		add_defines("UWVM_INT_PROFILE")
+	end
+
     local enable_jit = get_config("enable-jit")
 	if not enable_jit or enable_jit == "none" then
 		add_defines("UWVM_DISABLE_JIT")
@@ -69,6 +74,10 @@ function def_build()
 		add_defines("UWVM_USE_DEFAULT_JIT")
 	elseif enable_jit == "llvm" then
 		add_defines("UWVM_USE_LLVM_JIT")
+		-- LLVM found by llvm-config in PATH, linked as the shared libLLVM
+		add_sysincludedirs("$(shell llvm-config --includedir)")
+		add_linkdirs("$(shell llvm-config --libdir)")
+		add_links("LLVM")
 	end
 
     local detailed_debug_check = get_config("detailed-debug-check")
@@ -224,6 +233,12 @@ target("uwvm")
 		-- wasm parser
 		add_files("src/uwvm2/parser/**.cppm", {public = is_debug_mode})
 
+		-- memory
+		add_files("src/uwvm2/memory/**.cppm", {public = is_debug_mode})
+
+		-- non-image compilers
+		add_files("src/uwvm2/non-img/**.cppm", {public = is_debug_mode})
+
 		-- uwvm
 		add_files("src/uwvm2/uwvm/**.cppm", {public = is_debug_mode})
 	end 
@@ -269,6 +284,12 @@ for _, file in ipairs(os.files("test/**.cc")) do
 			-- wasm parser
 			add_files("src/uwvm2/parser/**.cppm", {public = is_debug_mode})
 
+			-- memory
+			add_files("src/uwvm2/memory/**.cppm", {public = is_debug_mode})
+
+			-- non-image compilers
+			add_files("src/uwvm2/non-img/**.cppm", {public = is_debug_mode})
+
 			-- uwvm
 			add_files("src/uwvm2/uwvm/**.cppm", {public = is_debug_mode})
 		end 
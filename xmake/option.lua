@@ -147,6 +147,15 @@ option("enable-int", function()
     set_values("none", "default", "uwvm-int")
 end)
 
+option("uwvm-int-profile", function()
+    set_description
+    (
+        "Count adjacent opcodes while uwvm-int lowers functions, the counts are printed by dump_fusion_profile to regenerate the fusion table",
+        "default = false"
+    )
+    set_default(false)
+end)
+
 option("enable-jit", function()
     set_description
     (